@@ -2,6 +2,20 @@
 #include "ble_manager.h"
 #include "can_manager.h"
 #include "usb_manager.h"  // 添加USB管理器头文件包含
+#include "diag_manager.h"
+#include "var_set_pipeline.h"
+#include "dbc_decoder.h"
+#include "config_store.h"
+#include "var_poller.h"
+
+// CAN任务: 接收、变量轮询和USB按钮帧发送。收到帧和按钮入队时立即唤醒，
+// 不经过主循环 (delay(10)、串口输出)
+static void canTask(void*) {
+  for (;;) {
+    uint32_t waitMs = canManager.service();
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+  }
+}
 
 void setup() {
   Serial.begin(115200);
@@ -9,6 +23,10 @@ void setup() {
 
   Serial.println("ESP32S3 Car Dashboard Starting...");
 
+  // 读入NVS中的运行时配置，之后各模块按配置初始化
+  configStore.begin();
+  varPoller.begin();
+
   // 初始化BLE管理器
   if (!bleManager.init()) {
     Serial.println("Failed to initialize BLE Manager");
@@ -16,23 +34,40 @@ void setup() {
       ;
   }
 
-  // 初始化CAN管理器
+  // 初始化CAN管理器; 失败时不停机，BLE仍可用，可以通过配置特征修正或恢复默认
   if (!canManager.init()) {
-    Serial.println("Failed to initialize CAN Manager");
-    while (1)
-      ;
+    Serial.println("Failed to initialize CAN Manager, CAN transmit disabled");
+  }
+
+#if DBC_DECODER_ENABLED
+  // 编译ECU广播信号表
+  if (!dbcDecoder.init()) {
+    Serial.println("No broadcast signals, all variables will be polled");
   }
+#endif
+
+  // CAN任务在接收用到的模块 (DBC解码表) 初始化之后启动
+  canManager.setPollHandler([] {
+    bleManager.updatePolling();
+  });
+  TaskHandle_t canTaskHandle;
+  if (xTaskCreatePinnedToCore(canTask, "can", CAN_TASK_STACK_SIZE, nullptr, CAN_TASK_PRIORITY, &canTaskHandle,
+                              CAN_TASK_CORE) == pdPASS) {
+    canManager.setTask(canTaskHandle);
+  } else {
+    Serial.println("Failed to start CAN task");
+  }
+
+  // 设置USB到CAN的回调; 在启动USB任务之前，最早的报告也能发出
+  usbManager.setCANSendCallback([](uint16_t buttonMask, uint32_t reportMicros) {
+    return canManager.queueButtonFrame(buttonMask, reportMicros);
+  });
 
   // 初始化USB管理器
   if (!usbManager.begin()) {  // 现在usbManager已正确定义
     Serial.println("Failed to initialize USB Manager");
   }
 
-  // 设置USB到CAN的回调
-  usbManager.setCANSendCallback([](uint8_t modifier, uint8_t firstKey, uint8_t secondKey) {
-    canManager.sendCommand(modifier, firstKey, secondKey);
-  });
-
   Serial.println("All managers initialized successfully");
 }
 
@@ -40,11 +75,11 @@ void loop() {
   // 更新BLE管理器
   bleManager.update();
 
-  // 处理CAN接收
-  canManager.processRx();
+  // 发送合并后的变量设置
+  varSetPipeline.process();
 
-  // 处理USB任务
-  usbManager.task();  // 现在usbManager已正确定义
+  // 串口诊断命令
+  diagManager.pollSerial();
 
   delay(10);
 }
\ No newline at end of file
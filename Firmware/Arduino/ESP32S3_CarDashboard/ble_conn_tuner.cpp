@@ -0,0 +1,196 @@
+#include "ble_conn_tuner.h"
+#include <esp_gap_ble_api.h>
+
+// 全局BLE连接参数协商实例
+BleConnTuner bleConnTuner;
+
+void BleConnTuner::begin() {
+  BLEDevice::setCustomGapHandler(gapHandler);
+}
+
+BleLink* BleConnTuner::linkFor(uint16_t connId) {
+  for (BleLink& link : links) {
+    if (link.used && link.connId == connId) return &link;
+  }
+  return nullptr;
+}
+
+const BleLink* BleConnTuner::linkFor(uint16_t connId) const {
+  for (const BleLink& link : links) {
+    if (link.used && link.connId == connId) return &link;
+  }
+  return nullptr;
+}
+
+BleLink* BleConnTuner::linkFor(const uint8_t* address) {
+  for (BleLink& link : links) {
+    if (link.used && memcmp(link.address, address, sizeof(esp_bd_addr_t)) == 0) return &link;
+  }
+  return nullptr;
+}
+
+void BleConnTuner::onConnect(BLEServer* server, esp_ble_gatts_cb_param_t* param) {
+  BleLink* link = nullptr;
+  for (BleLink& candidate : links) {
+    if (!candidate.used) {
+      link = &candidate;
+      break;
+    }
+  }
+  if (link == nullptr) return;
+
+  link->used = true;
+  link->connId = param->connect.conn_id;
+  memcpy(link->address, param->connect.remote_bda, sizeof(esp_bd_addr_t));
+  link->params.interval = param->connect.conn_params.interval;
+  link->params.latency = param->connect.conn_params.latency;
+  link->params.timeout = param->connect.conn_params.timeout;
+  link->params.mtu = 23;
+  link->params.txOctets = 27;
+  link->params.rxOctets = 27;
+  link->params.txPhy = 1;
+  link->params.rxPhy = 1;
+  link->updateCount = 0;
+
+  logMessage("BLE Tuner: Connection " + String(link->connId) + " interval " +
+             String(link->params.interval * 1.25f) + "ms, latency " + String(link->params.latency));
+
+  // 以下请求均为异步，结果在GAP事件中记录; 对方不支持时保持原参数
+  server->updateConnParams(param->connect.remote_bda, BLE_CONN_INTERVAL_MIN, BLE_CONN_INTERVAL_MAX,
+                           BLE_CONN_LATENCY, BLE_CONN_TIMEOUT);
+  dataLengthLink = link;
+  esp_ble_gap_set_pkt_data_len(param->connect.remote_bda, BLE_DATA_LENGTH);
+
+#if BLE_PREFER_2M_PHY && defined(CONFIG_BT_BLE_50_FEATURES_SUPPORTED)
+  esp_ble_gap_set_preferred_phy(param->connect.remote_bda, 0, ESP_BLE_GAP_PHY_2M_PREF_MASK,
+                                ESP_BLE_GAP_PHY_2M_PREF_MASK, ESP_BLE_GAP_PHY_OPTIONS_NO_PREF);
+#endif
+}
+
+void BleConnTuner::onMtuChanged(uint16_t connId, uint16_t mtu) {
+  BleLink* link = linkFor(connId);
+  if (link == nullptr) return;
+
+  link->params.mtu = mtu;
+  logMessage("BLE Tuner: Connection " + String(connId) + " MTU " + String(mtu));
+}
+
+void BleConnTuner::onDisconnect(uint16_t connId) {
+  BleLink* link = linkFor(connId);
+  if (link == nullptr) return;
+
+  link->used = false;
+  if (dataLengthLink == link) dataLengthLink = nullptr;
+}
+
+uint16_t BleConnTuner::mtu(uint16_t connId) const {
+  const BleLink* link = linkFor(connId);
+  return link != nullptr ? link->params.mtu : 23;
+}
+
+uint8_t BleConnTuner::linkCount() const {
+  uint8_t count = 0;
+  for (const BleLink& link : links) {
+    if (link.used) count++;
+  }
+  return count;
+}
+
+void BleConnTuner::gapHandler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param) {
+  bleConnTuner.handleGapEvent(event, param);
+}
+
+void BleConnTuner::handleGapEvent(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param) {
+  BleLink* link;
+
+  switch (event) {
+    case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+      link = linkFor(param->update_conn_params.bda);
+      if (link == nullptr) break;
+      if (param->update_conn_params.status != ESP_BT_STATUS_SUCCESS) {
+        logMessage("BLE Tuner: Connection parameter update rejected");
+        break;
+      }
+      link->params.interval = param->update_conn_params.conn_int;
+      link->params.latency = param->update_conn_params.latency;
+      link->params.timeout = param->update_conn_params.timeout;
+      link->updateCount++;
+      logMessage("BLE Tuner: Connection " + String(link->connId) + " interval " +
+                 String(link->params.interval * 1.25f) + "ms, latency " + String(link->params.latency) +
+                 ", timeout " + String(link->params.timeout * 10) + "ms");
+      break;
+
+    case ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT:
+      link = dataLengthLink;
+      dataLengthLink = nullptr;
+      if (link == nullptr) break;
+      if (param->pkt_data_lenth_cmpl.status != ESP_BT_STATUS_SUCCESS) {
+        logMessage("BLE Tuner: Data length extension not supported by peer");
+        break;
+      }
+      link->params.txOctets = param->pkt_data_lenth_cmpl.params.tx_len;
+      link->params.rxOctets = param->pkt_data_lenth_cmpl.params.rx_len;
+      logMessage("BLE Tuner: Connection " + String(link->connId) + " data length tx " +
+                 String(link->params.txOctets) + ", rx " + String(link->params.rxOctets));
+      break;
+
+#ifdef CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+    case ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT:
+      link = linkFor(param->phy_update.bda);
+      if (link == nullptr || param->phy_update.status != ESP_BT_STATUS_SUCCESS) break;
+      link->params.txPhy = param->phy_update.tx_phy;
+      link->params.rxPhy = param->phy_update.rx_phy;
+      logMessage("BLE Tuner: Connection " + String(link->connId) + " PHY tx " + String(link->params.txPhy) +
+                 "M, rx " + String(link->params.rxPhy) + "M");
+      break;
+#endif
+
+    default:
+      break;
+  }
+}
+
+void BleConnTuner::dump(Print& out) const {
+  if (linkCount() == 0) {
+    out.println("Not connected");
+    return;
+  }
+  for (const BleLink& link : links) {
+    if (!link.used) continue;
+    const BleLinkParams& p = link.params;
+    out.printf("Connection %u: interval %.2f ms, latency %u, timeout %u ms (%u updates)\n", link.connId,
+               p.interval * 1.25f, p.latency, p.timeout * 10, link.updateCount);
+    out.printf("  MTU %u, data length tx %u / rx %u, PHY tx %u rx %u\n", p.mtu, p.txOctets, p.rxOctets,
+               p.txPhy, p.rxPhy);
+  }
+}
+
+size_t BleConnTuner::encode(uint8_t part, uint8_t* out, size_t maxLen) const {
+  // [0x05][conn][interval u16][latency u16][timeout u16][mtu u16][tx octets u16][rx octets u16][tx phy][rx phy][updates]
+  const size_t size = 2 + 6 * 2 + 3;
+  if (maxLen < size) return 0;
+
+  const BleLink* link = nullptr;
+  uint8_t index = 0;
+  for (const BleLink& candidate : links) {
+    if (candidate.used && index++ == part) {
+      link = &candidate;
+      break;
+    }
+  }
+  if (link == nullptr) return 0;
+
+  const BleLinkParams& p = link->params;
+  out[0] = DIAG_CMD_BLE_LINK;
+  out[1] = (uint8_t)link->connId;
+  memcpy(out + 2, &p.interval, 2);
+  memcpy(out + 4, &p.latency, 2);
+  memcpy(out + 6, &p.timeout, 2);
+  memcpy(out + 8, &p.mtu, 2);
+  memcpy(out + 10, &p.txOctets, 2);
+  memcpy(out + 12, &p.rxOctets, 2);
+  out[14] = p.txPhy;
+  out[15] = p.rxPhy;
+  out[16] = link->updateCount;
+  return size;
+}
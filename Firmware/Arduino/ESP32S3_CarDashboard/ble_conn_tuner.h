@@ -0,0 +1,68 @@
+#ifndef BLE_CONN_TUNER_H
+#define BLE_CONN_TUNER_H
+
+#include "project_config.h"
+#include <BLEDevice.h>
+#include <BLEServer.h>
+
+// ============================================================================
+// BLE连接参数协商
+// ============================================================================
+// 手机默认的连接间隔通常为30-50 ms，每个连接事件只传一个27字节PDU。
+// 连接后主动请求 7.5-15 ms 间隔、251字节数据长度 (DLE) 和2M PHY，
+// 并记录实际协商结果供诊断，notify速率的上限由这些参数决定。
+// 每个连接单独记录; GAP事件按对端地址对应到连接。
+// GAP事件在BLE任务中到达，这里只写入标量字段。
+
+struct BleLinkParams {
+  uint16_t interval;  // 1.25 ms 单位，0 = 未连接
+  uint16_t latency;
+  uint16_t timeout;   // 10 ms 单位
+  uint16_t mtu;
+  uint16_t txOctets;  // 每个PDU的载荷长度
+  uint16_t rxOctets;
+  uint8_t txPhy;      // 1 = 1M, 2 = 2M, 3 = Coded
+  uint8_t rxPhy;
+};
+
+struct BleLink {
+  bool used;
+  uint16_t connId;
+  esp_bd_addr_t address;
+  BleLinkParams params;
+  uint8_t updateCount;  // 收到的连接参数更新
+};
+
+class BleConnTuner {
+public:
+  // 注册GAP事件处理，在 BLEDevice::init() 之后调用
+  void begin();
+
+  // BLE服务器回调
+  void onConnect(BLEServer* server, esp_ble_gatts_cb_param_t* param);
+  void onMtuChanged(uint16_t connId, uint16_t mtu);
+  void onDisconnect(uint16_t connId);
+
+  // 协商后的MTU，未知连接返回默认的23
+  uint16_t mtu(uint16_t connId) const;
+  uint8_t linkCount() const;
+
+  // 诊断输出: 每个连接一段
+  void dump(Print& out) const;
+  size_t encode(uint8_t part, uint8_t* out, size_t maxLen) const;
+
+private:
+  BleLink links[BLE_MAX_CENTRALS] = {};
+  BleLink* dataLengthLink = nullptr;  // 数据长度完成事件不带对端地址，记录最近一次请求的连接
+
+  BleLink* linkFor(uint16_t connId);
+  const BleLink* linkFor(uint16_t connId) const;
+  BleLink* linkFor(const uint8_t* address);
+
+  static void gapHandler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param);
+  void handleGapEvent(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param);
+};
+
+extern BleConnTuner bleConnTuner;
+
+#endif  // BLE_CONN_TUNER_H
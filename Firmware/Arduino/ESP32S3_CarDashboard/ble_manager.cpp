@@ -1,5 +1,15 @@
 #include "ble_manager.h"
 #include "can_manager.h"
+#include "diag_manager.h"
+#include "latency_stats.h"
+#include "can_bus_stats.h"
+#include "var_poller.h"
+#include "var_catalog.h"
+#include "var_set_pipeline.h"
+#include "ble_conn_tuner.h"
+#include "notify_packer.h"
+#include "config_store.h"
+#include <esp_gatts_api.h>
 
 // 全局BLE管理器实例
 BleManager bleManager;
@@ -14,12 +24,18 @@ void logMessage(const String& message) {
 // ============================================================================
 
 class BleManager::ServerCallbacks : public BLEServerCallbacks {
-  void onConnect(BLEServer* pServer) override {
-    bleManager.handleClientConnected();
+  void onConnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) override {
+    bleConnTuner.onConnect(pServer, param);
+    bleManager.handleClientConnected(param->connect.conn_id);
   }
 
-  void onDisconnect(BLEServer* pServer) override {
-    bleManager.handleClientDisconnected();
+  void onMtuChanged(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) override {
+    bleConnTuner.onMtuChanged(param->mtu.conn_id, param->mtu.mtu);
+  }
+
+  void onDisconnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) override {
+    bleConnTuner.onDisconnect(param->disconnect.conn_id);
+    bleManager.handleClientDisconnected(param->disconnect.conn_id);
   }
 };
 
@@ -31,9 +47,9 @@ class BleManager::ButtonCharCallbacks : public BLECharacteristicCallbacks {
 };
 
 class BleManager::VarRequestCharCallbacks : public BLECharacteristicCallbacks {
-  void onWrite(BLECharacteristic* pCharacteristic) override {
+  void onWrite(BLECharacteristic* pCharacteristic, esp_ble_gatts_cb_param_t* param) override {
     String value = pCharacteristic->getValue();
-    bleManager.handleVarRequestWrite(value);
+    bleManager.handleVarRequestWrite(param->write.conn_id, value);
   }
 };
 
@@ -44,6 +60,27 @@ class BleManager::VarSetCharCallbacks : public BLECharacteristicCallbacks {
   }
 };
 
+class BleManager::DiagCharCallbacks : public BLECharacteristicCallbacks {
+  void onWrite(BLECharacteristic* pCharacteristic) override {
+    String value = pCharacteristic->getValue();
+    bleManager.handleDiagWrite(value);
+  }
+};
+
+class BleManager::FlowCharCallbacks : public BLECharacteristicCallbacks {
+  void onWrite(BLECharacteristic* pCharacteristic, esp_ble_gatts_cb_param_t* param) override {
+    String value = pCharacteristic->getValue();
+    bleManager.handleCreditWrite(param->write.conn_id, value);
+  }
+};
+
+class BleManager::ConfigCharCallbacks : public BLECharacteristicCallbacks {
+  void onWrite(BLECharacteristic* pCharacteristic) override {
+    String value = pCharacteristic->getValue();
+    bleManager.handleConfigWrite(value);
+  }
+};
+
 // ============================================================================
 // BleManager 实现
 // ============================================================================
@@ -55,6 +92,7 @@ bool BleManager::init() {
 
   BLEDevice::init("ESP32S3 Car Dashboard");
   BLEDevice::setMTU(517);
+  bleConnTuner.begin();
 
   pServer = BLEDevice::createServer();
   pServer->setCallbacks(new ServerCallbacks());
@@ -85,6 +123,25 @@ bool BleManager::init() {
     BLECharacteristic::PROPERTY_WRITE_NR);
   pGpsDataChar->setCallbacks(new VarSetCharCallbacks());
 
+  // 创建诊断特征 (写入命令，notify返回报告)
+  pDiagChar = pService->createCharacteristic(
+    CHAR_DIAG_UUID,
+    BLECharacteristic::PROPERTY_WRITE_NR | BLECharacteristic::PROPERTY_NOTIFY);
+  pDiagChar->setCallbacks(new DiagCharCallbacks());
+
+  // 创建流控特征 (App写入授予的notify额度)
+  pFlowChar = pService->createCharacteristic(
+    CHAR_FLOW_CREDIT_UUID,
+    BLECharacteristic::PROPERTY_WRITE_NR);
+  pFlowChar->setCallbacks(new FlowCharCallbacks());
+
+  // 创建配置特征 (读取当前配置，写入 [id][值 u32 小端]... 修改)
+  pConfigChar = pService->createCharacteristic(
+    CHAR_CONFIG_UUID,
+    BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_WRITE);
+  pConfigChar->setCallbacks(new ConfigCharCallbacks());
+  refreshConfigValue();
+
   pService->start();
 
   BLEAdvertising* pAdvertising = BLEDevice::getAdvertising();
@@ -98,61 +155,121 @@ bool BleManager::init() {
   return true;
 }
 
+void BleManager::updatePolling() {
+  sendUnsentResponses();
+
+  // 波特率检测完成前不开始轮询，各中心设备的请求保留到可以发送时
+  if (!varPoller.isActive() && canManager.isTransmitEnabled()) {
+    startPollCycle();
+  }
+
+  varPoller.update(millis());
+
+  if (varPoller.isComplete()) {
+    sendBatchResponses();
+  }
+}
+
 void BleManager::update() {
-  checkRequestTimeout();
+  if (pendingDiagCmd != 0) {
+    uint8_t cmd = pendingDiagCmd;
+    pendingDiagCmd = 0;
+    sendDiagReport(cmd);
+  }
 
-  // 处理连接状态变化
-  if (!deviceConnected && oldDeviceConnected) {
-    static uint32_t disconnectTime = 0;
+  if (pendingConfigLength != 0) {
+    applyConfigWrite();
+  }
 
-    if (disconnectTime == 0) {
-      disconnectTime = millis();
-    } else if (millis() - disconnectTime >= RECONNECT_DELAY_MS) {
+  // 连接或断开后延时重新广播，连接数未满时允许更多中心设备连接
+  if (linkChanged && millis() - linkChangedMs >= RECONNECT_DELAY_MS) {
+    linkChanged = false;
+    if (connectedCount < BLE_MAX_CENTRALS) {
       pServer->startAdvertising();
-      logMessage("BLE Manager: Restarted advertising");
-      oldDeviceConnected = deviceConnected;
-      disconnectTime = 0;
+      logMessage("BLE Manager: Advertising (" + String(connectedCount) + "/" + String(BLE_MAX_CENTRALS) +
+                 " connected)");
     }
-  } else {
-    if (deviceConnected && !oldDeviceConnected) {
-      oldDeviceConnected = deviceConnected;
+  }
+}
 
-      // 重置批量请求状态
-      pendingVarCount = 0;
-      pendingVarIndex = 0;
-      batchResponseCount = 0;
+void BleManager::handleClientConnected(uint16_t connId) {
+  Central* central = nullptr;
+
+  portENTER_CRITICAL(&centralMux);
+  for (Central& candidate : centrals) {
+    if (!candidate.connected) {
+      central = &candidate;
+      central->connected = true;
+      central->connId = connId;
+      central->length = 0;
+      central->pending = false;
+      central->inCycle = false;
+      central->flowControl = false;
+      central->credits = 0;
+      central->stalled = false;
+      central->stallCount = 0;
+      central->unsentCount = 0;
+      central->header = false;
+      central->sequence = 0;
+      connectedCount++;
+      break;
     }
   }
-}
+  linkChanged = true;
+  linkChangedMs = millis();
+  portEXIT_CRITICAL(&centralMux);
+
+  if (central == nullptr) {
+    logMessage("BLE Manager: No free slot for connection " + String(connId));
+    pServer->disconnect(connId);
+    return;
+  }
 
-void BleManager::handleClientConnected() {
-  deviceConnected = true;
-  logMessage("BLE Manager: Client connected");
+  logMessage("BLE Manager: Client " + String(connId) + " connected (" + String(connectedCount) + "/" +
+             String(BLE_MAX_CENTRALS) + ")");
 }
 
-void BleManager::handleClientDisconnected() {
-  deviceConnected = false;
-  logMessage("BLE Manager: Client disconnected");
+void BleManager::handleClientDisconnected(uint16_t connId) {
+  portENTER_CRITICAL(&centralMux);
+  for (Central& central : centrals) {
+    if (central.connected && central.connId == connId) {
+      central.connected = false;
+      central.pending = false;
+      connectedCount--;
+      break;
+    }
+  }
+  linkChanged = true;
+  linkChangedMs = millis();
+  portEXIT_CRITICAL(&centralMux);
+
+  logMessage("BLE Manager: Client " + String(connId) + " disconnected");
 }
 
 void BleManager::handleButtonWrite(const String& value) {
+  uint32_t writeMicros = micros();
+
   if (value.length() >= 2) {
     uint16_t buttonMask = (uint8_t)value[0] | ((uint8_t)value[1] << 8);
     if (buttonMask != lastButtonMask) {
       lastButtonMask = buttonMask;
-      canManager.sendButtonFrame(buttonMask);
+      if (canManager.sendButtonFrame(buttonMask)) {
+        latencyStats.recordSince(LAT_BLE_BUTTON_TO_CAN, writeMicros);
+      }
     }
   } else if (value.length() == 1) {
     uint8_t buttonId = (uint8_t)value[0];
     uint16_t buttonMask = (1 << buttonId);
     if (buttonMask != lastButtonMask) {
       lastButtonMask = buttonMask;
-      canManager.sendButtonFrame(buttonMask);
+      if (canManager.sendButtonFrame(buttonMask)) {
+        latencyStats.recordSince(LAT_BLE_BUTTON_TO_CAN, writeMicros);
+      }
     }
   }
 }
 
-void BleManager::handleVarRequestWrite(const String& value) {
+void BleManager::handleVarRequestWrite(uint16_t connId, const String& value) {
   size_t len = value.length();
 
   if (len < 4) {
@@ -160,25 +277,29 @@ void BleManager::handleVarRequestWrite(const String& value) {
     return;
   }
 
-  // 如果当前有未完成的请求，忽略新请求
-  if (pendingVarCount > 0 && pendingVarIndex < pendingVarCount) {
-    logMessage("BLE Manager: Previous batch still in progress");
-    return;
+  if (len > VAR_REQUEST_MAX_BYTES) {
+    logMessage("BLE Manager: Variable request of " + String(len) + " bytes truncated to " +
+               String(VAR_REQUEST_MAX_BYTES));
+    len = VAR_REQUEST_MAX_BYTES;
   }
 
-  // 开始新的批量请求
-  startBatchRequest();
-
-  // 解析变量哈希值
-  for (size_t i = 0; i + 4 <= len && pendingVarCount < MAX_BATCH_VARS; i += 4) {
-    int32_t varHash = readInt32BigEndian((const uint8_t*)(value.c_str() + i));
-    addVariableToBatch(varHash);
+  // 只暂存，在update()中合并到下一轮轮询; 尚未响应的旧请求被新请求替换
+  bool stored = false;
+  portENTER_CRITICAL(&centralMux);
+  for (Central& central : centrals) {
+    if (central.connected && central.connId == connId) {
+      memcpy(central.request, value.c_str(), len);
+      central.length = len;
+      central.requestMicros = micros();
+      central.pending = true;
+      stored = true;
+      break;
+    }
   }
+  portEXIT_CRITICAL(&centralMux);
 
-  if (pendingVarCount > 0) {
-    lastVarRequestTime = millis();
-    canManager.requestVariable(pendingVarHashes[0]);
-    logMessage("BLE Manager: Started batch request with " + String(pendingVarCount) + " variables");
+  if (!stored) {
+    logMessage("BLE Manager: Variable request from unknown connection " + String(connId));
   }
 }
 
@@ -195,56 +316,318 @@ void BleManager::handleVarSetWrite(const String& value) {
     int32_t varHash = readInt32BigEndian(data);
     float varValue = readFloat32BigEndian(data + 4);
 
-    canManager.sendVariableToEcu(varHash, varValue);
+    // 只写槽位，由主循环按总线预算发送
+    if (!varSetPipeline.post(varHash, varValue)) {
+      logMessage("BLE Manager: Variable set table full, value dropped");
+    }
   }
 }
 
-void BleManager::startBatchRequest() {
-  pendingVarCount = 0;
-  pendingVarIndex = 0;
-  batchResponseCount = 0;
+void BleManager::handleDiagWrite(const String& value) {
+  if (value.length() < 1) return;
+
+  // 在update()中生成报告，避免在BLE回调中notify
+  pendingDiagCmd = (uint8_t)value[0];
 }
 
-void BleManager::addVariableToBatch(int32_t varHash) {
-  if (pendingVarCount < MAX_BATCH_VARS) {
-    pendingVarHashes[pendingVarCount++] = varHash;
+void BleManager::handleCreditWrite(uint16_t connId, const String& value) {
+  if (value.length() < 2) return;
+
+  // [额度 u16 小端]: 追加授予的notify数，第一次写入时启用该连接的流控
+  uint16_t grant = (uint8_t)value[0] | ((uint8_t)value[1] << 8);
+
+  portENTER_CRITICAL(&centralMux);
+  for (Central& central : centrals) {
+    if (central.connected && central.connId == connId) {
+      central.flowControl = true;
+      uint32_t credits = (uint32_t)central.credits + grant;
+      central.credits = credits > BLE_FLOW_MAX_CREDITS ? BLE_FLOW_MAX_CREDITS : credits;
+      break;
+    }
   }
+  portEXIT_CRITICAL(&centralMux);
 }
 
-void BleManager::sendBatchResponse() {
-  if (batchResponseCount == 0) return;
-  if (!deviceConnected || pVarDataChar == nullptr) return;
+void BleManager::handleConfigWrite(const String& value) {
+  size_t len = value.length();
+  if (len == 0 || len > CONFIG_WRITE_MAX_BYTES) {
+    logMessage("BLE Manager: Config write has invalid length " + String(len));
+    return;
+  }
 
-  uint32_t now = millis();
-  if (now - lastBleNotifyTime < BLE_NOTIFY_MIN_INTERVAL_MS) return;
+  // 只暂存，NVS写入在update()中进行; 上一次写入尚未处理时被覆盖
+  portENTER_CRITICAL(&configMux);
+  memcpy(pendingConfig, value.c_str(), len);
+  pendingConfigLength = len;
+  portEXIT_CRITICAL(&configMux);
+}
 
-  pVarDataChar->setValue(batchResponseBuffer, batchResponseCount * VAR_RESPONSE_SIZE);
-  pVarDataChar->notify();
+void BleManager::applyConfigWrite() {
+  uint8_t data[CONFIG_WRITE_MAX_BYTES];
+  portENTER_CRITICAL(&configMux);
+  uint8_t length = pendingConfigLength;
+  memcpy(data, pendingConfig, length);
+  pendingConfigLength = 0;
+  portEXIT_CRITICAL(&configMux);
 
-  lastBleNotifyTime = now;
-  bleNotifyCount++;
+  if (length == 1 && data[0] == CFG_RESET_DEFAULTS) {
+    logMessage(configStore.resetDefaults() ? "Config: Reset to defaults" : "Config: Reset failed");
+  } else {
+    // [id][值 u32 小端]...，每项单独校验，拒绝的项不影响其他项
+    for (uint8_t i = 0; i + 5 <= length; i += 5) {
+      uint32_t value;
+      memcpy(&value, data + i + 1, sizeof(value));
+      if (!configStore.set(data[i], value)) {
+        logMessage("Config: Rejected key " + String(data[i]) + " = " + String(value));
+      }
+    }
+  }
 
-  logMessage("BLE Manager: Sent batch response with " + String(batchResponseCount) + " variables");
+  if (configStore.rebootPending()) {
+    logMessage("Config: Some changes take effect after reboot");
+  }
+  refreshConfigValue();
+}
+
+void BleManager::refreshConfigValue() {
+  uint8_t value[DIAG_MAX_REPORT_SIZE];
+  size_t len = configStore.encode(value, sizeof(value));
+  if (len > 0) pConfigChar->setValue(value, len);
+}
+
+void BleManager::sendDiagReport(uint8_t cmd) {
+  if (connectedCount == 0 || pDiagChar == nullptr) return;
+
+  uint8_t report[DIAG_MAX_REPORT_SIZE];
+  for (uint8_t part = 0;; part++) {
+    size_t len = diagManager.encodeReport(cmd, part, report, sizeof(report));
+    if (len == 0) break;
+
+    for (const Central& central : centrals) {
+      if (central.connected) sendDiagNotify(central.connId, report, len);
+    }
+  }
+}
+
+void BleManager::sendDiagNotify(uint16_t connId, const uint8_t* report, size_t len) {
+  // BLECharacteristic::notify() 按默认MTU截断到20字节，这里按连接的MTU直接发送
+  uint16_t mtu = bleConnTuner.mtu(connId);
+  size_t payload = mtu > 3 ? mtu - 3 : 0;
+  if (len <= payload) {
+    esp_ble_gatts_send_indicate(pServer->getGattsIf(), connId, pDiagChar->getHandle(), len, (uint8_t*)report, false);
+    return;
+  }
+
+  // 分片: 每片重复 [cmd][part]，App按序号拼接，最后一片置 DIAG_FRAGMENT_LAST
+  uint8_t fragment[DIAG_MAX_REPORT_SIZE];
+  const size_t chunk = payload - 3;
+  uint8_t index = 0;
+  for (size_t offset = 2; offset < len; offset += chunk) {
+    size_t n = len - offset < chunk ? len - offset : chunk;
+    fragment[0] = DIAG_FRAGMENT_FLAG | report[0];
+    fragment[1] = report[1];
+    fragment[2] = index++ | (offset + n >= len ? DIAG_FRAGMENT_LAST : 0);
+    memcpy(fragment + 3, report + offset, n);
+    esp_ble_gatts_send_indicate(pServer->getGattsIf(), connId, pDiagChar->getHandle(), n + 3, fragment, false);
+  }
+}
+
+bool BleManager::readyForCycle(Central& central) {
+  if (!central.connected || !central.pending) return false;
+  if (!central.flowControl || (central.credits > 0 && central.unsentCount == 0)) return true;
+
+  // 没有额度: App处理不过来，请求等待下一次授予
+  if (!central.stalled) {
+    central.stalled = true;
+    central.stallCount++;
+  }
+  return false;
+}
+
+void BleManager::startPollCycle() {
+  bool anyReady = false;
+  for (Central& central : centrals) {
+    if (readyForCycle(central)) anyReady = true;
+  }
+  if (!anyReady) return;
+
+  varPoller.clear();
+
+  uint8_t centralCount = 0;
+  uint32_t startMicros = 0;
+  for (Central& central : centrals) {
+    central.inCycle = false;
+
+    // 取出请求后立即释放，BLE回调可以继续写入下一次请求
+    uint16_t length = 0;
+    uint32_t requestMicros = 0;
+    portENTER_CRITICAL(&centralMux);
+    if (readyForCycle(central)) {
+      central.stalled = false;
+      memcpy(requestScratch, central.request, central.length);
+      length = central.length;
+      requestMicros = central.requestMicros;
+      central.pending = false;
+    }
+    portEXIT_CRITICAL(&centralMux);
+    if (length == 0) continue;
+
+    addRequest(requestScratch, length, central);
+    central.inCycle = true;
+
+    // 延迟从最早的请求算起
+    if (centralCount == 0 || (int32_t)(requestMicros - startMicros) < 0) startMicros = requestMicros;
+    centralCount++;
+  }
+
+  // 不逐轮打印: 在CAN任务中运行，串口输出会推迟下一个请求
+  varPoller.start(startMicros);
+}
 
-  // 重置状态
-  startBatchRequest();
+uint16_t BleManager::addRequest(const uint8_t* data, uint16_t length, Central& central) {
+  // 解析 (ECU标记 | 选项 | 变量哈希) 列表，未标记的哈希发往主ECU
+  memset(central.selection, 0, sizeof(central.selection));
+  central.header = false;
+  uint8_t ecuId = configStore.get().ecuId;
+  uint16_t added = 0;
+  uint16_t dropped = 0;
+  for (uint16_t i = 0; i + 4 <= length; i += 4) {
+    int32_t varHash = readInt32BigEndian(data + i);
+    if (isVarEcuMarker(varHash)) {
+      ecuId = (uint8_t)varHash;
+      continue;
+    }
+    if (isVarOption(varHash)) {
+      // 未知选项忽略，以后的App可以请求新版本的头而不影响旧固件
+      if ((uint32_t)varHash == VAR_HEADER_V1) central.header = true;
+      continue;
+    }
+    if (!varPoller.hasEcu(ecuId)) {
+      logMessage("BLE Manager: ECU " + String(ecuId) + " not in VAR_ECU_IDS");
+      continue;
+    }
+    if (!checkCatalog(varHash)) continue;
+
+    int16_t entry = varPoller.add(ecuId, varHash);
+    if (entry < 0) {
+      dropped++;
+      continue;
+    }
+    central.selection[entry / 8] |= 1 << (entry % 8);
+    added++;
+  }
+
+  if (dropped > 0) {
+    logMessage("BLE Manager: Batch pool full, " + String(dropped) + " variables dropped");
+  }
+  return added;
 }
 
-void BleManager::checkRequestTimeout() {
-  if (pendingVarCount == 0 || pendingVarIndex >= pendingVarCount) return;
+bool BleManager::checkCatalog(int32_t varHash) {
+#if VAR_CATALOG_MODE != VAR_CATALOG_OFF
+  if (VarCatalog::contains(varHash)) return true;
+
+  unknownHashCount++;
+  logMessage("BLE Manager: Unknown variable hash " + String(varHash));
+  return VAR_CATALOG_MODE != VAR_CATALOG_REJECT;
+#else
+  return true;
+#endif
+}
 
+void BleManager::sendBatchResponses() {
+  // 距上次notify太近时留到CAN任务的下一次唤醒
   uint32_t now = millis();
-  if (now - lastVarRequestTime >= VAR_REQUEST_TIMEOUT_MS) {
-    timeoutCount++;
-    logMessage("BLE Manager: Variable request timeout for index " + String(pendingVarIndex));
+  if (now - lastBleNotifyTime < configStore.get().bleNotifyMinIntervalMs) return;
+
+  uint8_t clients = 0;
+  uint16_t notifies = 0;
+  for (Central& central : centrals) {
+    if (!central.inCycle) continue;
+    central.inCycle = false;
+    if (!central.connected || pVarDataChar == nullptr) continue;
+
+    uint16_t entries = varPoller.buildResponse(central.selection, responseScratch, VAR_RESPONSE_MAX_ENTRIES);
+    if (entries == 0) continue;
+
+    uint8_t sent = sendResponse(central, responseScratch, entries, varPoller.batchStart());
+    if (sent == 0) continue;
+    notifies += sent;
+    clients++;
+  }
+
+  if (clients > 0) {
+    latencyStats.recordSince(LAT_BATCH_TO_NOTIFY, varPoller.batchStart());
+    lastBleNotifyTime = now;
+    bleNotifyCount += notifies;
+  }
 
-    pendingVarIndex++;
+  varPoller.finish();
+}
+
+uint8_t BleManager::sendResponse(Central& central, const uint8_t* entries, uint16_t count, uint32_t batchStart) {
+  portENTER_CRITICAL(&centralMux);
+  const uint8_t maxNotifies = !central.flowControl ? 0xFF : central.credits > 0xFF ? 0xFF : central.credits;
+  portEXIT_CRITICAL(&centralMux);
+
+  // 按该连接协商的MTU拆分为一个或多个notify，连续发送，不超过额度
+  uint16_t consumed = 0;
+  uint8_t sent = 0;
+  if (maxNotifies > 0) {
+    sent = notifyPacker.send(pServer, pVarDataChar, central.connId, entries, count, bleConnTuner.mtu(central.connId),
+                             central.header ? &central.sequence : nullptr, batchStart, maxNotifies, &consumed);
+  }
+
+  // 按协议栈接受的notify扣除额度; 这期间新授予的额度保留
+  portENTER_CRITICAL(&centralMux);
+  if (central.flowControl) central.credits = central.credits > sent ? central.credits - sent : 0;
+  portEXIT_CRITICAL(&centralMux);
+
+  central.unsentCount = NotifyPacker::keepUnsent(entries, count, consumed, central.unsent);
+  central.unsentBatchStart = batchStart;
+  return sent;
+}
+
+void BleManager::sendUnsentResponses() {
+  for (Central& central : centrals) {
+    if (central.unsentCount == 0) continue;
+    if (!central.connected) {
+      central.unsentCount = 0;
+      continue;
+    }
+    if (central.credits == 0) continue;
+    bleNotifyCount += sendResponse(central, central.unsent, central.unsentCount, central.unsentBatchStart);
+  }
+}
 
-    if (pendingVarIndex < pendingVarCount) {
-      lastVarRequestTime = now;
-      canManager.requestVariable(pendingVarHashes[pendingVarIndex]);
+void BleManager::dumpFlowControl(Print& out) {
+  for (const Central& central : centrals) {
+    if (!central.connected) continue;
+    if (central.flowControl) {
+      out.printf("Client %u: %u credits, waited for credits %lu times, %u entries waiting\n", central.connId,
+                 central.credits, (unsigned long)central.stallCount, central.unsentCount);
     } else {
-      sendBatchResponse();
+      out.printf("Client %u: no flow control\n", central.connId);
     }
   }
-}
\ No newline at end of file
+}
+
+size_t BleManager::encodeFlowControl(uint8_t* out, size_t maxLen) {
+  // [n] + n × [conn][credits u16, 0xFFFF = 未启用][stalls u32]
+  const size_t entrySize = 1 + 2 + 4;
+  if (maxLen < 1) return 0;
+
+  uint8_t count = 0;
+  uint8_t* p = out + 1;
+  for (const Central& central : centrals) {
+    if (!central.connected || (size_t)(p - out) + entrySize > maxLen) continue;
+    uint16_t credits = central.flowControl ? central.credits : 0xFFFF;
+    p[0] = (uint8_t)central.connId;
+    memcpy(p + 1, &credits, 2);
+    memcpy(p + 3, &central.stallCount, 4);
+    p += entrySize;
+    count++;
+  }
+  out[0] = count;
+  return p - out;
+}
@@ -13,27 +13,20 @@ public:
     BleManager();
     bool init();
     void update();
+    // CAN任务中调用 (见 CanManager::setPollHandler): 开始一轮轮询、处理超时、发送批量响应
+    void updatePolling();
     
     // 连接状态
-    bool isConnected() const { return deviceConnected; }
-    
-    // 批量请求管理
-    void startBatchRequest();
-    void addVariableToBatch(int32_t varHash);
-    void sendBatchResponse();
+    bool isConnected() const { return connectedCount > 0; }
+    uint8_t getConnectedCount() const { return connectedCount; }
     
     // 统计信息
     uint32_t getNotifyCount() const { return bleNotifyCount; }
-    uint32_t getTimeoutCount() const { return timeoutCount; }
-    
-    // 批量请求数据（供外部访问）
-    int32_t pendingVarHashes[MAX_BATCH_VARS];
-    uint8_t pendingVarCount = 0;
-    uint8_t pendingVarIndex = 0;
-    uint32_t lastVarRequestTime = 0;
-    
-    uint8_t batchResponseBuffer[MAX_BATCH_VARS * VAR_RESPONSE_SIZE];
-    uint8_t batchResponseCount = 0;
+    uint32_t getUnknownHashCount() const { return unknownHashCount; }
+
+    // 诊断: 每个连接的流控额度
+    void dumpFlowControl(Print& out);
+    size_t encodeFlowControl(uint8_t* out, size_t maxLen);
     
 private:
     BLEServer* pServer = nullptr;
@@ -41,30 +34,100 @@ private:
     BLECharacteristic* pVarDataChar = nullptr;
     BLECharacteristic* pVarRequestChar = nullptr;
     BLECharacteristic* pGpsDataChar = nullptr;
+    BLECharacteristic* pDiagChar = nullptr;
+    BLECharacteristic* pFlowChar = nullptr;
+    BLECharacteristic* pConfigChar = nullptr;
     
-    bool deviceConnected = false;
-    bool oldDeviceConnected = false;
     uint16_t lastButtonMask = 0;
     uint32_t lastBleNotifyTime = 0;
+    volatile uint8_t pendingDiagCmd = 0;
+
+    // 配置写入暂存，在update()中校验并保存到NVS (闪存写入不放在BLE回调中)
+    uint8_t pendingConfig[CONFIG_WRITE_MAX_BYTES];
+    volatile uint8_t pendingConfigLength = 0;
+    portMUX_TYPE configMux = portMUX_INITIALIZER_UNLOCKED;
     
+    // 每个中心设备 (手机、平板、记录仪) 一项。BLE回调只暂存最近一次VarRequest的
+    // 原始数据; CAN任务把所有待响应的请求合并成一轮轮询 (相同变量只请求一次)，
+    // 完成后按各自的选择位图分别回复。显示设备增加不会增加CAN负载。
+    struct Central {
+        bool connected;
+        uint16_t connId;
+        uint8_t request[VAR_REQUEST_MAX_BYTES];
+        uint16_t length;
+        uint32_t requestMicros;
+        bool pending;   // 有尚未响应的请求
+        bool inCycle;   // 参与当前一轮轮询
+        uint8_t selection[(MAX_BATCH_VARS + 7) / 8];  // 本轮请求的池下标
+
+        // 流控: App写入流控特征后启用，每个notify消耗一个额度，
+        // 没有额度时请求留到额度到达后再参与轮询
+        bool flowControl;
+        uint16_t credits;
+        bool stalled;
+        uint32_t stallCount;
+        // 额度用完时未发送的响应条目，授予额度后先发完这些，之后才参与新一轮轮询
+        uint8_t unsent[VAR_RESPONSE_MAX_ENTRIES * VAR_RESPONSE_SIZE];
+        uint16_t unsentCount;
+        uint32_t unsentBatchStart;
+
+        // VarData头: 请求中包含 VAR_HEADER_V1 选项时启用，序号按连接逐notify递增
+        bool header;
+        uint32_t sequence;
+    };
+    Central centrals[BLE_MAX_CENTRALS] = {};
+    portMUX_TYPE centralMux = portMUX_INITIALIZER_UNLOCKED;
+    volatile uint8_t connectedCount = 0;
+
+    // 连接变化后延时重新广播 (连接数未满时)
+    volatile bool linkChanged = false;
+    volatile uint32_t linkChangedMs = 0;
+
+    // CAN任务 (轮询) 使用的缓冲区
+    uint8_t requestScratch[VAR_REQUEST_MAX_BYTES];
+    uint8_t responseScratch[VAR_RESPONSE_MAX_ENTRIES * VAR_RESPONSE_SIZE];
+
     uint32_t bleNotifyCount = 0;
-    uint32_t timeoutCount = 0;
+    uint32_t unknownHashCount = 0;
     
     // BLE回调类
     class ServerCallbacks;
     class ButtonCharCallbacks;
     class VarRequestCharCallbacks;
     class VarSetCharCallbacks;
+    class DiagCharCallbacks;
+    class FlowCharCallbacks;
+    class ConfigCharCallbacks;
     
     // 事件处理函数
     void handleButtonWrite(const String& value);
-    void handleVarRequestWrite(const String& value);
+    void handleVarRequestWrite(uint16_t connId, const String& value);
     void handleVarSetWrite(const String& value);
-    void handleClientConnected();
-    void handleClientDisconnected();
+    void handleDiagWrite(const String& value);
+    void handleCreditWrite(uint16_t connId, const String& value);
+    void handleConfigWrite(const String& value);
+    void handleClientConnected(uint16_t connId);
+    void handleClientDisconnected(uint16_t connId);
     
-    // 超时检查
-    void checkRequestTimeout();
+    // 合并待响应的请求开始一轮轮询 / 完成后向每个参与的连接发送响应
+    void startPollCycle();
+    bool readyForCycle(Central& central);
+    uint16_t addRequest(const uint8_t* data, uint16_t length, Central& central);
+    void sendBatchResponses();
+    // 按额度发送一个连接的响应，发不完的条目留在 central.unsent
+    uint8_t sendResponse(Central& central, const uint8_t* entries, uint16_t count, uint32_t batchStart);
+    void sendUnsentResponses();
+
+    // 按 VAR_CATALOG_MODE 校验哈希，返回false表示拒绝
+    bool checkCatalog(int32_t varHash);
+
+    // 发送诊断报告: 每个连接按各自的MTU发送，放不下时分片
+    void sendDiagReport(uint8_t cmd);
+    void sendDiagNotify(uint16_t connId, const uint8_t* report, size_t len);
+
+    // 应用暂存的配置写入，更新配置特征的值
+    void applyConfigWrite();
+    void refreshConfigValue();
 };
 
 extern BleManager bleManager;
@@ -0,0 +1,244 @@
+#include "can_bus_stats.h"
+
+// 全局总线统计实例
+CanBusStats canBusStats;
+
+// 错误帧: 错误标志(6~12) + 错误定界符(8) + 帧间隔(3)
+#define CAN_ERROR_FRAME_BITS 20
+// CRC定界符(1) + ACK(2) + EOF(7) + 帧间隔(3)
+#define CAN_FRAME_TRAILER_BITS 13
+// 窗口内没有可参考的帧时，硬件溢出丢失的帧按8字节标准帧估算
+#define CAN_LOST_FRAME_BITS 125
+
+// ============================================================================
+// 帧位长计算
+// ============================================================================
+
+namespace {
+
+// SOF到CRC之间的位流: 同时计算CRC-15和位填充
+struct CanBitCounter {
+  uint16_t crc = 0;
+  uint16_t bits = 0;
+  uint8_t lastBit = 0xFF;
+  uint8_t runLength = 0;
+
+  void stuff(uint8_t bit) {
+    bits++;
+    if (bit == lastBit) {
+      runLength++;
+    } else {
+      lastBit = bit;
+      runLength = 1;
+    }
+    // 连续5个相同位后插入一个相反的填充位
+    if (runLength == 5) {
+      bits++;
+      lastBit = bit ^ 1;
+      runLength = 1;
+    }
+  }
+
+  void push(uint32_t value, uint8_t width) {
+    for (int8_t i = width - 1; i >= 0; i--) {
+      uint8_t bit = (value >> i) & 1;
+      uint8_t crcNext = bit ^ ((crc >> 14) & 1);
+      crc = (crc << 1) & 0x7FFF;
+      if (crcNext) crc ^= 0x4599;
+      stuff(bit);
+    }
+  }
+
+  void pushCrc() {
+    uint16_t value = crc;
+    for (int8_t i = 14; i >= 0; i--) {
+      stuff((value >> i) & 1);
+    }
+  }
+};
+
+}  // namespace
+
+uint16_t CanBusStats::frameBitLength(const CANMessage& frame) {
+  CanBitCounter counter;
+  const uint8_t len = frame.len > 8 ? 8 : frame.len;
+
+  counter.push(0, 1);  // SOF
+  if (frame.ext) {
+    counter.push((frame.id >> 18) & 0x7FF, 11);
+    counter.push(0x3, 2);  // SRR, IDE
+    counter.push(frame.id & 0x3FFFF, 18);
+    counter.push(frame.rtr ? 1 : 0, 1);
+    counter.push(0, 2);  // r1, r0
+  } else {
+    counter.push(frame.id & 0x7FF, 11);
+    counter.push(frame.rtr ? 1 : 0, 1);
+    counter.push(0, 2);  // IDE, r0
+  }
+  counter.push(len, 4);
+  if (!frame.rtr) {
+    for (uint8_t i = 0; i < len; i++) {
+      counter.push(frame.data[i], 8);
+    }
+  }
+  counter.pushCrc();
+
+  return counter.bits + CAN_FRAME_TRAILER_BITS;
+}
+
+// ============================================================================
+// CanBusStats 实现
+// ============================================================================
+
+CanIdStat* CanBusStats::findOrInsert(uint32_t key) {
+  CanIdStat* minEntry = nullptr;
+  for (uint8_t i = 0; i < idTableCount; i++) {
+    if (idTable[i].id == key) return &idTable[i];
+    if (minEntry == nullptr || idTable[i].total < minEntry->total) minEntry = &idTable[i];
+  }
+
+  if (idTableCount < BUS_STATS_TOP_K) {
+    CanIdStat* entry = &idTable[idTableCount++];
+    *entry = { key, 0, 0, 0 };
+    return entry;
+  }
+
+  // 表满: 替换计数最小的ID，保留其计数作为上界估计
+  minEntry->id = key;
+  minEntry->windowCount = 0;
+  minEntry->rate = 0;
+  return minEntry;
+}
+
+void CanBusStats::onFrame(const CANMessage& frame, bool lost) {
+  const uint16_t bits = frameBitLength(frame);
+  const uint32_t key = frame.ext ? (frame.id | 0x80000000UL) : frame.id;
+
+  portENTER_CRITICAL(&statsMux);
+  windowBits += bits;
+  windowFrames++;
+  if (lost) windowLostFrames++;
+
+  CanIdStat* entry = findOrInsert(key);
+  entry->total++;
+  if (entry->windowCount < 0xFFFF) entry->windowCount++;
+  portEXIT_CRITICAL(&statsMux);
+}
+
+void CanBusStats::closeWindow(uint32_t nowMs, uint8_t rec, uint8_t tec, uint8_t eflg, uint32_t rxOverflows) {
+  // 错误计数器只增不减的部分近似为错误帧数: REC每次+1，TEC每次+8
+  uint32_t errorFrames = 0;
+  if (rec > lastRec) errorFrames += rec - lastRec;
+  if (tec > lastTec) errorFrames += (tec - lastTec + 7) / 8;
+  lastRec = rec;
+  lastTec = tec;
+  lastEflg = eflg;
+  const uint32_t overflowFrames = rxOverflows - lastRxOverflows;
+  lastRxOverflows = rxOverflows;
+
+  portENTER_CRITICAL(&statsMux);
+  uint32_t elapsedMs = nowMs - windowStartMs;
+  if (elapsedMs == 0) elapsedMs = 1;
+
+  // 硬件溢出丢失的帧看不到内容，按本窗口的平均帧长计
+  const uint32_t overflowBits =
+    overflowFrames * (windowFrames > 0 ? windowBits / windowFrames : CAN_LOST_FRAME_BITS);
+  const uint32_t frames = windowFrames + overflowFrames;
+  const uint32_t lostFrames = windowLostFrames + overflowFrames;
+
+  uint32_t bits = windowBits + overflowBits + errorFrames * CAN_ERROR_FRAME_BITS;
+  uint64_t permille = (uint64_t)bits * 1000000ULL / ((uint64_t)bitrate * elapsedMs);
+  loadPermille = permille > 1000 ? 1000 : (uint16_t)permille;
+  bitsPerSec = (uint32_t)((uint64_t)bits * 1000 / elapsedMs);
+  framesPerSec = (uint32_t)((uint64_t)frames * 1000 / elapsedMs);
+  errorFramesPerSec = (uint32_t)((uint64_t)errorFrames * 1000 / elapsedMs);
+  totalErrorFrames += errorFrames;
+  lostFramesPerSec = (uint32_t)((uint64_t)lostFrames * 1000 / elapsedMs);
+  totalLostFrames += lostFrames;
+
+  for (uint8_t i = 0; i < idTableCount; i++) {
+    idTable[i].rate = (uint16_t)((uint32_t)idTable[i].windowCount * 1000 / elapsedMs);
+    idTable[i].windowCount = 0;
+  }
+
+  windowBits = 0;
+  windowFrames = 0;
+  windowLostFrames = 0;
+  windowStartMs = nowMs;
+  portEXIT_CRITICAL(&statsMux);
+}
+
+uint32_t CanBusStats::pollBackoffMs() const {
+  if (!isSaturated()) return 0;
+
+  // 从饱和阈值到100%线性增加到最大退避
+  uint32_t over = loadPermille - BUS_LOAD_SATURATED_PERMILLE;
+  uint32_t range = 1000 - BUS_LOAD_SATURATED_PERMILLE;
+  uint32_t backoff = BUS_LOAD_BACKOFF_MAX_MS * over / range;
+  return backoff > 0 ? backoff : 1;
+}
+
+void CanBusStats::dump(Print& out) const {
+  out.printf("load=%u.%u%% frames/s=%lu bits/s=%lu errors/s=%lu errors=%lu lost/s=%lu lost=%lu REC=%u TEC=%u "
+             "EFLG=0x%02X%s\n",
+             loadPermille / 10, loadPermille % 10,
+             (unsigned long)framesPerSec,
+             (unsigned long)bitsPerSec,
+             (unsigned long)errorFramesPerSec,
+             (unsigned long)totalErrorFrames,
+             (unsigned long)lostFramesPerSec,
+             (unsigned long)totalLostFrames,
+             lastRec, lastTec, lastEflg,
+             isSaturated() ? " SATURATED" : "");
+
+  for (uint8_t i = 0; i < idTableCount; i++) {
+    const CanIdStat& entry = idTable[i];
+    out.printf("  0x%0*lX%s rate=%u/s total=%lu\n",
+               (entry.id & 0x80000000UL) ? 8 : 3,
+               (unsigned long)(entry.id & 0x1FFFFFFFUL),
+               (entry.id & 0x80000000UL) ? "x" : "",
+               entry.rate,
+               (unsigned long)entry.total);
+  }
+}
+
+// part 0: [0] DIAG_CMD_BUS_STATS, [1] 0, [2..3] 负载千分比, [4..7] 帧/秒,
+//         [8..11] 位/秒, [12..15] 错误帧/秒, [16] REC, [17] TEC, [18] EFLG,
+//         [19..22] 丢失帧/秒 (驱动缓冲区满 + MCP2515溢出)
+// part 1..: [0] DIAG_CMD_BUS_STATS, [1] part, [2] 条目数,
+//         每条目 [id u32 (bit31=扩展帧)][rate u16][total u32]，小端
+#define BUS_STATS_IDS_PER_PART 8
+
+size_t CanBusStats::encode(uint8_t part, uint8_t* out, size_t maxLen) const {
+  if (part == 0) {
+    if (maxLen < 23) return 0;
+    out[0] = DIAG_CMD_BUS_STATS;
+    out[1] = 0;
+    memcpy(out + 2, &loadPermille, 2);
+    memcpy(out + 4, &framesPerSec, 4);
+    memcpy(out + 8, &bitsPerSec, 4);
+    memcpy(out + 12, &errorFramesPerSec, 4);
+    out[16] = lastRec;
+    out[17] = lastTec;
+    out[18] = lastEflg;
+    memcpy(out + 19, &lostFramesPerSec, 4);
+    return 23;
+  }
+
+  uint8_t first = (part - 1) * BUS_STATS_IDS_PER_PART;
+  if (first >= idTableCount) return 0;
+  uint8_t count = min<uint8_t>(BUS_STATS_IDS_PER_PART, idTableCount - first);
+  if (maxLen < 3 + count * 10U) return 0;
+
+  out[0] = DIAG_CMD_BUS_STATS;
+  out[1] = part;
+  out[2] = count;
+  for (uint8_t i = 0; i < count; i++) {
+    const CanIdStat& entry = idTable[first + i];
+    uint8_t* p = out + 3 + i * 10;
+    memcpy(p, &entry.id, 4);
+    memcpy(p + 4, &entry.rate, 2);
+    memcpy(p + 6, &entry.total, 4);
+  }
+  return 3 + count * 10;
+}
@@ -0,0 +1,80 @@
+#ifndef CAN_BUS_STATS_H
+#define CAN_BUS_STATS_H
+
+#include "project_config.h"
+#include <ACAN2515_CANMessage.h>
+
+// ============================================================================
+// CAN总线负载统计
+// ============================================================================
+// 每帧按DLC和实际位填充计算总线位数，按窗口汇总为负载率。
+// 接收帧在驱动读出RXB时计入 (不论主循环是否来得及处理)，驱动接收缓冲区满
+// 丢弃的帧同样计入; MCP2515硬件溢出丢失的帧按窗口平均帧长估算。
+// 每ID计数用固定大小的top-K表 (space-saving算法)，表满时替换计数最小的ID。
+
+struct CanIdStat {
+  uint32_t id;           // bit 31 = 扩展帧
+  uint32_t total;        // 累计帧数 (被替换的条目会继承最小计数)
+  uint16_t windowCount;  // 当前窗口帧数
+  uint16_t rate;         // 上一窗口帧率 (帧/秒)
+};
+
+class CanBusStats {
+public:
+  // 驱动接收回调 (ACAN2515中断任务) 和本机TX都调用，lost = 驱动接收缓冲区满被丢弃
+  void onFrame(const CANMessage& frame, bool lost = false);
+
+  // 窗口结束时由CanManager调用，传入MCP2515错误计数器和累计硬件溢出次数
+  bool windowDue(uint32_t nowMs) const {
+    return nowMs - windowStartMs >= BUS_STATS_WINDOW_MS;
+  }
+  void closeWindow(uint32_t nowMs, uint8_t rec, uint8_t tec, uint8_t eflg, uint32_t rxOverflows);
+
+  // CanManager初始化后设置实际使用的波特率
+  void setBitrate(uint32_t bitrate) { this->bitrate = bitrate; }
+
+  // 上一窗口的负载 (千分比)
+  uint16_t busLoadPermille() const { return loadPermille; }
+  bool isSaturated() const { return loadPermille >= BUS_LOAD_SATURATED_PERMILLE; }
+
+  // 总线饱和时变量请求之间的额外间隔
+  uint32_t pollBackoffMs() const;
+
+  // 诊断输出
+  void dump(Print& out) const;
+  size_t encode(uint8_t part, uint8_t* out, size_t maxLen) const;
+
+  static uint16_t frameBitLength(const CANMessage& frame);
+
+private:
+  CanIdStat idTable[BUS_STATS_TOP_K] = {};
+  uint8_t idTableCount = 0;
+
+  uint32_t bitrate = CAN_BITRATE;
+  uint32_t windowStartMs = 0;
+  uint32_t windowBits = 0;
+  uint32_t windowFrames = 0;
+  uint32_t windowLostFrames = 0;
+
+  // 上一窗口结果
+  uint16_t loadPermille = 0;
+  uint32_t framesPerSec = 0;
+  uint32_t bitsPerSec = 0;
+  uint32_t errorFramesPerSec = 0;
+  uint32_t totalErrorFrames = 0;
+  uint32_t lostFramesPerSec = 0;
+  uint32_t totalLostFrames = 0;
+
+  uint8_t lastRec = 0;
+  uint8_t lastTec = 0;
+  uint8_t lastEflg = 0;
+  uint32_t lastRxOverflows = 0;
+
+  portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+  CanIdStat* findOrInsert(uint32_t key);
+};
+
+extern CanBusStats canBusStats;
+
+#endif  // CAN_BUS_STATS_H
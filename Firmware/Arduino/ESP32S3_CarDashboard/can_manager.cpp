@@ -1,44 +1,46 @@
 #include "can_manager.h"
 #include "ble_manager.h"
+#include "can_bus_stats.h"
+#include "var_poller.h"
+#include "var_cache.h"
+#include "dbc_decoder.h"
+#include "latency_stats.h"
+#include "config_store.h"
 
 
 // 全局CAN管理器实例
 CanManager canManager;
 
 // 辅助函数定义（放在CPP文件中）
+// ESP32为小端: 大端字节序转换是一次memcpy加一条字节交换指令
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "big-endian helpers assume a little-endian host");
+
 void writeInt32BigEndian(int32_t value, uint8_t* out) {
-  out[0] = (uint8_t)((value >> 24) & 0xFF);
-  out[1] = (uint8_t)((value >> 16) & 0xFF);
-  out[2] = (uint8_t)((value >> 8) & 0xFF);
-  out[3] = (uint8_t)(value & 0xFF);
+  uint32_t raw = __builtin_bswap32((uint32_t)value);
+  memcpy(out, &raw, sizeof(raw));
 }
 
 int32_t readInt32BigEndian(const uint8_t* in) {
-  return ((int32_t)in[0] << 24) | ((int32_t)in[1] << 16) | ((int32_t)in[2] << 8) | (int32_t)in[3];
+  uint32_t raw;
+  memcpy(&raw, in, sizeof(raw));
+  return (int32_t)__builtin_bswap32(raw);
 }
 
 float readFloat32BigEndian(const uint8_t* in) {
-  union {
-    float f;
-    uint32_t u;
-  } converter;
-
-  converter.u = ((uint32_t)in[0] << 24) | ((uint32_t)in[1] << 16) | ((uint32_t)in[2] << 8) | (uint32_t)in[3];
+  uint32_t raw;
+  memcpy(&raw, in, sizeof(raw));
+  raw = __builtin_bswap32(raw);
 
-  return converter.f;
+  float value;
+  memcpy(&value, &raw, sizeof(value));
+  return value;
 }
 
 void writeFloat32BigEndian(float value, uint8_t* out) {
-  union {
-    float f;
-    uint32_t u;
-  } converter;
-
-  converter.f = value;
-  out[0] = (uint8_t)((converter.u >> 24) & 0xFF);
-  out[1] = (uint8_t)((converter.u >> 16) & 0xFF);
-  out[2] = (uint8_t)((converter.u >> 8) & 0xFF);
-  out[3] = (uint8_t)(converter.u & 0xFF);
+  uint32_t raw;
+  memcpy(&raw, &value, sizeof(raw));
+  raw = __builtin_bswap32(raw);
+  memcpy(out, &raw, sizeof(raw));
 }
 
 // ============================================================================
@@ -52,94 +54,299 @@ bool CanManager::init() {
   Serial.println("CAN Manager: Initializing MCP2515...");
 
   SPI.begin();
+  txEnabled = false;
 
-  ACAN2515Settings settings(QUARTZ_FREQUENCY, 500UL * 1000UL);  // 500 kbps
-  settings.mRequestedMode = ACAN2515Settings::NormalMode;
+  // 自动波特率时先以只听模式启动，从上次检测到的波特率开始尝试
+  const bool autobaud = configStore.get().canBitrate == CAN_BITRATE_AUTO;
+  uint32_t bitrate = configStore.get().canBitrate;
+  if (autobaud) bitrate = configStore.detectedBitrate() != 0 ? configStore.detectedBitrate() : CAN_BITRATE;
+
+  ACAN2515Settings settings(QUARTZ_FREQUENCY, bitrate);
+  settings.mRequestedMode = autobaud ? ACAN2515Settings::ListenOnlyMode : ACAN2515Settings::NormalMode;
+
+  // 每个类别独立排队，TXB优先级 = 类别值 + 1 (TXB2=3 最高)
+  settings.mTransmitBuffer0Size = CAN_TX_BUFFER_SET;
+  settings.mTransmitBuffer1Size = CAN_TX_BUFFER_REQUEST;
+  settings.mTransmitBuffer2Size = CAN_TX_BUFFER_BUTTON;
+  settings.mTXBPriority = ((CAN_TX_BUTTON + 1) << 4) | ((CAN_TX_REQUEST + 1) << 2) | (CAN_TX_SET + 1);
+  can.setTransmitDelayCallBack(onTransmitDelay);
+  can.setReceiveCallBack(onReceive);
 
   const uint16_t errorCode = can.begin(settings, [] {
     canManager.can.isr();
   });
 
-  if (errorCode == 0) {
-    Serial.println("CAN Manager: Initialized successfully at 500kbps");
-    return true;
-  } else {
+  if (errorCode != 0) {
     Serial.print("CAN Manager: Initialization error 0x");
     Serial.println(errorCode, HEX);
     return false;
   }
+
+  if (autobaud) {
+    // 检测在CAN任务 (processRx) 中进行，不阻塞启动
+    beginDetection(bitrate);
+    Serial.printf("CAN Manager: Initialized in listen-only mode, detecting bitrate from %lukbps\n",
+                  (unsigned long)(bitrate / 1000));
+    return true;
+  }
+
+  activeBitrate = bitrate;
+  canBusStats.setBitrate(bitrate);
+  txEnabled = true;
+  Serial.printf("CAN Manager: Initialized successfully at %lukbps\n", (unsigned long)(bitrate / 1000));
+  return true;
 }
 
-bool CanManager::sendCommand(uint8_t modifier, uint8_t firstKey, uint8_t secondKey) {
-  int retryCount = 5;
-  bool sentSuccessfully = false;
+// ============================================================================
+// 自动波特率
+// ============================================================================
+// 只听模式不发ACK和错误帧，波特率不对也不会干扰ECU。选定之前transmit()拒绝
+// 所有帧。一整轮都没有选定时，用NVS中上次检测到的波特率 (之前已验证过) 进入
+// 正常模式: ECU只回答本机的请求，总线上可能一直没有流量; 没有上次的结果时
+// 继续轮流监听。
+
+void CanManager::beginDetection(uint32_t first) {
+  // 先试上次的结果 (或默认值)，然后是其他晶振能产生的波特率 (8MHz下没有1Mbps)
+  probeRateCount = 0;
+  probeRates[probeRateCount++] = first;
+  for (uint32_t rate : CAN_AUTOBAUD_RATES) {
+    if (rate != first && ACAN2515Settings(QUARTZ_FREQUENCY, rate).mBitRateClosedToDesiredRate) {
+      probeRates[probeRateCount++] = rate;
+    }
+  }
 
-  uint8_t payload[5];
-  payload[0] = 0x5A;                       // 魔法字节
-  payload[1] = 0;                          // 保留
-  payload[2] = TS_HW_BUTTONBOX1_CATEGORY;  // 硬件按钮盒类别
-  payload[3] = secondKey & 0xff;           // 数据
-  payload[4] = firstKey & 0xff;            // 数据
+  txEnabled = false;
+  detecting = true;
+  probePasses = 0;
+  startProbe(0, millis());
+}
 
-  Serial.printf("Sending CAN frame: secondKey=%02X, firstKey=%02X\n", secondKey, firstKey);
+void CanManager::startProbe(uint8_t index, uint32_t nowMs) {
+  if (index >= probeRateCount) {
+    if (probePasses < 0xFF) probePasses++;
+    const uint32_t cached = configStore.detectedBitrate();
+    if (cached != 0 && goLive(cached)) {
+      logMessage("CAN Manager: No traffic detected, using last detected " + String(cached / 1000) + "kbps");
+      return;
+    }
+    if (probePasses == 1) logMessage("CAN Manager: No traffic detected, staying in listen-only mode");
+    index = 0;
+  }
 
-  CANMessage frame;
-  frame.id = CANBUS_BUTTONBOX_ADDRESS;
-  frame.ext = false;
-  frame.rtr = false;
-  frame.len = 5;
-  memcpy(frame.data, payload, 5);
+  probeIndex = index;
+  const uint32_t rate = probeRates[index];
+  ACAN2515Settings settings(QUARTZ_FREQUENCY, rate);
+  settings.mRequestedMode = ACAN2515Settings::ListenOnlyMode;
+  if (can.changeBitRateOnTheFly(settings) != 0) {
+    // 控制器没有进入该波特率: 窗口内不会收到帧，自然换下一个
+    logMessage("CAN Manager: Failed to switch to " + String(rate / 1000) + "kbps");
+  }
+
+  canBusStats.setBitrate(rate);
+  probeStartMs = nowMs;
+  probeFrames = 0;
+  probeRec = can.receiveErrorCounter();
+}
 
-  while (retryCount > 0) {
-    Serial.println("Retry sending CAN frame...");
-    delay(10);
-    retryCount--;
+void CanManager::updateProbe(uint32_t nowMs) {
+  if (nowMs - probeStartMs < CAN_AUTOBAUD_WINDOW_MS) return;
+
+  // 每个接收错误使REC加1，每个有效帧减1，按整个窗口的净变化判断:
+  // 波特率不对时几乎全是CRC/填充错误，REC上升; 波特率正确但没有其他节点应答时，
+  // ECU先以错误帧重发 (REC上升)，变为错误被动后同一帧被正常收到 (REC回落)。
+  // 所以只有错误多于有效帧时才放弃该波特率，单纯的ACK错误不会
+  const uint32_t rate = probeRates[probeIndex];
+  const uint8_t rec = can.receiveErrorCounter();
+  const bool clean = rec <= probeRec;
+  if (probeFrames < CAN_AUTOBAUD_MIN_FRAMES || !clean) {
+    if (probePasses == 0) {
+      logMessage("CAN Manager: " + String(rate / 1000) + "kbps: " + String(probeFrames) + " frames, REC " +
+                 String(probeRec) + " -> " + String(rec));
+    }
+    startProbe(probeIndex + 1, nowMs);
+    return;
   }
 
-  if (!sentSuccessfully) {
-    Serial.println("Failed to send CAN frame after retries");
+  if (!goLive(rate)) {
+    startProbe(probeIndex, nowMs);
+    return;
   }
+  configStore.saveDetectedBitrate(rate);
+  logMessage("CAN Manager: Detected " + String(rate / 1000) + "kbps (" + String(probeFrames) +
+             " frames), transmit enabled");
+}
 
-  return sentSuccessfully;
+bool CanManager::goLive(uint32_t bitrate) {
+  ACAN2515Settings settings(QUARTZ_FREQUENCY, bitrate);
+  settings.mRequestedMode = ACAN2515Settings::NormalMode;
+  if (can.changeBitRateOnTheFly(settings) != 0) {
+    logMessage("CAN Manager: Failed to enter normal mode at " + String(bitrate / 1000) + "kbps");
+    return false;
+  }
+
+  detecting = false;
+  activeBitrate = bitrate;
+  canBusStats.setBitrate(bitrate);
+  txEnabled = true;
+  return true;
 }
 
+bool CanManager::queueButtonFrame(uint16_t buttonMask, uint32_t reportMicros) {
+  PendingCommand cmd;
+  buildButtonFrame(buttonMask, cmd.frame);
+  cmd.reportMicros = reportMicros;
+  cmd.deadlineMs = millis() + USB_CAN_TX_DEADLINE_MS;
 
-void CanManager::processRx() {
-  CANMessage frame;
-  uint8_t rxCount = 0;
-  const uint8_t maxRxPerLoop = 10;
+  if (!commandQueue.push(cmd)) {
+    commandDropCount++;
+    return false;
+  }
+  if (task != nullptr) xTaskNotifyGive(task);
+  return true;
+}
 
-  while (rxCount < maxRxPerLoop && can.receive(frame)) {
+uint32_t CanManager::service() {
+  // 先处理接收: 响应立即完成在途请求并发出下一个，轮询只需处理超时和批次边界
+  processRx();
+  if (pollHandler != nullptr) pollHandler();
+  const bool txPending = processTx();
+  return txPending || varPoller.isActive() ? CAN_TASK_RETRY_MS : CAN_TASK_IDLE_MS;
+}
+
+bool CanManager::processTx() {
+  PendingCommand* cmd;
+  if (!txEnabled) {
+    // 波特率检测完成前的按键不补发
+    while ((cmd = commandQueue.front()) != nullptr) {
+      commandDropCount++;
+      commandQueue.pop();
+    }
+    return false;
+  }
+
+  // 按顺序发送; tryToSend只在按钮类的驱动发送缓冲区满时失败，
+  // 由CAN任务在 CAN_TASK_RETRY_MS 后重试，直到期限
+  while ((cmd = commandQueue.front()) != nullptr) {
+    if (transmit(cmd->frame, CAN_TX_BUTTON)) {
+      // 不逐帧打印: 串口输出会阻塞CAN任务，发送延迟见延迟统计 (LAT_USB_TO_CAN)
+      latencyStats.recordSince(LAT_USB_TO_CAN, cmd->reportMicros);
+    } else if ((int32_t)(millis() - cmd->deadlineMs) < 0) {
+      return true;
+    } else {
+      commandDropCount++;
+      Serial.println("CAN TX: USB button frame dropped after retries");
+    }
+    commandQueue.pop();
+  }
+  return false;
+}
+
+void CanManager::processRx() {
+  const CANMessage* frame;
+  uint16_t rxCount = 0;
+  // 每轮排空驱动接收缓冲区; 上限为缓冲区大小，处理期间持续到达的帧留到下一轮
+  const uint16_t maxRxPerLoop = can.receiveBufferSize();
+
+  // 直接在驱动接收缓冲区的槽位上处理，不复制CANMessage; 处理完再释放槽位。
+  // 时间戳是驱动从RXB读出帧的时刻，不受本任务何时处理的影响
+  uint32_t rxMicros;
+  while (rxCount < maxRxPerLoop && (frame = can.peekReceivedMessage(rxMicros)) != nullptr) {
     rxCount++;
     canRxCount++;
-    handleReceivedFrame(frame);
+    handleReceivedFrame(*frame, rxMicros);
+    can.releaseReceivedMessage();
+  }
+
+  uint32_t now = millis();
+  if (detecting) {
+    // 只听模式下收到的帧都通过了CRC校验
+    probeFrames += rxCount;
+    updateProbe(now);
+  }
+
+  if (canBusStats.windowDue(now)) {
+    canBusStats.closeWindow(now, can.receiveErrorCounter(), can.transmitErrorCounter(), can.errorFlagRegister(),
+                            can.receiveOverflowCount());
   }
 }
 
-void CanManager::handleReceivedFrame(const CANMessage& frame) {
-  // 调试输出
-  Serial.print("CAN RX - ID: 0x");
-  Serial.print(frame.id, HEX);
-  Serial.print(", Len: ");
-  Serial.print(frame.len);
-  Serial.print(", Data: ");
-  for (int i = 0; i < frame.len; i++) {
-    Serial.print(frame.data[i], HEX);
-    Serial.print(" ");
+bool CanManager::transmit(CANMessage& frame, CanTxClass txClass) {
+  if (!txEnabled) {
+    txGatedCount++;
+    return false;
   }
-  Serial.println();
 
-  // 检查是否为ECU的变量响应
-  if (frame.id == (CAN_VAR_RESPONSE_BASE + ECU_ID) && frame.len >= 8) {
-    if (rxCallback) {
-      rxCallback(frame.data, frame.len);
-    }
+  frame.idx = txClass;
+  if (!can.tryToSend(frame)) {
+    txRejectCount[txClass]++;
+    return false;
   }
+
+  canTxCount++;
+  canBusStats.onFrame(frame);
+  return true;
 }
 
-bool CanManager::sendButtonFrame(uint16_t buttonMask) {
-  CANMessage frame;
-  frame.id = CANBUS_BUTTONBOX_ADDRESS;
+// ACAN2515中断任务中调用: 从RXB读出的每一帧都计入负载，包括缓冲区满被丢弃的帧;
+// 唤醒CAN任务处理。这里不能发送 (驱动正持有SPI)
+void CanManager::onReceive(const CANMessage& frame, bool stored) {
+  canBusStats.onFrame(frame, !stored);
+  if (stored && canManager.task != nullptr) xTaskNotifyGive(canManager.task);
+}
+
+// ACAN2515中断任务中调用: 帧装入TXB前在驱动缓冲区中等待的时间
+void CanManager::onTransmitDelay(uint8_t txb, uint32_t delayUs) {
+  static const LatencyChannel channels[CAN_TX_CLASS_COUNT] = { LAT_TXQ_SET, LAT_TXQ_REQUEST, LAT_TXQ_BUTTON };
+  if (txb < CAN_TX_CLASS_COUNT) latencyStats.record(channels[txb], delayUs);
+}
+
+void CanManager::dumpTxQueues(Print& out) {
+  static const char* const names[CAN_TX_CLASS_COUNT] = { "set", "request", "button" };
+  for (int8_t c = CAN_TX_CLASS_COUNT - 1; c >= 0; c--) {
+    out.printf("txb%d %-7s queued=%u peak=%u/%u rejected=%lu\n", c, names[c],
+               can.transmitBufferCount(c), can.transmitBufferPeakCount(c), can.transmitBufferSize(c),
+               (unsigned long)txRejectCount[c].load());
+    can.resetTransmitBufferPeakCount(c);
+  }
+  if (detecting) {
+    out.printf("listen-only: probing %lukbps, %lu frames refused\n", (unsigned long)(probeRates[probeIndex] / 1000),
+               (unsigned long)txGatedCount.load());
+  }
+}
+
+void CanManager::handleReceivedFrame(const CANMessage& frame, uint32_t rxMicros) {
+  rxTypeCount[dispatch(frame, rxMicros)]++;
+}
+
+CanRxType CanManager::dispatch(const CANMessage& frame, uint32_t rxMicros) {
+#if DBC_DECODER_ENABLED
+  // ECU广播帧: 按信号表解码到变量缓存
+  if (dbcDecoder.decode(frame, millis()) > 0) return CAN_RX_BROADCAST;
+#endif
+
+  // 某个ECU的变量响应 (0x720 + ecuId)，按ID路由到对应通道
+  uint32_t ecuId = frame.id - configStore.get().canVarResponseBase;  // ID低于基址时回绕为大数
+  if (!frame.ext && ecuId <= 0xFF && varPoller.hasEcu(ecuId) && frame.len >= VAR_RESPONSE_SIZE) {
+    onVarResponse(frame, ecuId, rxMicros);
+    return CAN_RX_VAR_RESPONSE;
+  }
+
+  return CAN_RX_OTHER;
+}
+
+void CanManager::onVarResponse(const CANMessage& frame, uint8_t ecuId, uint32_t rxMicros) {
+  // 本机在途请求的响应: VarPoller保存条目并立即发出该通道的下一个请求，
+  // 所有通道完成后 BleManager::updatePolling() 在同一次唤醒中发送批量响应，不等超时
+  if (varPoller.onResponse(ecuId, frame.data, frame.len, rxMicros)) return;
+
+#if VAR_SNIFF_ENABLED
+  // 其他工具请求得到的响应: 记入缓存，之后的批量请求可免发
+  varCache.store(ecuId, frame.data, millis());
+#endif
+}
+
+void CanManager::buildButtonFrame(uint16_t buttonMask, CANMessage& frame) {
+  frame.id = configStore.get().canButtonboxAddress;
   frame.ext = false;
   frame.rtr = false;
   frame.len = 5;
@@ -149,9 +356,13 @@ bool CanManager::sendButtonFrame(uint16_t buttonMask) {
   frame.data[2] = TS_HW_BUTTONBOX1_CATEGORY;
   frame.data[3] = static_cast<uint8_t>((buttonMask >> 8) & 0xFF);
   frame.data[4] = static_cast<uint8_t>(buttonMask & 0xFF);
+}
 
-  if (can.tryToSend(frame)) {
-    canTxCount++;
+bool CanManager::sendButtonFrame(uint16_t buttonMask) {
+  CANMessage frame;
+  buildButtonFrame(buttonMask, frame);
+
+  if (transmit(frame, CAN_TX_BUTTON)) {
     Serial.printf("CAN TX: Button frame 0x%04X sent\n", buttonMask);
     return true;
   }
@@ -160,28 +371,22 @@ bool CanManager::sendButtonFrame(uint16_t buttonMask) {
   return false;
 }
 
-bool CanManager::requestVariable(int32_t varHash) {
+bool CanManager::requestVariable(uint8_t ecuId, int32_t varHash) {
   CANMessage frame;
-  frame.id = CAN_VAR_REQUEST_BASE + ECU_ID;
+  frame.id = configStore.get().canVarRequestBase + ecuId;
   frame.ext = false;
   frame.rtr = false;
   frame.len = 4;
 
   writeInt32BigEndian(varHash, frame.data);
 
-  if (can.tryToSend(frame)) {
-    canTxCount++;
-    Serial.printf("CAN TX: Variable request 0x%08X sent\n", varHash);
-    return true;
-  }
-
-  Serial.println("CAN TX: Failed to send variable request");
-  return false;
+  // 不打印: 每个请求都在CAN任务中发出，失败计入 txRejectCount 并由VarPoller重试
+  return transmit(frame, CAN_TX_REQUEST);
 }
 
 bool CanManager::sendVariableToEcu(int32_t varHash, float value) {
   CANMessage frame;
-  frame.id = CAN_GPS_DATA_BASE + ECU_ID;
+  frame.id = configStore.get().canGpsDataBase + configStore.get().ecuId;
   frame.ext = false;
   frame.rtr = false;
   frame.len = 8;
@@ -189,16 +394,11 @@ bool CanManager::sendVariableToEcu(int32_t varHash, float value) {
   writeInt32BigEndian(varHash, frame.data);
   writeFloat32BigEndian(value, frame.data + 4);
 
-  if (can.tryToSend(frame)) {
-    canTxCount++;
-    Serial.printf("CAN TX: Variable 0x%08X = %.2f sent to ECU\n", varHash, value);
-    return true;
-  }
-
-  Serial.println("CAN TX: Failed to send variable to ECU");
-  return false;
+  // 不打印: 滑块拖动时每秒上百帧，失败计入 txRejectCount 并由VarSetPipeline重试
+  return transmit(frame, CAN_TX_SET);
 }
 
-void CanManager::setRxCallback(void (*callback)(const uint8_t* data, uint8_t len)) {
-  rxCallback = callback;
+void CanManager::dumpRxTypes(Print& out) {
+  out.printf("rx var=%lu broadcast=%lu other=%lu\n", (unsigned long)rxTypeCount[CAN_RX_VAR_RESPONSE],
+             (unsigned long)rxTypeCount[CAN_RX_BROADCAST], (unsigned long)rxTypeCount[CAN_RX_OTHER]);
 }
\ No newline at end of file
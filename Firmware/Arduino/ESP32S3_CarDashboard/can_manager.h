@@ -4,33 +4,105 @@
 #include "project_config.h"
 #include <ACAN2515.h>
 #include <SPI.h>
+#include "spsc_queue.h"
+
+// 发送类别 = MCP2515发送缓冲区编号 = 硬件优先级 (TXP)
+// 多个TXB同时待发时，MCP2515先发TXP高的
+enum CanTxClass : uint8_t {
+  CAN_TX_SET = 0,      // TXB0: GPS/ADC变量设置
+  CAN_TX_REQUEST = 1,  // TXB1: 变量请求
+  CAN_TX_BUTTON = 2,   // TXB2: 按钮帧
+  CAN_TX_CLASS_COUNT
+};
+
+// 接收帧类型: handleReceivedFrame按类型分发到对应的处理函数并计数
+enum CanRxType : uint8_t {
+  CAN_RX_VAR_RESPONSE = 0,  // 0x720 + ecuId: 变量响应 -> VarPoller / 变量缓存
+  CAN_RX_BROADCAST,         // dbc_signals.h 中的ECU广播帧 -> DbcDecoder
+  CAN_RX_OTHER,             // 不处理
+  CAN_RX_TYPE_COUNT
+};
 
 class CanManager {
 public:
   // 构造函数和初始化
   CanManager();
   bool init();
-    //发送USB信息
-  bool sendCommand(uint8_t modifier, uint8_t firstKey, uint8_t secondKey);
+  // USB按钮帧入队并唤醒CAN任务 (不阻塞，可在USB任务中调用)，队列满返回false
+  bool queueButtonFrame(uint16_t buttonMask, uint32_t reportMicros);
+  // 入队和收到帧时唤醒的任务 (见 ESP32S3_CarDashboard.ino 中的CAN任务)
+  void setTask(TaskHandle_t task) { this->task = task; }
+  // 变量轮询 (开始一轮、超时、发送批量响应)，CAN任务中紧接着接收处理调用
+  void setPollHandler(void (*handler)()) { pollHandler = handler; }
+
+  // CAN任务每次唤醒调用: 接收、轮询、发送，返回到下一次唤醒最多等待的毫秒数
+  uint32_t service();
+
+  // 发送排队的USB按钮帧; 返回true表示还有帧在等待发送缓冲区
+  bool processTx();
 
   // CAN发送功能
   bool sendButtonFrame(uint16_t buttonMask);
-  bool requestVariable(int32_t varHash);
+  bool requestVariable(uint8_t ecuId, int32_t varHash);
   bool sendVariableToEcu(int32_t varHash, float value);
 
-  // CAN接收处理
+  // CAN接收处理; 自动波特率检测也在这里推进
   void processRx();
 
-  // 设置数据回调函数
-  void setRxCallback(void (*callback)(const uint8_t* data, uint8_t len));
+  // 自动波特率检测完成前为false: 控制器处于只听模式，不发送任何帧
+  bool isTransmitEnabled() const { return txEnabled; }
+
+  // 统计信息
+  uint32_t getCommandDropCount() const { return commandDropCount; }
+  void dumpTxQueues(Print& out);
+  void dumpRxTypes(Print& out);
+  uint32_t getBitrate() const { return activeBitrate; }  // 检测完成前为0
 
 private:
+  struct PendingCommand {
+    CANMessage frame;
+    uint32_t reportMicros;  // USB报告到达时间，用于延迟统计
+    uint32_t deadlineMs;
+  };
+
   ACAN2515 can;
-  uint32_t canTxCount = 0;
+  TaskHandle_t task = nullptr;
+  void (*pollHandler)() = nullptr;
+  SpscQueue<PendingCommand, USB_CAN_QUEUE_SIZE> commandQueue;
+  // 发送计数在主循环、CAN任务和BLE任务 (sendButtonFrame) 中都会递增
+  std::atomic<uint32_t> canTxCount{ 0 };
   uint32_t canRxCount = 0;
-  void (*rxCallback)(const uint8_t* data, uint8_t len) = nullptr;
+  std::atomic<uint32_t> commandDropCount{ 0 };
+  uint32_t rxTypeCount[CAN_RX_TYPE_COUNT] = {};
+  uint32_t activeBitrate = 0;
+
+  std::atomic<uint32_t> txRejectCount[CAN_TX_CLASS_COUNT] = {};  // 驱动缓冲区满
+  std::atomic<uint32_t> txGatedCount{ 0 };                        // 检测波特率期间拒绝的帧
+
+  // 自动波特率: 只听模式下在CAN任务中轮流监听各波特率，直到某个窗口内收到足够的
+  // 有效帧且接收错误没有多于有效帧，才切换到正常模式并允许发送
+  std::atomic<bool> txEnabled{ false };  // BLE任务 (sendButtonFrame) 也会读取
+  bool detecting = false;
+  uint32_t probeRates[1 + sizeof(CAN_AUTOBAUD_RATES) / sizeof(CAN_AUTOBAUD_RATES[0])];
+  uint8_t probeRateCount = 0;
+  uint8_t probeIndex = 0;
+  uint8_t probePasses = 0;  // 完整尝试过的轮数，之后不再逐个打印结果
+  uint32_t probeStartMs = 0;
+  uint16_t probeFrames = 0;
+  uint8_t probeRec = 0;  // 窗口开始时的REC
+
+  void beginDetection(uint32_t first);
+  void startProbe(uint8_t index, uint32_t nowMs);
+  void updateProbe(uint32_t nowMs);
+  bool goLive(uint32_t bitrate);
 
-  void handleReceivedFrame(const CANMessage& frame);
+  static void buildButtonFrame(uint16_t buttonMask, CANMessage& frame);
+  static void onReceive(const CANMessage& frame, bool stored);
+  static void onTransmitDelay(uint8_t txb, uint32_t delayUs);
+  void handleReceivedFrame(const CANMessage& frame, uint32_t rxMicros);
+  CanRxType dispatch(const CANMessage& frame, uint32_t rxMicros);
+  void onVarResponse(const CANMessage& frame, uint8_t ecuId, uint32_t rxMicros);
+  bool transmit(CANMessage& frame, CanTxClass txClass);
 };
 
 extern CanManager canManager;
@@ -0,0 +1,182 @@
+#include "config_store.h"
+#include <Preferences.h>
+#include <ACAN2515Settings.h>
+
+// 全局运行时配置实例
+ConfigStore configStore;
+
+struct ConfigKey {
+  uint8_t id;
+  const char* nvsKey;  // NVS键名最长15字符
+  uint32_t RuntimeConfig::*field;
+  uint32_t defaultValue;
+  uint32_t minValue;
+  uint32_t maxValue;
+  bool hot;  // 写入后立即生效
+};
+
+// 基址 + ecuId (最大0xFF) 仍须是11位标准ID
+static const ConfigKey CONFIG_KEYS[] = {
+  { CFG_CAN_BITRATE, "bitrate", &RuntimeConfig::canBitrate, CAN_AUTOBAUD ? CAN_BITRATE_AUTO : CAN_BITRATE, 0, 1000000,
+    false },
+  { CFG_ECU_ID, "ecu", &RuntimeConfig::ecuId, ECU_ID, 1, 0xFE, false },
+  { CFG_CAN_VAR_REQUEST_BASE, "reqBase", &RuntimeConfig::canVarRequestBase, CAN_VAR_REQUEST_BASE, 0, 0x700, true },
+  { CFG_CAN_VAR_RESPONSE_BASE, "rspBase", &RuntimeConfig::canVarResponseBase, CAN_VAR_RESPONSE_BASE, 0, 0x700, true },
+  { CFG_CAN_GPS_DATA_BASE, "gpsBase", &RuntimeConfig::canGpsDataBase, CAN_GPS_DATA_BASE, 0, 0x700, true },
+  { CFG_CAN_BUTTONBOX_ADDRESS, "btnAddr", &RuntimeConfig::canButtonboxAddress, CANBUS_BUTTONBOX_ADDRESS, 0, 0x7FF,
+    true },
+  { CFG_VAR_REQUEST_TIMEOUT_MS, "reqTmo", &RuntimeConfig::varRequestTimeoutMs, VAR_REQUEST_TIMEOUT_MS, 1, 5000, true },
+  { CFG_VAR_REQUEST_TIMEOUT_MIN_MS, "reqTmoMin", &RuntimeConfig::varRequestTimeoutMinMs, VAR_REQUEST_TIMEOUT_MIN_MS, 1,
+    5000, true },
+  { CFG_BLE_NOTIFY_MIN_INTERVAL_MS, "notifyIvl", &RuntimeConfig::bleNotifyMinIntervalMs, BLE_NOTIFY_MIN_INTERVAL_MS, 0,
+    1000, true },
+  { CFG_VAR_SNIFF_MAX_AGE_MS, "sniffAge", &RuntimeConfig::varSniffMaxAgeMs, VAR_SNIFF_MAX_AGE_MS, 0, 10000, true },
+  { CFG_VAR_SET_TX_RATE, "setRate", &RuntimeConfig::varSetTxRate, VAR_SET_TX_RATE, 10, 5000, true },
+};
+static const uint8_t CONFIG_KEY_COUNT = sizeof(CONFIG_KEYS) / sizeof(CONFIG_KEYS[0]);
+
+// 自动波特率结果，不属于可写配置项
+static const char* const DETECTED_BITRATE_KEY = "autoBitrate";
+
+static const ConfigKey* findKey(uint8_t id) {
+  for (const ConfigKey& key : CONFIG_KEYS) {
+    if (key.id == id) return &key;
+  }
+  return nullptr;
+}
+
+// 单项范围之外的约束
+static bool isValid(const RuntimeConfig& config) {
+  switch (config.canBitrate) {
+    case CAN_BITRATE_AUTO:
+      break;
+    case 125000:
+    case 250000:
+    case 500000:
+    case 1000000:
+      // 晶振必须能产生该波特率 (8MHz下没有1Mbps)，否则重启后CAN无法初始化
+      if (!ACAN2515Settings(QUARTZ_FREQUENCY, config.canBitrate).mBitRateClosedToDesiredRate) return false;
+      break;
+    default:
+      return false;
+  }
+
+  // VarPoller把 VAR_ECU_IDS 中的 ECU_ID 换成主ECU，不能与其他通道的ECU重复
+  for (uint8_t ecuId : VAR_ECU_IDS) {
+    if (ecuId != ECU_ID && config.ecuId == ecuId) return false;
+  }
+  return config.varRequestTimeoutMinMs <= config.varRequestTimeoutMs;
+}
+
+ConfigStore::ConfigStore() {
+  for (const ConfigKey& key : CONFIG_KEYS) {
+    active.*key.field = key.defaultValue;
+  }
+  stored = active;
+}
+
+void ConfigStore::begin() {
+  Preferences prefs;
+  if (!prefs.begin(CONFIG_NVS_NAMESPACE, true)) {
+    // 首次启动命名空间还不存在
+    logMessage("Config: No stored configuration, using defaults");
+    return;
+  }
+
+  RuntimeConfig loaded = active;
+  for (const ConfigKey& key : CONFIG_KEYS) {
+    uint32_t value = prefs.getUInt(key.nvsKey, key.defaultValue);
+    if (value >= key.minValue && value <= key.maxValue) loaded.*key.field = value;
+  }
+  lastDetectedBitrate = prefs.getUInt(DETECTED_BITRATE_KEY, 0);
+  prefs.end();
+
+  if (!isValid(loaded)) {
+    logMessage("Config: Stored configuration invalid, using defaults");
+    return;
+  }
+  active = loaded;
+  stored = loaded;
+  logMessage("Config: Loaded, CAN " +
+             (active.canBitrate == CAN_BITRATE_AUTO ? String("auto") : String(active.canBitrate / 1000) + "kbps") +
+             ", ECU " + String(active.ecuId));
+}
+
+bool ConfigStore::set(uint8_t id, uint32_t value) {
+  const ConfigKey* key = findKey(id);
+  if (key == nullptr || value < key->minValue || value > key->maxValue) return false;
+
+  RuntimeConfig candidate = stored;
+  candidate.*key->field = value;
+  if (!isValid(candidate)) return false;
+
+  Preferences prefs;
+  if (!prefs.begin(CONFIG_NVS_NAMESPACE, false)) return false;
+  bool ok = prefs.putUInt(key->nvsKey, value) == sizeof(value);
+  prefs.end();
+  if (!ok) return false;
+
+  stored.*key->field = value;
+  if (key->hot) active.*key->field = value;
+  return true;
+}
+
+bool ConfigStore::resetDefaults() {
+  Preferences prefs;
+  if (!prefs.begin(CONFIG_NVS_NAMESPACE, false)) return false;
+  bool ok = prefs.clear();
+  prefs.end();
+  if (!ok) return false;
+
+  for (const ConfigKey& key : CONFIG_KEYS) {
+    stored.*key.field = key.defaultValue;
+    if (key.hot) active.*key.field = key.defaultValue;
+  }
+  lastDetectedBitrate = 0;
+  return true;
+}
+
+void ConfigStore::saveDetectedBitrate(uint32_t bitrate) {
+  if (bitrate == lastDetectedBitrate) return;
+
+  Preferences prefs;
+  if (!prefs.begin(CONFIG_NVS_NAMESPACE, false)) return;
+  if (prefs.putUInt(DETECTED_BITRATE_KEY, bitrate) == sizeof(bitrate)) lastDetectedBitrate = bitrate;
+  prefs.end();
+}
+
+bool ConfigStore::rebootPending() const {
+  for (const ConfigKey& key : CONFIG_KEYS) {
+    if (active.*key.field != stored.*key.field) return true;
+  }
+  return false;
+}
+
+// ============================================================================
+// 诊断输出
+// ============================================================================
+
+size_t ConfigStore::encode(uint8_t* out, size_t maxLen) const {
+  const size_t recordSize = 6;
+  if (maxLen < 1 + CONFIG_KEY_COUNT * recordSize) return 0;
+
+  size_t len = 0;
+  out[len++] = CONFIG_VERSION;
+  for (const ConfigKey& key : CONFIG_KEYS) {
+    uint32_t value = stored.*key.field;
+    out[len++] = key.id;
+    out[len++] = active.*key.field != value ? 0x01 : 0x00;
+    memcpy(out + len, &value, sizeof(value));
+    len += sizeof(value);
+  }
+  return len;
+}
+
+void ConfigStore::dump(Print& out) const {
+  for (const ConfigKey& key : CONFIG_KEYS) {
+    uint32_t value = stored.*key.field;
+    out.printf("%2u %-10s %lu%s\n", key.id, key.nvsKey, (unsigned long)value,
+               active.*key.field != value ? " (after reboot)" : "");
+  }
+  out.printf("   detected   %lu\n", (unsigned long)lastDetectedBitrate);
+}
@@ -0,0 +1,75 @@
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+#include "project_config.h"
+
+// ============================================================================
+// 运行时配置 (NVS)
+// ============================================================================
+// project_config.h 中的常量作为默认值，NVS中保存的值在启动时一次性读入
+// RuntimeConfig，热路径直接读结构体字段，没有查找开销。
+// BLE配置特征写入 [id][值 u32 小端]... ，在主循环中校验并保存到NVS:
+// 可以安全热应用的项立即生效，波特率和主ECU重启后生效。
+
+enum ConfigKeyId : uint8_t {
+  CFG_CAN_BITRATE = 1,             // 重启，CAN_BITRATE_AUTO = 自动检测
+  CFG_ECU_ID = 2,                  // 重启
+  CFG_CAN_VAR_REQUEST_BASE = 3,
+  CFG_CAN_VAR_RESPONSE_BASE = 4,
+  CFG_CAN_GPS_DATA_BASE = 5,
+  CFG_CAN_BUTTONBOX_ADDRESS = 6,
+  CFG_VAR_REQUEST_TIMEOUT_MS = 7,
+  CFG_VAR_REQUEST_TIMEOUT_MIN_MS = 8,
+  CFG_BLE_NOTIFY_MIN_INTERVAL_MS = 9,
+  CFG_VAR_SNIFF_MAX_AGE_MS = 10,
+  CFG_VAR_SET_TX_RATE = 11,
+  CFG_RESET_DEFAULTS = 0xFF,  // 写入单字节 [0xFF]: 全部恢复默认
+};
+
+// 字段全部为u32，配置项表用成员指针统一读写
+struct RuntimeConfig {
+  uint32_t canBitrate;
+  uint32_t ecuId;
+  uint32_t canVarRequestBase;
+  uint32_t canVarResponseBase;
+  uint32_t canGpsDataBase;
+  uint32_t canButtonboxAddress;
+  uint32_t varRequestTimeoutMs;
+  uint32_t varRequestTimeoutMinMs;
+  uint32_t bleNotifyMinIntervalMs;
+  uint32_t varSniffMaxAgeMs;
+  uint32_t varSetTxRate;
+};
+
+class ConfigStore {
+public:
+  ConfigStore();
+
+  // setup()中最先调用: 从NVS读入，缺失或越界的项使用默认值
+  void begin();
+
+  const RuntimeConfig& get() const { return active; }
+
+  // 校验并保存一项，热应用的项立即生效; 未知项、越界或保存失败返回false
+  bool set(uint8_t id, uint32_t value);
+  // 清除NVS，所有项恢复默认 (需重启的项重启后生效)
+  bool resetDefaults();
+  bool rebootPending() const;
+
+  // 自动波特率上次检测到的结果，0 = 没有
+  uint32_t detectedBitrate() const { return lastDetectedBitrate; }
+  void saveDetectedBitrate(uint32_t bitrate);
+
+  // 配置特征的值: [版本] + 每项 [id][标志][值 u32 小端]，标志bit0 = 重启后生效
+  size_t encode(uint8_t* out, size_t maxLen) const;
+  void dump(Print& out) const;
+
+private:
+  RuntimeConfig active;  // 当前生效的值
+  RuntimeConfig stored;  // NVS中的值
+  uint32_t lastDetectedBitrate = 0;
+};
+
+extern ConfigStore configStore;
+
+#endif  // CONFIG_STORE_H
@@ -0,0 +1,119 @@
+#include "dbc_decoder.h"
+#include "dbc_signals.h"
+#include "var_cache.h"
+#include "config_store.h"
+
+// 全局广播解码器实例
+DbcDecoder dbcDecoder;
+
+static const uint32_t DBC_EXTENDED_FLAG = 0x80000000UL;
+
+static uint32_t frameKey(const CANMessage& frame) {
+  return frame.ext ? (frame.id | DBC_EXTENDED_FLAG) : frame.id;
+}
+
+bool DbcDecoder::init() {
+  return init(DBC_SIGNALS, sizeof(DBC_SIGNALS) / sizeof(DBC_SIGNALS[0]));
+}
+
+bool DbcDecoder::init(const DbcSignal* signals, size_t count) {
+  extractorCount = 0;
+
+  for (size_t n = 0; n < count; n++) {
+    const DbcSignal& signal = signals[n];
+    if (extractorCount >= DBC_MAX_SIGNALS) {
+      logMessage("DBC Decoder: More than DBC_MAX_SIGNALS signals, rest ignored");
+      break;
+    }
+
+    // Intel: 起始位即最低位。Motorola: 起始位为最高位 (锯齿编号)，
+    // 换算到数据按大端装入的64位字中
+    int16_t shift;
+    uint8_t lastByte;
+    if (signal.motorola) {
+      int16_t msb = (7 - signal.startBit / 8) * 8 + signal.startBit % 8;
+      shift = msb - (signal.length - 1);
+      lastByte = 7 - shift / 8;
+    } else {
+      shift = signal.startBit;
+      lastByte = (signal.startBit + signal.length - 1) / 8;
+    }
+
+    if (signal.length == 0 || signal.length > 32 || shift < 0 || shift + signal.length > 64) {
+      logMessage("DBC Decoder: Invalid signal for hash " + String(signal.varHash));
+      continue;
+    }
+
+    DbcExtractor& ex = extractors[extractorCount];
+    ex.key = signal.canId;
+    ex.shift = shift;
+    ex.minLen = lastByte + 1;
+    ex.motorola = signal.motorola;
+    ex.mask = signal.length == 32 ? 0xFFFFFFFFUL : (1UL << signal.length) - 1;
+    ex.signBit = signal.isSigned ? 1UL << (signal.length - 1) : 0;
+    ex.factor = signal.factor;
+    ex.offset = signal.offset;
+    // 信号表中的 ECU_ID 指运行时配置的主ECU
+    ex.ecuId = signal.ecuId == ECU_ID ? configStore.get().ecuId : signal.ecuId;
+    ex.varHash = signal.varHash;
+
+    // 按ID插入排序，同一ID的信号保持定义顺序
+    uint8_t i = extractorCount++;
+    while (i > 0 && extractors[i - 1].key > ex.key) {
+      DbcExtractor tmp = extractors[i - 1];
+      extractors[i - 1] = extractors[i];
+      extractors[i] = tmp;
+      i--;
+    }
+  }
+
+  logMessage("DBC Decoder: " + String(extractorCount) + " broadcast signals");
+  return extractorCount > 0;
+}
+
+uint8_t DbcDecoder::lowerBound(uint32_t key) const {
+  uint8_t lo = 0;
+  uint8_t hi = extractorCount;
+  while (lo < hi) {
+    uint8_t mid = (lo + hi) / 2;
+    if (extractors[mid].key < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+uint8_t DbcDecoder::decode(const CANMessage& frame, uint32_t nowMs) {
+  uint32_t key = frameKey(frame);
+  uint8_t i = lowerBound(key);
+  if (i >= extractorCount || extractors[i].key != key) return 0;
+
+  // ESP32为小端: 直接装入即Intel字，字节反转即Motorola字
+  uint64_t intel;
+  memcpy(&intel, frame.data, sizeof(intel));
+  uint64_t motorola = __builtin_bswap64(intel);
+
+  uint8_t decoded = 0;
+  for (; i < extractorCount && extractors[i].key == key; i++) {
+    const DbcExtractor& ex = extractors[i];
+    if (frame.len < ex.minLen) continue;
+
+    uint32_t raw = (uint32_t)((ex.motorola ? motorola : intel) >> ex.shift) & ex.mask;
+    float value = (ex.signBit & raw) ? (float)(int32_t)(raw | ~ex.mask) : (float)raw;
+
+    uint8_t entry[VAR_RESPONSE_SIZE];
+    writeInt32BigEndian(ex.varHash, entry);
+    writeFloat32BigEndian(value * ex.factor + ex.offset, entry + 4);
+    varCache.store(ex.ecuId, entry, nowMs);
+    decoded++;
+  }
+
+  decodedCount += decoded;
+  return decoded;
+}
+
+void DbcDecoder::dump(Print& out) const {
+  out.printf("DBC: %u signals, %lu values decoded\n", extractorCount, (unsigned long)decodedCount);
+}
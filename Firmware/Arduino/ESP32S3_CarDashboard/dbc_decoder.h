@@ -0,0 +1,54 @@
+#ifndef DBC_DECODER_H
+#define DBC_DECODER_H
+
+#include "project_config.h"
+#include <ACAN2515_CANMessage.h>
+
+// ============================================================================
+// ECU广播帧解码
+// ============================================================================
+// init() 把 dbc_signals.h 的信号定义编译成按CAN ID排序的提取表:
+// 每个信号只剩 (移位, 掩码, 符号位, 系数, 偏移)。收到一帧时二分查找ID，
+// 把8字节数据按Intel/Motorola各装成一个64位字，每个信号一次移位和掩码。
+// 解码结果写入变量缓存，批量请求中的这些变量直接从缓存返回。
+
+struct DbcSignal;  // dbc_signals.h
+
+struct DbcExtractor {
+  uint32_t key;       // CAN ID，扩展帧置位bit31
+  uint8_t shift;      // 在64位字中的最低位
+  uint8_t minLen;     // 帧至少需要的字节数
+  bool motorola;
+  uint32_t mask;
+  uint32_t signBit;   // 0 = 无符号
+  float factor;
+  float offset;
+  uint8_t ecuId;
+  int32_t varHash;
+};
+
+class DbcDecoder {
+public:
+  // 编译信号表 (默认为 dbc_signals.h 中的 DBC_SIGNALS)，定义有误的信号被跳过并记录日志
+  bool init();
+  bool init(const DbcSignal* signals, size_t count);
+
+  // 主循环: 解码一帧，返回写入缓存的值个数
+  uint8_t decode(const CANMessage& frame, uint32_t nowMs);
+
+  uint32_t getDecodedCount() const { return decodedCount; }
+
+  void dump(Print& out) const;
+
+private:
+  DbcExtractor extractors[DBC_MAX_SIGNALS];
+  uint8_t extractorCount = 0;
+
+  uint32_t decodedCount = 0;
+
+  uint8_t lowerBound(uint32_t key) const;
+};
+
+extern DbcDecoder dbcDecoder;
+
+#endif  // DBC_DECODER_H
@@ -0,0 +1,45 @@
+#ifndef DBC_SIGNALS_H
+#define DBC_SIGNALS_H
+
+#include "project_config.h"
+
+// ============================================================================
+// ECU广播信号 (DBC子集)
+// ============================================================================
+// 字段含义与DBC的 SG_ 行相同:
+//   SG_ name : startBit|length@byteOrder(1=Intel,0=Motorola)sign (factor,offset)
+// Motorola信号的起始位为最高位 (DBC约定)。CAN ID 的 bit31 置位表示扩展帧。
+// 默认表为 rusEFI verbose CAN (基址 CAN_BROADCAST_BASE，Intel字节序)，
+// 其他ECU或不同固件版本按其DBC修改。
+
+struct DbcSignal {
+  uint32_t canId;
+  uint8_t startBit;
+  uint8_t length;
+  bool motorola;
+  bool isSigned;
+  float factor;
+  float offset;
+  uint8_t ecuId;   // 写入缓存时归属的ECU
+  int32_t varHash;
+};
+
+static const DbcSignal DBC_SIGNALS[] = {
+  // BASE1: RPM u16, 点火角, 喷油/点火占空比, 车速
+  { CAN_BROADCAST_BASE + 1, 0, 16, false, false, 1.0f, 0.0f, ECU_ID, varHash("RPMValue") },
+  { CAN_BROADCAST_BASE + 1, 48, 8, false, false, 1.0f, 0.0f, ECU_ID, varHash("vehicleSpeedKph") },
+  // BASE2: 踏板, TPS1, TPS2 (0.01 %)
+  { CAN_BROADCAST_BASE + 2, 16, 16, false, true, 0.01f, 0.0f, ECU_ID, varHash("TPSValue") },
+  // BASE3: MAP (1/30 kPa), CLT, IAT (+40 °C)
+  { CAN_BROADCAST_BASE + 3, 0, 16, false, false, 1.0f / 30, 0.0f, ECU_ID, varHash("MAPValue") },
+  { CAN_BROADCAST_BASE + 3, 16, 8, false, false, 1.0f, -40.0f, ECU_ID, varHash("coolant") },
+  { CAN_BROADCAST_BASE + 3, 24, 8, false, false, 1.0f, -40.0f, ECU_ID, varHash("intake") },
+  // BASE4: 机油压力 (1/30 kPa), 电池电压 (mV)
+  { CAN_BROADCAST_BASE + 4, 16, 16, false, false, 1.0f / 30, 0.0f, ECU_ID, varHash("oilPressure") },
+  { CAN_BROADCAST_BASE + 4, 48, 16, false, false, 0.001f, 0.0f, ECU_ID, varHash("VBatt") },
+  // BASE7: Lambda1 (1/10000)，同一字段换算为汽油AFR
+  { CAN_BROADCAST_BASE + 7, 0, 16, false, false, 0.0001f, 0.0f, ECU_ID, varHash("lambdaValue") },
+  { CAN_BROADCAST_BASE + 7, 0, 16, false, false, 0.0001f * 14.7f, 0.0f, ECU_ID, varHash("AFRValue") },
+};
+
+#endif  // DBC_SIGNALS_H
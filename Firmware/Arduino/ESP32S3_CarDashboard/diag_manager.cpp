@@ -0,0 +1,109 @@
+#include "diag_manager.h"
+#include "latency_stats.h"
+#include "can_bus_stats.h"
+#include "var_poller.h"
+#include "var_cache.h"
+#include "dbc_decoder.h"
+#include "hid_button_map.h"
+#include "usb_capture.h"
+#include "var_set_pipeline.h"
+#include "can_manager.h"
+#include "ble_conn_tuner.h"
+#include "notify_packer.h"
+#include "ble_manager.h"
+#include "config_store.h"
+
+// 全局诊断管理器实例
+DiagManager diagManager;
+
+uint8_t DiagManager::commandForChar(char c) {
+  switch (c) {
+    case 'l': return DIAG_CMD_LATENCY;
+    case 'b': return DIAG_CMD_BUS_STATS;
+    case 't': return DIAG_CMD_TIMEOUTS;
+    case 'h': return DIAG_CMD_HID_MAP;
+    case 'k': return DIAG_CMD_BLE_LINK;
+    default: return 0;
+  }
+}
+
+void DiagManager::pollSerial() {
+  while (Serial.available() > 0) {
+    char c = (char)Serial.read();
+    uint8_t cmd = commandForChar(c);
+    if (cmd != 0) {
+      printReport(cmd, Serial);
+    } else if (c == 'c') {
+      usbCapture.setEnabled(!usbCapture.isEnabled());
+      Serial.printf("USB capture %s\n", usbCapture.isEnabled() ? "on" : "off");
+    } else if (c == 'p') {
+      usbCapture.exportPcap(Serial);
+    } else if (c == 'g') {
+      Serial.println("=== Config ===");
+      configStore.dump(Serial);
+    } else if (c == '?') {
+      Serial.println("Diag commands: l=latency b=bus t=timeouts h=hid k=ble link g=config c=usb capture on/off p=usb pcap");
+    }
+  }
+}
+
+void DiagManager::printReport(uint8_t cmd, Print& out) {
+  switch (cmd) {
+    case DIAG_CMD_LATENCY:
+      out.println("=== Latency (reset on read) ===");
+      latencyStats.dump(out);
+      break;
+    case DIAG_CMD_BUS_STATS:
+      out.println("=== CAN bus ===");
+      canBusStats.dump(out);
+      canManager.dumpTxQueues(out);
+      canManager.dumpRxTypes(out);
+      varSetPipeline.dump(out);
+      varCache.dump(out);
+      dbcDecoder.dump(out);
+      break;
+    case DIAG_CMD_TIMEOUTS:
+      out.println("=== Request timeout ===");
+      varPoller.dumpTimeouts(out);
+      break;
+    case DIAG_CMD_HID_MAP:
+      out.println("=== USB HID button map ===");
+      hidButtonMap.dump(out);
+      break;
+    case DIAG_CMD_BLE_LINK:
+      out.println("=== BLE link ===");
+      bleConnTuner.dump(out);
+      notifyPacker.dump(out);
+      bleManager.dumpFlowControl(out);
+      break;
+    default:
+      break;
+  }
+}
+
+size_t DiagManager::encodeReport(uint8_t cmd, uint8_t part, uint8_t* out, size_t maxLen) {
+  switch (cmd) {
+    case DIAG_CMD_LATENCY:
+      if (part >= LAT_CHANNEL_COUNT) return 0;
+      return latencyStats.encode((LatencyChannel)part, out, maxLen);
+    case DIAG_CMD_BUS_STATS:
+      return canBusStats.encode(part, out, maxLen);
+    case DIAG_CMD_TIMEOUTS:
+      return varPoller.encodeTimeouts(part, out, maxLen);
+    case DIAG_CMD_HID_MAP:
+      return part == 0 ? hidButtonMap.encode(out, maxLen) : 0;
+    case DIAG_CMD_BLE_LINK: {
+      // 每个连接一段，之后是notify统计 (0xFF) 和流控额度 (0xFE)
+      uint8_t links = bleConnTuner.linkCount();
+      if (part < links) return bleConnTuner.encode(part, out, maxLen);
+      if (part > links + 1 || maxLen < 2) return 0;
+      out[0] = DIAG_CMD_BLE_LINK;
+      out[1] = part == links ? 0xFF : 0xFE;
+      size_t len = part == links ? notifyPacker.encode(out + 2, maxLen - 2)
+                                 : bleManager.encodeFlowControl(out + 2, maxLen - 2);
+      return len > 0 ? len + 2 : 0;
+    }
+    default:
+      return 0;
+  }
+}
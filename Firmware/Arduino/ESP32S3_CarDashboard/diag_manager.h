@@ -0,0 +1,24 @@
+#ifndef DIAG_MANAGER_H
+#define DIAG_MANAGER_H
+
+#include "project_config.h"
+
+// 诊断报告分发: 串口 (文本) 和 BLE (二进制) 共用同一组命令
+class DiagManager {
+public:
+  // 处理串口单字符命令
+  void pollSerial();
+
+  // 文本报告
+  void printReport(uint8_t cmd, Print& out);
+
+  // BLE二进制报告: 按段生成，返回写入字节数，0 表示没有更多段
+  size_t encodeReport(uint8_t cmd, uint8_t part, uint8_t* out, size_t maxLen);
+
+private:
+  static uint8_t commandForChar(char c);
+};
+
+extern DiagManager diagManager;
+
+#endif  // DIAG_MANAGER_H
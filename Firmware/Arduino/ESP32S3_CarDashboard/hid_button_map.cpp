@@ -0,0 +1,451 @@
+#include "hid_button_map.h"
+
+// 全局HID按钮映射实例
+HidButtonMap hidButtonMap;
+
+// ============================================================================
+// 报告描述符解析状态
+// ============================================================================
+
+#define HID_GLOBAL_STACK_DEPTH 4
+#define HID_MAX_LOCAL_USAGES 16
+// LUT的字节偏移为uint8_t (含Report ID字节)，更长的报告之后的字段无法映射
+#define HID_MAX_REPORT_BITS ((0xFF + 1) * 8)
+
+struct HidGlobalState {
+  uint16_t usagePage = 0;
+  int32_t logicalMin = 0;
+  int32_t logicalMax = 0;
+  uint16_t reportSize = 0;   // Report Size / Report Count 可以是2字节项目
+  uint16_t reportCount = 0;
+  uint8_t reportId = 0;
+};
+
+struct HidLocalState {
+  uint32_t usages[HID_MAX_LOCAL_USAGES];  // 高16位为Usage Page
+  uint8_t usageCount = 0;
+  uint32_t usageMin = 0;
+  uint32_t usageMax = 0;
+  bool hasRange = false;
+};
+
+struct HidReportCursor {
+  uint8_t reportId;
+  uint16_t bitOffset;
+  bool overflow;  // 字段超出 HID_MAX_REPORT_BITS，之后的偏移不可信
+};
+
+namespace {
+
+uint32_t itemData(const uint8_t* p, uint8_t size) {
+  uint32_t value = 0;
+  for (uint8_t i = 0; i < size; i++) {
+    value |= (uint32_t)p[i] << (8 * i);
+  }
+  return value;
+}
+
+uint16_t clampU16(uint32_t value) {
+  return value > 0xFFFF ? 0xFFFF : (uint16_t)value;
+}
+
+int32_t itemDataSigned(const uint8_t* p, uint8_t size) {
+  uint32_t value = itemData(p, size);
+  if (size == 1) return (int8_t)value;
+  if (size == 2) return (int16_t)value;
+  return (int32_t)value;
+}
+
+// 局部Usage不足4字节时使用主项目时刻的Usage Page
+uint32_t fullUsage(uint32_t usage, uint8_t size, uint16_t usagePage) {
+  return size == 4 ? usage : ((uint32_t)usagePage << 16) | usage;
+}
+
+// 按 HID_BUTTON_RULES 查找按钮位，未映射返回-1
+int8_t buttonBitFor(uint32_t usage) {
+  uint16_t page = usage >> 16;
+  uint16_t id = usage & 0xFFFF;
+  for (size_t i = 0; i < sizeof(HID_BUTTON_RULES) / sizeof(HID_BUTTON_RULES[0]); i++) {
+    const HidButtonRule& rule = HID_BUTTON_RULES[i];
+    if (page == rule.usagePage && id >= rule.usageMin && id <= rule.usageMax) {
+      uint16_t bit = rule.firstBit + (id - rule.usageMin);
+      return bit < 16 ? (int8_t)bit : -1;
+    }
+  }
+  return -1;
+}
+
+// 数组值 index 对应的Usage
+bool arrayUsageAt(const HidLocalState& local, uint16_t index, uint32_t& usage) {
+  if (local.hasRange) {
+    if (local.usageMin + index > local.usageMax) return false;
+    usage = local.usageMin + index;
+    return true;
+  }
+  if (index >= local.usageCount) return false;
+  usage = local.usages[index];
+  return true;
+}
+
+// Variable字段第 index 个元素的Usage: Usage列表不够时沿用最后一个
+bool variableUsageAt(const HidLocalState& local, uint16_t index, uint32_t& usage) {
+  if (local.hasRange) return arrayUsageAt(local, index, usage);
+  if (local.usageCount == 0) return false;
+  usage = local.usages[index < local.usageCount ? index : local.usageCount - 1];
+  return true;
+}
+
+}  // namespace
+
+// ============================================================================
+// HidButtonMap 实现
+// ============================================================================
+
+uint8_t HidButtonMap::layoutFor(uint8_t deviceAddress, uint8_t interfaceNumber, uint8_t firstLayout, uint8_t reportId) {
+  for (uint8_t l = firstLayout; l < layoutCount; l++) {
+    if (layouts[l].reportId == reportId) return l;
+  }
+  if (layoutCount >= HID_MAP_MAX_REPORTS) return 0xFF;
+
+  layouts[layoutCount] = { deviceAddress, interfaceNumber, reportId, 0, 0, 0 };
+  return layoutCount++;
+}
+
+bool HidButtonMap::compileInput(uint8_t deviceAddress, uint8_t interfaceNumber, uint8_t firstLayout, uint8_t firstLut, uint32_t flags,
+                                const HidGlobalState& global, const HidLocalState& local,
+                                HidReportCursor* cursors, uint8_t& cursorCount) {
+  HidReportCursor* cursor = nullptr;
+  for (uint8_t c = 0; c < cursorCount; c++) {
+    if (cursors[c].reportId == global.reportId) cursor = &cursors[c];
+  }
+  if (cursor == nullptr) {
+    if (cursorCount >= HID_MAP_MAX_REPORTS) return false;
+    cursor = &cursors[cursorCount++];
+    *cursor = { global.reportId, 0, false };
+  }
+  if (cursor->overflow) return false;
+
+  // 超出可映射长度的字段拒绝编译，并停止该报告的后续字段，避免偏移回绕后映射到错误的字节
+  const uint16_t fieldStart = cursor->bitOffset;
+  const uint32_t fieldBits = (uint32_t)global.reportSize * global.reportCount;
+  if (fieldStart + fieldBits > HID_MAX_REPORT_BITS) {
+    cursor->overflow = true;
+    return false;
+  }
+  cursor->bitOffset = fieldStart + fieldBits;
+
+  const bool isConstant = flags & 0x01;
+  const bool isVariable = flags & 0x02;
+  if (isConstant) return true;
+
+  const uint16_t idBytes = global.reportId != 0 ? 1 : 0;
+
+  if (isVariable && global.reportSize == 1) {
+    // 按钮位: 该位为1的所有字节值都置位对应按钮
+    for (uint16_t n = 0; n < global.reportCount; n++) {
+      uint32_t usage;
+      if (!variableUsageAt(local, n, usage)) continue;
+      int8_t bit = buttonBitFor(usage);
+      if (bit < 0) continue;
+
+      const uint16_t bitPos = fieldStart + n;
+      uint8_t layoutIndex = layoutFor(deviceAddress, interfaceNumber, firstLayout, global.reportId);
+      uint16_t* lut = layoutIndex == 0xFF ? nullptr : lutFor(layoutIndex, firstLut, idBytes + bitPos / 8);
+      if (lut == nullptr) return false;
+
+      const uint8_t bitMask = 1 << (bitPos % 8);
+      for (uint16_t v = 0; v < 256; v++) {
+        if (v & bitMask) lut[v] |= 1 << bit;
+      }
+    }
+  } else if (!isVariable && global.reportSize == 8 && fieldStart % 8 == 0) {
+    // 数组槽 (如键盘键码): 每个可能的值对应一个Usage，所有槽共用同一映射
+    int32_t minValue = global.logicalMin < 0 ? 0 : global.logicalMin;
+    int32_t maxValue = global.logicalMax < minValue ? 255 : min<int32_t>(global.logicalMax, 255);
+
+    for (uint16_t n = 0; n < global.reportCount; n++) {
+      uint16_t* lut = nullptr;
+      for (int32_t v = minValue; v <= maxValue; v++) {
+        uint32_t usage;
+        if (!arrayUsageAt(local, v - global.logicalMin, usage)) continue;
+        int8_t bit = buttonBitFor(usage);
+        if (bit < 0) continue;
+
+        if (lut == nullptr) {
+          uint8_t layoutIndex = layoutFor(deviceAddress, interfaceNumber, firstLayout, global.reportId);
+          lut = layoutIndex == 0xFF ? nullptr : lutFor(layoutIndex, firstLut, idBytes + fieldStart / 8 + n);
+          if (lut == nullptr) return false;
+        }
+        lut[v] |= 1 << bit;
+      }
+    }
+  }
+  return true;
+}
+
+bool HidButtonMap::compile(uint8_t deviceAddress, uint8_t interfaceNumber, const uint8_t* desc, uint16_t len) {
+  // 只在枚举时编译一次; 临界区内不做输出
+  portENTER_CRITICAL(&mapMux);
+  bool complete = compileLayouts(deviceAddress, interfaceNumber, desc, len);
+  portEXIT_CRITICAL(&mapMux);
+  return complete;
+}
+
+bool HidButtonMap::compileLayouts(uint8_t deviceAddress, uint8_t interfaceNumber, const uint8_t* desc, uint16_t len) {
+  removeLayouts(deviceAddress, interfaceNumber);
+
+  const uint8_t firstLayout = layoutCount;
+  const uint8_t firstLut = lutCount;
+
+  HidGlobalState global;
+  HidGlobalState globalStack[HID_GLOBAL_STACK_DEPTH];
+  uint8_t stackDepth = 0;
+  HidLocalState local;
+  HidReportCursor cursors[HID_MAP_MAX_REPORTS];
+  uint8_t cursorCount = 0;
+  bool complete = true;  // 表或布局用完时为false，已编译的部分仍然有效
+
+  uint16_t i = 0;
+  while (i < len) {
+    const uint8_t prefix = desc[i];
+    if (prefix == 0xFE) {  // 长项目: 跳过
+      if (i + 2 >= len) break;
+      i += 3 + desc[i + 1];
+      continue;
+    }
+
+    const uint8_t size = (prefix & 0x03) == 3 ? 4 : (prefix & 0x03);
+    const uint8_t type = (prefix >> 2) & 0x03;
+    const uint8_t tag = prefix >> 4;
+    if (i + 1 + size > len) break;
+    const uint8_t* data = desc + i + 1;
+    const uint32_t value = itemData(data, size);
+    i += 1 + size;
+
+    if (type == 1) {  // Global
+      switch (tag) {
+        case 0x0: global.usagePage = value; break;
+        case 0x1: global.logicalMin = itemDataSigned(data, size); break;
+        case 0x2: global.logicalMax = itemDataSigned(data, size); break;
+        case 0x7: global.reportSize = clampU16(value); break;
+        case 0x8: global.reportId = value; break;
+        case 0x9: global.reportCount = clampU16(value); break;
+        case 0xA:
+          if (stackDepth < HID_GLOBAL_STACK_DEPTH) globalStack[stackDepth++] = global;
+          break;
+        case 0xB:
+          if (stackDepth > 0) global = globalStack[--stackDepth];
+          break;
+        default: break;
+      }
+      continue;
+    }
+
+    if (type == 2) {  // Local
+      switch (tag) {
+        case 0x0:
+          if (local.usageCount < HID_MAX_LOCAL_USAGES) {
+            local.usages[local.usageCount++] = fullUsage(value, size, global.usagePage);
+          }
+          break;
+        case 0x1:
+          local.usageMin = fullUsage(value, size, global.usagePage);
+          local.hasRange = true;
+          break;
+        case 0x2:
+          local.usageMax = fullUsage(value, size, global.usagePage);
+          local.hasRange = true;
+          break;
+        default: break;
+      }
+      continue;
+    }
+
+    if (type != 0) continue;  // Reserved
+
+    // Main: 只有Input项目占用输入报告的位
+    if (tag == 0x8 && !compileInput(deviceAddress, interfaceNumber, firstLayout, firstLut, value, global, local, cursors, cursorCount)) {
+      complete = false;
+    }
+
+    // 每个主项目之后清除局部状态
+    local = HidLocalState();
+  }
+
+  // 同一报告的表排在一起 (按所属报告稳定排序)
+  for (uint8_t a = firstLut + 1; a < lutCount; a++) {
+    for (uint8_t b = a; b > firstLut && lutOwners[b - 1] > lutOwners[b]; b--) {
+      swapLuts(b - 1, b);
+    }
+  }
+  for (uint8_t l = firstLayout; l < layoutCount; l++) {
+    layouts[l].firstLut = lutCount;
+    layouts[l].lutCount = 0;
+    for (uint8_t k = firstLut; k < lutCount; k++) {
+      if (lutOwners[k] != l) continue;
+      if (layouts[l].lutCount == 0) layouts[l].firstLut = k;
+      layouts[l].lutCount++;
+    }
+  }
+
+  return complete;
+}
+
+uint16_t HidButtonMap::apply(uint8_t deviceAddress, uint8_t interfaceNumber, const uint8_t* report, uint16_t len) {
+  if (len == 0) return currentMask();
+
+  HidReportLayout* layout = findLayout(deviceAddress, interfaceNumber, 0);
+  if (layout == nullptr) layout = findLayout(deviceAddress, interfaceNumber, report[0]);
+  if (layout == nullptr) return currentMask();
+
+  uint16_t mask = 0;
+  const uint8_t end = layout->firstLut + layout->lutCount;
+  for (uint8_t k = layout->firstLut; k < end; k++) {
+    if (lutOffsets[k] < len) mask |= luts[k][report[lutOffsets[k]]];
+  }
+  layout->mask = mask;
+
+  return currentMask();
+}
+
+uint16_t HidButtonMap::currentMask() const {
+  uint16_t mask = 0;
+  for (uint8_t l = 0; l < layoutCount; l++) {
+    mask |= layouts[l].mask;
+  }
+  return mask;
+}
+
+void HidButtonMap::removeDevice(uint8_t deviceAddress) {
+  portENTER_CRITICAL(&mapMux);
+  removeLayouts(deviceAddress, ANY_INTERFACE);
+  portEXIT_CRITICAL(&mapMux);
+}
+
+void HidButtonMap::removeLayouts(uint8_t deviceAddress, uint8_t interfaceNumber) {
+  uint8_t keptLayouts = 0;
+  uint8_t keptLuts = 0;
+
+  // 布局按firstLut递增排列，向前搬移不会覆盖未处理的表
+  for (uint8_t l = 0; l < layoutCount; l++) {
+    HidReportLayout layout = layouts[l];
+    if (layout.deviceAddress == deviceAddress &&
+        (interfaceNumber == ANY_INTERFACE || layout.interfaceNumber == interfaceNumber)) continue;
+
+    for (uint8_t k = 0; k < layout.lutCount; k++) {
+      uint8_t from = layout.firstLut + k;
+      if (from != keptLuts) {
+        memcpy(luts[keptLuts], luts[from], sizeof(luts[0]));
+        lutOffsets[keptLuts] = lutOffsets[from];
+      }
+      lutOwners[keptLuts] = keptLayouts;
+      keptLuts++;
+    }
+    layout.firstLut = keptLuts - layout.lutCount;
+    layouts[keptLayouts++] = layout;
+  }
+
+  layoutCount = keptLayouts;
+  lutCount = keptLuts;
+}
+
+HidReportLayout* HidButtonMap::findLayout(uint8_t deviceAddress, uint8_t interfaceNumber, uint8_t reportId) {
+  for (uint8_t l = 0; l < layoutCount; l++) {
+    const HidReportLayout& layout = layouts[l];
+    if (layout.deviceAddress == deviceAddress && layout.interfaceNumber == interfaceNumber &&
+        layout.reportId == reportId) return &layouts[l];
+  }
+  return nullptr;
+}
+
+uint16_t* HidButtonMap::lutFor(uint8_t layoutIndex, uint8_t firstLut, uint16_t byteOffset) {
+  if (byteOffset > 0xFF) return nullptr;
+
+  for (uint8_t k = firstLut; k < lutCount; k++) {
+    if (lutOwners[k] == layoutIndex && lutOffsets[k] == byteOffset) return luts[k];
+  }
+  if (lutCount >= HID_MAP_MAX_LUTS) return nullptr;
+
+  uint8_t k = lutCount++;
+  memset(luts[k], 0, sizeof(luts[k]));
+  lutOffsets[k] = byteOffset;
+  lutOwners[k] = layoutIndex;
+  return luts[k];
+}
+
+void HidButtonMap::swapLuts(uint8_t a, uint8_t b) {
+  uint16_t tmp[256];
+  memcpy(tmp, luts[a], sizeof(tmp));
+  memcpy(luts[a], luts[b], sizeof(tmp));
+  memcpy(luts[b], tmp, sizeof(tmp));
+
+  uint8_t offset = lutOffsets[a];
+  lutOffsets[a] = lutOffsets[b];
+  lutOffsets[b] = offset;
+
+  uint8_t owner = lutOwners[a];
+  lutOwners[a] = lutOwners[b];
+  lutOwners[b] = owner;
+}
+
+// ============================================================================
+// 诊断输出
+// ============================================================================
+
+uint8_t HidButtonMap::snapshot(HidReportLayout* out, uint8_t* offsets, uint8_t& offsetCount) const {
+  portENTER_CRITICAL(&mapMux);
+  const uint8_t count = layoutCount;
+  memcpy(out, layouts, count * sizeof(layouts[0]));
+  offsetCount = lutCount;
+  memcpy(offsets, lutOffsets, lutCount);
+  portEXIT_CRITICAL(&mapMux);
+  return count;
+}
+
+void HidButtonMap::dump(Print& out) const {
+  HidReportLayout reports[HID_MAP_MAX_REPORTS];
+  uint8_t offsets[HID_MAP_MAX_LUTS];
+  uint8_t offsetCount;
+  const uint8_t count = snapshot(reports, offsets, offsetCount);
+
+  uint16_t mask = 0;
+  for (uint8_t l = 0; l < count; l++) mask |= reports[l].mask;
+  out.printf("mask=0x%04X reports=%u luts=%u/%u\n", mask, count, offsetCount, HID_MAP_MAX_LUTS);
+  for (uint8_t l = 0; l < count; l++) {
+    const HidReportLayout& layout = reports[l];
+    out.printf("  dev=%u if=%u id=%u mask=0x%04X bytes=", layout.deviceAddress, layout.interfaceNumber,
+               layout.reportId, layout.mask);
+    for (uint8_t k = 0; k < layout.lutCount; k++) {
+      out.printf("%s%u", k == 0 ? "" : ",", offsets[layout.firstLut + k]);
+    }
+    out.println();
+  }
+}
+
+// [0] DIAG_CMD_HID_MAP, [1..2] 合并掩码, [3] 报告数,
+// 每报告 [device][interface][report id][LUT数][mask u16]，小端
+size_t HidButtonMap::encode(uint8_t* out, size_t maxLen) const {
+  if (maxLen < 4) return 0;
+
+  HidReportLayout reports[HID_MAP_MAX_REPORTS];
+  uint8_t offsets[HID_MAP_MAX_LUTS];
+  uint8_t offsetCount;
+  const uint8_t total = snapshot(reports, offsets, offsetCount);
+
+  uint16_t mask = 0;
+  for (uint8_t l = 0; l < total; l++) mask |= reports[l].mask;
+  uint8_t count = min<size_t>(total, (maxLen - 4) / 6);
+
+  out[0] = DIAG_CMD_HID_MAP;
+  memcpy(out + 1, &mask, 2);
+  out[3] = count;
+  for (uint8_t l = 0; l < count; l++) {
+    uint8_t* p = out + 4 + l * 6;
+    p[0] = reports[l].deviceAddress;
+    p[1] = reports[l].interfaceNumber;
+    p[2] = reports[l].reportId;
+    p[3] = reports[l].lutCount;
+    memcpy(p + 4, &reports[l].mask, 2);
+  }
+  return 4 + count * 6;
+}
@@ -0,0 +1,75 @@
+#ifndef HID_BUTTON_MAP_H
+#define HID_BUTTON_MAP_H
+
+#include "project_config.h"
+
+// ============================================================================
+// HID报告 -> 16位按钮掩码
+// ============================================================================
+// 解析HID报告描述符，按 HID_BUTTON_RULES 把每个按钮位 (Variable, 1 bit)
+// 和按键数组槽 (Array, 8 bit, 如键盘键码) 编译成每字节一张256项查找表:
+//   mask = OR(lut[k][report[offset[k]]])
+// 处理一个报告只需对映射到的字节各查一次表，与按下多少键无关。
+// 映射按 (设备地址, 接口) 区分，Hub下的多个设备合并成同一个掩码。
+// compile/removeDevice/apply 在USB任务中调用; dump/encode 在主循环和BLE回调中，
+// 在临界区内取布局快照后再输出，不会读到编译或删除到一半的表。
+
+struct HidGlobalState;
+struct HidLocalState;
+struct HidReportCursor;
+
+struct HidReportLayout {
+  uint8_t deviceAddress;
+  uint8_t interfaceNumber;
+  uint8_t reportId;  // 0 = 描述符中没有Report ID
+  uint8_t firstLut;  // 在LUT池中的起始下标，同一报告的表连续存放
+  uint8_t lutCount;
+  uint16_t mask;     // 该报告最近一次的掩码
+};
+
+class HidButtonMap {
+public:
+  // 编译某个设备接口的报告描述符，替换该接口之前的映射
+  bool compile(uint8_t deviceAddress, uint8_t interfaceNumber, const uint8_t* desc, uint16_t len);
+
+  // 应用一个输入报告，返回所有设备、所有报告合并后的掩码
+  uint16_t apply(uint8_t deviceAddress, uint8_t interfaceNumber, const uint8_t* report, uint16_t len);
+
+  // 设备断开: 只清除该设备的映射，其余设备的按钮状态保留
+  void removeDevice(uint8_t deviceAddress);
+
+  uint16_t currentMask() const;
+
+  // 诊断输出
+  void dump(Print& out) const;
+  size_t encode(uint8_t* out, size_t maxLen) const;
+
+private:
+  HidReportLayout layouts[HID_MAP_MAX_REPORTS] = {};
+  uint8_t layoutCount = 0;
+
+  uint16_t luts[HID_MAP_MAX_LUTS][256];
+  uint8_t lutOffsets[HID_MAP_MAX_LUTS];  // 每张表对应的报告字节偏移 (含Report ID字节)
+  uint8_t lutOwners[HID_MAP_MAX_LUTS];   // 编译期间: 所属报告下标
+  uint8_t lutCount = 0;
+
+  static const uint8_t ANY_INTERFACE = 0xFF;
+
+  // 保护布局和表的修改 (USB任务) 与诊断快照 (其他任务)
+  mutable portMUX_TYPE mapMux = portMUX_INITIALIZER_UNLOCKED;
+
+  bool compileLayouts(uint8_t deviceAddress, uint8_t interfaceNumber, const uint8_t* desc, uint16_t len);
+  uint8_t snapshot(HidReportLayout* out, uint8_t* offsets, uint8_t& offsetCount) const;
+  void removeLayouts(uint8_t deviceAddress, uint8_t interfaceNumber);
+  HidReportLayout* findLayout(uint8_t deviceAddress, uint8_t interfaceNumber, uint8_t reportId);
+  uint8_t layoutFor(uint8_t deviceAddress, uint8_t interfaceNumber, uint8_t firstLayout, uint8_t reportId);
+  bool compileInput(uint8_t deviceAddress, uint8_t interfaceNumber, uint8_t firstLayout, uint8_t firstLut, uint32_t flags,
+                    const HidGlobalState& global, const HidLocalState& local,
+                    HidReportCursor* cursors, uint8_t& cursorCount);
+  uint16_t* lutFor(uint8_t layoutIndex, uint8_t firstLut, uint16_t byteOffset);
+  void swapLuts(uint8_t a, uint8_t b);
+};
+
+extern HidButtonMap hidButtonMap;
+
+#endif  // HID_BUTTON_MAP_H
@@ -0,0 +1,103 @@
+#include "latency_stats.h"
+
+// 全局延迟统计实例
+LatencyStats latencyStats;
+
+// ============================================================================
+// LatencyHistogram 实现
+// ============================================================================
+
+static inline uint8_t latencyBucketIndex(uint32_t us) {
+  if (us == 0) return 0;
+  uint8_t index = 32 - __builtin_clz(us);
+  return index < LATENCY_BUCKET_COUNT ? index : LATENCY_BUCKET_COUNT - 1;
+}
+
+// 桶的上界 (µs)，用于估算百分位
+static inline uint32_t latencyBucketUpperUs(uint8_t index) {
+  return index == 0 ? 0 : (1UL << index) - 1;
+}
+
+void LatencyHistogram::record(uint32_t us) {
+  buckets[latencyBucketIndex(us)].fetch_add(1, std::memory_order_relaxed);
+
+  uint32_t prevMax = maxUs.load(std::memory_order_relaxed);
+  while (us > prevMax && !maxUs.compare_exchange_weak(prevMax, us, std::memory_order_relaxed)) {
+  }
+}
+
+void LatencyHistogram::drain(LatencySnapshot& out) {
+  out.count = 0;
+  for (uint8_t i = 0; i < LATENCY_BUCKET_COUNT; i++) {
+    out.buckets[i] = buckets[i].exchange(0, std::memory_order_relaxed);
+    out.count += out.buckets[i];
+  }
+  out.maxUs = maxUs.exchange(0, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// LatencyStats 实现
+// ============================================================================
+
+const char* LatencyStats::channelName(LatencyChannel channel) {
+  switch (channel) {
+    case LAT_CAN_REQUEST_RTT: return "can_req_rtt";
+    case LAT_BATCH_TO_NOTIFY: return "batch_to_notify";
+    case LAT_BLE_BUTTON_TO_CAN: return "ble_btn_to_can";
+    case LAT_USB_TO_CAN: return "usb_to_can";
+    case LAT_TXQ_BUTTON: return "txq_button";
+    case LAT_TXQ_REQUEST: return "txq_request";
+    case LAT_TXQ_SET: return "txq_set";
+    default: return "?";
+  }
+}
+
+static uint32_t latencyPercentileUs(const LatencySnapshot& snap, uint8_t percent) {
+  if (snap.count == 0) return 0;
+  uint32_t threshold = (uint32_t)(((uint64_t)snap.count * percent + 99) / 100);
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < LATENCY_BUCKET_COUNT; i++) {
+    seen += snap.buckets[i];
+    if (seen >= threshold) return min(latencyBucketUpperUs(i), snap.maxUs);
+  }
+  return snap.maxUs;
+}
+
+void LatencyStats::dump(Print& out) {
+  LatencySnapshot snap;
+  for (uint8_t ch = 0; ch < LAT_CHANNEL_COUNT; ch++) {
+    drain((LatencyChannel)ch, snap);
+
+    out.printf("%-16s n=%lu p50<=%luus p99<=%luus max=%luus |",
+               channelName((LatencyChannel)ch),
+               (unsigned long)snap.count,
+               (unsigned long)latencyPercentileUs(snap, 50),
+               (unsigned long)latencyPercentileUs(snap, 99),
+               (unsigned long)snap.maxUs);
+    for (uint8_t i = 0; i < LATENCY_BUCKET_COUNT; i++) {
+      if (snap.buckets[i] == 0) continue;
+      out.printf(" <%lu:%lu", (unsigned long)(latencyBucketUpperUs(i) + 1), (unsigned long)snap.buckets[i]);
+    }
+    out.println();
+  }
+}
+
+// 格式: [0] DIAG_CMD_LATENCY, [1] 通道, [2..5] count, [6..9] max µs,
+//       [10..] LATENCY_BUCKET_COUNT x uint16 (饱和)，多字节字段均为小端
+size_t LatencyStats::encode(LatencyChannel channel, uint8_t* out, size_t maxLen) {
+  const size_t len = 10 + LATENCY_BUCKET_COUNT * 2;
+  if (maxLen < len) return 0;
+
+  LatencySnapshot snap;
+  drain(channel, snap);
+
+  out[0] = DIAG_CMD_LATENCY;
+  out[1] = channel;
+  memcpy(out + 2, &snap.count, 4);
+  memcpy(out + 6, &snap.maxUs, 4);
+  for (uint8_t i = 0; i < LATENCY_BUCKET_COUNT; i++) {
+    uint16_t n = snap.buckets[i] > 0xFFFF ? 0xFFFF : (uint16_t)snap.buckets[i];
+    memcpy(out + 10 + i * 2, &n, 2);
+  }
+  return len;
+}
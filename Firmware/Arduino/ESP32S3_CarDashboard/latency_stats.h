@@ -0,0 +1,74 @@
+#ifndef LATENCY_STATS_H
+#define LATENCY_STATS_H
+
+#include "project_config.h"
+#include <atomic>
+
+// ============================================================================
+// 延迟直方图
+// ============================================================================
+// 固定 log2(µs) 分桶: bucket 0 = 0µs, bucket i = [2^(i-1), 2^i) µs,
+// 最后一个桶收集所有更大的值。记录只用原子加法，无锁、无分配，
+// 可在BLE回调、USB任务和主循环中同时调用。
+
+#define LATENCY_BUCKET_COUNT 24  // 最后一桶 >= 2^22 µs (~4.2 s)
+
+enum LatencyChannel : uint8_t {
+  LAT_CAN_REQUEST_RTT = 0,  // CAN变量请求TX -> ECU响应RX
+  LAT_BATCH_TO_NOTIFY,      // 批量请求开始 -> BLE notify
+  LAT_BLE_BUTTON_TO_CAN,    // BLE按钮写入 -> CAN TX
+  LAT_USB_TO_CAN,           // USB HID报告 -> CAN TX
+  LAT_TXQ_BUTTON,           // 按钮帧在驱动缓冲区中等待TXB2的时间
+  LAT_TXQ_REQUEST,          // 变量请求等待TXB1
+  LAT_TXQ_SET,              // 变量设置等待TXB0
+  LAT_CHANNEL_COUNT
+};
+
+struct LatencySnapshot {
+  uint32_t buckets[LATENCY_BUCKET_COUNT];
+  uint32_t count;
+  uint32_t maxUs;
+};
+
+class LatencyHistogram {
+public:
+  void record(uint32_t us);
+
+  // 读取并清零 (reset-on-read)
+  void drain(LatencySnapshot& out);
+
+private:
+  std::atomic<uint32_t> buckets[LATENCY_BUCKET_COUNT] = {};
+  std::atomic<uint32_t> maxUs{ 0 };
+};
+
+class LatencyStats {
+public:
+  void record(LatencyChannel channel, uint32_t us) {
+    histograms[channel].record(us);
+  }
+
+  // 记录从 startUs (micros()) 到现在的耗时
+  void recordSince(LatencyChannel channel, uint32_t startUs) {
+    histograms[channel].record(micros() - startUs);
+  }
+
+  void drain(LatencyChannel channel, LatencySnapshot& out) {
+    histograms[channel].drain(out);
+  }
+
+  // 串口文本输出 (读取并清零)
+  void dump(Print& out);
+
+  // BLE二进制编码单个通道 (读取并清零)，返回写入字节数
+  size_t encode(LatencyChannel channel, uint8_t* out, size_t maxLen);
+
+  static const char* channelName(LatencyChannel channel);
+
+private:
+  LatencyHistogram histograms[LAT_CHANNEL_COUNT];
+};
+
+extern LatencyStats latencyStats;
+
+#endif  // LATENCY_STATS_H
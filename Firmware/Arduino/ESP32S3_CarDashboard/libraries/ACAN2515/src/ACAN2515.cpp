@@ -271,6 +271,46 @@ bool ACAN2515::receive (CANMessage & outMessage) {
 
 //------------------------------------------------------------------------------
 
+const CANMessage * ACAN2515::peekReceivedMessage (void) {
+  uint32_t receiveMicros ;
+  return peekReceivedMessage (receiveMicros) ;
+}
+
+//------------------------------------------------------------------------------
+
+const CANMessage * ACAN2515::peekReceivedMessage (uint32_t & outReceiveMicros) {
+  #ifdef ARDUINO_ARCH_ESP32
+    mSPI.beginTransaction (mSPISettings) ; // For ensuring mutual exclusion access
+  #else
+    noInterrupts () ;
+  #endif
+    const CANMessage * message = mReceiveBuffer.peek (outReceiveMicros) ;
+  #ifdef ARDUINO_ARCH_ESP32
+    mSPI.endTransaction () ;
+  #else
+    interrupts () ;
+  #endif
+  return message ;
+}
+
+//------------------------------------------------------------------------------
+
+void ACAN2515::releaseReceivedMessage (void) {
+  #ifdef ARDUINO_ARCH_ESP32
+    mSPI.beginTransaction (mSPISettings) ; // For ensuring mutual exclusion access
+  #else
+    noInterrupts () ;
+  #endif
+    mReceiveBuffer.drop () ;
+  #ifdef ARDUINO_ARCH_ESP32
+    mSPI.endTransaction () ;
+  #else
+    interrupts () ;
+  #endif
+}
+
+//------------------------------------------------------------------------------
+
 bool ACAN2515::dispatchReceivedMessage (const tFilterMatchCallBack inFilterMatchCallBack) {
   CANMessage receivedMessage ;
   const bool hasReceived = receive (receivedMessage) ;
@@ -317,16 +357,16 @@ uint16_t ACAN2515::internalBeginOperation (const ACAN2515Settings & inSettings,
     errorCode |= kInconsistentBitRateSettings ;
   }
 //----------------------------------- Allocate buffer
-  if (!mReceiveBuffer.initWithSize (inSettings.mReceiveBufferSize)) {
+  if (!mReceiveBuffer.initWithSize (inSettings.mReceiveBufferSize, true)) {
     errorCode |= kCannotAllocateReceiveBuffer ;
   }
-  if (!mTransmitBuffer [0].initWithSize (inSettings.mTransmitBuffer0Size)) {
+  if (!mTransmitBuffer [0].initWithSize (inSettings.mTransmitBuffer0Size, true)) {
     errorCode |= kCannotAllocateTransmitBuffer0 ;
   }
-  if (!mTransmitBuffer [1].initWithSize (inSettings.mTransmitBuffer1Size)) {
+  if (!mTransmitBuffer [1].initWithSize (inSettings.mTransmitBuffer1Size, true)) {
     errorCode |= kCannotAllocateTransmitBuffer1 ;
   }
-  if (!mTransmitBuffer [2].initWithSize (inSettings.mTransmitBuffer2Size)) {
+  if (!mTransmitBuffer [2].initWithSize (inSettings.mTransmitBuffer2Size, true)) {
     errorCode |= kCannotAllocateTransmitBuffer2 ;
   }
   mTXBIsFree [0] = true ;
@@ -372,13 +412,13 @@ uint16_t ACAN2515::internalBeginOperation (const ACAN2515Settings & inSettings,
   //--- Register CANINTE: activate interrupts
   //  Bit 7 --> 0: MERRE
   //  Bit 6 --> 0: WAKIE
-  //  Bit 5 --> 0: ERRIE
+  //  Bit 5 --> 1: ERRIE (receive overflow count)
   //  Bit 4 --> 1: TX2IE
   //  Bit 3 --> 1: TX1IE
   //  Bit 2 --> 1: TX0IE
   //  Bit 1 --> 1: RX1IE
   //  Bit 0 --> 1: RX0IE
-    mSPI.transfer (0x1F) ;
+    mSPI.transfer (0x3F) ;
     unselect () ;
   //----------------------------------- Deactivate the RXnBF Pins (High Impedance State)
     write2515Register (BFPCTRL_REGISTER, 0) ;
@@ -483,6 +523,51 @@ uint16_t ACAN2515::changeModeOnTheFly (const ACAN2515Settings::RequestedMode inR
   return errorCode ;
 }
 
+//------------------------------------------------------------------------------
+//    Change bit rate on the fly
+//------------------------------------------------------------------------------
+
+uint16_t ACAN2515::changeBitRateOnTheFly (const ACAN2515Settings & inSettings) {
+  uint16_t errorCode = 0 ;
+  if (!inSettings.mBitRateClosedToDesiredRate) {
+    errorCode |= kTooFarFromDesiredBitRate ;
+  }
+  if (inSettings.CANBitSettingConsistency () != 0) {
+    errorCode |= kInconsistentBitRateSettings ;
+  }
+  if (errorCode == 0) {
+  //--- CNF registers are writable in configuration mode only; keep CANCTRL bits 0 ... 4
+    mSPI.beginTransaction (mSPISettings) ;
+      const uint8_t currentMode = read2515Register (CANCTRL_REGISTER) ;
+    mSPI.endTransaction () ;
+    const uint8_t configurationMode = (0b100 << 5) ;
+    errorCode = setRequestedMode ((currentMode & 0x1F) | configurationMode) ;
+  //--- Same encoding as internalBeginOperation
+    const uint8_t cnf3 =
+      ((inSettings.mCLKOUT_SOF_pin == ACAN2515Settings::SOF) << 6) /* SOF */ |
+      ((inSettings.mPhaseSegment2 - 1) << 0) /* PHSEG2 */
+    ;
+    const uint8_t cnf2 =
+      0x80 /* BLTMODE */ |
+      (inSettings.mTripleSampling << 6) /* SAM */ |
+      ((inSettings.mPhaseSegment1 - 1) << 3) /* PHSEG1 */ |
+      ((inSettings.mPropagationSegment - 1) << 0) /* PRSEG */
+    ;
+    const uint8_t cnf1 =
+      ((inSettings.mSJW - 1) << 6) /* SJW */ |
+      ((inSettings.mBitRatePrescaler - 1) << 0) /* BRP */
+    ;
+    mSPI.beginTransaction (mSPISettings) ;
+      write2515Register (CNF3_REGISTER, cnf3) ;
+      write2515Register (CNF2_REGISTER, cnf2) ;
+      write2515Register (CNF1_REGISTER, cnf1) ;
+    mSPI.endTransaction () ;
+  //--- Return to requested mode
+    errorCode |= setRequestedMode ((currentMode & 0x1F) | (uint8_t) inSettings.mRequestedMode) ;
+  }
+  return errorCode ;
+}
+
 //------------------------------------------------------------------------------
 //    Set filters on the fly
 //------------------------------------------------------------------------------
@@ -650,7 +735,7 @@ bool ACAN2515::isr_core (void) {
     case 0 : // No interrupt
       break ;
     case 1 << 1 : // Error interrupt
-      bitModify2515Register (CANINTF_REGISTER, 0x20, 0) ; // Ack interrupt
+      handleErrorInterrupt () ;
       break ;
     case 2 << 1 : // Wake-up interrupt
       bitModify2515Register (CANINTF_REGISTER, 0x40, 0) ; // Ack interrupt
@@ -679,6 +764,7 @@ bool ACAN2515::isr_core (void) {
 // This function is called by ISR when a MCP2515 receive buffer becomes full
 
 void ACAN2515::handleRXBInterrupt (void) {
+  const uint32_t receiveMicros = micros () ; // Before the SPI reads, closest to the frame arrival
   const uint8_t rxStatus = read2515RxStatus () ; // Bit 6: message in RXB0, bit 7: message in RXB1
   const bool received = (rxStatus & 0xC0) != 0 ;
   if (received) { // Message in RXB0 and / or RXB1
@@ -729,7 +815,24 @@ void ACAN2515::handleRXBInterrupt (void) {
   //--- Free receive buffer command
     bitModify2515Register (CANINTF_REGISTER, accessRXB0 ? 0x01 : 0x02, 0) ;
   //--- Enter received message in receive buffer (if not full)
-    mReceiveBuffer.append (message) ;
+    const bool stored = mReceiveBuffer.append (message, receiveMicros) ;
+    if (mReceiveCallBack != NULL) {
+      mReceiveCallBack (message, stored) ;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// This function is called by ISR when an EFLG bit changes
+
+void ACAN2515::handleErrorInterrupt (void) {
+//--- Acknowledge interrupt
+  bitModify2515Register (CANINTF_REGISTER, 0x20, 0) ;
+//--- RX0OVR (bit 6), RX1OVR (bit 7): a frame was lost, flags must be cleared by software
+  const uint8_t overflows = read2515Register (EFLG_REGISTER) & 0xC0 ;
+  if (overflows != 0) {
+    mReceiveOverflowCount = mReceiveOverflowCount + ((overflows == 0xC0) ? 2 : 1) ;
+    bitModify2515Register (EFLG_REGISTER, overflows, 0) ;
   }
 }
 
@@ -741,9 +844,13 @@ void ACAN2515::handleTXBInterrupt (const uint8_t inTXB) { // inTXB value is 0, 1
   bitModify2515Register (CANINTF_REGISTER, 0x04 << inTXB, 0) ;
 //--- Send an other message ?
   CANMessage message ;
-  const bool ok = mTransmitBuffer [inTXB].remove (message) ;
+  uint32_t stamp ;
+  const bool ok = mTransmitBuffer [inTXB].remove (message, stamp) ;
   if (ok) {
     internalSendMessage (message, inTXB) ;
+    if (mTransmitDelayCallBack != NULL) {
+      mTransmitDelayCallBack (inTXB, micros () - stamp) ;
+    }
   }else{
     mTXBIsFree [inTXB] = true ;
   }
@@ -940,17 +1047,21 @@ bool ACAN2515::tryToSend (const CANMessage & inMessage) {
   #endif
    //---
     mSPI.beginTransaction (mSPISettings) ;
-      bool ok = mTXBIsFree [idx] ;
+      const bool sentNow = mTXBIsFree [idx] ;
+      bool ok = sentNow ;
       if (ok) { // Transmit buffer and TXB are both free: transmit immediatly
         mTXBIsFree [idx] = false ;
         internalSendMessage (inMessage, idx) ;
       }else{ // Enter in transmit buffer, if not full
-        ok = mTransmitBuffer [idx].append (inMessage) ;
+        ok = mTransmitBuffer [idx].append (inMessage, micros ()) ;
       }
     mSPI.endTransaction () ;
   #ifndef ARDUINO_ARCH_ESP32
     interrupts () ;
   #endif
+  if (sentNow && (mTransmitDelayCallBack != NULL)) {
+    mTransmitDelayCallBack (idx, 0) ;
+  }
   return ok ;
 }
 
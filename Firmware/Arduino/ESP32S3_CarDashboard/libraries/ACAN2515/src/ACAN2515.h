@@ -73,6 +73,16 @@ class ACAN2515 {
   public: uint16_t changeModeOnTheFly (const ACAN2515Settings::RequestedMode inRequestedMode) ;
 
 
+  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  //    Change bit rate on the fly
+  //    Writes CNF1-3 from inSettings (bit timing and mRequestedMode only; buffers, filters
+  //    and interrupt handling stay as set by begin). Used for bit rate detection in
+  //    ListenOnlyMode without calling begin again.
+  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  public: uint16_t changeBitRateOnTheFly (const ACAN2515Settings & inSettings) ;
+
+
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
   //    Set filters on the fly
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -108,6 +118,49 @@ class ACAN2515 {
 
   public: bool dispatchReceivedMessage (const tFilterMatchCallBack inFilterMatchCallBack = NULL) ;
 
+  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  //    In-place reception
+  //    peekReceivedMessage returns the oldest message of the driver receive buffer (NULL if
+  //    empty) without copying it; the slot stays valid until releaseReceivedMessage, which
+  //    must be called once per peeked message before the next peek.
+  //    outReceiveMicros is micros () when the driver read the message from RXB0/RXB1.
+  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  public: const CANMessage * peekReceivedMessage (void) ;
+
+  public: const CANMessage * peekReceivedMessage (uint32_t & outReceiveMicros) ;
+
+  public: void releaseReceivedMessage (void) ;
+
+  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  //    Receive call back
+  //    Called for every frame read from RXB0/RXB1, before it is (or is not, inStored false
+  //    when the driver receive buffer is full) entered in the receive buffer.
+  //    On ESP32 it runs in the ACAN2515Handler task: keep it short.
+  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  public: typedef void (*ACANReceiveRoutine) (const CANMessage & inMessage, const bool inStored) ;
+
+  public: inline void setReceiveCallBack (ACANReceiveRoutine inCallBack) {
+    mReceiveCallBack = inCallBack ;
+  }
+
+  private: ACANReceiveRoutine mReceiveCallBack = NULL ;
+
+  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  //    Receive overflow count
+  //    Frames lost by the MCP2515 itself (EFLG RX0OVR / RX1OVR), counted by the error
+  //    interrupt, which clears the flags. Several frames lost before the interrupt is
+  //    handled count as one.
+  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  public: inline uint32_t receiveOverflowCount (void) const {
+    return mReceiveOverflowCount ;
+  }
+
+  private: volatile uint32_t mReceiveOverflowCount = 0 ;
+  private: void handleErrorInterrupt (void) ;
+
 
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
   //    Handling messages to send and receiving messages
@@ -202,6 +255,26 @@ class ACAN2515 {
   public: inline uint16_t transmitBufferPeakCount (const uint8_t inIndex) const {
     return mTransmitBuffer [inIndex].peakCount () ;
   }
+
+  public: inline void resetTransmitBufferPeakCount (const uint8_t inIndex) {
+    mTransmitBuffer [inIndex].resetPeakCount () ;
+  }
+
+
+  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  //    Transmit delay call back
+  //    Called each time a frame is loaded into TXBi, with the time (micros) it waited
+  //    in the driver transmit buffer; 0 if it was loaded directly by tryToSend.
+  //    On ESP32 it mostly runs in the ACAN2515Handler task: keep it short.
+  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  public: typedef void (*ACANTransmitDelayRoutine) (const uint8_t inTXB, const uint32_t inDelayMicros) ;
+
+  public: inline void setTransmitDelayCallBack (ACANTransmitDelayRoutine inCallBack) {
+    mTransmitDelayCallBack = inCallBack ;
+  }
+
+  private: ACANTransmitDelayRoutine mTransmitDelayCallBack = NULL ;
   private: void internalSendMessage (const CANMessage & inFrame, const uint8_t inTXB) ;
 
 
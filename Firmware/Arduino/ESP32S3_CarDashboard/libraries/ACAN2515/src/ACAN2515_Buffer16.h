@@ -16,6 +16,7 @@ class ACAN2515_Buffer16 {
 
   public: ACAN2515_Buffer16 (void)  :
   mBuffer (NULL),
+  mStamps (NULL),
   mSize (0),
   mReadIndex (0),
   mCount (0),
@@ -28,6 +29,7 @@ class ACAN2515_Buffer16 {
 
   public: ~ ACAN2515_Buffer16 (void) {
     delete [] mBuffer ;
+    delete [] mStamps ;
   }
 
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -35,6 +37,7 @@ class ACAN2515_Buffer16 {
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
   private: CANMessage * mBuffer ;
+  private: uint32_t * mStamps ; // Optional, one per message (see initWithSize)
   private: uint16_t mSize ;
   private: uint16_t mReadIndex ;
   private: uint16_t mCount ;
@@ -53,10 +56,12 @@ class ACAN2515_Buffer16 {
   // initWithSize
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-  public: bool initWithSize (const uint16_t inSize) {
+  public: bool initWithSize (const uint16_t inSize, const bool inWithStamps = false) {
     delete [] mBuffer ;
+    delete [] mStamps ;
     mBuffer = new CANMessage [inSize] ;
-    const bool ok = mBuffer != NULL ;
+    mStamps = inWithStamps ? new uint32_t [inSize] : NULL ;
+    const bool ok = (mBuffer != NULL) && (!inWithStamps || (mStamps != NULL)) ;
     mSize = ok ? inSize : 0 ;
     mReadIndex = 0 ;
     mCount = 0 ;
@@ -68,7 +73,7 @@ class ACAN2515_Buffer16 {
   // append
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-  public: bool append (const CANMessage & inMessage) {
+  public: bool append (const CANMessage & inMessage, const uint32_t inStamp = 0) {
     const bool ok = mCount < mSize ;
     if (ok) {
       uint16_t writeIndex = mReadIndex + mCount ;
@@ -76,6 +81,9 @@ class ACAN2515_Buffer16 {
         writeIndex -= mSize ;
       }
       mBuffer [writeIndex] = inMessage ;
+      if (mStamps != NULL) {
+        mStamps [writeIndex] = inStamp ;
+      }
       mCount ++ ;
       if (mPeakCount < mCount) {
         mPeakCount = mCount ;
@@ -89,9 +97,15 @@ class ACAN2515_Buffer16 {
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
   public: bool remove (CANMessage & outMessage) {
+    uint32_t stamp ;
+    return remove (outMessage, stamp) ;
+  }
+
+  public: bool remove (CANMessage & outMessage, uint32_t & outStamp) {
     const bool ok = mCount > 0 ;
     if (ok) {
       outMessage = mBuffer [mReadIndex] ;
+      outStamp = (mStamps != NULL) ? mStamps [mReadIndex] : 0 ;
       mCount -= 1 ;
       mReadIndex += 1 ;
       if (mReadIndex == mSize) {
@@ -101,12 +115,37 @@ class ACAN2515_Buffer16 {
     return ok ;
   }
 
+  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  // Peek / drop: in-place access to the oldest message, without copying it.
+  // append never writes the slot returned by peek until drop releases it.
+  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  public: inline const CANMessage * peek (void) const {
+    return (mCount > 0) ? &mBuffer [mReadIndex] : NULL ;
+  }
+
+  public: inline const CANMessage * peek (uint32_t & outStamp) const {
+    outStamp = ((mCount > 0) && (mStamps != NULL)) ? mStamps [mReadIndex] : 0 ;
+    return peek () ;
+  }
+
+  public: void drop (void) {
+    if (mCount > 0) {
+      mCount -= 1 ;
+      mReadIndex += 1 ;
+      if (mReadIndex == mSize) {
+        mReadIndex = 0 ;
+      }
+    }
+  }
+
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
   // Free
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
   public: void free (void) {
     delete [] mBuffer ; mBuffer = nullptr ;
+    delete [] mStamps ; mStamps = nullptr ;
     mSize = 0 ;
     mReadIndex = 0 ;
     mCount = 0 ;
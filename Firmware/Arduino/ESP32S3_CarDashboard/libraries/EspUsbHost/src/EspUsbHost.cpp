@@ -7,14 +7,6 @@ void EspUsbHost::_printPcapText(const char *title, uint16_t function, uint8_t di
     urbsize = 0x1b;
   }
 
-  String data_str = "";
-  for (int i = 0; i < size; i++) {
-    if (data[i] < 16) {
-      data_str += "0";
-    }
-    data_str += String(data[i], HEX) + " ";
-  }
-
   printf("\n");
   printf("[PCAP TEXT]%s\n", title);
   printf("0000  %02x 00 00 00 00 00 00 00 00 00 00 00 00 00 %02x %02x\n", urbsize, (function & 0xff), ((function >> 8) & 0xff));
@@ -24,13 +16,20 @@ void EspUsbHost::_printPcapText(const char *title, uint16_t function, uint8_t di
   } else {
     printf("\n");
   }
-  printf("00%02x  %s\n", urbsize, data_str.c_str());
+  printf("00%02x  ", urbsize);
+  for (int i = 0; i < size; i++) {
+    printf("%02x ", data[i]);
+  }
+  printf("\n");
   printf("\n");
 #endif
 }
 
 void EspUsbHost::begin(void) {
-  usbTransferSize = 0;
+  for (int i = 0; i < ESP_USB_HOST_MAX_DEVICES; i++) {
+    devices[i] = {};
+    devices[i].host = this;
+  }
 
   const usb_host_config_t config = {
     .skip_phy_setup = false,
@@ -59,155 +58,231 @@ void EspUsbHost::begin(void) {
   }
 }
 
+bool EspUsbHost::beginTask(UBaseType_t priority, BaseType_t core, uint32_t stackSize) {
+  begin();
+
+  taskMode = true;
+  if (xTaskCreatePinnedToCore(_libTask, "usb_lib", stackSize, this, priority, &libTaskHandle, core) != pdPASS) {
+    ESP_LOGI("EspUsbHost", "xTaskCreatePinnedToCore(usb_lib) failed");
+    taskMode = false;
+    return false;
+  }
+  if (xTaskCreatePinnedToCore(_clientTask, "usb_client", stackSize, this, priority, &clientTaskHandle, core) != pdPASS) {
+    ESP_LOGI("EspUsbHost", "xTaskCreatePinnedToCore(usb_client) failed");
+    vTaskDelete(libTaskHandle);
+    libTaskHandle = NULL;
+    taskMode = false;
+    return false;
+  }
+  return true;
+}
+
+void EspUsbHost::_libTask(void *arg) {
+  EspUsbHost *usbHost = (EspUsbHost *)arg;
+  while (true) {
+    esp_err_t err = usb_host_lib_handle_events(portMAX_DELAY, &usbHost->eventFlags);
+    if (err != ESP_OK && err != ESP_ERR_TIMEOUT) {
+      ESP_LOGI("EspUsbHost", "usb_host_lib_handle_events() err=%x eventFlags=%x", err, usbHost->eventFlags);
+    }
+  }
+}
+
+void EspUsbHost::_clientTask(void *arg) {
+  EspUsbHost *usbHost = (EspUsbHost *)arg;
+  while (true) {
+    // Client events and transfer completion callbacks are dispatched from here
+    esp_err_t err = usb_host_client_handle_events(usbHost->clientHandle, portMAX_DELAY);
+    if (err != ESP_OK && err != ESP_ERR_TIMEOUT) {
+      ESP_LOGI("EspUsbHost", "usb_host_client_handle_events() err=%x", err);
+    }
+  }
+}
+
+void EspUsbHost::_submitTransfer(usb_transfer_t *transfer) {
+  esp_err_t err = usb_host_transfer_submit(transfer);
+  if (err != ESP_OK && err != ESP_ERR_NOT_FINISHED && err != ESP_ERR_INVALID_STATE) {
+    ESP_LOGI("EspUsbHost", "usb_host_transfer_submit() err=%x", err);
+  }
+}
+
 void EspUsbHost::_clientEventCallback(const usb_host_client_event_msg_t *eventMsg, void *arg) {
   EspUsbHost *usbHost = (EspUsbHost *)arg;
 
   esp_err_t err;
   switch (eventMsg->event) {
     case USB_HOST_CLIENT_EVENT_NEW_DEV:
-      ESP_LOGI("EspUsbHost", "USB_HOST_CLIENT_EVENT_NEW_DEV new_dev.address=%d", eventMsg->new_dev.address);
-      err = usb_host_device_open(usbHost->clientHandle, eventMsg->new_dev.address, &usbHost->deviceHandle);
-      if (err != ESP_OK) {
-        ESP_LOGI("EspUsbHost", "usb_host_device_open() err=%x", err);
-      } else {
-        ESP_LOGI("EspUsbHost", "usb_host_device_open() ESP_OK");
-      }
+      {
+        ESP_LOGI("EspUsbHost", "USB_HOST_CLIENT_EVENT_NEW_DEV new_dev.address=%d", eventMsg->new_dev.address);
+        device_t *device = usbHost->findDevice(NULL);
+        if (device == NULL) {
+          ESP_LOGI("EspUsbHost", "no free device slot, max=%d", ESP_USB_HOST_MAX_DEVICES);
+          break;
+        }
 
-      usb_device_info_t dev_info;
-      err = usb_host_device_info(usbHost->deviceHandle, &dev_info);
-      if (err != ESP_OK) {
-        ESP_LOGI("EspUsbHost", "usb_host_device_info() err=%x", err);
-      } else {
-        ESP_LOGI("EspUsbHost", "usb_host_device_info() ESP_OK\n"
-                               "# speed                 = %d\n"
-                               "# dev_addr              = %d\n"
-                               "# vMaxPacketSize0       = %d\n"
-                               "# bConfigurationValue   = %d\n"
-                               "# str_desc_manufacturer = \"%s\"\n"
-                               "# str_desc_product      = \"%s\"\n"
-                               "# str_desc_serial_num   = \"%s\"",
-                 dev_info.speed,
-                 dev_info.dev_addr,
-                 dev_info.bMaxPacketSize0,
-                 dev_info.bConfigurationValue,
-                 getUsbDescString(dev_info.str_desc_manufacturer).c_str(),
-                 getUsbDescString(dev_info.str_desc_product).c_str(),
-                 getUsbDescString(dev_info.str_desc_serial_num).c_str());
-      }
+        err = usb_host_device_open(usbHost->clientHandle, eventMsg->new_dev.address, &device->handle);
+        if (err != ESP_OK) {
+          ESP_LOGI("EspUsbHost", "usb_host_device_open() err=%x", err);
+          break;
+        } else {
+          ESP_LOGI("EspUsbHost", "usb_host_device_open() ESP_OK");
+        }
+        device->inUse = true;
+        device->address = eventMsg->new_dev.address;
 
-      const usb_device_desc_t *dev_desc;
-      err = usb_host_get_device_descriptor(usbHost->deviceHandle, &dev_desc);
-      if (err != ESP_OK) {
-        ESP_LOGI("EspUsbHost", "usb_host_get_device_descriptor() err=%x", err);
-      } else {
-        const uint8_t setup[8] = { 0x80, 0x06, 0x00, 0x01, 0x00, 0x00, 0x12, 0x00 };
-        _printPcapText("GET DESCRIPTOR Request DEVICE", 0x000b, 0x00, 0x80, 0x02, sizeof(setup), 0x00, setup);
-        _printPcapText("GET DESCRIPTOR Response DEVICE", 0x0008, 0x01, 0x80, 0x02, sizeof(usb_device_desc_t), 0x03, (const uint8_t *)dev_desc);
+        usb_device_info_t dev_info;
+        err = usb_host_device_info(device->handle, &dev_info);
+        if (err != ESP_OK) {
+          ESP_LOGI("EspUsbHost", "usb_host_device_info() err=%x", err);
+        } else {
+          ESP_LOGI("EspUsbHost", "usb_host_device_info() ESP_OK\n"
+                                 "# speed                 = %d\n"
+                                 "# dev_addr              = %d\n"
+                                 "# vMaxPacketSize0       = %d\n"
+                                 "# bConfigurationValue   = %d\n"
+                                 "# str_desc_manufacturer = \"%s\"\n"
+                                 "# str_desc_product      = \"%s\"\n"
+                                 "# str_desc_serial_num   = \"%s\"",
+                   dev_info.speed,
+                   dev_info.dev_addr,
+                   dev_info.bMaxPacketSize0,
+                   dev_info.bConfigurationValue,
+                   getUsbDescString(dev_info.str_desc_manufacturer).c_str(),
+                   getUsbDescString(dev_info.str_desc_product).c_str(),
+                   getUsbDescString(dev_info.str_desc_serial_num).c_str());
+        }
 
-        ESP_LOGI("EspUsbHost", "usb_host_get_device_descriptor() ESP_OK\n"
-                               "#### DESCRIPTOR DEVICE ####\n"
-                               "# bLength            = %d\n"
-                               "# bDescriptorType    = %d\n"
-                               "# bcdUSB             = 0x%x\n"
-                               "# bDeviceClass       = 0x%x\n"
-                               "# bDeviceSubClass    = 0x%x\n"
-                               "# bDeviceProtocol    = 0x%x\n"
-                               "# bMaxPacketSize0    = %d\n"
-                               "# idVendor           = 0x%x\n"
-                               "# idProduct          = 0x%x\n"
-                               "# bcdDevice          = 0x%x\n"
-                               "# iManufacturer      = %d\n"
-                               "# iProduct           = %d\n"
-                               "# iSerialNumber      = %d\n"
-                               "# bNumConfigurations = %d",
-                 dev_desc->bLength,
-                 dev_desc->bDescriptorType,
-                 dev_desc->bcdUSB,
-                 dev_desc->bDeviceClass,
-                 dev_desc->bDeviceSubClass,
-                 dev_desc->bDeviceProtocol,
-                 dev_desc->bMaxPacketSize0,
-                 dev_desc->idVendor,
-                 dev_desc->idProduct,
-                 dev_desc->bcdDevice,
-                 dev_desc->iManufacturer,
-                 dev_desc->iProduct,
-                 dev_desc->iSerialNumber,
-                 dev_desc->bNumConfigurations);
-      }
+        const usb_device_desc_t *dev_desc;
+        err = usb_host_get_device_descriptor(device->handle, &dev_desc);
+        if (err != ESP_OK) {
+          ESP_LOGI("EspUsbHost", "usb_host_get_device_descriptor() err=%x", err);
+        } else {
+          const uint8_t setup[8] = { 0x80, 0x06, 0x00, 0x01, 0x00, 0x00, 0x12, 0x00 };
+          _printPcapText("GET DESCRIPTOR Request DEVICE", 0x000b, 0x00, 0x80, 0x02, sizeof(setup), 0x00, setup);
+          _printPcapText("GET DESCRIPTOR Response DEVICE", 0x0008, 0x01, 0x80, 0x02, sizeof(usb_device_desc_t), 0x03, (const uint8_t *)dev_desc);
+
+          ESP_LOGI("EspUsbHost", "usb_host_get_device_descriptor() ESP_OK\n"
+                                 "#### DESCRIPTOR DEVICE ####\n"
+                                 "# bLength            = %d\n"
+                                 "# bDescriptorType    = %d\n"
+                                 "# bcdUSB             = 0x%x\n"
+                                 "# bDeviceClass       = 0x%x\n"
+                                 "# bDeviceSubClass    = 0x%x\n"
+                                 "# bDeviceProtocol    = 0x%x\n"
+                                 "# bMaxPacketSize0    = %d\n"
+                                 "# idVendor           = 0x%x\n"
+                                 "# idProduct          = 0x%x\n"
+                                 "# bcdDevice          = 0x%x\n"
+                                 "# iManufacturer      = %d\n"
+                                 "# iProduct           = %d\n"
+                                 "# iSerialNumber      = %d\n"
+                                 "# bNumConfigurations = %d",
+                   dev_desc->bLength,
+                   dev_desc->bDescriptorType,
+                   dev_desc->bcdUSB,
+                   dev_desc->bDeviceClass,
+                   dev_desc->bDeviceSubClass,
+                   dev_desc->bDeviceProtocol,
+                   dev_desc->bMaxPacketSize0,
+                   dev_desc->idVendor,
+                   dev_desc->idProduct,
+                   dev_desc->bcdDevice,
+                   dev_desc->iManufacturer,
+                   dev_desc->iProduct,
+                   dev_desc->iSerialNumber,
+                   dev_desc->bNumConfigurations);
+        }
 
-      const usb_config_desc_t *config_desc;
-      err = usb_host_get_active_config_descriptor(usbHost->deviceHandle, &config_desc);
-      if (err != ESP_OK) {
-        ESP_LOGI("EspUsbHost", "usb_host_get_active_config_descriptor() err=%x", err);
-      } else {
-        const uint8_t setup[8] = { 0x80, 0x06, 0x00, 0x02, 0x00, 0x00, 0x09, 0x00 };
-        _printPcapText("GET DESCRIPTOR Request CONFIGURATION", 0x000b, 0x00, 0x80, 0x02, sizeof(setup), 0x00, setup);
-        _printPcapText("GET DESCRIPTOR Response CONFIGURATION", 0x0008, 0x01, 0x80, 0x02, sizeof(usb_config_desc_t), 0x03, (const uint8_t *)config_desc);
+        const usb_config_desc_t *config_desc;
+        err = usb_host_get_active_config_descriptor(device->handle, &config_desc);
+        if (err != ESP_OK) {
+          ESP_LOGI("EspUsbHost", "usb_host_get_active_config_descriptor() err=%x", err);
+        } else {
+          const uint8_t setup[8] = { 0x80, 0x06, 0x00, 0x02, 0x00, 0x00, 0x09, 0x00 };
+          _printPcapText("GET DESCRIPTOR Request CONFIGURATION", 0x000b, 0x00, 0x80, 0x02, sizeof(setup), 0x00, setup);
+          _printPcapText("GET DESCRIPTOR Response CONFIGURATION", 0x0008, 0x01, 0x80, 0x02, sizeof(usb_config_desc_t), 0x03, (const uint8_t *)config_desc);
+
+          ESP_LOGI("EspUsbHost", "usb_host_get_active_config_descriptor() ESP_OK\n"
+                                 "# bLength             = %d\n"
+                                 "# bDescriptorType     = %d\n"
+                                 "# wTotalLength        = %d\n"
+                                 "# bNumInterfaces      = %d\n"
+                                 "# bConfigurationValue = %d\n"
+                                 "# iConfiguration      = %d\n"
+                                 "# bmAttributes        = 0x%x\n"
+                                 "# bMaxPower           = %dmA",
+                   config_desc->bLength,
+                   config_desc->bDescriptorType,
+                   config_desc->wTotalLength,
+                   config_desc->bNumInterfaces,
+                   config_desc->bConfigurationValue,
+                   config_desc->iConfiguration,
+                   config_desc->bmAttributes,
+                   config_desc->bMaxPower * 2);
+        }
 
-        ESP_LOGI("EspUsbHost", "usb_host_get_active_config_descriptor() ESP_OK\n"
-                               "# bLength             = %d\n"
-                               "# bDescriptorType     = %d\n"
-                               "# wTotalLength        = %d\n"
-                               "# bNumInterfaces      = %d\n"
-                               "# bConfigurationValue = %d\n"
-                               "# iConfiguration      = %d\n"
-                               "# bmAttributes        = 0x%x\n"
-                               "# bMaxPower           = %dmA",
-                 config_desc->bLength,
-                 config_desc->bDescriptorType,
-                 config_desc->wTotalLength,
-                 config_desc->bNumInterfaces,
-                 config_desc->bConfigurationValue,
-                 config_desc->iConfiguration,
-                 config_desc->bmAttributes,
-                 config_desc->bMaxPower * 2);
+        usbHost->configDevice = device;
+        usbHost->_configCallback(config_desc);
+        usbHost->configDevice = NULL;
       }
-
-      usbHost->_configCallback(config_desc);
       break;
 
     case USB_HOST_CLIENT_EVENT_DEV_GONE:
       {
         ESP_LOGI("EspUsbHost", "USB_HOST_CLIENT_EVENT_DEV_GONE dev_gone.dev_hdl=%x", eventMsg->dev_gone.dev_hdl);
-        for (int i = 0; i < usbHost->usbTransferSize; i++) {
-          if (usbHost->usbTransfer[i] == NULL) {
+        device_t *device = usbHost->findDevice(eventMsg->dev_gone.dev_hdl);
+        if (device == NULL) {
+          break;
+        }
+
+        for (int i = 0; i < device->usbTransferSize; i++) {
+          if (device->usbTransfer[i] == NULL) {
             continue;
           }
 
-          err = usb_host_endpoint_clear(eventMsg->dev_gone.dev_hdl, usbHost->usbTransfer[i]->bEndpointAddress);
+          err = usb_host_endpoint_clear(device->handle, device->usbTransfer[i]->bEndpointAddress);
           if (err != ESP_OK) {
-            ESP_LOGI("EspUsbHost", "usb_host_endpoint_clear() err=%x, dev_hdl=%x, bEndpointAddress=%x", err, eventMsg->dev_gone.dev_hdl, usbHost->usbTransfer[i]->bEndpointAddress);
+            ESP_LOGI("EspUsbHost", "usb_host_endpoint_clear() err=%x, dev_hdl=%x, bEndpointAddress=%x", err, device->handle, device->usbTransfer[i]->bEndpointAddress);
           } else {
-            ESP_LOGI("EspUsbHost", "usb_host_endpoint_clear() ESP_OK, dev_hdl=%x, bEndpointAddress=%x", eventMsg->dev_gone.dev_hdl, usbHost->usbTransfer[i]->bEndpointAddress);
+            ESP_LOGI("EspUsbHost", "usb_host_endpoint_clear() ESP_OK, dev_hdl=%x, bEndpointAddress=%x", device->handle, device->usbTransfer[i]->bEndpointAddress);
           }
 
-          err = usb_host_transfer_free(usbHost->usbTransfer[i]);
+          err = usb_host_transfer_free(device->usbTransfer[i]);
           if (err != ESP_OK) {
-            ESP_LOGI("EspUsbHost", "usb_host_transfer_free() err=%x, err, usbTransfer=%x", err, usbHost->usbTransfer[i]);
+            ESP_LOGI("EspUsbHost", "usb_host_transfer_free() err=%x, err, usbTransfer=%x", err, device->usbTransfer[i]);
           } else {
-            ESP_LOGI("EspUsbHost", "usb_host_transfer_free() ESP_OK, usbTransfer=%x", usbHost->usbTransfer[i]);
+            ESP_LOGI("EspUsbHost", "usb_host_transfer_free() ESP_OK, usbTransfer=%x", device->usbTransfer[i]);
           }
 
-          usbHost->usbTransfer[i] = NULL;
+          device->usbTransfer[i] = NULL;
         }
-        usbHost->usbTransferSize = 0;
+        device->usbTransferSize = 0;
 
-        for (int i = 0; i < usbHost->usbInterfaceSize; i++) {
-          err = usb_host_interface_release(usbHost->clientHandle, usbHost->deviceHandle, usbHost->usbInterface[i]);
+        for (int i = 0; i < device->usbInterfaceSize; i++) {
+          err = usb_host_interface_release(usbHost->clientHandle, device->handle, device->usbInterface[i]);
           if (err != ESP_OK) {
-            ESP_LOGI("EspUsbHost", "usb_host_interface_release() err=%x, err, clientHandle=%x, deviceHandle=%x, Interface=%x", err, usbHost->clientHandle, usbHost->deviceHandle, usbHost->usbInterface[i]);
+            ESP_LOGI("EspUsbHost", "usb_host_interface_release() err=%x, err, clientHandle=%x, deviceHandle=%x, Interface=%x", err, usbHost->clientHandle, device->handle, device->usbInterface[i]);
           } else {
-            ESP_LOGI("EspUsbHost", "usb_host_interface_release() ESP_OK, clientHandle=%x, deviceHandle=%x, Interface=%x", usbHost->clientHandle, usbHost->deviceHandle, usbHost->usbInterface[i]);
+            ESP_LOGI("EspUsbHost", "usb_host_interface_release() ESP_OK, clientHandle=%x, deviceHandle=%x, Interface=%x", usbHost->clientHandle, device->handle, device->usbInterface[i]);
           }
 
-          usbHost->usbInterface[i] = 0;
+          device->usbInterface[i] = 0;
         }
-        usbHost->usbInterfaceSize = 0;
+        device->usbInterfaceSize = 0;
 
-        usb_host_device_close(usbHost->clientHandle, usbHost->deviceHandle);
+        usb_host_device_close(usbHost->clientHandle, device->handle);
 
+        // findDevice(eventMsg->dev_gone.dev_hdl) still resolves inside onGone()
         usbHost->onGone(eventMsg);
+
+        *device = {};
+        device->host = usbHost;
+
+        usbHost->isReady = false;
+        for (int i = 0; i < ESP_USB_HOST_MAX_DEVICES; i++) {
+          if (usbHost->devices[i].usbTransferSize > 0) {
+            usbHost->isReady = true;
+          }
+        }
       }
       break;
 
@@ -237,6 +312,10 @@ void EspUsbHost::_configCallback(const usb_config_desc_t *config_desc) {
 }
 
 void EspUsbHost::task(void) {
+  if (this->taskMode) {
+    return;
+  }
+
   esp_err_t err = usb_host_lib_handle_events(1, &this->eventFlags);
   if (err != ESP_OK && err != ESP_ERR_TIMEOUT) {
     ESP_LOGI("EspUsbHost", "usb_host_lib_handle_events() err=%x eventFlags=%x", err, this->eventFlags);
@@ -252,20 +331,33 @@ void EspUsbHost::task(void) {
     if ((now - this->lastCheck) > this->interval) {
       this->lastCheck = now;
 
-      for (int i = 0; i < this->usbTransferSize; i++) {
-        if (this->usbTransfer[i] == NULL) {
-          continue;
-        }
+      for (int d = 0; d < ESP_USB_HOST_MAX_DEVICES; d++) {
+        device_t *device = &this->devices[d];
+        for (int i = 0; i < device->usbTransferSize; i++) {
+          if (device->usbTransfer[i] == NULL) {
+            continue;
+          }
 
-        esp_err_t err = usb_host_transfer_submit(this->usbTransfer[i]);
-        if (err != ESP_OK && err != ESP_ERR_NOT_FINISHED && err != ESP_ERR_INVALID_STATE) {
-          //ESP_LOGI("EspUsbHost", "usb_host_transfer_submit() err=%x", err);
+          esp_err_t err = usb_host_transfer_submit(device->usbTransfer[i]);
+          if (err != ESP_OK && err != ESP_ERR_NOT_FINISHED && err != ESP_ERR_INVALID_STATE) {
+            //ESP_LOGI("EspUsbHost", "usb_host_transfer_submit() err=%x", err);
+          }
         }
       }
     }
   }
 }
 
+EspUsbHost::device_t *EspUsbHost::findDevice(usb_device_handle_t handle) {
+  // handle == NULL returns a free slot
+  for (int i = 0; i < ESP_USB_HOST_MAX_DEVICES; i++) {
+    if (handle == NULL ? !devices[i].inUse : (devices[i].inUse && devices[i].handle == handle)) {
+      return &devices[i];
+    }
+  }
+  return NULL;
+}
+
 String EspUsbHost::getUsbDescString(const usb_str_desc_t *str_desc) {
   String str = "";
   if (str_desc == NULL) {
@@ -282,6 +374,11 @@ String EspUsbHost::getUsbDescString(const usb_str_desc_t *str_desc) {
 }
 
 void EspUsbHost::onConfig(const uint8_t bDescriptorType, const uint8_t *p) {
+  device_t *device = this->configDevice;
+  if (device == NULL) {
+    return;
+  }
+
   switch (bDescriptorType) {
     case USB_DEVICE_DESC:
       {
@@ -356,17 +453,17 @@ void EspUsbHost::onConfig(const uint8_t bDescriptorType, const uint8_t *p) {
                  intf->bInterfaceProtocol,
                  intf->iInterface);
 
-        this->claim_err = usb_host_interface_claim(this->clientHandle, this->deviceHandle, intf->bInterfaceNumber, intf->bAlternateSetting);
-        if (this->claim_err != ESP_OK) {
-          ESP_LOGI("EspUsbHost", "usb_host_interface_claim() err=%x", claim_err);
+        device->claim_err = usb_host_interface_claim(this->clientHandle, device->handle, intf->bInterfaceNumber, intf->bAlternateSetting);
+        if (device->claim_err != ESP_OK) {
+          ESP_LOGI("EspUsbHost", "usb_host_interface_claim() err=%x", device->claim_err);
         } else {
           ESP_LOGI("EspUsbHost", "usb_host_interface_claim() ESP_OK");
-          this->usbInterface[this->usbInterfaceSize] = intf->bInterfaceNumber;
-          this->usbInterfaceSize++;
-          _bInterfaceNumber = intf->bInterfaceNumber;
-          _bInterfaceClass = intf->bInterfaceClass;
-          _bInterfaceSubClass = intf->bInterfaceSubClass;
-          _bInterfaceProtocol = intf->bInterfaceProtocol;
+          device->usbInterface[device->usbInterfaceSize] = intf->bInterfaceNumber;
+          device->usbInterfaceSize++;
+          device->_bInterfaceNumber = intf->bInterfaceNumber;
+          device->_bInterfaceClass = intf->bInterfaceClass;
+          device->_bInterfaceSubClass = intf->bInterfaceSubClass;
+          device->_bInterfaceProtocol = intf->bInterfaceProtocol;
         }
       }
       break;
@@ -392,16 +489,16 @@ void EspUsbHost::onConfig(const uint8_t bDescriptorType, const uint8_t *p) {
                  ep_desc->wMaxPacketSize,
                  ep_desc->bInterval);
 
-        if (this->claim_err != ESP_OK) {
+        if (device->claim_err != ESP_OK) {
           ESP_LOGI("EspUsbHost", "claim_err skip");
           return;
         }
 
-        this->endpoint_data_list[USB_EP_DESC_GET_EP_NUM(ep_desc)].bInterfaceNumber = _bInterfaceNumber;
-        this->endpoint_data_list[USB_EP_DESC_GET_EP_NUM(ep_desc)].bInterfaceClass = _bInterfaceClass;
-        this->endpoint_data_list[USB_EP_DESC_GET_EP_NUM(ep_desc)].bInterfaceSubClass = _bInterfaceSubClass;
-        this->endpoint_data_list[USB_EP_DESC_GET_EP_NUM(ep_desc)].bInterfaceProtocol = _bInterfaceProtocol;
-        this->endpoint_data_list[USB_EP_DESC_GET_EP_NUM(ep_desc)].bCountryCode = _bCountryCode;
+        device->endpoint_data_list[USB_EP_DESC_GET_EP_NUM(ep_desc)].bInterfaceNumber = device->_bInterfaceNumber;
+        device->endpoint_data_list[USB_EP_DESC_GET_EP_NUM(ep_desc)].bInterfaceClass = device->_bInterfaceClass;
+        device->endpoint_data_list[USB_EP_DESC_GET_EP_NUM(ep_desc)].bInterfaceSubClass = device->_bInterfaceSubClass;
+        device->endpoint_data_list[USB_EP_DESC_GET_EP_NUM(ep_desc)].bInterfaceProtocol = device->_bInterfaceProtocol;
+        device->endpoint_data_list[USB_EP_DESC_GET_EP_NUM(ep_desc)].bCountryCode = device->_bCountryCode;
 
         if ((ep_desc->bmAttributes & USB_BM_ATTRIBUTES_XFERTYPE_MASK) != USB_BM_ATTRIBUTES_XFER_INT) {
           ESP_LOGI("EspUsbHost", "err ep_desc->bmAttributes=%x", ep_desc->bmAttributes);
@@ -409,23 +506,33 @@ void EspUsbHost::onConfig(const uint8_t bDescriptorType, const uint8_t *p) {
         }
 
         if (ep_desc->bEndpointAddress & USB_B_ENDPOINT_ADDRESS_EP_DIR_MASK) {
-          esp_err_t err = usb_host_transfer_alloc(ep_desc->wMaxPacketSize + 1, 0, &this->usbTransfer[this->usbTransferSize]);
+          if (device->usbTransferSize >= 16) {
+            ESP_LOGI("EspUsbHost", "too many endpoints, bEndpointAddress=%x", ep_desc->bEndpointAddress);
+            return;
+          }
+
+          usb_transfer_t *transfer;
+          esp_err_t err = usb_host_transfer_alloc(ep_desc->wMaxPacketSize + 1, 0, &transfer);
           if (err != ESP_OK) {
-            this->usbTransfer[this->usbTransferSize] = NULL;
             ESP_LOGI("EspUsbHost", "usb_host_transfer_alloc() err=%x", err);
             return;
           } else {
             ESP_LOGI("EspUsbHost", "usb_host_transfer_alloc() ESP_OK data_buffer_size=%d", ep_desc->wMaxPacketSize + 1);
           }
 
-          this->usbTransfer[this->usbTransferSize]->device_handle = this->deviceHandle;
-          this->usbTransfer[this->usbTransferSize]->bEndpointAddress = ep_desc->bEndpointAddress;
-          this->usbTransfer[this->usbTransferSize]->callback = this->_onReceive;
-          this->usbTransfer[this->usbTransferSize]->context = this;
-          this->usbTransfer[this->usbTransferSize]->num_bytes = ep_desc->wMaxPacketSize;
+          transfer->device_handle = device->handle;
+          transfer->bEndpointAddress = ep_desc->bEndpointAddress;
+          transfer->callback = this->_onReceive;
+          transfer->context = device;
+          transfer->num_bytes = ep_desc->wMaxPacketSize;
+          device->usbTransfer[device->usbTransferSize] = transfer;
+          device->usbTransferSize++;
           interval = ep_desc->bInterval;
           isReady = true;
-          this->usbTransferSize++;
+
+          // The host controller polls the endpoint every bInterval; the
+          // completion callback resubmits, so the first submit starts the cycle.
+          _submitTransfer(transfer);
         }
       }
       break;
@@ -473,9 +580,9 @@ void EspUsbHost::onConfig(const uint8_t bDescriptorType, const uint8_t *p) {
                  hid_desc->bNumDescriptors,
                  hid_desc->bReportType,
                  hid_desc->wReportLength);
-        _bCountryCode = hid_desc->bCountryCode;
+        device->_bCountryCode = hid_desc->bCountryCode;
 
-        submitControl(0x81, 0x00, 0x22, _bInterfaceNumber, hid_desc->wReportLength);
+        submitControl(device, 0x81, 0x00, 0x22, device->_bInterfaceNumber, hid_desc->wReportLength);
       }
       break;
 
@@ -501,20 +608,38 @@ void EspUsbHost::onConfig(const uint8_t bDescriptorType, const uint8_t *p) {
 }
 
 void EspUsbHost::_onReceive(usb_transfer_t *transfer) {
-  EspUsbHost *usbHost = (EspUsbHost *)transfer->context;
-  endpoint_data_t *endpoint_data = &usbHost->endpoint_data_list[(transfer->bEndpointAddress & USB_B_ENDPOINT_ADDRESS_EP_NUM_MASK)];
+  device_t *device = deviceOf(transfer);
+  EspUsbHost *usbHost = device->host;
+
+  switch (transfer->status) {
+    case USB_TRANSFER_STATUS_COMPLETED:
+      break;
+    case USB_TRANSFER_STATUS_NO_DEVICE:
+    case USB_TRANSFER_STATUS_CANCELED:
+    case USB_TRANSFER_STATUS_STALL:
+      // Device gone or endpoint halted: leave the transfer idle
+      ESP_LOGI("EspUsbHost", "_onReceive() status=%d, bEndpointAddress=%x", transfer->status, transfer->bEndpointAddress);
+      return;
+    default:
+      // Transient error (NAK timeout, overflow, ...): poll again
+      _submitTransfer(transfer);
+      return;
+  }
+
+  endpoint_data_t *endpoint_data = &device->endpoint_data_list[(transfer->bEndpointAddress & USB_B_ENDPOINT_ADDRESS_EP_NUM_MASK)];
 
 #if (ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_VERBOSE)
   _printPcapText("URB_INTERRUPT in", 0x0009, 0x01, transfer->bEndpointAddress, 0x01, transfer->actual_num_bytes, 0xff, (const uint8_t *)transfer->data_buffer);
 
-  String buffer_str = "";
-  for (int i = 0; i < transfer->actual_num_bytes; i++) {
-    if (transfer->data_buffer[i] < 16) {
-      buffer_str += "0";
-    }
-    buffer_str += String(transfer->data_buffer[i], HEX) + " ";
+  // Hex dump into a fixed buffer; interrupt reports are at most 64 bytes
+  char buffer_str[64 * 3 + 1] = "";
+  int buffer_len = min(transfer->actual_num_bytes, 64);
+  for (int i = 0; i < buffer_len; i++) {
+    snprintf(&buffer_str[i * 3], 4, "%02x ", transfer->data_buffer[i]);
+  }
+  if (buffer_len > 0) {
+    buffer_str[buffer_len * 3 - 1] = '\0';
   }
-  buffer_str.trim();
   ESP_LOGV("EspUsbHost", "transfer\n"
                          "# bInterfaceClass    = 0x%x\n"
                          "# bInterfaceSubClass = 0x%x\n"
@@ -531,7 +656,7 @@ void EspUsbHost::_onReceive(usb_transfer_t *transfer) {
            endpoint_data->bInterfaceSubClass,
            endpoint_data->bInterfaceProtocol,
            endpoint_data->bCountryCode,
-           buffer_str.c_str(),
+           buffer_str,
            transfer->data_buffer_size,
            transfer->num_bytes,
            transfer->actual_num_bytes,
@@ -544,7 +669,7 @@ void EspUsbHost::_onReceive(usb_transfer_t *transfer) {
   if (endpoint_data->bInterfaceClass == USB_CLASS_HID) {
     if (endpoint_data->bInterfaceSubClass == HID_SUBCLASS_BOOT) {
       if (endpoint_data->bInterfaceProtocol == HID_ITF_PROTOCOL_KEYBOARD) {
-        static hid_keyboard_report_t last_report = {};
+        hid_keyboard_report_t &last_report = device->last_report;
 
         if (transfer->data_buffer[2] == HID_KEY_NUM_LOCK) {
           // HID_KEY_NUM_LOCK TODO!
@@ -573,7 +698,7 @@ void EspUsbHost::_onReceive(usb_transfer_t *transfer) {
           memcpy(&last_report, &report, sizeof(last_report));
         }
       } else if (endpoint_data->bInterfaceProtocol == HID_ITF_PROTOCOL_MOUSE) {
-        static uint8_t last_buttons = 0;
+        uint8_t &last_buttons = device->last_buttons;
         hid_mouse_report_t report = {};
         report.buttons = transfer->data_buffer[1];
         report.x = (uint8_t)transfer->data_buffer[2];
@@ -594,6 +719,8 @@ void EspUsbHost::_onReceive(usb_transfer_t *transfer) {
   }
 
   usbHost->onReceive(transfer);
+
+  _submitTransfer(transfer);
 }
 
 void EspUsbHost::onMouse(hid_mouse_report_t report, uint8_t last_buttons) {
@@ -742,9 +869,13 @@ void EspUsbHost::setHIDLocal(hid_local_enum_t code) {
   hidLocal = code;
 }
 
-esp_err_t EspUsbHost::submitControl(const uint8_t bmRequestType, const uint8_t bDescriptorIndex, const uint8_t bDescriptorType, const uint16_t wInterfaceNumber, const uint16_t wDescriptorLength) {
+esp_err_t EspUsbHost::submitControl(device_t *device, const uint8_t bmRequestType, const uint8_t bDescriptorIndex, const uint8_t bDescriptorType, const uint16_t wInterfaceNumber, const uint16_t wDescriptorLength) {
   usb_transfer_t *transfer;
-  usb_host_transfer_alloc(wDescriptorLength + 8 + 1, 0, &transfer);
+  esp_err_t err = usb_host_transfer_alloc(wDescriptorLength + 8 + 1, 0, &transfer);
+  if (err != ESP_OK) {
+    ESP_LOGI("EspUsbHost", "usb_host_transfer_alloc() err=%x", err);
+    return err;
+  }
 
   transfer->num_bytes = wDescriptorLength + 8;
   transfer->data_buffer[0] = bmRequestType;
@@ -756,19 +887,20 @@ esp_err_t EspUsbHost::submitControl(const uint8_t bmRequestType, const uint8_t b
   transfer->data_buffer[6] = wDescriptorLength & 0xff;
   transfer->data_buffer[7] = wDescriptorLength >> 8;
 
-  transfer->device_handle = deviceHandle;
+  transfer->device_handle = device->handle;
   transfer->bEndpointAddress = 0x00;
   transfer->callback = _onReceiveControl;
-  transfer->context = this;
+  transfer->context = device;
 
   //submitControl(0x81, 0x00, 0x22, 0x0000, 136);
   if (bmRequestType == 0x81 && bDescriptorIndex == 0x00 && bDescriptorType == 0x22) {
     _printPcapText("GET DESCRIPTOR Request HID Report", 0x0028, 0x00, 0x80, 0x02, 8, 0, transfer->data_buffer);
   }
 
-  esp_err_t err = usb_host_transfer_submit_control(clientHandle, transfer);
+  err = usb_host_transfer_submit_control(clientHandle, transfer);
   if (err != ESP_OK) {
     ESP_LOGI("EspUsbHost", "usb_host_transfer_submit_control() err=%x", err);
+    usb_host_transfer_free(transfer);
   }
   return err;
 }
@@ -1294,5 +1426,12 @@ void EspUsbHost::_onReceiveControl(usb_transfer_t *transfer) {
   printf("-----------------------------------------------------\n");
 #endif
 
+  // GET_DESCRIPTOR(HID Report): wIndex carries the interface number
+  if (transfer->status == USB_TRANSFER_STATUS_COMPLETED && transfer->actual_num_bytes > 8
+      && transfer->data_buffer[1] == 0x06 && transfer->data_buffer[3] == 0x22) {
+    device_t *device = deviceOf(transfer);
+    device->host->onReportDescriptor(device->address, transfer->data_buffer[4], &transfer->data_buffer[8], transfer->actual_num_bytes - 8);
+  }
+
   usb_host_transfer_free(transfer);
 }
\ No newline at end of file
@@ -6,6 +6,11 @@
 #include <class/hid/hid.h>
 #include <rom/usb/usb_common.h>
 
+// Devices served at the same time (e.g. several keypads behind a hub)
+#ifndef ESP_USB_HOST_MAX_DEVICES
+#define ESP_USB_HOST_MAX_DEVICES 4
+#endif
+
 class EspUsbHost {
 public:
   bool isReady = false;
@@ -19,27 +24,60 @@ public:
     uint8_t bInterfaceProtocol;
     uint8_t bCountryCode;    
   };
-  endpoint_data_t endpoint_data_list[17];
-  uint8_t _bInterfaceNumber;
-  uint8_t _bInterfaceClass;
-  uint8_t _bInterfaceSubClass;
-  uint8_t _bInterfaceProtocol;
-  uint8_t _bCountryCode;
-  esp_err_t claim_err;
+
+  // One opened device. It owns its transfers, claimed interfaces and
+  // last-report state; every transfer's context points back to it, so each
+  // completion callback knows which device it belongs to.
+  struct device_t {
+    EspUsbHost *host;
+    bool inUse;
+    uint8_t address;
+    usb_device_handle_t handle;
+
+    endpoint_data_t endpoint_data_list[17];
+    uint8_t _bInterfaceNumber;
+    uint8_t _bInterfaceClass;
+    uint8_t _bInterfaceSubClass;
+    uint8_t _bInterfaceProtocol;
+    uint8_t _bCountryCode;
+    esp_err_t claim_err;
+
+    usb_transfer_t *usbTransfer[16];
+    uint8_t usbTransferSize;
+    uint8_t usbInterface[16];
+    uint8_t usbInterfaceSize;
+
+    hid_keyboard_report_t last_report;
+    uint8_t last_buttons;
+  };
+  device_t devices[ESP_USB_HOST_MAX_DEVICES] = {};
+  device_t *configDevice = NULL;  // device whose descriptors onConfig() is parsing
 
   usb_host_client_handle_t clientHandle;
-  usb_device_handle_t deviceHandle;
   uint32_t eventFlags;
-  usb_transfer_t *usbTransfer[16];
-  uint8_t usbTransferSize;
-  uint8_t usbInterface[16];
-  uint8_t usbInterfaceSize;
 
   hid_local_enum_t hidLocal;
 
   void begin(void);
   void task(void);
 
+  device_t *findDevice(usb_device_handle_t handle);
+  static device_t *deviceOf(const usb_transfer_t *transfer) {
+    return (device_t *)transfer->context;
+  }
+
+  // Run the host library and client event loops in their own FreeRTOS tasks,
+  // blocking on events. Interrupt IN transfers are resubmitted from their
+  // completion callback, so task() must not be called from loop() afterwards.
+  // Callbacks (onReceive, onKeyboard, ...) then run in the client task.
+  bool beginTask(UBaseType_t priority = 5, BaseType_t core = tskNO_AFFINITY, uint32_t stackSize = 4096);
+  bool taskMode = false;
+  TaskHandle_t libTaskHandle = NULL;
+  TaskHandle_t clientTaskHandle = NULL;
+  static void _libTask(void *arg);
+  static void _clientTask(void *arg);
+  static void _submitTransfer(usb_transfer_t *transfer);
+
   static void _clientEventCallback(const usb_host_client_event_msg_t *eventMsg, void *arg);
   void _configCallback(const usb_config_desc_t *config_desc);
   void onConfig(const uint8_t bDescriptorType, const uint8_t *p);
@@ -47,11 +85,12 @@ public:
   static void _onReceive(usb_transfer_t *transfer);
 
   static void _printPcapText(const char* title, uint16_t function, uint8_t direction, uint8_t endpoint, uint8_t type, uint8_t size, uint8_t stage, const uint8_t *data);
-  esp_err_t submitControl(const uint8_t bmRequestType, const uint8_t bDescriptorIndex, const uint8_t bDescriptorType, const uint16_t wInterfaceNumber, const uint16_t wDescriptorLength);
+  esp_err_t submitControl(device_t *device, const uint8_t bmRequestType, const uint8_t bDescriptorIndex, const uint8_t bDescriptorType, const uint16_t wInterfaceNumber, const uint16_t wDescriptorLength);
   static void _onReceiveControl(usb_transfer_t *transfer);
 
   virtual void onReceive(const usb_transfer_t *transfer){};
   virtual void onGone(const usb_host_client_event_msg_t *eventMsg){};
+  virtual void onReportDescriptor(uint8_t address, uint8_t bInterfaceNumber, const uint8_t *desc, uint16_t len){};
 
   virtual uint8_t getKeycodeToAscii(uint8_t keycode, uint8_t shift);
   virtual void onKeyboard(hid_keyboard_report_t report, hid_keyboard_report_t last_report);
@@ -0,0 +1,143 @@
+#include "notify_packer.h"
+#include "var_poller.h"
+#include "config_store.h"
+#include <esp_gatts_api.h>
+
+// 全局notify打包实例
+NotifyPacker notifyPacker;
+
+uint8_t NotifyPacker::send(BLEServer* server, BLECharacteristic* characteristic, uint16_t connId,
+                          const uint8_t* entries, uint16_t count, uint16_t mtu, uint32_t* sequence,
+                          uint32_t batchStartMicros, uint8_t maxNotifies, uint16_t* consumed) {
+  // 有效载荷按条目对齐，MTU最小23时每个notify仍可装下标记 + 一个值
+  uint16_t payload = mtu > 3 ? mtu - 3 : 0;
+  if (payload > BLE_NOTIFY_MAX_PAYLOAD) payload = BLE_NOTIFY_MAX_PAYLOAD;
+  payload -= payload % VAR_RESPONSE_SIZE;
+  if (payload < 2 * VAR_RESPONSE_SIZE) payload = 2 * VAR_RESPONSE_SIZE;
+  payloadLimit = payload;
+
+  // 头占两个条目，还要能装下标记 + 一个值; 否则不加头 (App按首个哈希判断有无头)
+  bool header = sequence != nullptr && payload >= 4 * VAR_RESPONSE_SIZE;
+
+  uint8_t buffer[BLE_NOTIFY_MAX_PAYLOAD];
+  const uint8_t primaryEcu = configStore.get().ecuId;
+  uint8_t ecuId = primaryEcu;  // 下一个值所属的ECU
+  uint8_t sent = 0;
+  uint8_t attempts = 0;
+  uint16_t i = 0;
+
+  while (i < count && sent < maxNotifies) {
+    size_t len = header ? writeHeader(buffer, (*sequence)++, batchStartMicros) : 0;
+
+    if (attempts > 0 && ecuId != primaryEcu && !isVarEcuMarker(readInt32BigEndian(entries + i * VAR_RESPONSE_SIZE))) {
+      writeInt32BigEndian(varEcuMarker(ecuId), buffer + len);
+      memset(buffer + len + 4, 0, VAR_RESPONSE_SIZE - 4);
+      len += VAR_RESPONSE_SIZE;
+    }
+
+    const uint8_t* first = entries + i * VAR_RESPONSE_SIZE;
+    uint16_t fit = (payload - len) / VAR_RESPONSE_SIZE;
+    uint16_t n = count - i < fit ? count - i : fit;
+    for (uint16_t k = 0; k < n; k++) {
+      int32_t varHash = readInt32BigEndian(first + k * VAR_RESPONSE_SIZE);
+      if (isVarEcuMarker(varHash)) ecuId = (uint8_t)varHash;
+    }
+    i += n;
+
+    // 没有头和重复标记时直接从条目数组发送 (协议栈会复制)，否则拼到缓冲区
+    uint8_t* data = (uint8_t*)first;
+    if (len > 0) {
+      memcpy(buffer + len, first, n * VAR_RESPONSE_SIZE);
+      data = buffer;
+    }
+    len += n * VAR_RESPONSE_SIZE;
+
+    // BLECharacteristic::notify() 发往所有连接，这里直接按连接发送;
+    // 协议栈拒绝的notify不计入发送数 (不扣流控额度)，App从序号上能看到缺失
+    attempts++;
+    if (esp_ble_gatts_send_indicate(server->getGattsIf(), connId, characteristic->getHandle(), len, data,
+                                    false) != ESP_OK) {
+      errorCount++;
+      continue;
+    }
+    byteCount += len;
+    sent++;
+  }
+
+  notifyCount += sent;
+  if (attempts > 1) splitCount++;
+  if (consumed != nullptr) *consumed = i;
+  return sent;
+}
+
+uint16_t NotifyPacker::keepUnsent(const uint8_t* entries, uint16_t count, uint16_t consumed, uint8_t* out) {
+  if (consumed >= count) return 0;
+
+  // 已发送部分最后一个标记决定剩余条目所属的ECU
+  const uint8_t primaryEcu = configStore.get().ecuId;
+  uint8_t ecuId = primaryEcu;
+  for (uint16_t i = 0; i < consumed; i++) {
+    int32_t varHash = readInt32BigEndian(entries + i * VAR_RESPONSE_SIZE);
+    if (isVarEcuMarker(varHash)) ecuId = (uint8_t)varHash;
+  }
+
+  // 只有consumed > 0时才会补标记，目标不超过源，可以原地移动
+  const uint16_t remaining = count - consumed;
+  const bool marker =
+    ecuId != primaryEcu && !isVarEcuMarker(readInt32BigEndian(entries + consumed * VAR_RESPONSE_SIZE));
+  memmove(out + (marker ? VAR_RESPONSE_SIZE : 0), entries + consumed * VAR_RESPONSE_SIZE,
+          remaining * VAR_RESPONSE_SIZE);
+  if (!marker) return remaining;
+
+  writeInt32BigEndian(varEcuMarker(ecuId), out);
+  memset(out + 4, 0, VAR_RESPONSE_SIZE - 4);
+  return remaining + 1;
+}
+
+size_t NotifyPacker::writeHeader(uint8_t* out, uint32_t sequence, uint32_t batchStartMicros) {
+  // [VAR_HEADER_V1][序号] [设备时间 µs][批次年龄 µs]，与条目一样按大端排列
+  uint32_t now = micros();
+  writeInt32BigEndian((int32_t)VAR_HEADER_V1, out);
+  writeInt32BigEndian((int32_t)sequence, out + 4);
+  writeInt32BigEndian((int32_t)now, out + 8);
+  writeInt32BigEndian((int32_t)(now - batchStartMicros), out + 12);
+  return 2 * VAR_RESPONSE_SIZE;
+}
+
+uint16_t NotifyPacker::notifiesPerSecond(uint32_t nowMs) const {
+  uint32_t elapsed = nowMs - windowStartMs;
+  return elapsed > 0 ? (uint16_t)((uint64_t)notifyCount * 1000 / elapsed) : 0;
+}
+
+void NotifyPacker::resetWindow(uint32_t nowMs) {
+  notifyCount = 0;
+  byteCount = 0;
+  splitCount = 0;
+  errorCount = 0;
+  windowStartMs = nowMs;
+}
+
+void NotifyPacker::dump(Print& out) {
+  uint32_t now = millis();
+  out.printf("Notify: %u/s, %lu bytes avg, payload limit %u, %lu split batches, %lu errors\n",
+             notifiesPerSecond(now), (unsigned long)(notifyCount > 0 ? byteCount / notifyCount : 0), payloadLimit,
+             (unsigned long)splitCount, (unsigned long)errorCount);
+  resetWindow(now);
+}
+
+size_t NotifyPacker::encode(uint8_t* out, size_t maxLen) {
+  // [notifies/s u16][avg bytes u16][payload limit u16][split batches u32][errors u32]
+  const size_t size = 3 * 2 + 2 * 4;
+  if (maxLen < size) return 0;
+
+  uint32_t now = millis();
+  uint16_t rate = notifiesPerSecond(now);
+  uint16_t avgBytes = notifyCount > 0 ? byteCount / notifyCount : 0;
+  memcpy(out, &rate, 2);
+  memcpy(out + 2, &avgBytes, 2);
+  memcpy(out + 4, &payloadLimit, 2);
+  memcpy(out + 6, &splitCount, 4);
+  memcpy(out + 10, &errorCount, 4);
+  resetWindow(now);
+  return size;
+}
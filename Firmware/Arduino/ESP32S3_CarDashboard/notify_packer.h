@@ -0,0 +1,47 @@
+#ifndef NOTIFY_PACKER_H
+#define NOTIFY_PACKER_H
+
+#include "project_config.h"
+#include <BLEDevice.h>
+
+// ============================================================================
+// 按MTU打包变量notify
+// ============================================================================
+// 每个notify装满 MTU - 3 字节 (按8字节条目对齐)，超出的条目在同一轮循环中
+// 连续发送后续notify。后续notify的第一个值不属于 ECU_ID 时先重复ECU标记，
+// 每个notify都可以单独解析。notify只发往指定连接，多个中心设备各收各的响应。
+// 连接选择了VarData头时，每个notify前加 VAR_HEADER_V1 头 (序号、时间戳、批次年龄)。
+
+class NotifyPacker {
+public:
+  // 向一个连接发送 count 个 VAR_RESPONSE_SIZE 条目，返回协议栈接受的notify数。
+  // sequence非空时每个notify带头，使用并递增该连接的序号。
+  // 协议栈接受 maxNotifies 个notify后停止 (流控额度)，consumed非空时写入已处理的条目数
+  uint8_t send(BLEServer* server, BLECharacteristic* characteristic, uint16_t connId, const uint8_t* entries,
+               uint16_t count, uint16_t mtu, uint32_t* sequence, uint32_t batchStartMicros,
+               uint8_t maxNotifies = 0xFF, uint16_t* consumed = nullptr);
+
+  // send() 停在 consumed 处时，把剩余条目移到out开头 (out可以就是entries)，
+  // 所属ECU不是主ECU时前面补标记，之后可以单独发送。返回out中的条目数
+  static uint16_t keepUnsent(const uint8_t* entries, uint16_t count, uint16_t consumed, uint8_t* out);
+
+  // 诊断: 平均每个notify的字节数和每秒notify数，读取后重置
+  void dump(Print& out);
+  size_t encode(uint8_t* out, size_t maxLen);
+
+private:
+  uint32_t notifyCount = 0;
+  uint32_t byteCount = 0;
+  uint32_t splitCount = 0;  // 需要多个notify的批次
+  uint32_t errorCount = 0;  // 协议栈拒绝的notify
+  uint16_t payloadLimit = 0;
+  uint32_t windowStartMs = 0;
+
+  uint16_t notifiesPerSecond(uint32_t nowMs) const;
+  void resetWindow(uint32_t nowMs);
+  static size_t writeHeader(uint8_t* out, uint32_t sequence, uint32_t batchStartMicros);
+};
+
+extern NotifyPacker notifyPacker;
+
+#endif  // NOTIFY_PACKER_H
@@ -38,19 +38,105 @@ static const uint32_t QUARTZ_FREQUENCY = 8UL * 1000UL * 1000UL;  // 8MHz晶振
 // ============================================================================
 // 超时配置
 // ============================================================================
-#define VAR_REQUEST_TIMEOUT_MS 100     // Timeout waiting for ECU response
+#define VAR_REQUEST_TIMEOUT_MS 100     // Timeout waiting for ECU response (adaptive upper bound)
+#define VAR_REQUEST_TIMEOUT_MIN_MS 5   // Adaptive timeout lower bound
+#define VAR_RTO_K 4                    // Timeout = SRTT + K * RTTVAR
 #define BLE_NOTIFY_MIN_INTERVAL_MS 10  // Minimum interval between BLE notifications
 #define RECONNECT_DELAY_MS 100         // Delay before restarting advertising (was 500)
 
+// 负缓存: 连续超时的变量按指数退避跳过
+#define NEG_CACHE_SIZE 16
+#define NEG_CACHE_THRESHOLD 2             // 连续超时次数达到后开始退避
+#define NEG_CACHE_BASE_BACKOFF_MS 1000    // 首次退避时间，之后每次加倍
+#define NEG_CACHE_MAX_BACKOFF_MS 60000
+
+// 变量目录校验: 请求的哈希不在 variables.json 中时的处理
+#define VAR_CATALOG_OFF 0     // 不校验
+#define VAR_CATALOG_FLAG 1    // 照常请求，只记录和计数
+#define VAR_CATALOG_REJECT 2  // 不发往CAN总线
+#define VAR_CATALOG_MODE VAR_CATALOG_REJECT
+
+// USB主机任务: 阻塞等待USB事件，延迟跟随设备的bInterval而不是主循环周期
+#define USB_HOST_TASK_PRIORITY 5
+#define USB_HOST_TASK_CORE 1  // 与loop()同核，BLE协议栈在核0
+#define USB_HOST_TASK_STACK_SIZE 4096
+
+// CAN任务: USB按钮帧入队和收到CAN帧时立即被唤醒，按键到总线、ECU响应到下一个请求的
+// 延迟与主循环周期无关。有请求在途或帧在等待发送缓冲区时每 CAN_TASK_RETRY_MS 检查超时和重试，
+// 空闲时每 CAN_TASK_IDLE_MS 关闭统计窗口。优先级高于USB任务，入队后立即运行
+#define CAN_TASK_PRIORITY 6
+#define CAN_TASK_CORE 1
+#define CAN_TASK_STACK_SIZE 4096
+#define CAN_TASK_RETRY_MS 1
+#define CAN_TASK_IDLE_MS 10
+
+// USB HID -> 按钮掩码: 每条规则把一段连续的Usage映射到从 firstBit 开始的掩码位
+struct HidButtonRule {
+  uint16_t usagePage;
+  uint16_t usageMin;
+  uint16_t usageMax;
+  uint8_t firstBit;
+};
+
+const HidButtonRule HID_BUTTON_RULES[] = {
+  { 0x09, 0x01, 0x10, 0 },  // Button 1-16 -> bit 0-15 (手柄、按钮盒)
+  { 0x07, 0x68, 0x73, 0 },  // Keyboard F13-F24 -> bit 0-11 (键盘型按钮盒)
+  { 0x07, 0x1E, 0x27, 0 },  // Keyboard 1-9, 0 -> bit 0-9
+};
+
+#define HID_MAP_MAX_REPORTS 8  // 所有设备、所有接口的输入报告布局总数
+#define HID_MAP_MAX_LUTS 16    // 每张查找表 512 字节
+
+// USB抓包环形缓冲区 (串口 'c' 开关，'p' 导出pcap)
+#define USB_CAPTURE_DEPTH 64      // 记录条数
+#define USB_CAPTURE_MAX_DATA 64   // 每条最多保存的报告字节数
+
+// USB按钮 -> CAN: 掩码变化时排队发送，发送缓冲区满时在截止时间内重试
+#define USB_CAN_QUEUE_SIZE 8          // 必须是2的幂
+#define USB_CAN_TX_DEADLINE_MS 50     // 超过后丢弃该帧
+
+// CAN发送优先级: 按钮 > 变量请求 > 变量设置，分别使用TXB2/TXB1/TXB0，
+// 每个TXB有独立的驱动发送缓冲区 (帧数)
+#define CAN_TX_BUFFER_BUTTON 4
+#define CAN_TX_BUFFER_REQUEST 4
+#define CAN_TX_BUFFER_SET 8
+
+// BLE变量设置 (GPS、虚拟ADC) -> CAN: 每个哈希一个槽位，新值覆盖未发送的旧值
+#define VAR_SET_SLOTS 32     // GPS + 16路ADC，留有余量
+#define VAR_SET_TX_RATE 200  // 总线预算 (帧/秒)，500kbps下约占5%
+#define VAR_SET_TX_BURST 4   // 空闲后可连续发送的帧数
+
 // ============================================================================
 // CAN协议定义
 // ============================================================================
 #define TS_HW_BUTTONBOX1_CATEGORY 27    // hardware button box 1
 #define CANBUS_BUTTONBOX_ADDRESS 0x711  // CANBUS BUTTONBOX TX
-#define ECU_ID 1
+#define ECU_ID 1                     // 主ECU: 未指定ECU的请求和变量设置发往此ID
 #define CAN_VAR_REQUEST_BASE 0x700   // TX: Request variable (0x700 + ecuId)
 #define CAN_VAR_RESPONSE_BASE 0x720  // RX: Variable broadcast (0x720 + ecuId)
 #define CAN_GPS_DATA_BASE 0x780      // TX: GPS data to ECU (0x780 + ecuId)
+#define CAN_BITRATE 500000UL         // 总线波特率 (自动检测没有结果时使用)
+
+// 自动波特率 (可选): MCP2515只听模式下 (不发ACK和错误帧，不干扰ECU) 依次尝试各波特率，
+// 窗口内收到足够多的有效帧且接收错误不多于有效帧即选定，之前不发送任何帧。
+// 结果保存在NVS，下次启动先试该波特率; 一整轮没有流量时直接使用该结果
+#define CAN_AUTOBAUD 0                // 1 = 默认配置为自动 (运行时配置项1 = 0)
+#define CAN_BITRATE_AUTO 0
+const uint32_t CAN_AUTOBAUD_RATES[] = { 1000000, 500000, 250000, 125000 };
+#define CAN_AUTOBAUD_WINDOW_MS 250    // 每个波特率的监听时间
+#define CAN_AUTOBAUD_MIN_FRAMES 3     // 选定所需的有效帧数
+
+// 可轮询的ECU，每个一个独立的请求通道 (并行轮询)
+const uint8_t VAR_ECU_IDS[] = { ECU_ID, 2 };  // 主ECU + 第二个EpicEFI
+#define VAR_ECU_COUNT (sizeof(VAR_ECU_IDS) / sizeof(VAR_ECU_IDS[0]))
+
+// ============================================================================
+// 总线负载统计
+// ============================================================================
+#define BUS_STATS_TOP_K 16                // 每ID统计表大小
+#define BUS_STATS_WINDOW_MS 1000          // 统计窗口
+#define BUS_LOAD_SATURATED_PERMILLE 700   // 负载超过70%视为饱和
+#define BUS_LOAD_BACKOFF_MAX_MS 20        // 饱和时变量请求间最大额外间隔
 
 // ============================================================================
 // BLE UUID定义
@@ -60,28 +146,106 @@ static const uint32_t QUARTZ_FREQUENCY = 8UL * 1000UL * 1000UL;  // 8MHz晶振
 #define CHAR_VAR_DATA_UUID "beb5483e-36e1-4688-b7f5-ea07361b26a9"
 #define CHAR_VAR_REQUEST_UUID "beb5483e-36e1-4688-b7f5-ea07361b26aa"
 #define CHAR_GPS_DATA_UUID "beb5483e-36e1-4688-b7f5-ea07361b26ab"
+#define CHAR_DIAG_UUID "beb5483e-36e1-4688-b7f5-ea07361b26ac"
+#define CHAR_FLOW_CREDIT_UUID "beb5483e-36e1-4688-b7f5-ea07361b26ad"
+#define CHAR_CONFIG_UUID "beb5483e-36e1-4688-b7f5-ea07361b26ae"
+
+// ============================================================================
+// BLE连接参数
+// ============================================================================
+// 连接后主动请求的参数，notify速率受连接间隔和每个连接事件的PDU长度限制
+#define BLE_CONN_INTERVAL_MIN 6    // 1.25 ms 单位: 7.5 ms
+#define BLE_CONN_INTERVAL_MAX 12   // 15 ms
+#define BLE_CONN_LATENCY 0
+#define BLE_CONN_TIMEOUT 400       // 10 ms 单位: 4 s
+#define BLE_DATA_LENGTH 251        // LE数据长度扩展 (DLE)，最大PDU载荷
+#define BLE_PREFER_2M_PHY 1        // 对方支持时使用2M PHY
+#define BLE_NOTIFY_MAX_PAYLOAD 512 // 单个notify上限 (ATT属性值最大512字节)，实际按 MTU - 3
+#define BLE_MAX_CENTRALS 3         // 同时连接的中心设备 (手机、平板、记录仪)，不超过 CONFIG_BT_ACL_CONNECTIONS
+#define BLE_FLOW_MAX_CREDITS 64    // 流控: App授予的notify额度上限
 
 // ============================================================================
 // 批量请求配置
 // ============================================================================
-#define MAX_BATCH_VARS 16  // 4 bytes hash + 4 bytes value
+#define MAX_BATCH_VARS 128        // 批量请求池容量，所有ECU共享 (4 bytes hash + 4 bytes value)
+#define VAR_REQUEST_MAX_BYTES 512  // 一次VarRequest写入的上限 (ATT属性值最大512字节)
 #define VAR_RESPONSE_SIZE 8
 
+// 多ECU: 哈希位置上的 0xFFFFECnn 是ECU标记，请求中表示后续哈希发往ECU nn，
+// 响应中 [标记][0] 表示后续值来自ECU nn。只涉及 ECU_ID 时不出现标记，与旧格式相同
+#define VAR_ECU_MARKER 0xFFFFEC00UL
+
+// VarData头 (可选): 请求中包含选项条目 0xFFFFED01 时，该连接的每个notify以两个条目开头:
+// [0xFFFFED01][序号 u32] [设备时间 µs u32][批次年龄 µs u32]，均为大端。序号按连接逐notify递增，
+// App据此统计丢包和乱序，批次年龄为最早的请求到该notify发送的时间。MTU太小 (< 35) 时不加头
+#define VAR_OPTION_MARKER 0xFFFFED00UL
+#define VAR_HEADER_V1 0xFFFFED01UL
+#define VAR_RESPONSE_MAX_ENTRIES (MAX_BATCH_VARS * 2)  // 值 + 最坏情况下的标记
+
+// 被动嗅探: 其他工具 (TunerStudio、记录仪) 请求得到的 0x720 + ecuId 响应也写入缓存，
+// 缓存中足够新的变量直接放入批量响应，不再发请求
+#define VAR_SNIFF_ENABLED 1
+#define VAR_CACHE_SLOTS 64         // (ECU, 哈希) 缓存项数，满时替换最旧的
+#define VAR_SNIFF_MAX_AGE_MS 100   // 缓存值在此时间内视为新鲜
+
+// ============================================================================
+// ECU广播解码配置
+// ============================================================================
+// 按 dbc_signals.h 中的信号定义 (DBC子集) 解码ECU周期广播帧，写入变量缓存，
+// 常用仪表变量不再需要 0x700 请求
+#define DBC_DECODER_ENABLED 1
+#define DBC_MAX_SIGNALS 32
+#define CAN_BROADCAST_BASE 0x200  // rusEFI verbose CAN 广播基址
+
+// ============================================================================
+// 运行时配置
+// ============================================================================
+// 波特率、ECU_ID、CAN ID、请求超时、notify间隔、嗅探缓存时效和变量设置预算
+// 可通过配置特征修改并保存在NVS中 (config_store.h)，上面的定义是默认值
+#define CONFIG_NVS_NAMESPACE "dashcfg"
+#define CONFIG_VERSION 1
+#define CONFIG_WRITE_MAX_BYTES 60  // 一次写入最多12项 [id][值 u32 小端]
+
+// ============================================================================
+// 诊断配置
+// ============================================================================
+// 诊断命令: BLE写入CHAR_DIAG_UUID的第一个字节，或串口输入对应字符
+#define DIAG_CMD_LATENCY 0x01    // 延迟直方图 (串口 'l')
+#define DIAG_CMD_BUS_STATS 0x02  // 总线负载和每ID帧率 (串口 'b')
+#define DIAG_CMD_TIMEOUTS 0x03   // 自适应超时和负缓存 (串口 't')
+#define DIAG_CMD_HID_MAP 0x04    // USB HID按钮映射 (串口 'h')
+#define DIAG_CMD_BLE_LINK 0x05   // BLE连接参数 (串口 'k')
+#define DIAG_MAX_REPORT_SIZE 128
+// 超过连接 MTU - 3 的报告分片发送: [0x80 | cmd][part][序号, bit7 = 最后一片] + 报告第3字节起的内容
+#define DIAG_FRAGMENT_FLAG 0x80
+#define DIAG_FRAGMENT_LAST 0x80
+
 // ============================================================================
 // 变量哈希定义
 // ============================================================================
+// ECU变量名哈希: 名称转小写后的djb2，编译期求值
+constexpr uint32_t varHashStep(const char* name, uint32_t hash) {
+  return *name == '\0'
+           ? hash
+           : varHashStep(name + 1, hash * 33 + (uint8_t)(*name >= 'A' && *name <= 'Z' ? *name + ('a' - 'A') : *name));
+}
+
+constexpr int32_t varHash(const char* name) {
+  return (int32_t)varHashStep(name, 5381);
+}
+
 // GPS变量哈希
-const int32_t VAR_HASH_GPS_HMSD_PACKED = 703958849;      // Hours, minutes, seconds, days (packed)
-const int32_t VAR_HASH_GPS_MYQSAT_PACKED = -1519914092;  // Months, years, quality, satellites (packed)
-const int32_t VAR_HASH_GPS_ACCURACY = -1489698215;
-const int32_t VAR_HASH_GPS_ALTITUDE = -2100224086;
-const int32_t VAR_HASH_GPS_COURSE = 1842893663;
-const int32_t VAR_HASH_GPS_LATITUDE = 1524934922;
-const int32_t VAR_HASH_GPS_LONGITUDE = -809214087;
-const int32_t VAR_HASH_GPS_SPEED = -1486968225;
+constexpr int32_t VAR_HASH_GPS_HMSD_PACKED = varHash("gps_hmsd_packed");  // Hours, minutes, seconds, days (packed)
+constexpr int32_t VAR_HASH_GPS_MYQSAT_PACKED = varHash("gps_myqsat_packed");  // Months, years, quality, satellites (packed)
+constexpr int32_t VAR_HASH_GPS_ACCURACY = varHash("gps_accuracy");
+constexpr int32_t VAR_HASH_GPS_ALTITUDE = varHash("gps_altitude");
+constexpr int32_t VAR_HASH_GPS_COURSE = varHash("gps_course");
+constexpr int32_t VAR_HASH_GPS_LATITUDE = varHash("gps_latitude");
+constexpr int32_t VAR_HASH_GPS_LONGITUDE = varHash("gps_longitude");
+constexpr int32_t VAR_HASH_GPS_SPEED = varHash("gps_speed");
 
 
-// 虚拟ADC变量哈希
+// 虚拟ADC变量哈希 (ECU端名称不在 variables.json 中，保留ECU给出的值)
 const int32_t VAR_HASH_ADC[16] = {
   595545759,    // A0
   595545760,    // A1
@@ -101,7 +265,7 @@ const int32_t VAR_HASH_ADC[16] = {
   -1821826347   // A15
 };
 
-// 数字输入变量哈希
+// 数字输入变量哈希 (同上，ECU端名称未知)
 const int32_t VAR_HASH_D22_D37 = 2138825443;
 
 // ============================================================================
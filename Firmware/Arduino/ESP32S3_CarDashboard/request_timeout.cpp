@@ -0,0 +1,170 @@
+#include "request_timeout.h"
+#include "latency_stats.h"
+#include "var_catalog.h"
+#include "config_store.h"
+
+// ============================================================================
+// RTT估计
+// ============================================================================
+
+void RequestTimeout::onRequestSent(int32_t varHash, uint32_t sentMicros) {
+  inFlightHash = varHash;
+  inFlightMicros = sentMicros;
+  inFlight = true;
+  answered = false;
+}
+
+void RequestTimeout::onResponse(int32_t varHash, uint32_t rxMicros) {
+  // ECU认识这个哈希，不论是否为当前请求都移出负缓存
+  removeNegative(varHash);
+
+  // 只对当前请求采样 (Karn算法: 迟到的响应不参与估计)
+  if (inFlight && !answered && varHash == inFlightHash) {
+    answered = true;
+    // 按驱动读出响应的时刻计算，CAN任务处理的延迟不计入RTT
+    uint32_t rttUs = rxMicros - inFlightMicros;
+    latencyStats.record(LAT_CAN_REQUEST_RTT, rttUs);
+    sampleRtt(rttUs);
+  }
+}
+
+void RequestTimeout::sampleRtt(uint32_t rttUs) {
+  if (!hasSample) {
+    srttUs = rttUs;
+    rttvarUs = rttUs / 2;
+    hasSample = true;
+  } else {
+    uint32_t err = srttUs > rttUs ? srttUs - rttUs : rttUs - srttUs;
+    rttvarUs = rttvarUs - rttvarUs / 4 + err / 4;
+    srttUs = srttUs - srttUs / 8 + rttUs / 8;
+  }
+  backoffShift = 0;
+}
+
+uint32_t RequestTimeout::timeoutMs() const {
+  const RuntimeConfig& config = configStore.get();
+  if (!hasSample) return config.varRequestTimeoutMs;
+
+  uint32_t rtoMs = (srttUs + VAR_RTO_K * rttvarUs + 999) / 1000;
+  rtoMs <<= backoffShift;
+  if (rtoMs < config.varRequestTimeoutMinMs) rtoMs = config.varRequestTimeoutMinMs;
+  if (rtoMs > config.varRequestTimeoutMs) rtoMs = config.varRequestTimeoutMs;
+  return rtoMs;
+}
+
+bool RequestTimeout::onTimeout(uint32_t nowMs) {
+  bool wasAnswered = inFlight && answered;
+  bool wasInFlight = inFlight;
+  inFlight = false;
+
+  if (wasAnswered) return false;
+
+  if (wasInFlight) {
+    recordFailure(inFlightHash, nowMs);
+    if (backoffShift < 4) backoffShift++;
+  }
+  return true;
+}
+
+// ============================================================================
+// 负缓存
+// ============================================================================
+
+NegativeCacheEntry* RequestTimeout::findNegative(int32_t varHash) {
+  for (uint8_t i = 0; i < negativeCount; i++) {
+    if (negativeCache[i].varHash == varHash) return &negativeCache[i];
+  }
+  return nullptr;
+}
+
+const NegativeCacheEntry* RequestTimeout::findNegative(int32_t varHash) const {
+  for (uint8_t i = 0; i < negativeCount; i++) {
+    if (negativeCache[i].varHash == varHash) return &negativeCache[i];
+  }
+  return nullptr;
+}
+
+void RequestTimeout::removeNegative(int32_t varHash) {
+  NegativeCacheEntry* entry = findNegative(varHash);
+  if (entry == nullptr) return;
+
+  *entry = negativeCache[--negativeCount];
+}
+
+void RequestTimeout::recordFailure(int32_t varHash, uint32_t nowMs) {
+  NegativeCacheEntry* entry = findNegative(varHash);
+  if (entry == nullptr) {
+    if (negativeCount < NEG_CACHE_SIZE) {
+      entry = &negativeCache[negativeCount++];
+    } else {
+      // 表满: 替换失败次数最少的条目
+      entry = &negativeCache[0];
+      for (uint8_t i = 1; i < negativeCount; i++) {
+        if (negativeCache[i].failures < entry->failures) entry = &negativeCache[i];
+      }
+    }
+    *entry = { varHash, 0, nowMs };
+  }
+
+  if (entry->failures < 0xFF) entry->failures++;
+
+  if (entry->failures >= NEG_CACHE_THRESHOLD) {
+    uint8_t shift = min<uint8_t>(entry->failures - NEG_CACHE_THRESHOLD, 16);
+    uint32_t backoffMs = min<uint32_t>((uint32_t)NEG_CACHE_BASE_BACKOFF_MS << shift, NEG_CACHE_MAX_BACKOFF_MS);
+    entry->retryAtMs = nowMs + backoffMs;
+  }
+}
+
+bool RequestTimeout::isBackedOff(int32_t varHash, uint32_t nowMs) const {
+  const NegativeCacheEntry* entry = findNegative(varHash);
+  if (entry == nullptr || entry->failures < NEG_CACHE_THRESHOLD) return false;
+  return (int32_t)(nowMs - entry->retryAtMs) < 0;
+}
+
+// ============================================================================
+// 诊断输出
+// ============================================================================
+
+void RequestTimeout::dump(Print& out) const {
+  out.printf("srtt=%luus rttvar=%luus timeout=%lums backoff=x%u\n",
+             (unsigned long)srttUs, (unsigned long)rttvarUs,
+             (unsigned long)timeoutMs(), 1U << backoffShift);
+
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < negativeCount; i++) {
+    const NegativeCacheEntry& entry = negativeCache[i];
+    int32_t retryIn = (int32_t)(entry.retryAtMs - now);
+    const char* name = VarCatalog::name(entry.varHash);
+    out.printf("  hash=%ld (%s) failures=%u retry_in=%ldms\n",
+               (long)entry.varHash, name != nullptr ? name : "?", entry.failures,
+               (long)(entry.failures >= NEG_CACHE_THRESHOLD && retryIn > 0 ? retryIn : 0));
+  }
+}
+
+// [0] DIAG_CMD_TIMEOUTS, [1] ECU ID, [2..5] SRTT µs, [6..9] RTTVAR µs, [10..11] 超时 ms, [12] 条目数,
+// 每条目 [hash i32][failures u8][retry_in ms u32]，小端
+size_t RequestTimeout::encode(uint8_t ecuId, uint8_t* out, size_t maxLen) const {
+  if (maxLen < 13) return 0;
+
+  uint16_t timeout = (uint16_t)timeoutMs();
+  uint8_t count = min<size_t>(negativeCount, (maxLen - 13) / 9);
+
+  out[0] = DIAG_CMD_TIMEOUTS;
+  out[1] = ecuId;
+  memcpy(out + 2, &srttUs, 4);
+  memcpy(out + 6, &rttvarUs, 4);
+  memcpy(out + 10, &timeout, 2);
+  out[12] = count;
+
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < count; i++) {
+    const NegativeCacheEntry& entry = negativeCache[i];
+    int32_t retryIn = (int32_t)(entry.retryAtMs - now);
+    uint32_t retryInMs = entry.failures >= NEG_CACHE_THRESHOLD && retryIn > 0 ? (uint32_t)retryIn : 0;
+    uint8_t* p = out + 13 + i * 9;
+    memcpy(p, &entry.varHash, 4);
+    p[4] = entry.failures;
+    memcpy(p + 5, &retryInMs, 4);
+  }
+  return 13 + count * 9;
+}
@@ -0,0 +1,60 @@
+#ifndef REQUEST_TIMEOUT_H
+#define REQUEST_TIMEOUT_H
+
+#include "project_config.h"
+
+// ============================================================================
+// 自适应变量请求超时
+// ============================================================================
+// 按TCP (RFC 6298) 方式从0x720响应时间估计 SRTT/RTTVAR，
+// 超时 = SRTT + K*RTTVAR，限制在 [VAR_REQUEST_TIMEOUT_MIN_MS, VAR_REQUEST_TIMEOUT_MS]。
+// 连续超时的哈希进入负缓存，按指数退避跳过，避免一个无效变量拖慢整批。
+// 每个ECU通道一个实例 (见 VarPoller)。
+
+struct NegativeCacheEntry {
+  int32_t varHash;
+  uint8_t failures;    // 连续超时次数
+  uint32_t retryAtMs;  // 退避结束时间
+};
+
+class RequestTimeout {
+public:
+  // 请求已发出 / 收到0x720响应; 时间戳为发送前和驱动读出响应帧的 micros()
+  void onRequestSent(int32_t varHash, uint32_t sentMicros);
+  void onResponse(int32_t varHash, uint32_t rxMicros);
+
+  // 当前请求超时，返回false表示其实已收到响应
+  bool onTimeout(uint32_t nowMs);
+
+  // 当前超时时间
+  uint32_t timeoutMs() const;
+
+  // 是否应跳过该变量 (负缓存退避中)
+  bool isBackedOff(int32_t varHash, uint32_t nowMs) const;
+
+  // 诊断输出
+  void dump(Print& out) const;
+  size_t encode(uint8_t ecuId, uint8_t* out, size_t maxLen) const;
+
+private:
+  uint32_t srttUs = 0;
+  uint32_t rttvarUs = 0;
+  bool hasSample = false;
+  uint8_t backoffShift = 0;  // 超时后加倍，收到有效样本后清零
+
+  int32_t inFlightHash = 0;
+  uint32_t inFlightMicros = 0;
+  bool inFlight = false;
+  bool answered = false;
+
+  NegativeCacheEntry negativeCache[NEG_CACHE_SIZE] = {};
+  uint8_t negativeCount = 0;
+
+  void sampleRtt(uint32_t rttUs);
+  NegativeCacheEntry* findNegative(int32_t varHash);
+  const NegativeCacheEntry* findNegative(int32_t varHash) const;
+  void removeNegative(int32_t varHash);
+  void recordFailure(int32_t varHash, uint32_t nowMs);
+};
+
+#endif  // REQUEST_TIMEOUT_H
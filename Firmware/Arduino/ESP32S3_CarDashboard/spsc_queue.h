@@ -0,0 +1,49 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <stddef.h>
+
+// ============================================================================
+// 单生产者/单消费者无锁环形队列
+// ============================================================================
+// 生产者和消费者可以在不同任务中，各自只写自己的索引。
+// N 必须是2的幂；索引自由递增，用差值判断满/空。
+
+template <typename T, size_t N>
+class SpscQueue {
+  static_assert(N > 0 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+  // 生产者: 队列满返回false
+  bool push(const T& item) {
+    size_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= N) return false;
+
+    items[h & (N - 1)] = item;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  // 消费者: 队首元素，空时返回nullptr；处理完后调用pop()
+  T* front() {
+    size_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return nullptr;
+    return &items[t & (N - 1)];
+  }
+
+  void pop() {
+    tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  size_t size() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+  }
+
+private:
+  T items[N];
+  std::atomic<size_t> head{ 0 };
+  std::atomic<size_t> tail{ 0 };
+};
+
+#endif  // SPSC_QUEUE_H
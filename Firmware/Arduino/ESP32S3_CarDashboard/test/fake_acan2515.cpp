@@ -0,0 +1,111 @@
+#include "fake_can_bus.h"
+#include <ACAN2515.h>
+#include <deque>
+
+static ACAN2515* fakeDriver = nullptr;
+static std::deque<CANMessage> pendingRx;
+
+FakeCanController& fakeCan() {
+  static FakeCanController controller = { 0, ACAN2515Settings::NormalMode, 0, 0, false };
+  return controller;
+}
+
+std::vector<CANMessage>& fakeCanSent() {
+  static std::vector<CANMessage> sent;
+  return sent;
+}
+
+void fakeCanReceive(const CANMessage& frame) {
+  pendingRx.push_back(frame);
+  fakeDriver->isr();
+}
+
+CANMessage fakeCanFrame(uint32_t id, const uint8_t* data, uint8_t len) {
+  CANMessage frame;
+  frame.id = id;
+  frame.len = len;
+  memcpy(frame.data, data, len);
+  return frame;
+}
+
+// ============================================================================
+// ACAN2515 成员 (CanManager用到的部分)
+// ============================================================================
+
+ACAN2515::ACAN2515(const uint8_t inCS, SPIClass& inSPI, const uint8_t inINT)
+  : mSPI(inSPI),
+    mSPISettings(),
+    mCS(inCS),
+    mINT(inINT),
+    mRolloverEnable(false),
+    mReceiveBuffer(),
+    mCallBackFunctionArray(),
+    mTXBIsFree() {
+  fakeDriver = this;
+  mReceiveBuffer.initWithSize(32, true);
+  for (uint8_t i = 0; i < 3; i++) {
+    mTransmitBuffer[i].initWithSize(16, true);
+  }
+}
+
+uint16_t ACAN2515::begin(const ACAN2515Settings& inSettings, void (*inInterruptServiceRoutine)(void)) {
+  mReceiveBuffer.initWithSize(inSettings.mReceiveBufferSize, true);
+  fakeCan().bitrate = inSettings.mDesiredBitRate;
+  fakeCan().mode = inSettings.mRequestedMode;
+  return 0;
+}
+
+uint16_t ACAN2515::changeModeOnTheFly(const ACAN2515Settings::RequestedMode inRequestedMode) {
+  fakeCan().mode = inRequestedMode;
+  return 0;
+}
+
+uint16_t ACAN2515::changeBitRateOnTheFly(const ACAN2515Settings& inSettings) {
+  if (!inSettings.mBitRateClosedToDesiredRate) return kTooFarFromDesiredBitRate;
+  fakeCan().bitrate = inSettings.mDesiredBitRate;
+  fakeCan().mode = inSettings.mRequestedMode;
+  return 0;
+}
+
+// 中断任务: 取出注入的帧
+void ACAN2515::isr(void) {
+  while (!pendingRx.empty()) {
+    const bool stored = mReceiveBuffer.append(pendingRx.front(), micros());
+    if (mReceiveCallBack != NULL) mReceiveCallBack(pendingRx.front(), stored);
+    pendingRx.pop_front();
+  }
+}
+
+bool ACAN2515::receive(CANMessage& outFrame) {
+  return mReceiveBuffer.remove(outFrame);
+}
+
+const CANMessage* ACAN2515::peekReceivedMessage(void) {
+  return mReceiveBuffer.peek();
+}
+
+const CANMessage* ACAN2515::peekReceivedMessage(uint32_t& outReceiveMicros) {
+  return mReceiveBuffer.peek(outReceiveMicros);
+}
+
+void ACAN2515::releaseReceivedMessage(void) {
+  mReceiveBuffer.drop();
+}
+
+bool ACAN2515::tryToSend(const CANMessage& inMessage) {
+  if (fakeCan().txFull) return false;
+  fakeCanSent().push_back(inMessage);
+  return true;
+}
+
+uint8_t ACAN2515::receiveErrorCounter(void) {
+  return fakeCan().rec;
+}
+
+uint8_t ACAN2515::transmitErrorCounter(void) {
+  return 0;
+}
+
+uint8_t ACAN2515::errorFlagRegister(void) {
+  return fakeCan().eflg;
+}
@@ -0,0 +1,31 @@
+#ifndef FAKE_CAN_BUS_H
+#define FAKE_CAN_BUS_H
+
+#include <ACAN2515_CANMessage.h>
+#include <ACAN2515Settings.h>
+#include <vector>
+
+// ============================================================================
+// ACAN2515替身
+// ============================================================================
+// fake_acan2515.cpp 代替驱动实现，不访问SPI: 发送的帧记录在 fakeCanSent()，
+// fakeCanReceive() 像中断任务一样把帧放入驱动接收缓冲区并调用接收回调。
+// fakeCan() 是控制器状态: begin()/changeXxxOnTheFly() 写入波特率和模式，
+// 测试设定REC、EFLG和发送缓冲区是否已满。
+
+struct FakeCanController {
+  uint32_t bitrate;
+  ACAN2515Settings::RequestedMode mode;
+  uint8_t rec;
+  uint8_t eflg;
+  bool txFull;  // tryToSend() 返回false
+};
+
+FakeCanController& fakeCan();
+
+std::vector<CANMessage>& fakeCanSent();
+void fakeCanReceive(const CANMessage& frame);
+
+CANMessage fakeCanFrame(uint32_t id, const uint8_t* data, uint8_t len);
+
+#endif  // FAKE_CAN_BUS_H
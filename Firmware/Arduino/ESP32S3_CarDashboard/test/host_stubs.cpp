@@ -0,0 +1,62 @@
+#include "host_stubs.h"
+#include <Preferences.h>
+#include <SPI.h>
+#include <esp_gatts_api.h>
+
+HardwareSerial Serial;
+
+static unsigned long fakeMillis = 1000;
+
+void setMillis(unsigned long ms) {
+  fakeMillis = ms;
+}
+
+void advanceMillis(unsigned long ms) {
+  fakeMillis += ms;
+}
+
+unsigned long millis() {
+  return fakeMillis;
+}
+
+unsigned long micros() {
+  return fakeMillis * 1000;
+}
+
+void delay(unsigned long ms) {
+  advanceMillis(ms);
+}
+
+void delayMicroseconds(unsigned int) {}
+void yield() {}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return LOW; }
+void noInterrupts() {}
+void interrupts() {}
+
+// 固件中定义在 ble_manager.cpp
+void logMessage(const String& message) {
+  if (getenv("HOST_TEST_VERBOSE") != nullptr) printf("%lums: %s\n", millis(), message.c_str());
+}
+
+// ============================================================================
+// stubs/ 中声明的替身状态
+// ============================================================================
+
+SPIClass SPI;
+
+std::map<std::string, uint32_t>& fakeNvs() {
+  static std::map<std::string, uint32_t> nvs;
+  return nvs;
+}
+
+std::vector<FakeIndication>& fakeIndications() {
+  static std::vector<FakeIndication> indications;
+  return indications;
+}
+
+esp_err_t& fakeIndicateResult() {
+  static esp_err_t result = ESP_OK;
+  return result;
+}
@@ -0,0 +1,22 @@
+#ifndef HOST_STUBS_H
+#define HOST_STUBS_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// 主机测试支持
+// ============================================================================
+// 时钟只在测试调用 advanceMillis() 时前进; delay() 同样推进时钟。
+
+void setMillis(unsigned long ms);
+void advanceMillis(unsigned long ms);
+
+#define CHECK(cond)                                                      \
+  do {                                                                   \
+    if (!(cond)) {                                                       \
+      fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+      exit(1);                                                           \
+    }                                                                    \
+  } while (0)
+
+#endif  // HOST_STUBS_H
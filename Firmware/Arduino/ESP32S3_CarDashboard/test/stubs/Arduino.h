@@ -0,0 +1,134 @@
+// 主机测试用的Arduino最小替身: 只提供被测模块用到的接口
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <stdarg.h>
+#include <atomic>
+#include <algorithm>
+#include <string>
+#include "freertos_stub.h"
+
+using std::max;
+using std::min;
+typedef uint8_t byte;
+
+#define HEX 16
+#define DEC 10
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define IRAM_ATTR
+#define PROGMEM
+
+class String {
+public:
+  String(const char* s = "") : value(s) {}
+  String(const std::string& s) : value(s) {}
+  String(char c) : value(1, c) {}
+  String(int v, unsigned char base = 10) : value(format(base == 16 ? "%x" : "%d", v)) {}
+  String(unsigned int v, unsigned char base = 10) : value(format(base == 16 ? "%x" : "%u", v)) {}
+  String(long v, unsigned char base = 10) : value(format(base == 16 ? "%lx" : "%ld", v)) {}
+  String(unsigned long v, unsigned char base = 10) : value(format(base == 16 ? "%lx" : "%lu", v)) {}
+  String(float v, unsigned int decimals = 2) : value(format("%.*f", decimals, v)) {}
+  String(double v, unsigned int decimals = 2) : value(format("%.*f", decimals, v)) {}
+
+  String& operator+=(const String& other) {
+    value += other.value;
+    return *this;
+  }
+  friend String operator+(const String& a, const String& b) { return String(a.value + b.value); }
+  friend String operator+(const String& a, const char* b) { return String(a.value + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b.value); }
+
+  size_t length() const { return value.size(); }
+  const char* c_str() const { return value.c_str(); }
+  char operator[](size_t i) const { return i < value.size() ? value[i] : 0; }
+
+private:
+  std::string value;
+
+  template <typename T>
+  static std::string format(const char* fmt, T v) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), fmt, v);
+    return buf;
+  }
+  template <typename T>
+  static std::string format(const char* fmt, unsigned int decimals, T v) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), fmt, (int)decimals, (double)v);
+    return buf;
+  }
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) { return write(&c, 1); }
+  virtual size_t write(const uint8_t* buffer, size_t size) = 0;
+
+  size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(unsigned int v, int base = DEC) { return print(String(v, base)); }
+  size_t print(int v, int base = DEC) { return print(String(v, base)); }
+  size_t println() { return print("\n"); }
+  template <typename T>
+  size_t println(const T& v) { return print(v) + println(); }
+  template <typename T>
+  size_t println(const T& v, int base) { return print(v, base) + println(); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    if (len < 0) return 0;
+    return write((const uint8_t*)buf, min<size_t>(len, sizeof(buf) - 1));
+  }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+  void flush() {}
+};
+
+// 输出到stdout
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long) {}
+  using Print::write;
+  // 与 logMessage() 一样只在设置了 HOST_TEST_VERBOSE 时输出
+  size_t write(const uint8_t* buffer, size_t size) override {
+    return getenv("HOST_TEST_VERBOSE") != nullptr ? fwrite(buffer, 1, size, stdout) : size;
+  }
+};
+extern HardwareSerial Serial;
+
+// 时钟由测试控制，见 host_stubs.h
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void noInterrupts();
+void interrupts();
+
+#define ESP_LOGI(tag, ...) do {} while (0)
+#define ESP_LOGD(tag, ...) do {} while (0)
+#define ESP_LOGW(tag, ...) do {} while (0)
+#define ESP_LOGE(tag, ...) do {} while (0)
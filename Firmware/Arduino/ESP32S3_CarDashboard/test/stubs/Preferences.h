@@ -0,0 +1,25 @@
+// NVS替身: 所有命名空间共用一个内存表，测试用 fakeNvs() 检查或清空
+#pragma once
+#include <Arduino.h>
+#include <map>
+#include <string>
+
+std::map<std::string, uint32_t>& fakeNvs();
+
+class Preferences {
+public:
+  bool begin(const char* name, bool readOnly = false) { return true; }
+  void end() {}
+  uint32_t getUInt(const char* key, uint32_t defaultValue = 0) {
+    auto it = fakeNvs().find(key);
+    return it == fakeNvs().end() ? defaultValue : it->second;
+  }
+  size_t putUInt(const char* key, uint32_t value) {
+    fakeNvs()[key] = value;
+    return sizeof(value);
+  }
+  bool clear() {
+    fakeNvs().clear();
+    return true;
+  }
+};
@@ -0,0 +1,26 @@
+// ESP32 BLE库替身: 只有被测模块用到的类型和调用
+#pragma once
+#include <Arduino.h>
+
+typedef int esp_gatt_if_t;
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+class BLEUUID {
+public:
+  BLEUUID(const char*) {}
+};
+
+class BLECharacteristic {
+public:
+  static const uint32_t PROPERTY_READ = 1, PROPERTY_WRITE = 2, PROPERTY_NOTIFY = 4, PROPERTY_WRITE_NR = 8;
+  void setValue(const uint8_t* data, size_t len) {}
+  void notify(bool = true) {}
+  uint16_t getHandle() { return 0x2A; }
+};
+
+class BLEServer {
+public:
+  esp_gatt_if_t getGattsIf() { return 3; }
+};
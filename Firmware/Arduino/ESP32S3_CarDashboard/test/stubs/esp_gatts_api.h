@@ -0,0 +1,19 @@
+// 记录每个notify; fakeIndicateResult() 设定协议栈的返回值
+#pragma once
+#include "ble_stub.h"
+#include <vector>
+
+struct FakeIndication {
+  uint16_t connId;
+  std::vector<uint8_t> data;
+};
+
+std::vector<FakeIndication>& fakeIndications();
+esp_err_t& fakeIndicateResult();
+
+inline esp_err_t esp_ble_gatts_send_indicate(esp_gatt_if_t gattsIf, uint16_t connId, uint16_t handle, uint16_t len,
+                                             uint8_t* value, bool needConfirm) {
+  if (fakeIndicateResult() != ESP_OK) return fakeIndicateResult();
+  fakeIndications().push_back({ connId, std::vector<uint8_t>(value, value + len) });
+  return ESP_OK;
+}
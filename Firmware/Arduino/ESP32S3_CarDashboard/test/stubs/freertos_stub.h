@@ -0,0 +1,17 @@
+// 主机测试是单线程的: 临界区为空操作
+#pragma once
+#include <stdint.h>
+
+typedef struct {
+  int unused;
+} portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+
+inline void portENTER_CRITICAL(portMUX_TYPE*) {}
+inline void portEXIT_CRITICAL(portMUX_TYPE*) {}
+inline void taskENTER_CRITICAL(portMUX_TYPE*) {}
+inline void taskEXIT_CRITICAL(portMUX_TYPE*) {}
+
+// 任务通知: 测试直接调用任务中的处理函数
+typedef void* TaskHandle_t;
+inline void xTaskNotifyGive(TaskHandle_t) {}
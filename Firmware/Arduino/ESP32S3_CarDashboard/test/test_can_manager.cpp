@@ -0,0 +1,148 @@
+#include "host_stubs.h"
+#include "fake_can_bus.h"
+#include "can_manager.h"
+#include "config_store.h"
+#include <Preferences.h>
+#include <set>
+
+static const uint8_t FRAME[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+// CAN任务空闲时的一次唤醒
+static void loopOnce() {
+  advanceMillis(CAN_TASK_IDLE_MS);
+  canManager.service();
+}
+
+// 运行时配置为自动波特率; cached非0时作为上次检测到的结果
+static void configureAutobaud(uint32_t cached) {
+  fakeNvs().clear();
+  fakeNvs()["bitrate"] = CAN_BITRATE_AUTO;
+  if (cached != 0) fakeNvs()["autoBitrate"] = cached;
+  configStore.begin();
+  fakeCan().rec = 0;
+  fakeCan().eflg = 0;
+  fakeCanSent().clear();
+}
+
+static void testSilentBusStaysListenOnly() {
+  configureAutobaud(0);
+  CHECK(canManager.init());
+  CHECK(fakeCan().mode == ACAN2515Settings::ListenOnlyMode);
+  CHECK(fakeCan().bitrate == CAN_BITRATE);
+  CHECK(!canManager.isTransmitEnabled());
+
+  // 没有流量也没有上次的结果: 不猜测波特率进入正常模式，一直轮流监听
+  std::set<uint32_t> probed;
+  for (int i = 0; i < 500; i++) {
+    loopOnce();
+    probed.insert(fakeCan().bitrate);
+    CHECK(fakeCan().mode == ACAN2515Settings::ListenOnlyMode);
+  }
+  CHECK(probed.count(500000) && probed.count(250000) && probed.count(125000));
+  CHECK(!canManager.isTransmitEnabled());
+  CHECK(canManager.getBitrate() == 0);
+  CHECK(configStore.detectedBitrate() == 0);
+
+  // 发送全部被拒绝，总线上没有任何帧
+  CHECK(!canManager.requestVariable(ECU_ID, 0x1234));
+  CHECK(!canManager.sendButtonFrame(0x0001));
+  CHECK(!canManager.sendVariableToEcu(0x1234, 1.0f));
+  CHECK(canManager.queueButtonFrame(0x0001, micros()));
+  canManager.processTx();
+  CHECK(fakeCanSent().empty());
+}
+
+static void testSilentBusUsesCachedRate() {
+  // ECU只回答请求的总线: 一整轮没有流量后用上次检测到的波特率进入正常模式
+  configureAutobaud(250000);
+  CHECK(canManager.init());
+  CHECK(fakeCan().bitrate == 250000);
+
+  int loops = 0;
+  while (!canManager.isTransmitEnabled()) {
+    CHECK(++loops < 500);
+    CHECK(fakeCan().mode == ACAN2515Settings::ListenOnlyMode);
+    loopOnce();
+  }
+  CHECK(loops * 10 >= 3 * CAN_AUTOBAUD_WINDOW_MS);  // 250k/500k/125k各一个窗口
+  CHECK(fakeCan().mode == ACAN2515Settings::NormalMode);
+  CHECK(fakeCan().bitrate == 250000);
+  CHECK(canManager.getBitrate() == 250000);
+  CHECK(canManager.requestVariable(ECU_ID, 0x1234));
+  CHECK(fakeCanSent().size() == 1);
+}
+
+static void testRateWithReceiveErrorsIsRejected() {
+  // 总线为250k; 其他波特率下偶尔有帧碰巧通过CRC，但错误更多，REC净上升
+  configureAutobaud(0);
+  CHECK(canManager.init());
+
+  std::set<uint32_t> rejected;
+  for (int i = 0; i < 500 && !canManager.isTransmitEnabled(); i++) {
+    const uint32_t rate = fakeCan().bitrate;
+    fakeCanReceive(fakeCanFrame(0x100, FRAME, sizeof(FRAME)));
+    if (rate != 250000) {
+      fakeCan().rec += 2;
+      rejected.insert(rate);
+    } else if (fakeCan().rec > 0) {
+      fakeCan().rec--;
+    }
+    loopOnce();
+  }
+
+  CHECK(rejected.count(500000));
+  CHECK(canManager.isTransmitEnabled());
+  CHECK(fakeCan().mode == ACAN2515Settings::NormalMode);
+  CHECK(fakeCan().bitrate == 250000);
+  CHECK(canManager.getBitrate() == 250000);
+  CHECK(configStore.detectedBitrate() == 250000);
+
+  fakeCanSent().clear();
+  CHECK(canManager.requestVariable(ECU_ID, 0x1234));
+  CHECK(fakeCanSent().size() == 1);
+}
+
+static void testAckErrorsDoNotRejectRate() {
+  // 总线上只有ECU和本机: ECU的帧没有应答，先以错误帧重发16次 (REC +16)，
+  // 变为错误被动后同一帧被反复正常收到 (REC逐帧回落)
+  configureAutobaud(0);
+  CHECK(canManager.init());
+  CHECK(fakeCan().bitrate == 500000);
+
+  fakeCan().rec = 16;
+  for (int i = 0; i < 20; i++) {
+    fakeCanReceive(fakeCanFrame(0x100, FRAME, sizeof(FRAME)));
+    if (fakeCan().rec > 0) fakeCan().rec--;
+  }
+  for (int i = 0; i < CAN_AUTOBAUD_WINDOW_MS / CAN_TASK_IDLE_MS; i++) loopOnce();
+
+  CHECK(canManager.isTransmitEnabled());
+  CHECK(canManager.getBitrate() == 500000);
+}
+
+static void testFixedBitrateSkipsDetection() {
+  // 默认配置 (CAN_AUTOBAUD 0): 固定波特率，直接进入正常模式
+  fakeNvs().clear();
+  configStore.begin();
+  CHECK(canManager.init());
+  CHECK(fakeCan().mode == ACAN2515Settings::NormalMode);
+  CHECK(fakeCan().bitrate == CAN_BITRATE);
+  CHECK(canManager.isTransmitEnabled());
+
+  fakeNvs()["bitrate"] = 125000;
+  configStore.begin();
+  CHECK(canManager.init());
+  CHECK(fakeCan().mode == ACAN2515Settings::NormalMode);
+  CHECK(fakeCan().bitrate == 125000);
+  CHECK(canManager.isTransmitEnabled());
+}
+
+int main() {
+  testSilentBusStaysListenOnly();
+  testSilentBusUsesCachedRate();
+  testRateWithReceiveErrorsIsRejected();
+  testAckErrorsDoNotRejectRate();
+  testFixedBitrateSkipsDetection();
+  puts("test_can_manager: ok");
+  return 0;
+}
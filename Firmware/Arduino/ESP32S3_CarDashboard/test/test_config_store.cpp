@@ -0,0 +1,121 @@
+#include "host_stubs.h"
+#include "config_store.h"
+#include <Preferences.h>
+
+static void testDefaults() {
+  fakeNvs().clear();
+  ConfigStore store;
+  store.begin();
+  CHECK(store.get().canBitrate == (CAN_AUTOBAUD ? CAN_BITRATE_AUTO : CAN_BITRATE));
+  CHECK(store.get().ecuId == ECU_ID);
+  CHECK(store.get().canVarRequestBase == CAN_VAR_REQUEST_BASE);
+  CHECK(store.get().canVarResponseBase == CAN_VAR_RESPONSE_BASE);
+  CHECK(store.detectedBitrate() == 0);
+  CHECK(!store.rebootPending());
+}
+
+static void testHotAndRebootKeys() {
+  fakeNvs().clear();
+  ConfigStore store;
+  store.begin();
+
+  // 热应用项立即生效，主ECU重启后生效
+  CHECK(store.set(CFG_VAR_REQUEST_TIMEOUT_MS, 50));
+  CHECK(store.get().varRequestTimeoutMs == 50);
+  CHECK(store.set(CFG_ECU_ID, 3));
+  CHECK(store.get().ecuId == ECU_ID);
+  CHECK(store.rebootPending());
+
+  // 配置特征的值: 主ECU的记录带"重启后生效"标志
+  uint8_t encoded[128];
+  size_t len = store.encode(encoded, sizeof(encoded));
+  CHECK(len > 0 && encoded[0] == CONFIG_VERSION);
+  bool found = false;
+  for (size_t i = 1; i + 6 <= len; i += 6) {
+    if (encoded[i] != CFG_ECU_ID) continue;
+    uint32_t value;
+    memcpy(&value, encoded + i + 2, 4);
+    CHECK(encoded[i + 1] == 0x01 && value == 3);
+    found = true;
+  }
+  CHECK(found);
+
+  // 重启: 两项都从NVS读回
+  ConfigStore rebooted;
+  rebooted.begin();
+  CHECK(rebooted.get().ecuId == 3);
+  CHECK(rebooted.get().varRequestTimeoutMs == 50);
+  CHECK(!rebooted.rebootPending());
+}
+
+static void testInvalidValuesAreRejected() {
+  fakeNvs().clear();
+  ConfigStore store;
+  store.begin();
+
+  CHECK(!store.set(0x42, 1));                          // 未知项
+  CHECK(!store.set(CFG_CAN_BITRATE, 300000));          // 范围内但不是支持的波特率
+  CHECK(!store.set(CFG_CAN_BITRATE, 1000000));         // 8MHz晶振产生不了，重启后CAN无法初始化
+  CHECK(!store.set(CFG_ECU_ID, 0));
+  CHECK(!store.set(CFG_ECU_ID, 0xFF));
+  CHECK(!store.set(CFG_VAR_REQUEST_TIMEOUT_MIN_MS, store.get().varRequestTimeoutMs + 1));
+  CHECK(fakeNvs().empty());
+
+  // 与 VAR_ECU_IDS 中其他通道的ECU重复会产生两个相同的轮询通道
+  for (uint8_t ecuId : VAR_ECU_IDS) {
+    if (ecuId != ECU_ID) CHECK(!store.set(CFG_ECU_ID, ecuId));
+  }
+  CHECK(store.set(CFG_ECU_ID, ECU_ID));
+}
+
+static void testInvalidStoredConfigFallsBackToDefaults() {
+  // 旧固件可能已保存重复的主ECU
+  fakeNvs().clear();
+  fakeNvs()["ecu"] = 2;
+  fakeNvs()["reqTmo"] = 50;
+  ConfigStore store;
+  store.begin();
+  CHECK(store.get().ecuId == ECU_ID);
+  CHECK(store.get().varRequestTimeoutMs == VAR_REQUEST_TIMEOUT_MS);
+}
+
+static void testUnsupportedStoredBitrateFallsBackToDefaults() {
+  fakeNvs().clear();
+  fakeNvs()["bitrate"] = 1000000;
+  ConfigStore store;
+  store.begin();
+  CHECK(store.get().canBitrate == (CAN_AUTOBAUD ? CAN_BITRATE_AUTO : CAN_BITRATE));
+}
+
+static void testResetAndDetectedBitrate() {
+  fakeNvs().clear();
+  ConfigStore store;
+  store.begin();
+  store.saveDetectedBitrate(250000);
+  CHECK(store.set(CFG_CAN_VAR_REQUEST_BASE, 0x600));
+  CHECK(store.set(CFG_CAN_BITRATE, 125000));
+
+  ConfigStore rebooted;
+  rebooted.begin();
+  CHECK(rebooted.detectedBitrate() == 250000);
+  CHECK(rebooted.get().canBitrate == 125000);
+  CHECK(rebooted.get().canVarRequestBase == 0x600);
+
+  CHECK(rebooted.resetDefaults());
+  CHECK(rebooted.detectedBitrate() == 0);
+  CHECK(rebooted.get().canVarRequestBase == CAN_VAR_REQUEST_BASE);
+  CHECK(rebooted.get().canBitrate == 125000);  // 重启后才恢复
+  CHECK(rebooted.rebootPending());
+  CHECK(fakeNvs().empty());
+}
+
+int main() {
+  testDefaults();
+  testHotAndRebootKeys();
+  testInvalidValuesAreRejected();
+  testInvalidStoredConfigFallsBackToDefaults();
+  testUnsupportedStoredBitrateFallsBackToDefaults();
+  testResetAndDetectedBitrate();
+  puts("test_config_store: ok");
+  return 0;
+}
@@ -0,0 +1,102 @@
+#include "host_stubs.h"
+#include "fake_can_bus.h"
+#include "dbc_decoder.h"
+#include "dbc_signals.h"
+#include "var_cache.h"
+#include "config_store.h"
+
+static const uint32_t INTEL_ID = 0x300;
+static const uint32_t MOTOROLA_ID = 0x301;
+static const uint32_t EXTENDED_ID = 0x18FF0001UL;
+static const uint32_t INVALID_ID = 0x302;
+
+static const DbcSignal SIGNALS[] = {
+  // Intel: 起始位为最低位
+  { INTEL_ID, 0, 16, false, false, 1.0f, 0.0f, ECU_ID, 0x100 },  // 字节0-1
+  { INTEL_ID, 4, 12, false, true, 0.5f, 10.0f, ECU_ID, 0x101 },  // 字节0高4位 + 字节1，有符号
+  { INTEL_ID, 56, 8, false, false, 1.0f, 0.0f, ECU_ID, 0x102 },  // 字节7，无符号不扩展符号
+  // Motorola: 起始位为最高位 (DBC锯齿编号)
+  { MOTOROLA_ID, 7, 16, true, false, 1.0f, 0.0f, ECU_ID, 0x110 },  // 字节0 (高) - 字节1
+  { MOTOROLA_ID, 13, 10, true, true, 1.0f, 0.0f, 2, 0x111 },       // 字节1 bit5..0 + 字节2 bit7..4，有符号
+  // 扩展帧 (bit31)
+  { EXTENDED_ID | 0x80000000UL, 0, 32, false, true, 1.0f, 0.0f, ECU_ID, 0x120 },
+  // Motorola最高位在字节7 bit4，长度10超出帧尾: 跳过
+  { INVALID_ID, 60, 10, true, false, 1.0f, 0.0f, ECU_ID, 0x130 },
+};
+
+// 解码后从变量缓存读出的值
+static float cachedValue(uint8_t ecuId, int32_t varHash) {
+  uint8_t entry[VAR_RESPONSE_SIZE];
+  CHECK(varCache.copyFresh(ecuId, varHash, millis(), 1000, entry));
+  CHECK(readInt32BigEndian(entry) == varHash);
+  return readFloat32BigEndian(entry + 4);
+}
+
+static bool isCached(uint8_t ecuId, int32_t varHash) {
+  uint8_t entry[VAR_RESPONSE_SIZE];
+  return varCache.copyFresh(ecuId, varHash, millis(), 1000, entry);
+}
+
+static void testIntel() {
+  // 0x1234; 12位有符号 0xF9C = -100 -> -100 * 0.5 + 10; 字节7 0xFF = 255
+  const uint8_t data[8] = { 0xC4, 0xF9, 0, 0, 0, 0, 0, 0xFF };
+  CHECK(dbcDecoder.decode(fakeCanFrame(INTEL_ID, data, 8), millis()) == 3);
+  CHECK(cachedValue(ECU_ID, 0x101) == -40.0f);
+  CHECK(cachedValue(ECU_ID, 0x102) == 255.0f);
+
+  const uint8_t plain[8] = { 0x34, 0x12 };
+  CHECK(dbcDecoder.decode(fakeCanFrame(INTEL_ID, plain, 8), millis()) == 3);
+  CHECK(cachedValue(ECU_ID, 0x100) == 4660.0f);
+  CHECK(cachedValue(ECU_ID, 0x101) == 0x123 * 0.5f + 10.0f);  // 正数不扩展
+}
+
+static void testMotorola() {
+  // 0x123F 大端; 10位有符号 0x3FD = -3: 字节1低6位 111111，字节2高4位 1101
+  const uint8_t data[8] = { 0x12, 0x3F, 0xD0 };
+  CHECK(dbcDecoder.decode(fakeCanFrame(MOTOROLA_ID, data, 3), millis()) == 2);
+  CHECK(cachedValue(ECU_ID, 0x110) == (float)0x123F);
+  CHECK(cachedValue(2, 0x111) == -3.0f);
+
+  // 正数: 0x0FF = 255 (字节1低6位 001111，字节2高4位 1111)
+  const uint8_t positive[8] = { 0x12, 0x0F, 0xF0 };
+  CHECK(dbcDecoder.decode(fakeCanFrame(MOTOROLA_ID, positive, 3), millis()) == 2);
+  CHECK(cachedValue(2, 0x111) == 255.0f);
+}
+
+static void testShortFrameSkipsSignals() {
+  // DLC 2: Motorola信号到字节2 (minLen 3) 不解码，不读帧尾之后的旧字节
+  advanceMillis(2000);
+  const uint8_t data[8] = { 0xAB, 0xCD, 0xEE };
+  CHECK(dbcDecoder.decode(fakeCanFrame(MOTOROLA_ID, data, 2), millis()) == 1);
+  CHECK(cachedValue(ECU_ID, 0x110) == (float)0xABCD);
+  CHECK(!isCached(2, 0x111));
+
+  // DLC 7: Intel字节7的信号跳过
+  const uint8_t intel[8] = { 0x01, 0x00, 0, 0, 0, 0, 0, 0x7F };
+  CHECK(dbcDecoder.decode(fakeCanFrame(INTEL_ID, intel, 7), millis()) == 2);
+  CHECK(!isCached(ECU_ID, 0x102));
+
+  // 无效信号在init()中被丢弃
+  CHECK(dbcDecoder.decode(fakeCanFrame(INVALID_ID, data, 8), millis()) == 0);
+}
+
+static void testExtendedFrames() {
+  // 32位有符号; 同一ID的标准帧不匹配
+  const uint8_t data[8] = { 0xFE, 0xFF, 0xFF, 0xFF };
+  CANMessage frame = fakeCanFrame(EXTENDED_ID, data, 4);
+  CHECK(dbcDecoder.decode(frame, millis()) == 0);
+  frame.ext = true;
+  CHECK(dbcDecoder.decode(frame, millis()) == 1);
+  CHECK(cachedValue(ECU_ID, 0x120) == -2.0f);
+}
+
+int main() {
+  configStore.begin();
+  CHECK(dbcDecoder.init(SIGNALS, sizeof(SIGNALS) / sizeof(SIGNALS[0])));
+  testIntel();
+  testMotorola();
+  testShortFrameSkipsSignals();
+  testExtendedFrames();
+  puts("test_dbc_decoder: ok");
+  return 0;
+}
@@ -0,0 +1,85 @@
+#include "host_stubs.h"
+#include "hid_button_map.h"
+
+// 标准启动键盘: 修饰键、保留字节、6个键码槽
+static const uint8_t KEYBOARD[] = {
+  0x05, 0x01, 0x09, 0x06, 0xA1, 0x01, 0x05, 0x07, 0x19, 0xE0, 0x29, 0xE7, 0x15, 0x00, 0x25, 0x01,
+  0x75, 0x01, 0x95, 0x08, 0x81, 0x02, 0x95, 0x01, 0x75, 0x08, 0x81, 0x01, 0x95, 0x05, 0x75, 0x01,
+  0x05, 0x08, 0x19, 0x01, 0x29, 0x05, 0x91, 0x02, 0x95, 0x01, 0x75, 0x03, 0x91, 0x01, 0x95, 0x06,
+  0x75, 0x08, 0x15, 0x00, 0x25, 0x65, 0x05, 0x07, 0x19, 0x00, 0x29, 0x65, 0x81, 0x00, 0xC0,
+};
+
+// Report ID 1: 16个按钮位 + X/Y
+static const uint8_t GAMEPAD[] = {
+  0x05, 0x01, 0x09, 0x05, 0xA1, 0x01, 0x85, 0x01, 0x05, 0x09, 0x19, 0x01, 0x29, 0x10, 0x15, 0x00,
+  0x25, 0x01, 0x75, 0x01, 0x95, 0x10, 0x81, 0x02, 0x05, 0x01, 0x09, 0x30, 0x09, 0x31, 0x15, 0x81,
+  0x25, 0x7F, 0x75, 0x08, 0x95, 0x02, 0x81, 0x02, 0xC0,
+};
+
+// 256位常量填充 (2字节Report Count 0x96)，按钮1~8在第32字节
+static const uint8_t LONG_PADDING[] = {
+  0x05, 0x01, 0x09, 0x05, 0xA1, 0x01, 0x75, 0x01, 0x96, 0x00, 0x01, 0x81, 0x03, 0x05, 0x09, 0x19,
+  0x01, 0x29, 0x08, 0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x08, 0x81, 0x02, 0xC0,
+};
+
+// 按钮1~8在第0字节，之后65535字节的填充超出可映射长度，再之后的按钮9~16无法映射
+static const uint8_t OVERFLOW_PADDING[] = {
+  0x05, 0x01, 0x09, 0x05, 0xA1, 0x01, 0x05, 0x09, 0x19, 0x01, 0x29, 0x08, 0x15, 0x00, 0x25, 0x01,
+  0x75, 0x01, 0x95, 0x08, 0x81, 0x02, 0x75, 0x08, 0x96, 0xFF, 0xFF, 0x81, 0x03, 0x19, 0x09, 0x29,
+  0x10, 0x75, 0x01, 0x95, 0x08, 0x81, 0x02, 0xC0,
+};
+
+static void testDevicesAreMerged() {
+  HidButtonMap map;
+  CHECK(map.compile(2, 0, KEYBOARD, sizeof(KEYBOARD)));
+  CHECK(map.compile(3, 0, KEYBOARD, sizeof(KEYBOARD)));
+  CHECK(map.compile(4, 0, GAMEPAD, sizeof(GAMEPAD)));
+
+  const uint8_t key1[8] = { 0, 0, 0x1E, 0, 0, 0, 0, 0 };  // 数字键1 -> bit 0
+  const uint8_t key3[8] = { 0, 0, 0x20, 0, 0, 0, 0, 0 };  // 数字键3 -> bit 2
+  const uint8_t pad[5] = { 1, 0x80, 0, 0, 0 };             // 按钮8 -> bit 7
+  CHECK(map.apply(2, 0, key1, sizeof(key1)) == 0x0001);
+  CHECK(map.apply(3, 0, key3, sizeof(key3)) == 0x0005);
+  CHECK(map.apply(4, 0, pad, sizeof(pad)) == 0x0085);
+
+  // 断开一个设备只释放它的按钮
+  map.removeDevice(3);
+  CHECK(map.currentMask() == 0x0081);
+  CHECK(map.compile(3, 0, KEYBOARD, sizeof(KEYBOARD)));
+  CHECK(map.apply(3, 0, key3, sizeof(key3)) == 0x0085);
+  map.removeDevice(2);
+  map.removeDevice(4);
+  CHECK(map.currentMask() == 0x0004);
+}
+
+static void testTwoByteReportCount() {
+  HidButtonMap map;
+  CHECK(map.compile(2, 0, LONG_PADDING, sizeof(LONG_PADDING)));
+
+  uint8_t report[33] = {};
+  report[0] = 0xFF;  // 填充不影响按钮
+  CHECK(map.apply(2, 0, report, sizeof(report)) == 0x0000);
+  report[32] = 0x01;
+  CHECK(map.apply(2, 0, report, sizeof(report)) == 0x0001);
+}
+
+static void testOverflowingFieldIsRejected() {
+  HidButtonMap map;
+  CHECK(!map.compile(2, 0, OVERFLOW_PADDING, sizeof(OVERFLOW_PADDING)));
+
+  // 溢出之前的字段仍然有效，之后的字段不映射到错误的字节
+  uint8_t report[64] = {};
+  report[0] = 0x02;
+  CHECK(map.apply(2, 0, report, sizeof(report)) == 0x0002);
+  report[0] = 0;
+  memset(report + 1, 0xFF, sizeof(report) - 1);
+  CHECK(map.apply(2, 0, report, sizeof(report)) == 0x0000);
+}
+
+int main() {
+  testDevicesAreMerged();
+  testTwoByteReportCount();
+  testOverflowingFieldIsRejected();
+  puts("test_hid_button_map: ok");
+  return 0;
+}
@@ -0,0 +1,168 @@
+#include "host_stubs.h"
+#include "notify_packer.h"
+#include "var_poller.h"
+#include "config_store.h"
+#include <esp_gatts_api.h>
+
+static BLEServer server;
+static BLECharacteristic characteristic;
+
+// count个条目: 哈希 = 0x1000 + 序号，值 = 序号; ecu2From起的条目属于ECU 2 (前面插入标记)
+static uint16_t makeEntries(uint8_t* out, uint16_t count, uint16_t ecu2From) {
+  uint16_t n = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    if (i == ecu2From) {
+      writeInt32BigEndian(varEcuMarker(2), out + n * VAR_RESPONSE_SIZE);
+      writeInt32BigEndian(0, out + n * VAR_RESPONSE_SIZE + 4);
+      n++;
+    }
+    writeInt32BigEndian(0x1000 + i, out + n * VAR_RESPONSE_SIZE);
+    writeInt32BigEndian(i, out + n * VAR_RESPONSE_SIZE + 4);
+    n++;
+  }
+  return n;
+}
+
+static int32_t entryHash(const std::vector<uint8_t>& data, size_t index) {
+  return readInt32BigEndian(data.data() + index * VAR_RESPONSE_SIZE);
+}
+
+static void reset() {
+  fakeIndications().clear();
+  fakeIndicateResult() = ESP_OK;
+}
+
+static void testLargeMtuSendsOneNotifyWithHeader() {
+  reset();
+  uint8_t entries[20 * VAR_RESPONSE_SIZE];
+  uint16_t count = makeEntries(entries, 16, 0xFFFF);
+  uint32_t sequence = 7;
+
+  CHECK(notifyPacker.send(&server, &characteristic, 1, entries, count, 517, &sequence, micros()) == 1);
+  CHECK(sequence == 8);
+  CHECK(fakeIndications().size() == 1);
+  const FakeIndication& n = fakeIndications()[0];
+  CHECK(n.connId == 1);
+  CHECK(n.data.size() == (2 + 16) * VAR_RESPONSE_SIZE);
+  CHECK((uint32_t)entryHash(n.data, 0) == VAR_HEADER_V1);
+  CHECK(readInt32BigEndian(n.data.data() + 4) == 7);
+  CHECK(memcmp(n.data.data() + 2 * VAR_RESPONSE_SIZE, entries, 16 * VAR_RESPONSE_SIZE) == 0);
+}
+
+static void testSplitNotifiesRepeatEcuMarker() {
+  reset();
+  // MTU 35: 32字节载荷 = 4个条目，头占两个，每个notify还剩2个
+  uint8_t entries[20 * VAR_RESPONSE_SIZE];
+  uint16_t count = makeEntries(entries, 6, 3);  // 0 1 2 [ECU2] 3 4 5
+  uint32_t sequence = 0;
+
+  uint8_t sent = notifyPacker.send(&server, &characteristic, 0, entries, count, 35, &sequence, micros());
+  CHECK(sent == fakeIndications().size());
+  CHECK(sequence == sent);
+
+  // 每个notify单独解析: 不以标记开头的ECU 2的值前面补了标记
+  uint8_t ecuId = ECU_ID;
+  int32_t next = 0x1000;
+  for (const FakeIndication& n : fakeIndications()) {
+    CHECK(n.data.size() <= 32);
+    uint8_t notifyEcu = ECU_ID;
+    for (size_t k = 2; k < n.data.size() / VAR_RESPONSE_SIZE; k++) {
+      int32_t hash = entryHash(n.data, k);
+      if (isVarEcuMarker(hash)) {
+        notifyEcu = (uint8_t)hash;
+        continue;
+      }
+      CHECK(hash == next);
+      next++;
+      ecuId = hash >= 0x1003 ? 2 : ECU_ID;
+      CHECK(notifyEcu == ecuId);
+    }
+  }
+  CHECK(next == 0x1006);
+}
+
+static void testMinimumMtuDropsHeader() {
+  reset();
+  uint8_t entries[4 * VAR_RESPONSE_SIZE];
+  uint16_t count = makeEntries(entries, 4, 0xFFFF);
+  uint32_t sequence = 0;
+
+  CHECK(notifyPacker.send(&server, &characteristic, 0, entries, count, 23, &sequence, micros()) == 2);
+  CHECK(sequence == 0);
+  CHECK(entryHash(fakeIndications()[0].data, 0) == 0x1000);
+  CHECK(entryHash(fakeIndications()[1].data, 0) == 0x1002);
+}
+
+static void testRejectedNotifiesAreNotCounted() {
+  reset();
+  uint8_t entries[4 * VAR_RESPONSE_SIZE];
+  uint16_t count = makeEntries(entries, 4, 0xFFFF);
+  uint8_t stats[14];
+  notifyPacker.encode(stats, sizeof(stats));  // 清零统计窗口
+
+  fakeIndicateResult() = ESP_FAIL;
+  CHECK(notifyPacker.send(&server, &characteristic, 0, entries, count, 23, nullptr, micros()) == 0);
+
+  // [notifies/s][avg bytes][payload limit][split batches][errors]
+  CHECK(notifyPacker.encode(stats, sizeof(stats)) == sizeof(stats));
+  uint16_t avgBytes;
+  uint32_t errors;
+  memcpy(&avgBytes, stats + 2, 2);
+  memcpy(&errors, stats + 10, 4);
+  CHECK(avgBytes == 0);
+  CHECK(errors == 2);
+}
+
+static void testCreditLimitResumesWithMarker() {
+  reset();
+  // MTU 23: 两个条目一个notify。0 1 [ECU2] 2 3 4 5 共7个条目，额度只够2个notify
+  uint8_t entries[20 * VAR_RESPONSE_SIZE];
+  uint16_t count = makeEntries(entries, 6, 2);
+  uint16_t consumed = 0;
+
+  CHECK(notifyPacker.send(&server, &characteristic, 0, entries, count, 23, nullptr, micros(), 2, &consumed) == 2);
+  CHECK(fakeIndications().size() == 2);
+  CHECK(consumed == 4);  // 0 1 | [ECU2] 2
+
+  // 剩余的 3 4 5 属于ECU 2: 补标记后可以单独发送 (原地移动)
+  count = NotifyPacker::keepUnsent(entries, count, consumed, entries);
+  CHECK(count == 4);
+  CHECK(readInt32BigEndian(entries) == varEcuMarker(2));
+  CHECK(readInt32BigEndian(entries + VAR_RESPONSE_SIZE) == 0x1003);
+  CHECK(readInt32BigEndian(entries + 3 * VAR_RESPONSE_SIZE) == 0x1005);
+
+  CHECK(notifyPacker.send(&server, &characteristic, 0, entries, count, 23, nullptr, micros(), 0xFF, &consumed) == 3);  // 每个notify重复标记
+  CHECK(consumed == count);
+  CHECK(NotifyPacker::keepUnsent(entries, count, consumed, entries) == 0);
+
+  // 主ECU的值不补标记
+  count = makeEntries(entries, 4, 0xFFFF);
+  CHECK(notifyPacker.send(&server, &characteristic, 0, entries, count, 23, nullptr, micros(), 1, &consumed) == 1);
+  CHECK(NotifyPacker::keepUnsent(entries, count, consumed, entries) == 2);
+  CHECK(readInt32BigEndian(entries) == 0x1002);
+}
+
+static void testBigEndianHelpers() {
+  uint8_t buffer[4];
+  writeInt32BigEndian(0x12345678, buffer);
+  CHECK(buffer[0] == 0x12 && buffer[1] == 0x34 && buffer[2] == 0x56 && buffer[3] == 0x78);
+  CHECK(readInt32BigEndian(buffer) == 0x12345678);
+  writeInt32BigEndian(-2, buffer);
+  CHECK(readInt32BigEndian(buffer) == -2);
+
+  writeFloat32BigEndian(1.5f, buffer);
+  CHECK(buffer[0] == 0x3F && buffer[1] == 0xC0 && buffer[2] == 0 && buffer[3] == 0);
+  CHECK(readFloat32BigEndian(buffer) == 1.5f);
+}
+
+int main() {
+  configStore.begin();
+  testLargeMtuSendsOneNotifyWithHeader();
+  testSplitNotifiesRepeatEcuMarker();
+  testMinimumMtuDropsHeader();
+  testRejectedNotifiesAreNotCounted();
+  testCreditLimitResumesWithMarker();
+  testBigEndianHelpers();
+  puts("test_notify_packer: ok");
+  return 0;
+}
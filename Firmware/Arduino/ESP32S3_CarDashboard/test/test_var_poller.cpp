@@ -0,0 +1,197 @@
+#include "host_stubs.h"
+#include "fake_can_bus.h"
+#include "var_poller.h"
+#include "can_manager.h"
+#include "config_store.h"
+#include <Preferences.h>
+
+static const uint8_t ECU2 = 2;
+
+// 模拟ECU: 回答所有已发出的变量请求，值 = 哈希的低16位。
+// 驱动的接收回调随即唤醒CAN任务，返回前按任务的一次唤醒调用 service()
+static uint16_t answerRequests() {
+  std::vector<CANMessage> requests;
+  requests.swap(fakeCanSent());
+  for (const CANMessage& request : requests) {
+    uint8_t ecuId = request.id - configStore.get().canVarRequestBase;
+    uint8_t data[VAR_RESPONSE_SIZE];
+    memcpy(data, request.data, 4);
+    writeInt32BigEndian(readInt32BigEndian(request.data) & 0xFFFF, data + 4);
+    fakeCanReceive(fakeCanFrame(configStore.get().canVarResponseBase + ecuId, data, sizeof(data)));
+  }
+  canManager.service();
+  return requests.size();
+}
+
+// 固件中由 BleManager::updatePolling() 调用; 批次的开始和响应由测试负责
+static void pollHandler() {
+  varPoller.update(millis());
+}
+
+static void select(uint8_t* selection, int16_t index) {
+  CHECK(index >= 0);
+  selection[index / 8] |= 1 << (index % 8);
+}
+
+static uint32_t srttUs(uint8_t lane) {
+  uint8_t report[64];
+  CHECK(varPoller.encodeTimeouts(lane, report, sizeof(report)) >= 13);
+  uint32_t srtt;
+  memcpy(&srtt, report + 2, 4);
+  return srtt;
+}
+
+static void testRttFromDriverTimestamp() {
+  // 响应2ms后到达，CAN任务8ms后才处理: RTT按驱动读出帧的时刻计为2ms
+  varPoller.clear();
+  CHECK(varPoller.add(ECU_ID, 0x4000) == 0);
+  fakeCanSent().clear();
+  varPoller.start(micros());
+  CHECK(fakeCanSent().size() == 1);
+
+  advanceMillis(2);
+  uint8_t data[VAR_RESPONSE_SIZE] = {};
+  writeInt32BigEndian(0x4000, data);
+  fakeCanReceive(fakeCanFrame(configStore.get().canVarResponseBase + ECU_ID, data, sizeof(data)));
+  advanceMillis(8);
+  canManager.service();
+
+  CHECK(varPoller.isComplete());
+  CHECK(srttUs(0) == 2000);  // 第一个样本
+  varPoller.finish();
+}
+
+static void testUnionPollSharesRequests() {
+  // 中心设备A: h1 h2，中心设备B: h2 h3 + ECU 2 的 h4; h2只请求一次
+  uint8_t selectionA[(MAX_BATCH_VARS + 7) / 8] = {};
+  uint8_t selectionB[(MAX_BATCH_VARS + 7) / 8] = {};
+  varPoller.clear();
+  select(selectionA, varPoller.add(ECU_ID, 0x1001));
+  select(selectionA, varPoller.add(ECU_ID, 0x1002));
+  select(selectionB, varPoller.add(ECU_ID, 0x1002));
+  select(selectionB, varPoller.add(ECU_ID, 0x1003));
+  select(selectionB, varPoller.add(ECU2, 0x1004));
+  CHECK(varPoller.size() == 4);
+  CHECK(varPoller.add(3, 0x1005) == -1);  // 未配置的ECU
+
+  fakeCanSent().clear();
+  varPoller.start(micros());
+  uint16_t requests = 0;
+  while (!varPoller.isComplete()) {
+    uint16_t answered = answerRequests();
+    CHECK(answered > 0);
+    requests += answered;
+  }
+  CHECK(requests == 4);
+
+  uint8_t out[MAX_BATCH_VARS * 2][VAR_RESPONSE_SIZE];
+  CHECK(varPoller.buildResponse(selectionA, out[0], MAX_BATCH_VARS * 2) == 2);
+  CHECK(readInt32BigEndian(out[0]) == 0x1001 && readInt32BigEndian(out[0] + 4) == 0x1001);
+  CHECK(readInt32BigEndian(out[1]) == 0x1002);
+
+  CHECK(varPoller.buildResponse(selectionB, out[0], MAX_BATCH_VARS * 2) == 4);
+  CHECK(readInt32BigEndian(out[0]) == 0x1002);
+  CHECK(readInt32BigEndian(out[1]) == 0x1003);
+  CHECK(readInt32BigEndian(out[2]) == varEcuMarker(ECU2));
+  CHECK(readInt32BigEndian(out[3]) == 0x1004 && readInt32BigEndian(out[3] + 4) == 0x1004);
+
+  // 批次容量不够时不拆开标记和值
+  CHECK(varPoller.buildResponse(selectionB, out[0], 3) == 2);
+  varPoller.finish();
+  CHECK(!varPoller.isActive());
+}
+
+static void testBatchCompletesAtEcuLatency() {
+  // 16个变量发往同一ECU，ECU在每个请求1ms后回答: 接收唤醒CAN任务，响应在同一次
+  // 唤醒中发出下一个请求，整批用16ms，不等超时也不等主循环
+  varPoller.clear();
+  for (int32_t i = 0; i < 16; i++) CHECK(varPoller.add(ECU_ID, 0x2000 + i) == i);
+
+  fakeCanSent().clear();
+  const uint32_t timeouts = varPoller.getTimeoutCount();
+  const unsigned long start = millis();
+  varPoller.start(micros());
+  // 有请求在途时任务不会睡得比ECU响应更久
+  CHECK(canManager.service() == CAN_TASK_RETRY_MS);
+  while (!varPoller.isComplete()) {
+    CHECK(millis() - start < 1000);
+    advanceMillis(1);
+    CHECK(answerRequests() == 1);
+  }
+
+  CHECK(millis() - start == 16);
+  CHECK(varPoller.getTimeoutCount() == timeouts);
+
+  uint8_t out[MAX_BATCH_VARS][VAR_RESPONSE_SIZE];
+  CHECK(varPoller.buildResponse(nullptr, out[0], MAX_BATCH_VARS) == 16);
+  CHECK(readInt32BigEndian(out[15]) == 0x200F && readInt32BigEndian(out[15] + 4) == 0x200F);
+  varPoller.finish();
+  CHECK(canManager.service() == CAN_TASK_IDLE_MS);
+}
+
+static void testTimeoutAtTaskPeriod() {
+  // ECU不回答: 任务按返回的等待时间唤醒，超时在到期后的那一次唤醒中处理
+  varPoller.clear();
+  CHECK(varPoller.add(ECU_ID, 0x3000) == 0);
+
+  fakeCanSent().clear();
+  const uint32_t timeouts = varPoller.getTimeoutCount();
+  const unsigned long start = millis();
+  varPoller.start(micros());
+  CHECK(fakeCanSent().size() == 1);
+  uint32_t waitMs = canManager.service();
+  while (!varPoller.isComplete()) {
+    CHECK(millis() - start <= configStore.get().varRequestTimeoutMs);
+    advanceMillis(waitMs);
+    waitMs = canManager.service();
+  }
+
+  CHECK(millis() - start >= configStore.get().varRequestTimeoutMinMs);
+  CHECK(varPoller.getTimeoutCount() == timeouts + 1);
+  varPoller.finish();
+}
+
+static void testUnsentRequestsComplete() {
+  // 请求类发送缓冲区一直满: 每个请求从第一次尝试起按超时放弃，批次仍然完成，
+  // 不计入ECU超时
+  varPoller.clear();
+  CHECK(varPoller.add(ECU_ID, 0x5000) == 0);
+  CHECK(varPoller.add(ECU_ID, 0x5001) == 1);
+
+  fakeCan().txFull = true;
+  fakeCanSent().clear();
+  const uint32_t timeouts = varPoller.getTimeoutCount();
+  const uint32_t unsent = varPoller.getUnsentCount();
+  const unsigned long start = millis();
+  varPoller.start(micros());
+  uint32_t waitMs = canManager.service();
+  while (!varPoller.isComplete()) {
+    CHECK(millis() - start <= 2 * configStore.get().varRequestTimeoutMs);
+    advanceMillis(waitMs);
+    waitMs = canManager.service();
+  }
+  fakeCan().txFull = false;
+
+  CHECK(fakeCanSent().empty());
+  CHECK(varPoller.getUnsentCount() == unsent + 2);
+  CHECK(varPoller.getTimeoutCount() == timeouts);
+  uint8_t out[MAX_BATCH_VARS][VAR_RESPONSE_SIZE];
+  CHECK(varPoller.buildResponse(nullptr, out[0], MAX_BATCH_VARS) == 0);
+  varPoller.finish();
+}
+
+int main() {
+  // 固定波特率: 不经过自动检测，直接允许发送
+  fakeNvs()["bitrate"] = 500000;
+  configStore.begin();
+  varPoller.begin();
+  CHECK(canManager.init());
+  canManager.setPollHandler(pollHandler);
+  testRttFromDriverTimestamp();
+  testUnionPollSharesRequests();
+  testBatchCompletesAtEcuLatency();
+  testTimeoutAtTaskPeriod();
+  testUnsentRequestsComplete();
+  puts("test_var_poller: ok");
+  return 0;
+}
@@ -0,0 +1,128 @@
+#include "host_stubs.h"
+#include "fake_can_bus.h"
+#include "var_set_pipeline.h"
+#include "can_manager.h"
+#include "config_store.h"
+#include <Preferences.h>
+
+// 每帧的预算 (默认 200 帧/秒 = 5ms)
+static const uint32_t FRAME_MS = 1000 / VAR_SET_TX_RATE;
+
+static int32_t frameHash(const CANMessage& frame) {
+  return readInt32BigEndian(frame.data);
+}
+
+static float frameValue(const CANMessage& frame) {
+  return readFloat32BigEndian(frame.data + 4);
+}
+
+// 空闲足够久，令牌桶装满
+static void drain() {
+  advanceMillis(1000);
+  varSetPipeline.process();
+  fakeCanSent().clear();
+}
+
+static void testCoalescesToLatestValue() {
+  drain();
+  const uint32_t coalesced = varSetPipeline.getCoalescedCount();
+
+  // 滑块拖动: 同一哈希写入100次，只发出最后一个值
+  for (int i = 0; i < 100; i++) CHECK(varSetPipeline.post(0x6000, (float)i));
+  varSetPipeline.process();
+
+  CHECK(fakeCanSent().size() == 1);
+  CHECK(fakeCanSent()[0].id == configStore.get().canGpsDataBase + configStore.get().ecuId);
+  CHECK(fakeCanSent()[0].len == 8);
+  CHECK(frameHash(fakeCanSent()[0]) == 0x6000);
+  CHECK(frameValue(fakeCanSent()[0]) == 99.0f);
+  CHECK(varSetPipeline.getCoalescedCount() == coalesced + 99);
+
+  // 已发送后再写入是新的一帧，不算合并
+  CHECK(varSetPipeline.post(0x6000, 100.0f));
+  advanceMillis(FRAME_MS);
+  varSetPipeline.process();
+  CHECK(fakeCanSent().size() == 2);
+  CHECK(varSetPipeline.getCoalescedCount() == coalesced + 99);
+}
+
+static void testPacedByBudget() {
+  drain();
+
+  // 20个不同的哈希: 先连发 VAR_SET_TX_BURST 帧，之后每 FRAME_MS 一帧，轮流发送
+  for (int32_t i = 0; i < 20; i++) CHECK(varSetPipeline.post(0x7000 + i, (float)i));
+  varSetPipeline.process();
+  CHECK(fakeCanSent().size() == VAR_SET_TX_BURST);
+
+  const unsigned long start = millis();
+  while (fakeCanSent().size() < 20) {
+    CHECK(millis() - start < 1000);
+    advanceMillis(1);
+    const size_t before = fakeCanSent().size();
+    varSetPipeline.process();
+    CHECK(fakeCanSent().size() - before <= 1);
+  }
+  CHECK(millis() - start == (20 - VAR_SET_TX_BURST) * FRAME_MS);
+
+  for (int32_t i = 0; i < 20; i++) CHECK(frameHash(fakeCanSent()[i]) == 0x7000 + i);
+}
+
+static void testRetriesWhenBufferFull() {
+  drain();
+  const uint32_t sent = varSetPipeline.getSentCount();
+
+  // 发送缓冲区满: 值保留到下一轮，期间的新值覆盖旧值
+  fakeCan().txFull = true;
+  CHECK(varSetPipeline.post(0x8000, 1.0f));
+  varSetPipeline.process();
+  CHECK(varSetPipeline.post(0x8000, 2.0f));
+  advanceMillis(FRAME_MS);
+  varSetPipeline.process();
+  CHECK(fakeCanSent().empty());
+  CHECK(varSetPipeline.getSentCount() == sent);
+
+  fakeCan().txFull = false;
+  advanceMillis(FRAME_MS);
+  varSetPipeline.process();
+  CHECK(fakeCanSent().size() == 1);
+  CHECK(frameValue(fakeCanSent()[0]) == 2.0f);
+  CHECK(varSetPipeline.getSentCount() == sent + 1);
+
+  // 之后没有重复发送
+  advanceMillis(FRAME_MS);
+  varSetPipeline.process();
+  CHECK(fakeCanSent().size() == 1);
+}
+
+static void testDropsWhenAllSlotsPending() {
+  drain();
+  const uint32_t drops = varSetPipeline.getDropCount();
+
+  // 发送被阻塞，所有槽位都待发送: 新的哈希被丢弃，已有哈希仍可覆盖
+  fakeCan().txFull = true;
+  for (int32_t i = 0; i < VAR_SET_SLOTS; i++) CHECK(varSetPipeline.post(0x9000 + i, (float)i));
+  CHECK(!varSetPipeline.post(0x9FFF, 0.0f));
+  CHECK(varSetPipeline.getDropCount() == drops + 1);
+  CHECK(varSetPipeline.post(0x9000, 5.0f));
+
+  // 发出后槽位可以给新的哈希复用
+  fakeCan().txFull = false;
+  advanceMillis(VAR_SET_SLOTS * FRAME_MS);
+  varSetPipeline.process();
+  CHECK(fakeCanSent().size() == VAR_SET_TX_BURST);
+  CHECK(varSetPipeline.post(0x9FFF, 0.0f));
+  CHECK(varSetPipeline.getDropCount() == drops + 1);
+}
+
+int main() {
+  // 固定波特率: 不经过自动检测，直接允许发送
+  fakeNvs()["bitrate"] = 500000;
+  configStore.begin();
+  CHECK(canManager.init());
+  testCoalescesToLatestValue();
+  testPacedByBudget();
+  testRetriesWhenBufferFull();
+  testDropsWhenAllSlotsPending();
+  puts("test_var_set_pipeline: ok");
+  return 0;
+}
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+"""Generate var_catalog_data.h from the app's variables.json.
+
+The table is sorted by hash so the firmware can binary-search it in flash.
+Names are packed into one string pool and referenced by offset.
+
+Usage (from the repository root):
+    python3 Firmware/Arduino/ESP32S3_CarDashboard/tools/gen_var_catalog.py
+
+Re-run whenever Android/variables.json changes.
+"""
+
+import json
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SKETCH_DIR = os.path.dirname(HERE)
+REPO_ROOT = os.path.abspath(os.path.join(SKETCH_DIR, "..", "..", ".."))
+DEFAULT_INPUT = os.path.join(REPO_ROOT, "Android", "variables.json")
+OUTPUT = os.path.join(SKETCH_DIR, "var_catalog_data.h")
+
+SOURCES = {"output": 0, "config": 1}
+
+# VAR_ECU_MARKER in project_config.h: 0xFFFFECnn in a VarRequest selects ECU nn
+ECU_MARKER = 0xFFFFEC00
+# VAR_OPTION_MARKER: 0xFFFFEDnn are request options / VarData header entries
+OPTION_MARKER = 0xFFFFED00
+
+
+def to_int32(value):
+    value &= 0xFFFFFFFF
+    return value - (1 << 32) if value >= (1 << 31) else value
+
+
+def var_hash(name):
+    """djb2 over the lower-cased name, same as varHash() in project_config.h."""
+    h = 5381
+    for c in name.lower():
+        h = (h * 33 + ord(c)) & 0xFFFFFFFF
+    return to_int32(h)
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_INPUT
+    with open(path, encoding="utf-8") as f:
+        variables = json.load(f)
+
+    seen = {}
+    for var in variables:
+        name, h = var["name"], var["hash"]
+        if var_hash(name) != h:
+            sys.exit(f"{name}: hash {h} does not match varHash() {var_hash(name)}")
+        if h in seen:
+            sys.exit(f"hash collision: {name} and {seen[h]}")
+        if (h & 0xFFFFFF00) == ECU_MARKER:
+            sys.exit(f"{name}: hash {h} collides with the ECU marker range")
+        if (h & 0xFFFFFF00) == OPTION_MARKER:
+            sys.exit(f"{name}: hash {h} collides with the option marker range")
+        if '"' in name or "\\" in name:
+            sys.exit(f"{name}: unsupported character in name")
+        if var.get("source", "output") not in SOURCES:
+            sys.exit(f"{name}: unknown source {var.get('source')}")
+        seen[h] = name
+
+    variables.sort(key=lambda v: v["hash"])
+
+    pool = []
+    offsets = []
+    pool_size = 0
+    for var in variables:
+        offsets.append(pool_size)
+        pool.append(var["name"])
+        pool_size += len(var["name"]) + 1
+    if pool_size > 0xFFFF:
+        sys.exit("name pool exceeds 64 KiB, widen VarCatalogEntry::nameOffset")
+
+    lines = []
+    lines.append("// Generated by tools/gen_var_catalog.py from variables.json - do not edit.")
+    lines.append("#ifndef VAR_CATALOG_DATA_H")
+    lines.append("#define VAR_CATALOG_DATA_H")
+    lines.append("")
+    lines.append(f"#define VAR_CATALOG_SIZE {len(variables)}")
+    lines.append("")
+    lines.append("static const char VAR_CATALOG_NAMES[] =")
+    for name in pool:
+        lines.append(f'  "{name}\\0"')
+    lines.append("  ;")
+    lines.append("")
+    lines.append("static const VarCatalogEntry VAR_CATALOG[VAR_CATALOG_SIZE] = {")
+    for var, offset in zip(variables, offsets):
+        source = SOURCES[var.get("source", "output")]
+        lines.append(f"  {{ {var['hash']}, {offset}, {source} }},  // {var['name']}")
+    lines.append("};")
+    lines.append("")
+    lines.append("// Every entry checks the compile-time varHash() against variables.json.")
+    for var in variables:
+        lines.append(f'static_assert(varHash("{var["name"]}") == {var["hash"]}, "varHash: {var["name"]}");')
+    lines.append("")
+    lines.append("#endif  // VAR_CATALOG_DATA_H")
+    lines.append("")
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines))
+
+    print(f"{OUTPUT}: {len(variables)} variables, {pool_size} bytes of names")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""Fetch the firmware's USB capture ring over serial and save it as pcap.
+
+Enable capture first with the serial command 'c', reproduce the input, then:
+    python3 usb_pcap.py /dev/ttyACM0 capture.pcap
+
+Requires pyserial. The resulting file opens in Wireshark (USBPcap link type).
+
+The firmware sends the pcap stream as base64 lines prefixed with "PCAP:"
+between a header and an end line; log lines printed by other tasks during
+the export are skipped.
+"""
+
+import base64
+import re
+import sys
+
+import serial
+
+HEADER_RE = re.compile(rb"=== USB capture: (\d+) packets, (\d+) overwritten ===")
+END_RE = re.compile(rb"=== USB capture end: (\d+) bytes ===")
+DATA_PREFIX = b"PCAP:"
+
+
+def read_line(port):
+    line = port.readline()
+    if not line:
+        sys.exit("timeout while reading pcap stream")
+    return line.strip()
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+
+    with serial.Serial(sys.argv[1], 115200, timeout=5) as port:
+        port.reset_input_buffer()
+        port.write(b"p")
+
+        # Skip log lines until the capture header
+        while True:
+            match = HEADER_RE.search(read_line(port))
+            if match:
+                break
+        packets, overwritten = int(match.group(1)), int(match.group(2))
+
+        pcap = b""
+        while True:
+            line = read_line(port)
+            end = END_RE.search(line)
+            if end:
+                break
+            if line.startswith(DATA_PREFIX):
+                pcap += base64.b64decode(line[len(DATA_PREFIX):])
+
+    if len(pcap) != int(end.group(1)):
+        sys.exit(f"pcap stream is {len(pcap)} bytes, firmware sent {end.group(1)}")
+
+    with open(sys.argv[2], "wb") as f:
+        f.write(pcap)
+    print(f"{sys.argv[2]}: {packets} packets ({overwritten} overwritten before export)")
+
+
+if __name__ == "__main__":
+    main()
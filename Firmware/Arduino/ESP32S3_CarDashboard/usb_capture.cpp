@@ -0,0 +1,161 @@
+#include "usb_capture.h"
+
+// 全局USB抓包实例
+UsbCapture usbCapture;
+
+#define PCAP_LINKTYPE_USBPCAP 249
+#define USBPCAP_HEADER_LEN 27
+#define USBPCAP_FUNCTION_BULK_OR_INTERRUPT 0x0009
+#define USBPCAP_TRANSFER_INTERRUPT 1
+#define PCAP_LINE_BYTES 48  // 每行编码的字节数 (64个base64字符)
+
+namespace {
+
+const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// 把字节流按行编码为 "PCAP:<base64>\n"。每行用一次write()输出，
+// 其他任务同时打印的日志只会出现在行与行之间，不会混进pcap数据
+class PcapLineWriter {
+public:
+  explicit PcapLineWriter(Print& out) : out(out) {}
+
+  void write(const uint8_t* data, size_t len) {
+    total += len;
+    while (len > 0) {
+      size_t n = min<size_t>(len, PCAP_LINE_BYTES - pending);
+      memcpy(buffer + pending, data, n);
+      pending += n;
+      data += n;
+      len -= n;
+      if (pending == PCAP_LINE_BYTES) flush();
+    }
+  }
+
+  void flush() {
+    if (pending == 0) return;
+
+    char line[5 + PCAP_LINE_BYTES / 3 * 4 + 1];
+    size_t len = 0;
+    memcpy(line, "PCAP:", 5);
+    len += 5;
+    for (size_t i = 0; i < pending; i += 3) {
+      uint32_t group = (uint32_t)buffer[i] << 16;
+      if (i + 1 < pending) group |= (uint32_t)buffer[i + 1] << 8;
+      if (i + 2 < pending) group |= buffer[i + 2];
+      line[len++] = BASE64_CHARS[(group >> 18) & 0x3F];
+      line[len++] = BASE64_CHARS[(group >> 12) & 0x3F];
+      line[len++] = i + 1 < pending ? BASE64_CHARS[(group >> 6) & 0x3F] : '=';
+      line[len++] = i + 2 < pending ? BASE64_CHARS[group & 0x3F] : '=';
+    }
+    line[len++] = '\n';
+    out.write((const uint8_t*)line, len);
+    pending = 0;
+  }
+
+  uint32_t bytes() const { return total; }
+
+private:
+  Print& out;
+  uint8_t buffer[PCAP_LINE_BYTES];
+  size_t pending = 0;
+  uint32_t total = 0;
+};
+
+}  // namespace
+
+void UsbCapture::store(uint8_t deviceAddress, uint8_t endpoint, const uint8_t* data, uint16_t len, uint32_t timestampUs) {
+  if (len > USB_CAPTURE_MAX_DATA) len = USB_CAPTURE_MAX_DATA;
+
+  portENTER_CRITICAL(&captureMux);
+  UsbCaptureRecord& rec = records[head];
+  rec.timestampUs = timestampUs;
+  rec.deviceAddress = deviceAddress;
+  rec.endpoint = endpoint;
+  rec.len = len;
+  memcpy(rec.data, data, len);
+
+  head = (head + 1) % USB_CAPTURE_DEPTH;
+  if (count < USB_CAPTURE_DEPTH) {
+    count++;
+  } else {
+    overwritten++;
+  }
+  portEXIT_CRITICAL(&captureMux);
+}
+
+uint16_t UsbCapture::exportPcap(Print& out) {
+  bool wasEnabled = enabled.exchange(false);
+
+  portENTER_CRITICAL(&captureMux);
+  uint16_t packets = count;
+  uint32_t lost = overwritten;
+  overwritten = 0;
+  portEXIT_CRITICAL(&captureMux);
+
+  out.printf("=== USB capture: %u packets, %lu overwritten ===\n", packets, (unsigned long)lost);
+  PcapLineWriter pcap(out);
+
+  // pcap全局头，小端
+  const uint32_t magic = 0xA1B2C3D4;
+  const uint16_t versionMajor = 2;
+  const uint16_t versionMinor = 4;
+  const uint32_t zero = 0;
+  const uint32_t snapLen = USBPCAP_HEADER_LEN + USB_CAPTURE_MAX_DATA;
+  const uint32_t linkType = PCAP_LINKTYPE_USBPCAP;
+  uint8_t header[24];
+  memcpy(header, &magic, 4);
+  memcpy(header + 4, &versionMajor, 2);
+  memcpy(header + 6, &versionMinor, 2);
+  memcpy(header + 8, &zero, 4);   // thiszone
+  memcpy(header + 12, &zero, 4);  // sigfigs
+  memcpy(header + 16, &snapLen, 4);
+  memcpy(header + 20, &linkType, 4);
+  pcap.write(header, sizeof(header));
+
+  for (uint16_t i = 0; i < packets; i++) {
+    // 逐条取出最旧的记录，串口输出不在临界区内
+    UsbCaptureRecord rec;
+    portENTER_CRITICAL(&captureMux);
+    bool available = count > 0;
+    if (available) {
+      rec = records[(head + USB_CAPTURE_DEPTH - count) % USB_CAPTURE_DEPTH];
+      count--;
+    }
+    portEXIT_CRITICAL(&captureMux);
+    if (!available) break;
+
+    // pcap记录头: ts_sec, ts_usec, incl_len, orig_len
+    // USBPcap包头 (27字节): headerLen, irpId, status, function, info, bus, device, endpoint, transfer, dataLength
+    uint8_t packet[16 + USBPCAP_HEADER_LEN];
+    const uint32_t tsSec = rec.timestampUs / 1000000;
+    const uint32_t tsUsec = rec.timestampUs % 1000000;
+    const uint32_t capLen = USBPCAP_HEADER_LEN + rec.len;
+    const uint16_t headerLen = USBPCAP_HEADER_LEN;
+    const uint64_t irpId = 0;
+    const uint16_t function = USBPCAP_FUNCTION_BULK_OR_INTERRUPT;
+    const uint16_t bus = 1;
+    const uint16_t device = rec.deviceAddress;
+    const uint32_t dataLen = rec.len;
+    memcpy(packet, &tsSec, 4);
+    memcpy(packet + 4, &tsUsec, 4);
+    memcpy(packet + 8, &capLen, 4);
+    memcpy(packet + 12, &capLen, 4);
+    memcpy(packet + 16, &headerLen, 2);
+    memcpy(packet + 18, &irpId, 8);
+    memcpy(packet + 26, &zero, 4);  // USBD_STATUS_SUCCESS
+    memcpy(packet + 30, &function, 2);
+    packet[32] = 0x01;  // info: PDO -> FDO (完成的IN传输)
+    memcpy(packet + 33, &bus, 2);
+    memcpy(packet + 35, &device, 2);
+    packet[37] = rec.endpoint;
+    packet[38] = USBPCAP_TRANSFER_INTERRUPT;
+    memcpy(packet + 39, &dataLen, 4);
+    pcap.write(packet, sizeof(packet));
+    pcap.write(rec.data, rec.len);
+  }
+
+  pcap.flush();
+  out.printf("=== USB capture end: %lu bytes ===\n", (unsigned long)pcap.bytes());
+  enabled.store(wasEnabled);
+  return packets;
+}
@@ -0,0 +1,53 @@
+#ifndef USB_CAPTURE_H
+#define USB_CAPTURE_H
+
+#include "project_config.h"
+#include <atomic>
+
+// ============================================================================
+// USB报告抓包
+// ============================================================================
+// 默认关闭，只有一次原子读取的开销。开启后把中断IN报告按时间戳
+// 存入固定大小的环形缓冲区 (满时覆盖最旧的)，按需通过串口导出为
+// pcap流 (LINKTYPE_USBPCAP 249)，可直接用Wireshark打开。
+// 串口同时还有其他任务的日志，pcap按行编码为base64 ("PCAP:" 前缀)，
+// tools/usb_pcap.py 只取这些行还原文件。
+
+struct UsbCaptureRecord {
+  uint32_t timestampUs;
+  uint8_t deviceAddress;
+  uint8_t endpoint;
+  uint8_t len;
+  uint8_t data[USB_CAPTURE_MAX_DATA];
+};
+
+class UsbCapture {
+public:
+  void setEnabled(bool enabled) { this->enabled.store(enabled, std::memory_order_relaxed); }
+  bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+  // USB任务: 记录一个中断IN报告
+  void record(uint8_t deviceAddress, uint8_t endpoint, const uint8_t* data, uint16_t len, uint32_t timestampUs) {
+    if (!isEnabled()) return;
+    store(deviceAddress, endpoint, data, len, timestampUs);
+  }
+
+  // 写出 "=== USB capture: N packets ... ===" 行、base64编码的pcap流
+  // ("PCAP:" 行) 和 "=== USB capture end: B bytes ===" 行，并清空缓冲区。
+  // 导出期间暂停抓包。返回包数
+  uint16_t exportPcap(Print& out);
+
+private:
+  std::atomic<bool> enabled{ false };
+  UsbCaptureRecord records[USB_CAPTURE_DEPTH];
+  uint16_t head = 0;   // 下一个写入位置
+  uint16_t count = 0;  // 有效记录数
+  uint32_t overwritten = 0;
+  portMUX_TYPE captureMux = portMUX_INITIALIZER_UNLOCKED;
+
+  void store(uint8_t deviceAddress, uint8_t endpoint, const uint8_t* data, uint16_t len, uint32_t timestampUs);
+};
+
+extern UsbCapture usbCapture;
+
+#endif  // USB_CAPTURE_H
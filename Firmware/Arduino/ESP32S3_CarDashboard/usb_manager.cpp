@@ -1,5 +1,8 @@
 #include "usb_manager.h"
 #include <Arduino.h>
+#include "project_config.h"
+#include "hid_button_map.h"
+#include "usb_capture.h"
 
 // 添加全局实例定义
 USBBtnManager usbManager;
@@ -8,50 +11,53 @@ USBBtnManager::USBBtnManager() : usbHost(this) {}
 
 bool USBBtnManager::begin() {
     deviceGoneFlag = 0;
-    usbHost.begin();
     usbHost.setHIDLocal(HID_LOCAL_Japan_Katakana);
-    usbHost.task();
+
+    // USB事件在独立任务中处理，回调直接在该任务中执行
+    if (!usbHost.beginTask(USB_HOST_TASK_PRIORITY, USB_HOST_TASK_CORE, USB_HOST_TASK_STACK_SIZE)) {
+        Serial.println("USB Manager: Failed to start USB host task");
+        return false;
+    }
     Serial.println("USB Manager initialized successfully");
     return true;
 }
 
-void USBBtnManager::task() {
-    usbHost.task();
+void USBBtnManager::handleDeviceGone(uint8_t address) {
+    deviceGoneFlag = 1;
+    Serial.printf("USB device %u disconnected\n", address);
+
+    // 该设备的映射失效，释放它仍按下的按钮；其他设备的按钮不受影响
+    hidButtonMap.removeDevice(address);
+    updateButtonMask(hidButtonMap.currentMask(), micros());
 }
 
-void USBBtnManager::handleDeviceGone() {
-    deviceGoneFlag = 1;
-    Serial.println("USB device disconnected");
+void USBBtnManager::handleReportDescriptor(uint8_t address, uint8_t interfaceNumber, const uint8_t *desc, uint16_t len) {
+    bool complete = hidButtonMap.compile(address, interfaceNumber, desc, len);
+    Serial.printf("USB Manager: Device %u interface %u report descriptor compiled (%u bytes)%s\n",
+                  address, interfaceNumber, len, complete ? "" : ", mapping table full");
 }
 
 void USBBtnManager::handleUSBReceive(const usb_transfer_t *transfer) {
     if (!transfer->data_buffer) return;
+    uint32_t reportMicros = micros();
 
-    // 打印接收到的原始数据（调试用）
-    Serial.print("USB HID Data: ");
-    for (int i = 0; i < transfer->data_buffer_size && i < 50; i++) {
-        Serial.printf("%02x ", transfer->data_buffer[i]);
-    }
-    Serial.println();
+    // 每个传输的context指向所属设备，Hub下的多个设备各自路由
+    const EspUsbHost::device_t *device = EspUsbHost::deviceOf(transfer);
 
-    if (transfer->num_bytes > 4 && transfer->data_buffer_size > 4) {
-        uint8_t modifier = transfer->data_buffer[0];
-        uint8_t firstKey = transfer->data_buffer[2];
-        uint8_t secondKey = transfer->data_buffer[3];
+    // 调试: 抓包开启时记录原始报告 (默认关闭)
+    usbCapture.record(device->address, transfer->bEndpointAddress,
+                      transfer->data_buffer, transfer->actual_num_bytes, reportMicros);
 
-        processHIDData(modifier, firstKey, secondKey);
-    }
+    uint8_t interfaceNumber = device->endpoint_data_list[transfer->bEndpointAddress & USB_B_ENDPOINT_ADDRESS_EP_NUM_MASK].bInterfaceNumber;
+    uint16_t mask = hidButtonMap.apply(device->address, interfaceNumber, transfer->data_buffer, transfer->actual_num_bytes);
+    updateButtonMask(mask, reportMicros);
 }
 
-void USBBtnManager::processHIDData(uint8_t modifier, uint8_t firstKey, uint8_t secondKey) {
-    if (firstKey > 0) firstKey += (modifier * 0xff);
-    if (secondKey > 0) secondKey += (modifier * 0xff);
+void USBBtnManager::updateButtonMask(uint16_t mask, uint32_t reportMicros) {
+    // 只在掩码变化时发送；入队失败时保留旧值，下一个报告再试
+    if (mask == lastButtonMask || canSendCallback == nullptr) return;
 
-    if (canSendCallback) {
-        if (firstKey > 0) {
-            canSendCallback(modifier, firstKey & 0xff, (firstKey >> 8) & 0xff);
-        } else if (secondKey > 0) {
-            canSendCallback(modifier, secondKey & 0xff, (secondKey >> 8) & 0xff);
-        }
+    if (canSendCallback(mask, reportMicros)) {
+        lastButtonMask = mask;
     }
-}
\ No newline at end of file
+}
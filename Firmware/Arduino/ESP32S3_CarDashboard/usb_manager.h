@@ -7,10 +7,10 @@ class USBBtnManager {
 public:
     USBBtnManager();
     bool begin();
-    void task();
     
-    // 设置CAN发送回调函数
-    void setCANSendCallback(void (*callback)(uint8_t, uint8_t, uint8_t)) {
+    // 设置CAN发送回调函数，按钮掩码变化时调用
+    // 回调不能阻塞，参数为 按钮掩码, USB报告时间(micros)，返回false表示未能入队
+    void setCANSendCallback(bool (*callback)(uint16_t, uint32_t)) {
         canSendCallback = callback;
     }
 
@@ -21,21 +21,28 @@ private:
         MyEspUsbHost(USBBtnManager* p) : parent(p) {}
         
         void onGone(const usb_host_client_event_msg_t *eventMsg) {
-            if (parent) parent->handleDeviceGone();
+            device_t *device = findDevice(eventMsg->dev_gone.dev_hdl);
+            if (parent && device) parent->handleDeviceGone(device->address);
         }
 
         void onReceive(const usb_transfer_t *transfer) {
             if (parent) parent->handleUSBReceive(transfer);
         }
+
+        void onReportDescriptor(uint8_t address, uint8_t bInterfaceNumber, const uint8_t *desc, uint16_t len) {
+            if (parent) parent->handleReportDescriptor(address, bInterfaceNumber, desc, len);
+        }
     };
 
-    void handleDeviceGone();
+    void handleDeviceGone(uint8_t address);
     void handleUSBReceive(const usb_transfer_t *transfer);
-    void processHIDData(uint8_t modifier, uint8_t firstKey, uint8_t secondKey);
+    void handleReportDescriptor(uint8_t address, uint8_t interfaceNumber, const uint8_t *desc, uint16_t len);
+    void updateButtonMask(uint16_t mask, uint32_t reportMicros);
     
     MyEspUsbHost usbHost;
-    void (*canSendCallback)(uint8_t, uint8_t, uint8_t) = nullptr;
+    bool (*canSendCallback)(uint16_t, uint32_t) = nullptr;
     int deviceGoneFlag = 0;
+    uint16_t lastButtonMask = 0;
 };
 
 // 添加全局实例声明
@@ -0,0 +1,54 @@
+#include "var_cache.h"
+
+// 全局变量缓存实例
+VarCache varCache;
+
+VarCacheEntry* VarCache::find(uint8_t ecuId, int32_t varHash) {
+  for (VarCacheEntry& entry : entries) {
+    if (entry.used && entry.varHash == varHash && entry.ecuId == ecuId) return &entry;
+  }
+  return nullptr;
+}
+
+void VarCache::store(uint8_t ecuId, const uint8_t* data, uint32_t nowMs) {
+  int32_t varHash = readInt32BigEndian(data);
+
+  VarCacheEntry* entry = find(ecuId, varHash);
+  if (entry == nullptr) {
+    // 空项优先，否则替换最久未更新的
+    entry = &entries[0];
+    for (VarCacheEntry& candidate : entries) {
+      if (!candidate.used) {
+        entry = &candidate;
+        break;
+      }
+      if (nowMs - candidate.updatedMs > nowMs - entry->updatedMs) entry = &candidate;
+    }
+    entry->varHash = varHash;
+    entry->ecuId = ecuId;
+    entry->used = true;
+  }
+
+  memcpy(entry->value, data + 4, sizeof(entry->value));
+  entry->updatedMs = nowMs;
+  storedCount++;
+}
+
+bool VarCache::copyFresh(uint8_t ecuId, int32_t varHash, uint32_t nowMs, uint32_t maxAgeMs, uint8_t* out) {
+  VarCacheEntry* entry = find(ecuId, varHash);
+  if (entry == nullptr || nowMs - entry->updatedMs > maxAgeMs) return false;
+
+  writeInt32BigEndian(varHash, out);
+  memcpy(out + 4, entry->value, sizeof(entry->value));
+  hitCount++;
+  return true;
+}
+
+void VarCache::dump(Print& out) const {
+  uint8_t used = 0;
+  for (const VarCacheEntry& entry : entries) {
+    if (entry.used) used++;
+  }
+  out.printf("Sniff cache: %u/%u entries, %lu values stored, %lu requests avoided\n",
+             used, VAR_CACHE_SLOTS, (unsigned long)storedCount, (unsigned long)hitCount);
+}
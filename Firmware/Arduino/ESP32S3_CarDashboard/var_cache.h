@@ -0,0 +1,46 @@
+#ifndef VAR_CACHE_H
+#define VAR_CACHE_H
+
+#include "project_config.h"
+
+// ============================================================================
+// 被动嗅探变量缓存
+// ============================================================================
+// 保存总线上不是由本机请求得到的变量响应 (ECU在回答其他工具)，
+// 以及从ECU广播帧解码出的变量 (DbcDecoder)。
+// 批量请求时缓存中足够新的变量直接从缓存返回，其他轮询工具在线时
+// 仪表不再额外占用总线带宽。只在主循环中访问。
+
+struct VarCacheEntry {
+  int32_t varHash;
+  uint8_t value[4];  // 原始大端浮点，原样放入响应
+  uint8_t ecuId;
+  bool used;
+  uint32_t updatedMs;
+};
+
+class VarCache {
+public:
+  // 写入一帧 [hash][value] 响应
+  void store(uint8_t ecuId, const uint8_t* data, uint32_t nowMs);
+
+  // 值在 maxAgeMs 内更新过时写出8字节响应条目并返回true
+  bool copyFresh(uint8_t ecuId, int32_t varHash, uint32_t nowMs, uint32_t maxAgeMs, uint8_t* out);
+
+  uint32_t getStoredCount() const { return storedCount; }
+  uint32_t getHitCount() const { return hitCount; }
+
+  void dump(Print& out) const;
+
+private:
+  VarCacheEntry entries[VAR_CACHE_SLOTS] = {};
+
+  uint32_t storedCount = 0;  // 嗅探到的帧
+  uint32_t hitCount = 0;     // 代替请求返回的值
+
+  VarCacheEntry* find(uint8_t ecuId, int32_t varHash);
+};
+
+extern VarCache varCache;
+
+#endif  // VAR_CACHE_H
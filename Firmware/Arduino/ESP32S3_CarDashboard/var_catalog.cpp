@@ -0,0 +1,27 @@
+#include "var_catalog.h"
+#include "var_catalog_data.h"
+
+const VarCatalogEntry* VarCatalog::find(int32_t varHash) {
+  size_t lo = 0;
+  size_t hi = VAR_CATALOG_SIZE;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    int32_t midHash = VAR_CATALOG[mid].hash;
+    if (midHash == varHash) return &VAR_CATALOG[mid];
+    if (midHash < varHash) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return nullptr;
+}
+
+const char* VarCatalog::name(int32_t varHash) {
+  const VarCatalogEntry* entry = find(varHash);
+  return entry != nullptr ? VAR_CATALOG_NAMES + entry->nameOffset : nullptr;
+}
+
+size_t VarCatalog::size() {
+  return VAR_CATALOG_SIZE;
+}
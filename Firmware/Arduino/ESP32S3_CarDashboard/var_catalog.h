@@ -0,0 +1,35 @@
+#ifndef VAR_CATALOG_H
+#define VAR_CATALOG_H
+
+#include "project_config.h"
+
+// ============================================================================
+// 变量目录
+// ============================================================================
+// 由 tools/gen_var_catalog.py 从 variables.json 生成 var_catalog_data.h，
+// 按哈希排序的常量表直接放在flash中，二分查找，不在RAM中复制。
+
+enum VarSource : uint8_t {
+  VAR_SOURCE_OUTPUT = 0,  // ECU输出通道
+  VAR_SOURCE_CONFIG = 1   // 标定参数
+};
+
+struct VarCatalogEntry {
+  int32_t hash;
+  uint16_t nameOffset;  // 在名称池中的偏移
+  uint8_t source;       // VarSource
+};
+
+class VarCatalog {
+public:
+  // 查找哈希，未知返回nullptr
+  static const VarCatalogEntry* find(int32_t varHash);
+  static bool contains(int32_t varHash) { return find(varHash) != nullptr; }
+
+  // 变量名，未知返回nullptr
+  static const char* name(int32_t varHash);
+
+  static size_t size();
+};
+
+#endif  // VAR_CATALOG_H
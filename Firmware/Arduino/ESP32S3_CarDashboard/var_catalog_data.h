@@ -0,0 +1,5493 @@
+// Generated by tools/gen_var_catalog.py from variables.json - do not edit.
+#ifndef VAR_CATALOG_DATA_H
+#define VAR_CATALOG_DATA_H
+
+#define VAR_CATALOG_SIZE 1826
+
+static const char VAR_CATALOG_NAMES[] =
+  "etbSplit\0"
+  "idleRpmPid.pFactor\0"
+  "sadDwellRatioCounter\0"
+  "tachPulsePerRev\0"
+  "stft.maxLambda\0"
+  "acLowRpmLimit\0"
+  "calibrationBirthday\0"
+  "accelerationLat\0"
+  "accelerationLon\0"
+  "vvtTarget\0"
+  "throttlePedalUpVoltage\0"
+  "fuelPumpisPrime\0"
+  "etb2etbErrorCode\0"
+  "wheelSlipRatioLeftRightREF\0"
+  "waterPumpenabledForAc\0"
+  "tcuInputSpeedSensorTeeth\0"
+  "totalGearsCount\0"
+  "stopEngineCode\0"
+  "boostCutPressureHyst\0"
+  "etb2etbRevLimitActive\0"
+  "stepperForceParkingEveryRestart\0"
+  "acisDisabledByLua\0"
+  "useIacTableForCoasting\0"
+  "injectorPrimeInhibit\0"
+  "disableEtbWhenEngineStopped\0"
+  "lambdaProtectionMinLoad\0"
+  "idleisBlipping\0"
+  "cruiseControlReadClutchPedal\0"
+  "mc33_t_hold_off\0"
+  "mc33_t_hold_tot\0"
+  "gapTrackingLengthOverride\0"
+  "tcu_rangeSensorPulldown\0"
+  "waterPump2ExtraIdle\0"
+  "engineMode\0"
+  "maxCamPhaseResolveRpm\0"
+  "enabledStep1Limiter\0"
+  "baroPressure\0"
+  "iacByTpsTaper\0"
+  "ltitIntegratorThreshold\0"
+  "knockm_knockFrequencyStart\0"
+  "etb2luaAdjustment\0"
+  "disableWaterPump2WhenStopped\0"
+  "mafEstimate\0"
+  "cc_pedal_release_seconds\0"
+  "resetCanToggleInhibit1\0"
+  "resetCanToggleInhibit2\0"
+  "resetCanToggleInhibit3\0"
+  "resetCanToggleInhibit4\0"
+  "resetCanToggleInhibit5\0"
+  "resetCanToggleInhibit6\0"
+  "resetCanToggleInhibit7\0"
+  "resetCanToggleInhibit8\0"
+  "isPedalError\0"
+  "idleTimingPid.offset\0"
+  "mafMeasured\0"
+  "coastingFuelCutVssHigh\0"
+  "ALSIdleAdd\0"
+  "fan2MaxPwm\0"
+  "complexWallModel\0"
+  "minimumOilPressureTimeout\0"
+  "hasCriticalError\0"
+  "fan2MinPwm\0"
+  "acacButtonState\0"
+  "knockm_maximumRetard\0"
+  "acacPressureTooHigh\0"
+  "useSeparateVeForIdle\0"
+  "fan1m_state\0"
+  "idleneedReset\0"
+  "alternatorControl.periodMs\0"
+  "alternatorControl.pFactor\0"
+  "waterPump2SoftStartSec\0"
+  "boostCutPressure\0"
+  "benchTestOnTime\0"
+  "boostPwmFrequency\0"
+  "yesUnderstandLocking\0"
+  "vvt2esynchronizationCounter\0"
+  "boosthasInitBoost\0"
+  "boostControlMinMap\0"
+  "boostControlMinRpm\0"
+  "boostControlMinTps\0"
+  "cc_smooth_exp_average\0"
+  "highFuelPressure\0"
+  "etb1etbFeedForward\0"
+  "waterPumpradiatorFanStatus\0"
+  "boostControlSafeDutyCycle\0"
+  "fixedModeTiming\0"
+  "seconds\0"
+  "isLaunchCondition\0"
+  "vssToothCount\0"
+  "smartChipAliveCounter\0"
+  "invertSecondaryTriggerSignal\0"
+  "startStopPhysicalState\0"
+  "trgsynchronizationCounter\0"
+  "lastCanButtonSeen\0"
+  "rawFlexFreq\0"
+  "alwaysInstantRpm\0"
+  "vehicleSpeedKph\0"
+  "enableKnockSpectrogramFilter\0"
+  "isWarnNow\0"
+  "luaIgnitionSkip\0"
+  "disableFan2AtSpeed\0"
+  "ecuCanId\0"
+  "ambientTempSensor.config.bias_resistor\0"
+  "highPressureFuel.value1\0"
+  "highPressureFuel.value2\0"
+  "watchOutForLinearTime\0"
+  "disableFan2WhenStoppedTimeout\0"
+  "alternatorStatus.output\0"
+  "ltft.deadband\0"
+  "timingIatCorrection\0"
+  "can2ListenMode\0"
+  "etb2etbErrorCodeBlinker\0"
+  "isPreLaunchCondition\0"
+  "fuelAlgorithm\0"
+  "idleTimingPid.iFactor\0"
+  "etbMinimumPosition\0"
+  "mapExpAverageAlpha\0"
+  "fan2SoftStartSec\0"
+  "ignitionDisabled1\0"
+  "ignitionDisabled2\0"
+  "ignitionDisabled3\0"
+  "ignitionDisabled4\0"
+  "ignitionDisabled5\0"
+  "ignitionDisabled6\0"
+  "ignitionDisabled7\0"
+  "ignitionDisabled8\0"
+  "ignitionDisabled9\0"
+  "fuelInjectionCounter\0"
+  "applyExpAverageToEtbTarget\0"
+  "knockFuelTrimReapplyRate\0"
+  "clt.config.tempC_1\0"
+  "clt.config.tempC_2\0"
+  "clt.config.tempC_3\0"
+  "isBoostControlEnabled\0"
+  "launchSparkCutEnable\0"
+  "useLinearCltSensor\0"
+  "idleStatus.dTerm\0"
+  "idleStatus.error\0"
+  "knockFuelTrimAggression\0"
+  "sd_error\0"
+  "etb1etbRevLimitActive\0"
+  "etb1m_lastPidDtMs\0"
+  "idleStatus.iTerm\0"
+  "etb2m_adjustedTarget\0"
+  "launchRpmWindow\0"
+  "fastAdcPeriod\0"
+  "idleStatus.pTerm\0"
+  "rawPpsSecondary\0"
+  "assistedEtbMinBatteryVoltage\0"
+  "acacCompressorState\0"
+  "tpsaccaen\0"
+  "tpsaccden\0"
+  "checkEngine\0"
+  "waterPump2PwmFrequency\0"
+  "maxOilPressureTimeout\0"
+  "nitrousDeactivationRpmWindow\0"
+  "RealLambdaValue1\0"
+  "RealLambdaValue2\0"
+  "totalFuelCorrection\0"
+  "fan2radiatorFanStatus\0"
+  "baseDwell\0"
+  "fastAdcLastError\0"
+  "isAlternatorControlEnabled\0"
+  "vvtChannel1\0"
+  "vvtChannel2\0"
+  "vvtChannel3\0"
+  "vvtChannel4\0"
+  "nitrousLuaGaugeArmingValue\0"
+  "isTriggerError\0"
+  "tpsSecondaryMaximum\0"
+  "launchSpeedThreshold\0"
+  "idlerpmpid_iTermMax\0"
+  "idlerpmpid_iTermMin\0"
+  "veTableSwitch1Active\0"
+  "vvt2itriggerStateIndex\0"
+  "cc_unsafeTps\0"
+  "knockBankCyl10\0"
+  "knockBankCyl11\0"
+  "knockBankCyl12\0"
+  "dtTuneCurCycle\0"
+  "mapVvt_MAP_AT_SPECIAL_POINT\0"
+  "maximumIgnitionTiming\0"
+  "etb_iTermMax\0"
+  "etb_iTermMin\0"
+  "enableSoftwareKnock\0"
+  "effectiveMap\0"
+  "AFRValue2\0"
+  "fan1hot\0"
+  "fan1Pwm\0"
+  "fan2hot\0"
+  "fan2Pwm\0"
+  "cranking.rpm\0"
+  "cc_rpmDeadBandHigh\0"
+  "triggerPageRefreshFlag\0"
+  "vvt1evvtToothDurations0\0"
+  "mafAirChargeLoad\0"
+  "ltft.correctionEnabled\0"
+  "rtcUnixEpochTime\0"
+  "idleMaximumAirmass\0"
+  "TMFLoadIsTMF\0"
+  "accelerationVert\0"
+  "tracSpeedLeftRightREF\0"
+  "toothLogReady\0"
+  "dynoCarFrontalAreaM2\0"
+  "etbResetCnt\0"
+  "tcu_shiftTime\0"
+  "benchTestOffTime\0"
+  "auxLowPassCutoffHz\0"
+  "wallWettingAeEnabled\0"
+  "acm_acEnabled\0"
+  "lambdaProtectionTimeout\0"
+  "auxSpeed1Multiplier\0"
+  "fan2PwmFrequency\0"
+  "idletargetRpmByClt\0"
+  "can_call_last_ok\0"
+  "enableWaterPump2WithAc\0"
+  "isAppConditionSatisfied\0"
+  "inj10ok\0"
+  "inj11ok\0"
+  "inj12ok\0"
+  "accelerometerScale\0"
+  "driveWheelRevPerKm1\0"
+  "driveWheelRevPerKm2\0"
+  "driveWheelRevPerKm3\0"
+  "driveWheelRevPerKm4\0"
+  "disableProgOutputs\0"
+  "isMapAveraging\0"
+  "luaTimingMult\0"
+  "alternatorControl.maxValue\0"
+  "ltitClampMax\0"
+  "ltitClampMin\0"
+  "idleDeltaRpmAdjAvgFactor\0"
+  "dynoCarGearPrimaryReduction\0"
+  "stftLimitsUseLambda\0"
+  "lua.torqueReductionState\0"
+  "tachSweepTime\0"
+  "isSdCardEnabled\0"
+  "epic_hall_inps916\0"
+  "epic_hall_inp1\0"
+  "epic_hall_inp2\0"
+  "epic_hall_inp3\0"
+  "epic_hall_inp4\0"
+  "epic_hall_inp5\0"
+  "epic_hall_inp6\0"
+  "epic_hall_inp7\0"
+  "epic_hall_inp8\0"
+  "epic_hall_inp9\0"
+  "sparkOutOfOrderCounter\0"
+  "maxTriggerReentrant\0"
+  "idleidleTargetFlow\0"
+  "dtTuneBatch\0"
+  "mapVvt_MAP_AT_DIFF\0"
+  "assistedEtbMaxAllowedPpsPct\0"
+  "enableLaunchRetard\0"
+  "cylindersCount\0"
+  "disableFan1AtSpeed\0"
+  "useEeprom\0"
+  "throttlePedalSecondaryUpVoltage\0"
+  "idlePidActivationTime\0"
+  "canBroadcastKnock\0"
+  "calibrationValue\0"
+  "compressorDischargeTemperature.config.bias_resistor\0"
+  "tractionControlSparkSkip\0"
+  "revolutionCounterSinceStart\0"
+  "instantMAFValue\0"
+  "acrActive\0"
+  "deferAllWritesUntilEngineOff\0"
+  "isPhaseSyncRequiredForIgnition\0"
+  "tpsAeFastCallback\0"
+  "boostboostControllerClosedLoopPart\0"
+  "isTps2Error\0"
+  "artificialTestMisfire\0"
+  "tmf_maf_tmf_airmass_split\0"
+  "enableWaterPump\0"
+  "cc_proportionalGainSPEED\0"
+  "can2OpenBLT\0"
+  "wallFuelCorrectionValue\0"
+  "cc_proportionalGainRPM\0"
+  "etb1integralError\0"
+  "afrTrimRangeMax\0"
+  "afrTrimRangeMin\0"
+  "hasFaultReportFile\0"
+  "primaryInjectorDisabled10\0"
+  "primaryInjectorDisabled11\0"
+  "primaryInjectorDisabled12\0"
+  "currentMafCorrection\0"
+  "luaHardSparkSkip\0"
+  "coastingFuelCutClt\0"
+  "coastingFuelCutMap\0"
+  "coastingFuelCutTps\0"
+  "mapaccaen\0"
+  "mapaccden\0"
+  "idlelooksLikeCrankToIdle\0"
+  "engineChartSize\0"
+  "isCylinderCleanupEnabled\0"
+  "fan1radiatorFanStatus\0"
+  "boostisZeroRpm\0"
+  "mafmapBlendPercentage\0"
+  "rawMafFast\0"
+  "fordInjectorSmallPulseSlope\0"
+  "shuttingDownMainRelay\0"
+  "noFuelTrimAfterAccelTime\0"
+  "oilTempSensor.config.tempC_1\0"
+  "oilTempSensor.config.tempC_2\0"
+  "oilTempSensor.config.tempC_3\0"
+  "rawMapFast\0"
+  "predTimerResetCnt\0"
+  "disableWaterPumpWhenStopped\0"
+  "brokenInjector\0"
+  "boostopenLoopPart\0"
+  "starterState\0"
+  "map.sensor.highValue\0"
+  "actualLastInjectionStage2\0"
+  "vvt2isynchronizationCounter\0"
+  "cc_speedBandLow\0"
+  "fastAdcOverrunCount\0"
+  "etbStatus.output\0"
+  "auxLinear1.v1\0"
+  "auxLinear1.v2\0"
+  "auxLinear2.v1\0"
+  "auxLinear2.v2\0"
+  "auxLinear3.v1\0"
+  "auxLinear3.v2\0"
+  "auxLinear4.v1\0"
+  "auxLinear4.v2\0"
+  "waterPumpcranking\0"
+  "idleTimingPid.pFactor\0"
+  "enableTrailingSparks\0"
+  "ltft.enabled\0"
+  "dynoCarWheelAspectRatio\0"
+  "ALSSkipRatio\0"
+  "etbWastegatePid.minValue\0"
+  "idleisIacTableForCoasting\0"
+  "lua.fuelMult\0"
+  "isAnalogFailure\0"
+  "rawTps2Primary\0"
+  "retardThresholdRpm\0"
+  "acrRevolutions\0"
+  "fixedTiming\0"
+  "boostluaOpenLoopAdd\0"
+  "distanceTraveled\0"
+  "wheelspeedAvgError\0"
+  "isIgnitionEnabled\0"
+  "cruiseControlEnableTogglesState\0"
+  "lastErrorCode\0"
+  "auxSpeedMult1\0"
+  "auxSpeedMult2\0"
+  "auxSpeedMult3\0"
+  "auxSpeedMult4\0"
+  "fastAdcErrorCount\0"
+  "dynoCarCarMassKg\0"
+  "launchTpsThreshold\0"
+  "injectorDutyCycleStage2\0"
+  "etb_use_two_wires\0"
+  "invertVvtControlExhaust\0"
+  "cc_kmhstep\0"
+  "orderingErrorCounter\0"
+  "rawRawPpsSecondary\0"
+  "tps1SecondaryMax\0"
+  "tps1SecondaryMin\0"
+  "vbattDividerCoeff\0"
+  "tracMinSpeed\0"
+  "map.sensor.lowValue\0"
+  "RealAFRValue\0"
+  "oilTempSensor.config.resistance_1\0"
+  "oilTempSensor.config.resistance_2\0"
+  "oilTempSensor.config.resistance_3\0"
+  "lua.brakePedalState\0"
+  "running.postCrankingFuelCorrection\0"
+  "TMFPressureSplitPercentUp\0"
+  "fuelPumpPrimeDelay\0"
+  "fuelTempSensor.config.bias_resistor\0"
+  "useFordRedundantPps\0"
+  "useFordRedundantTps\0"
+  "accelEnX\0"
+  "accelEnY\0"
+  "accelEnZ\0"
+  "useTLE8888_cranking_hack\0"
+  "rawOilTemperature\0"
+  "idlem_isIdlingOrTaper\0"
+  "mafLoad\0"
+  "lambdaProtectionRestoreLoad\0"
+  "idleidle_m_last_phase\0"
+  "idle_derivativeFilterLoss\0"
+  "mapFast\0"
+  "boostlwgDutyPct\0"
+  "wheelSlipRatioLeftRightREAR\0"
+  "idlePositionMax\0"
+  "idlePositionMin\0"
+  "hpfpCamLobes\0"
+  "alternatorStatus.resetCounter\0"
+  "verboseTLE8888\0"
+  "mapPredEventOver\0"
+  "etb2etbTpsErrorCounter\0"
+  "epicCanEcuReadONLYONWrite\0"
+  "etb1jamDetected\0"
+  "injectorHwIssue\0"
+  "isEnabled0_int\0"
+  "measureMapOnlyInOneCylinder\0"
+  "displacement\0"
+  "mc33810spiErrorCounter\0"
+  "fuelCutReason\0"
+  "sdAirmass\0"
+  "dwellClampPercent\0"
+  "dwellDurationAngle\0"
+  "crankingFuel.coolantTemperatureCoefficient\0"
+  "tunedVeStrengthMultiplier\0"
+  "fan2PwmEnabled\0"
+  "nitrousFuelAdderPercent\0"
+  "tunedMassAirflow\0"
+  "enableAemXSeriesEgt\0"
+  "fuelTempSensor.config.resistance_1\0"
+  "fuelTempSensor.config.resistance_2\0"
+  "fuelTempSensor.config.resistance_3\0"
+  "enableOilPressureProtect\0"
+  "canBoxTracTrim\0"
+  "boostPid.dFactor\0"
+  "auxTempSensor1.config.bias_resistor\0"
+  "stepperMaxDutyCycle\0"
+  "tpsFuelPumpPrimeThreshold\0"
+  "acPressure.value1\0"
+  "acPressure.value2\0"
+  "m_deadtime\0"
+  "slowAdcOverrunCount\0"
+  "engineRunTime\0"
+  "stftDeadBand\0"
+  "useSpooledCurve\0"
+  "tpsAccelLookback\0"
+  "instantMAPValue\0"
+  "vvt1esynchronizationCounter\0"
+  "ignitionFault\0"
+  "tuneCrc16\0"
+  "disableFuelCutOnClutch\0"
+  "stepperMinDutyCycle\0"
+  "stage1InjSmallPwActive\0"
+  "canButtons916\0"
+  "epic_hall_inp10\0"
+  "ignBlend1BlendMode\0"
+  "knockm_knockRetard\0"
+  "disableFan1WhenStopped\0"
+  "ltftEnableAutoSave\0"
+  "tChargeAirIncrLimit\0"
+  "coilState1\0"
+  "coilState2\0"
+  "coilState3\0"
+  "coilState4\0"
+  "coilState5\0"
+  "coilState6\0"
+  "coilState7\0"
+  "coilState8\0"
+  "coilState9\0"
+  "maxCylindersCount\0"
+  "dynoCarCoeffOfDrag\0"
+  "lambdaValue\0"
+  "tpsFuelPumpPrimeDuration\0"
+  "alsMinTimeBetween\0"
+  "luaSoftSparkSkip\0"
+  "afrError\0"
+  "alternatorStatus.dTerm\0"
+  "alternatorStatus.error\0"
+  "tpsAccelExtraShot\0"
+  "alternatorStatus.iTerm\0"
+  "auxTempSensor1.config.tempC_1\0"
+  "auxTempSensor1.config.tempC_2\0"
+  "auxTempSensor1.config.tempC_3\0"
+  "alternatorStatus.pTerm\0"
+  "AFRValue\0"
+  "cutSparkOnHardLimit\0"
+  "dynoRpmStep\0"
+  "ambientTempSensor.config.resistance_1\0"
+  "ambientTempSensor.config.resistance_2\0"
+  "ambientTempSensor.config.resistance_3\0"
+  "mapHighValueVoltage\0"
+  "fuelTemp\0"
+  "idleStepperTotalSteps\0"
+  "isMapPreAveraging\0"
+  "multisparkEnable\0"
+  "verboseCan\0"
+  "ignBlend2BlendMode\0"
+  "waterPumpnotRunning\0"
+  "canButtonToggle1\0"
+  "canButtonToggle2\0"
+  "canButtonToggle3\0"
+  "canButtonToggle4\0"
+  "canButtonToggle5\0"
+  "canButtonToggle6\0"
+  "canButtonToggle7\0"
+  "canButtonToggle8\0"
+  "canButtonToggle9\0"
+  "etb2adjustedEtbTarget\0"
+  "vvt2ivvtCurrentPosition\0"
+  "auxLinear4.value1\0"
+  "auxLinear4.value2\0"
+  "verboseCan2\0"
+  "turboSpeedSensorMultiplier\0"
+  "verboseQuad\0"
+  "harleyAcrSprayFuel\0"
+  "rawTps1Primary\0"
+  "baroHasPressure\0"
+  "etb1etbCurrentTarget\0"
+  "useBiQuadOnWheelSpeedSensors1\0"
+  "useBiQuadOnWheelSpeedSensors2\0"
+  "useBiQuadOnWheelSpeedSensors3\0"
+  "useBiQuadOnWheelSpeedSensors4\0"
+  "fordInjectorSmallPulseBreakPoint\0"
+  "canBoxTracTrimMax\0"
+  "canBoxTracTrimMin\0"
+  "iat.config.resistance_1\0"
+  "iat.config.resistance_2\0"
+  "iat.config.resistance_3\0"
+  "ecumasterEgtToCanBaseId\0"
+  "useSpiImu\0"
+  "idleRpmPid.minValue\0"
+  "can_call_found_func\0"
+  "ltitEmaAlpha\0"
+  "etb1etbErrorCodeBlinker\0"
+  "transitionEventCode\0"
+  "uartConsoleSerialSpeed\0"
+  "tpsAeUseDynamicThreshold\0"
+  "waterPumpOnTemperature\0"
+  "idleidleTargetError\0"
+  "etb.minValue\0"
+  "mafmapAirmassSplit\0"
+  "mapVvt_min_point_counter\0"
+  "launchFuelCutEnable\0"
+  "isValidInputPin\0"
+  "assistedEtbMaxPct\0"
+  "rpmAcceleration\0"
+  "assistedEtbMinPct\0"
+  "minAcPressure\0"
+  "tpsDecelEnleanmentThreshold\0"
+  "startStopStateToggleCounter\0"
+  "boostboostControlTarget\0"
+  "dtTuneInjModeOverride\0"
+  "launchSmoothRetard\0"
+  "triggerCompSensorSatRpm\0"
+  "boostPid.periodMs\0"
+  "fallbackMap\0"
+  "knockRetardReapplyRate\0"
+  "nitrousisNitrousRpmCondition\0"
+  "vvt1etriggerCountersError\0"
+  "antiLagEnabled\0"
+  "nitrousisNitrousCondition\0"
+  "mcp3208vref\0"
+  "nitrousisNitrousArmed\0"
+  "currentInjectionMode\0"
+  "boostm_shouldResetPid\0"
+  "useStepperIdle\0"
+  "pressureCorrectionReference\0"
+  "injAdvAssistEndDeg\0"
+  "disableEGT\0"
+  "acRelayAlternatorDutyAdder\0"
+  "launchFuelAdderPercent\0"
+  "dtTuneCycles\0"
+  "sparkDwell\0"
+  "auxTempSensor2.config.tempC_1\0"
+  "auxTempSensor2.config.tempC_2\0"
+  "auxTempSensor2.config.tempC_3\0"
+  "tractionAdvanceDrop\0"
+  "enableSlipCalculations\0"
+  "MAPPREValue\0"
+  "mc33_t_peak_off\0"
+  "mc33_t_peak_tot\0"
+  "sd.tCharge\0"
+  "usbBytesOutPerSec\0"
+  "internalMcuTemperature\0"
+  "finalGearRatio\0"
+  "CLBoostBlend1BlendMode\0"
+  "etbWastegatePid.dFactor\0"
+  "minOilPressureAfterStart\0"
+  "fan1cold\0"
+  "sparkHardwareLatencyCorrectionCurveCurveUnits\0"
+  "fan2cold\0"
+  "fanOnTemperature\0"
+  "STFTResetRegionChange\0"
+  "canVssScaling\0"
+  "tpsErrorDetectionTooHigh\0"
+  "lastCanButtonFoundIdx\0"
+  "etb2targetWithIdlePosition\0"
+  "tachSweepMax\0"
+  "canReWidebandCmdStatus\0"
+  "limitTorqueReductionTime\0"
+  "heaterControlEnabled\0"
+  "etb2m_lastPidDtMs\0"
+  "canButtonToggle10\0"
+  "canButtonToggle11\0"
+  "canButtonToggle12\0"
+  "canButtonToggle13\0"
+  "canButtonToggle14\0"
+  "canButtonToggle15\0"
+  "canButtonToggle16\0"
+  "slowAdcErrorCount\0"
+  "lua.luaIgnCut\0"
+  "rawAuxTemp1\0"
+  "rawAuxTemp2\0"
+  "clutchUpState\0"
+  "speedoSweepTime\0"
+  "cutFuelOnHardLimit\0"
+  "running.fuel\0"
+  "watchDogBuddy\0"
+  "etbJamDetectThreshold\0"
+  "idealEngineTorque\0"
+  "acrEngineMovedRecently\0"
+  "etbMaximumPosition\0"
+  "mc33810Gpgd0Mode\0"
+  "mc33810Gpgd1Mode\0"
+  "mc33810Gpgd2Mode\0"
+  "mc33810Gpgd3Mode\0"
+  "idleiacByTpsTaper\0"
+  "ignTableSwitch1Active\0"
+  "launchRpm\0"
+  "multisparkMaxRpm\0"
+  "rpmPreLaunchCondition\0"
+  "sdCardLogFrequency\0"
+  "triggerScopeReady\0"
+  "torqueReductionArmingApp\0"
+  "torqueReductionArmingRpm\0"
+  "assistedEtbRotate\0"
+  "etb1adjustedEtbTarget\0"
+  "cc_rpmstep\0"
+  "cc_maxEtbAdjustmentOpen\0"
+  "useCustomIATSensor\0"
+  "instantRpmRange\0"
+  "coolant\0"
+  "wheelspeedFLerror\0"
+  "dfcoTimingRetard\0"
+  "targetLambda\0"
+  "canReWidebandFwYear\0"
+  "alsEtbPosition\0"
+  "ppsSecondaryMaximum\0"
+  "auxLinear3.value1\0"
+  "auxLinear3.value2\0"
+  "isWaveAnalyzerEnabled\0"
+  "useMapEstimateDuringTransient\0"
+  "is_enabled_spi_1\0"
+  "is_enabled_spi_2\0"
+  "is_enabled_spi_3\0"
+  "is_enabled_spi_4\0"
+  "is_enabled_spi_5\0"
+  "is_enabled_spi_6\0"
+  "ignitionDisabled10\0"
+  "ignitionDisabled11\0"
+  "ignitionDisabled12\0"
+  "fuelTempSensor.config.tempC_1\0"
+  "fuelTempSensor.config.tempC_2\0"
+  "fuelTempSensor.config.tempC_3\0"
+  "brakePedalState\0"
+  "requireFootOnBrakeToCrank\0"
+  "vvt1etriggerSyncGapRatio\0"
+  "throttlePedalSecondaryWOTVoltage\0"
+  "mc33810Maxi\0"
+  "mc33810Nomi\0"
+  "useCustomOTSensor\0"
+  "tpsAccelAeEnabled\0"
+  "speedToRpmRatio\0"
+  "idlelooksLikeRunning\0"
+  "isMapPreValid\0"
+  "nitrousMaximumAfr\0"
+  "nitrousMaximumMap\0"
+  "rawIdlePositionSensor\0"
+  "iat.config.tempC_1\0"
+  "iat.config.tempC_2\0"
+  "iat.config.tempC_3\0"
+  "startUpFuelPumpDuration\0"
+  "fan1enabledForAc\0"
+  "instantRpm\0"
+  "tractionControlEnabled\0"
+  "throttlePressureRatio\0"
+  "clt.config.bias_resistor\0"
+  "can_blend_clboost_1_toggle\0"
+  "canBoxTracTrim1\0"
+  "canBoxTracTrim2\0"
+  "canBoxTracTrim3\0"
+  "canBoxTracTrim4\0"
+  "useTLE8888_stepper\0"
+  "waterPumpbrokenClt\0"
+  "canOpenBLT\0"
+  "lowFuelPressure\0"
+  "idleshouldResetPid\0"
+  "dfcoActive\0"
+  "torqueReductionEnabled\0"
+  "isForcedInduction\0"
+  "nitrousIgnitionRetard\0"
+  "injAdvAssistMaxRpm\0"
+  "enableFan1\0"
+  "enableFan2\0"
+  "fan1brokenClt\0"
+  "oilPressure.v1\0"
+  "oilPressure.v2\0"
+  "m_isPriming\0"
+  "vvt1isynchronizationCounter\0"
+  "tChargeMaxRpmMaxTps\0"
+  "cc_maxThrottlePedalAllowedToStayEngaged\0"
+  "injAdvAssistMinRpm\0"
+  "cruiseControlUseVehicleSpeed\0"
+  "idleveTableYAxis\0"
+  "trgvvtToothDurations0\0"
+  "idletargetRpmAc\0"
+  "useInjSmallPulseWidth1\0"
+  "useInjSmallPulseWidth2\0"
+  "tChargeMaxRpmMinTps\0"
+  "idleidleTargetAirmass\0"
+  "cc_speedDeadBandHigh\0"
+  "ignitionDwellForCrankingMs\0"
+  "invertPrimaryTriggerSignal\0"
+  "flexEnabled\0"
+  "nitrousControlEnabled\0"
+  "etb2validPlantPosition\0"
+  "boostPid.maxValue\0"
+  "getAirmassImpl_temp_c\0"
+  "idle.solenoidFrequency\0"
+  "tChargeMinRpmMaxTps\0"
+  "disableFan1WhenStoppedTimeout\0"
+  "flexCranking\0"
+  "mapMinBufferLength\0"
+  "maxLockedDuration\0"
+  "tChargeMinRpmMinTps\0"
+  "enableKnockSpectrogram\0"
+  "TMFPressureSplitPercentDown\0"
+  "fan2brokenClt\0"
+  "rpmSoftLimitTimingRetard\0"
+  "boostisTpsInvalid\0"
+  "egoLowPassCutoffHz\0"
+  "dtTuneMinRpm\0"
+  "vvt2etriggerStateIndex\0"
+  "idlePidRpmDeadZone\0"
+  "canReadEnabled\0"
+  "idle_antiwindupFreq\0"
+  "stft.minLambda\0"
+  "disableMCP3208\0"
+  "smartChipState\0"
+  "VssAcceleration\0"
+  "etb2integralError\0"
+  "speedoSweepUsesSpeedoCorrection\0"
+  "fan2AcAdder\0"
+  "wheelspeedFRerror\0"
+  "stepperParkingExtraSteps\0"
+  "ignKeyAdcDivider\0"
+  "oilPressure.value1\0"
+  "oilPressure.value2\0"
+  "can_blend_ign_2_toggle\0"
+  "compressorDischargeTemperature.config.tempC_1\0"
+  "compressorDischargeTemperature.config.tempC_2\0"
+  "compressorDischargeTemperature.config.tempC_3\0"
+  "vssFilterReciprocal\0"
+  "waterPumpOffTemperature\0"
+  "assistedEtbTuningEnabled\0"
+  "idlemustResetPid\0"
+  "verboseIsoTp\0"
+  "mc33_t_max_boost\0"
+  "verboseKLine\0"
+  "lowPressureFuel.v1\0"
+  "lowPressureFuel.v2\0"
+  "nitrousActivationRpm\0"
+  "stft.cell.timeConstant\0"
+  "mc33810DisableRecoveryMode\0"
+  "idleRpmPid.dFactor\0"
+  "forceIdleBelowTpsThreshold\0"
+  "tunedVeValue\0"
+  "triggerChannel1\0"
+  "triggerChannel2\0"
+  "veTableSwitch2Active\0"
+  "knockSamplingDuration\0"
+  "lua.clutchUpState\0"
+  "torqueReductionActivationTemperature\0"
+  "secondaryInjectorFuelReferencePressure\0"
+  "idleStatus.resetCounter\0"
+  "etb.offset\0"
+  "useSeparateIdleTablesForCrankingTaper\0"
+  "etb2jamDetected\0"
+  "issFilterReciprocal\0"
+  "allowDFUwithIgn\0"
+  "etb1state\0"
+  "vvt1itriggerStateIndex\0"
+  "sparkDwellClamp\0"
+  "idleidleTarget\0"
+  "auxLinear2.value1\0"
+  "auxLinear2.value2\0"
+  "fuelReferencePressure\0"
+  "dynoSaeBaro\0"
+  "wwaeTau\0"
+  "forceO2Heating\0"
+  "tpsAccelFuel\0"
+  "AFRBlend1BlendMode\0"
+  "fuelPumpDisable\0"
+  "waterPumpMaxPwm\0"
+  "vvtBooleanForVerySpecialCases\0"
+  "pressureDelta\0"
+  "mc33_i_boost\0"
+  "etb2state\0"
+  "waterPumpMinPwm\0"
+  "stft.deadband_lean\0"
+  "stft.deadband_rich\0"
+  "waterPumpdisabledWhileEngineStopped\0"
+  "useIacPidMultTable\0"
+  "initialIgnitionCutPercent\0"
+  "pressureRatio\0"
+  "accelHighRes\0"
+  "tmf_rho\0"
+  "tmfLoad\0"
+  "injectorDutyCycle\0"
+  "actualLastInjPreSmallPw\0"
+  "idleiacByRpmTaper\0"
+  "isMafValid\0"
+  "rawPpsPrimary\0"
+  "oilTempSensor.config.bias_resistor\0"
+  "waterPumpSoftStartSec\0"
+  "knockDetectionWindowStart\0"
+  "mapLowPassCutoffHz\0"
+  "launchControlEnabled\0"
+  "can_blend_ve_2_toggle\0"
+  "boosttpsTooLow\0"
+  "verboseTriggerSynchDetails\0"
+  "spooledLevel\0"
+  "timingPidCorrection\0"
+  "boardUseCanTerminator\0"
+  "alternatorControl.dFactor\0"
+  "disableFan2WhenStopped\0"
+  "accelerometerHPCF\0"
+  "luaTimingAdd\0"
+  "etb2m_wastegatePosition\0"
+  "tmfAirmass\0"
+  "waterPump2m_state\0"
+  "isRpmConditionSatisfied\0"
+  "enableFan1WithAc\0"
+  "hellenBoardId\0"
+  "globalTriggerAngleOffset\0"
+  "injectorSecondary.flow\0"
+  "anotherCiTest\0"
+  "customSentTpsMax\0"
+  "customSentTpsMin\0"
+  "baroCorrection\0"
+  "triggerToothAngleError\0"
+  "rawFrequencyMaf\0"
+  "alternatorControl.minValue\0"
+  "etb2boardEtbAdjustment\0"
+  "boostisPlantValid\0"
+  "ltft.maxRemove\0"
+  "useCicPidForIdle\0"
+  "nitrousisNitrousCltCondition\0"
+  "alphaNUseIat\0"
+  "etb.iFactor\0"
+  "assistedEtbRotatePeriodSec\0"
+  "tpsAeDynamicTresholdAverageStaticCurve\0"
+  "adcVcc\0"
+  "tuneHidingKey\0"
+  "injectionOffset\0"
+  "afr.v1\0"
+  "afr.v2\0"
+  "iacByTpsHoldTime\0"
+  "cc_maxRpm\0"
+  "auxFrequencyFilter1\0"
+  "auxFrequencyFilter2\0"
+  "auxFrequencyFilter3\0"
+  "auxFrequencyFilter4\0"
+  "sd_present\0"
+  "cc_minRpm\0"
+  "tps2Max\0"
+  "tps2Min\0"
+  "injAdvAssistStartDeg\0"
+  "vssGearRatio\0"
+  "etb1jamTimer\0"
+  "benchTestCount\0"
+  "vssToothCount1\0"
+  "vssToothCount2\0"
+  "vssToothCount3\0"
+  "vssToothCount4\0"
+  "map.sensorpre.lowValue\0"
+  "vvt1ivvtCurrentPosition\0"
+  "gapVvtTrackingLengthOverride\0"
+  "throttleEffectiveAreaOpening\0"
+  "dtTuneSimultaneous\0"
+  "forceIdleIgnitionBelowTps\0"
+  "crankingFuel.fuel\0"
+  "fan1AcAdder\0"
+  "airTaperRpmRange\0"
+  "waterPump2disabledWhileEngineStopped\0"
+  "dtTuneCycleFuel\0"
+  "can_blend_ign_1_toggle\0"
+  "cc_accdec_request_timeout\0"
+  "fan1notRunning\0"
+  "rawLowFuelPressure\0"
+  "waterPumpPwmFrequency\0"
+  "mapLowValueVoltage\0"
+  "ltitIgnitionOnDelay\0"
+  "idlebaseIdlePosition\0"
+  "runningAirmass\0"
+  "can_blend_afr_1_toggle\0"
+  "RealAFRValue2\0"
+  "fan1cranking\0"
+  "knockFuelTrim\0"
+  "sdTriggerLog\0"
+  "idleRpmPid.offset\0"
+  "injAdvAssistEnabled\0"
+  "fuelPumpengineTurnedRecently\0"
+  "stft.maxAfr\0"
+  "waterPump2cranking\0"
+  "throttlePedalPosition\0"
+  "hpfpActivationAngle\0"
+  "stft.minAfr\0"
+  "stft.minClt\0"
+  "rpmForIgnitionIdleTableDot\0"
+  "dwellVoltageCorrection\0"
+  "engine\0"
+  "auxLinear1.value1\0"
+  "auxLinear1.value2\0"
+  "invertExhaustCamVVTSignal\0"
+  "waterPumpPwmEnabled\0"
+  "sparkCutReason\0"
+  "disableINJOK\0"
+  "etbStatus.dTerm\0"
+  "useRunningMathForCranking\0"
+  "etbStatus.error\0"
+  "etbIdleThrottleRange\0"
+  "launchTriggered\0"
+  "etbStatus.iTerm\0"
+  "justATempTest\0"
+  "vvt2evvtCurrentPosition\0"
+  "minCamPhaseResolveRpm\0"
+  "injectorState10\0"
+  "injectorState11\0"
+  "injectorState12\0"
+  "running.baseFuel\0"
+  "etbStatus.pTerm\0"
+  "tmf_engineload\0"
+  "defaultEthanolContent\0"
+  "boostmapTooLow\0"
+  "triggerCompHystMax\0"
+  "triggerCompHystMin\0"
+  "pauseEtbControl\0"
+  "can_blend_ve_1_toggle\0"
+  "clt.config.resistance_1\0"
+  "clt.config.resistance_2\0"
+  "clt.config.resistance_3\0"
+  "brakeMeanEffectivePressureDifferential\0"
+  "turboSpeed\0"
+  "currentIgnitionMode\0"
+  "canReWidebandVersion\0"
+  "disableBARO\0"
+  "disableDINP\0"
+  "rawTps1Secondary\0"
+  "wwaeBeta\0"
+  "fanOffTemperature\0"
+  "hp\0"
+  "verboseCanBaseAddress\0"
+  "mapErrorDetectionTooLow\0"
+  "useIdleTimingPidControl\0"
+  "useHbridgesToDriveIdleStepper\0"
+  "isTpsError\0"
+  "mainRelayShutoffDelay\0"
+  "tps2SecondaryMax\0"
+  "tps2SecondaryMin\0"
+  "wastegatePositionClosedVoltage\0"
+  "crankingFuel.tpsCoefficient\0"
+  "isMapError\0"
+  "etb1m_adjustedTarget\0"
+  "idleTimingPid.periodMs\0"
+  "acIdleRpmTarget\0"
+  "calibrationValue2\0"
+  "twoStroke\0"
+  "hondaK\0"
+  "isMapValid\0"
+  "engineSnifferRpmThreshold\0"
+  "finalIgnitionCutPercentBeforeLaunch\0"
+  "multisparkSparkDuration\0"
+  "waterPump2cold\0"
+  "wastegatePositionSensor\0"
+  "tachPulseDuractionMs\0"
+  "idleReturnTargetRampDuration\0"
+  "tpsAccelFractionDivisor\0"
+  "rawTps2Secondary\0"
+  "cc_speedBandHigh\0"
+  "idlewasResetPid\0"
+  "cc_rpmDeadBandLow\0"
+  "inj1ok\0"
+  "inj2ok\0"
+  "inj3ok\0"
+  "inj4ok\0"
+  "inj5ok\0"
+  "inj6ok\0"
+  "inj7ok\0"
+  "inj8ok\0"
+  "inj9ok\0"
+  "intake\0"
+  "etb1etbTpsErrorCounter\0"
+  "rawAuxAnalog1\0"
+  "rawAuxAnalog2\0"
+  "rawAuxAnalog3\0"
+  "rawAuxAnalog4\0"
+  "rawAuxAnalog5\0"
+  "rawAuxAnalog6\0"
+  "rawAuxAnalog7\0"
+  "rawAuxAnalog8\0"
+  "tachPulseDurationAsDutyCycle\0"
+  "etb1targetWithIdlePosition\0"
+  "idlelooksLikeCoasting\0"
+  "triggerSkipPulses\0"
+  "alternator_iTermMax\0"
+  "alternator_iTermMin\0"
+  "afrGasolineScale\0"
+  "vvt1itriggerSyncGapRatio\0"
+  "wallFuelAmount\0"
+  "MAFMAPLoadIsMAF\0"
+  "idleReturnTargetRamp\0"
+  "mapVvt_CycleDelta\0"
+  "fuelLevelUpdatePeriodSec\0"
+  "lua.clutchDownState\0"
+  "disallowPrimeFuelPump\0"
+  "clBoostTableSwitch1Active\0"
+  "boostluaTargetAdd\0"
+  "wastegateDcStatus.resetCounter\0"
+  "currentEngineDecodedPhase\0"
+  "fan1disabledWhileEngineStopped\0"
+  "coastingFuelCutRpmLow\0"
+  "can_call_counter\0"
+  "byFirmwareVersion\0"
+  "baroSensor.highValue\0"
+  "can1ListenMode\0"
+  "dynoCarCargoMassKg\0"
+  "baroLowValueVoltage\0"
+  "etb.pFactor\0"
+  "running.intakeTemperatureCoefficient\0"
+  "ISSValue\0"
+  "stft.cell.maxRemove\0"
+  "useFixedBaroCorrFromMap\0"
+  "waterPump2brokenClt\0"
+  "wastegateDcStatus.output\0"
+  "vvt1itriggerCountersError\0"
+  "useSeparateAdvanceForIdle\0"
+  "dynoCarGearFinalDrive\0"
+  "dwellAccuracyRatio\0"
+  "launchCorrectionsEndRpm\0"
+  "enableCanVss\0"
+  "triggerPrimaryFall\0"
+  "triggerPrimaryRise\0"
+  "tmf_tmfarea\0"
+  "nitrousisNitrousMapCondition\0"
+  "lua.luaFuelCut\0"
+  "crank\0"
+  "cltTimingCorrection\0"
+  "enableAemXSeries\0"
+  "maxInjectorDutySustainedTimeout\0"
+  "tmf_sd_tmf_airmass_split\0"
+  "idleTimingPid.dFactor\0"
+  "ready\0"
+  "trailingSparkAngle\0"
+  "ambientTempSensor.config.tempC_1\0"
+  "ambientTempSensor.config.tempC_2\0"
+  "ambientTempSensor.config.tempC_3\0"
+  "VBatt\0"
+  "egoValueShift\0"
+  "detectedGear\0"
+  "isMapAveragingEnabled\0"
+  "vvtActivationDelayMs\0"
+  "canSleepPeriodMs\0"
+  "acPressureEnableHyst\0"
+  "minimumIgnitionTiming\0"
+  "firmwareSignatureHash\0"
+  "kLineDoHondaSend\0"
+  "waterPumpm_state\0"
+  "camDecoder2jzPrecision\0"
+  "boostStatus.resetCounter\0"
+  "ambientTemp\0"
+  "mapErrorDetectionTooHigh\0"
+  "trgtriggerStateIndex\0"
+  "assistedEtbRiseWindowSec\0"
+  "isBelowTemperatureThreshold\0"
+  "cc_max_soft_etb\0"
+  "coastingFuelCutVssLow\0"
+  "hpfpPumpVolume\0"
+  "stepperDcInvertedPins\0"
+  "ltitSmoothingIntensity\0"
+  "ltitStableRpmThreshold\0"
+  "stoichiometricRatio\0"
+  "primaryInjectorDisabled1\0"
+  "primaryInjectorDisabled2\0"
+  "primaryInjectorDisabled3\0"
+  "primaryInjectorDisabled4\0"
+  "primaryInjectorDisabled5\0"
+  "primaryInjectorDisabled6\0"
+  "primaryInjectorDisabled7\0"
+  "primaryInjectorDisabled8\0"
+  "primaryInjectorDisabled9\0"
+  "issEdgeCounter\0"
+  "rawRawPpsPrimary\0"
+  "lambdaCurrentlyGood\0"
+  "cruiseControlAverageAdjustment\0"
+  "correctedIgnitionAdvance\0"
+  "sd_formating\0"
+  "afrSensorLambdaRange\0"
+  "canButtons18\0"
+  "compressionRatio\0"
+  "idleStepperTargetPosition\0"
+  "vssCalSpeed\0"
+  "waterPump2OnTemperature\0"
+  "mc33_i_hold\0"
+  "mc33_i_peak\0"
+  "auxFrequencyFilter\0"
+  "vssEdgeCounter\0"
+  "trigger.customSkippedToothCount\0"
+  "boostStatus.dTerm\0"
+  "boostStatus.error\0"
+  "mafExpAverageAlpha\0"
+  "wheelSlipRatio\0"
+  "boostStatus.iTerm\0"
+  "etbRevLimitRange\0"
+  "etbRevLimitStart\0"
+  "idleTimingPid.maxValue\0"
+  "multisparkMaxSparkingAngle\0"
+  "flexPercent\0"
+  "cc_maxThrottlePedalAllowedToEngage\0"
+  "iat.config.bias_resistor\0"
+  "boostStatus.pTerm\0"
+  "bypassTcharge\0"
+  "rawAfr\0"
+  "rawClt\0"
+  "rawIat\0"
+  "rawMaf\0"
+  "rawMap\0"
+  "rawVss\0"
+  "ltitIgnitionOffSaveDelay\0"
+  "useInjectorFlowLinearizationTable\0"
+  "hpfpPidI\0"
+  "hpfpPidP\0"
+  "isO2HeaterOn\0"
+  "olBoostTableSwitch1Active\0"
+  "injectorFlowAsMassFlow\0"
+  "allowIdenticalPps\0"
+  "twoWireBatchIgnition\0"
+  "ppsExpAverageAlpha\0"
+  "boostboostOutput\0"
+  "idleisInDeadZone\0"
+  "sd_msd\0"
+  "sdLoad\0"
+  "engineSnifferFocusOnInputs\0"
+  "canInputBCM\0"
+  "tcuDesiredGear\0"
+  "vvtCamCounter\0"
+  "startw\0"
+  "waterPump2radiatorFanStatus\0"
+  "lambdaTimeSinceGood\0"
+  "acDelay\0"
+  "storedInitialBaroPressure\0"
+  "baseIgnitionAdvance\0"
+  "fan2disabledWhileEngineStopped\0"
+  "acnoClt\0"
+  "ltitStableTime\0"
+  "torqueReductionTriggerPinState\0"
+  "vssPulsePerKm\0"
+  "tmf_cd\0"
+  "torque\0"
+  "flexSensorInverted\0"
+  "boostStatus.output\0"
+  "tpsADC\0"
+  "tpsMax\0"
+  "tpsMin\0"
+  "ignTableSwitch2Active\0"
+  "isCltError\0"
+  "gyroYaw\0"
+  "waterPump2enabledForAc\0"
+  "running.timeSinceCrankingInSecs\0"
+  "hpfpPid_iTermMax\0"
+  "hpfpPid_iTermMin\0"
+  "deviceUid\0"
+  "rawMCP3208_v_1\0"
+  "rawMCP3208_v_2\0"
+  "rawMCP3208_v_3\0"
+  "rawMCP3208_v_4\0"
+  "rawMCP3208_v_5\0"
+  "rawMCP3208_v_6\0"
+  "rawMCP3208_v_7\0"
+  "rawMCP3208_v_8\0"
+  "rawMCP3208_v_9\0"
+  "fuelTankLevel\0"
+  "compressorDischargeTemp\0"
+  "tpsAeScaledFrom\0"
+  "etb1m_wastegatePosition\0"
+  "tpsFuelPumpPrimeEnabled\0"
+  "fuelPumpignitionOn\0"
+  "mc33_hpfp_i_hold\0"
+  "mc33_hpfp_i_peak\0"
+  "silentTriggerError\0"
+  "fuelingLoad\0"
+  "sd.tChargeK\0"
+  "useIdleAdvanceWhileCoasting\0"
+  "dynoCarGearRatio\0"
+  "tmf_maf_engineload_split\0"
+  "camDecoder2jzPosition\0"
+  "minimumBoostClosedLoopMap\0"
+  "oilPressure\0"
+  "modeledFlowIdle\0"
+  "dfcoRetardDeg\0"
+  "rawMapPre\0"
+  "warmup\0"
+  "multisparkDwell\0"
+  "tpsErrorDetectionTooLow\0"
+  "auxTempSensor1.config.resistance_1\0"
+  "auxTempSensor1.config.resistance_2\0"
+  "auxTempSensor1.config.resistance_3\0"
+  "boostUsePWMLimiterLowerWg\0"
+  "baroHasError\0"
+  "globalSparkCounter\0"
+  "tps1Split\0"
+  "startCrankingDuration\0"
+  "tpsExtraShotTimer\0"
+  "useIdleTimingTargetError\0"
+  "vvt2etriggerSyncGapRatio\0"
+  "mc33_hpfp_max_hold\0"
+  "triggerEventsTimeoutMs\0"
+  "useLinearIatSensor\0"
+  "fan2enabledForAc\0"
+  "tChargeAirDecrLimit\0"
+  "usescriptTableForCanSniffingFiltering\0"
+  "fixSyncMisfire\0"
+  "multiSparkCounter\0"
+  "actualLastInjection\0"
+  "tps2Split\0"
+  "rawMCP3208_v_10\0"
+  "rawMCP3208_v_11\0"
+  "rawMCP3208_v_12\0"
+  "rawMCP3208_v_13\0"
+  "rawMCP3208_v_14\0"
+  "rawMCP3208_v_15\0"
+  "rawMCP3208_v_16\0"
+  "rawMCP3208_v_17\0"
+  "rawMCP3208_v_18\0"
+  "rawMCP3208_v_19\0"
+  "rawMCP3208_v_20\0"
+  "rawMCP3208_v_21\0"
+  "rawMCP3208_v_22\0"
+  "rawMCP3208_v_23\0"
+  "rawMCP3208_v_24\0"
+  "useSeparateAdvanceForCranking\0"
+  "nitrousisNitrousSpeedCondition\0"
+  "TPS2Value\0"
+  "etb2etbPpsErrorCounter\0"
+  "tunedMafCorrection\0"
+  "vvt2ivvtToothDurations0\0"
+  "luaLaunchState\0"
+  "sd_logging_internal\0"
+  "boostluaTargetMult\0"
+  "idleisCranking\0"
+  "mcuSerial\0"
+  "fuelPumptpsFuelPumpPrime\0"
+  "disableWaterPump2WhenStoppedTimeout\0"
+  "clutchDownState\0"
+  "multisparkMaxExtraSparkCount\0"
+  "idleStatus.output\0"
+  "vehicleSpeedKphFrontAvg\0"
+  "cc_maxSpeed\0"
+  "auxTempSensor2.config.bias_resistor\0"
+  "OLBoostBlend1BlendMode\0"
+  "ltitCorrectionRate\0"
+  "frequencyMafFilter\0"
+  "startRequestPinInverted\0"
+  "etb1validPlantPosition\0"
+  "mapPreFast\0"
+  "invertVvtControlIntake\0"
+  "isDecodingMapCam\0"
+  "lowPressureFuel.value1\0"
+  "lowPressureFuel.value2\0"
+  "triggerElapsedUs\0"
+  "tpsLowPassCutoffHz\0"
+  "etb2etbFeedForward\0"
+  "throttleInletPressure\0"
+  "can_var_get_counter\0"
+  "tracSpeedFrontRearREF\0"
+  "boostPid.minValue\0"
+  "isBrakePedalActivated\0"
+  "idlePositionSensor\0"
+  "alwaysWriteSdCard\0"
+  "etbWastegatePid.offset\0"
+  "ignitionOnTime\0"
+  "vvt1etriggerStateIndex\0"
+  "firmwareVersion\0"
+  "alternatorPwmFrequency\0"
+  "boostisBelowClosedLoopThreshold\0"
+  "auxLinear1\0"
+  "auxLinear2\0"
+  "auxLinear3\0"
+  "auxLinear4\0"
+  "acengineTooHot\0"
+  "usbBytesOut\0"
+  "vssFilterReciprocal1\0"
+  "vssFilterReciprocal2\0"
+  "vssFilterReciprocal3\0"
+  "vssFilterReciprocal4\0"
+  "fuelFlowRate\0"
+  "luaLastCycleDuration\0"
+  "vvt1evvtCurrentPosition\0"
+  "disableWaterPumpAtSpeed\0"
+  "tpsCondition\0"
+  "fuelPumpisFuelPumpOn\0"
+  "waterPumpdisabledBySpeed\0"
+  "etb1etbErrorCode\0"
+  "useRawOutputToDriveIdleStepper\0"
+  "overrideVvtTriggerGaps\0"
+  "wheelspeedRearAvgError\0"
+  "disableWaterPumpWhenStoppedTimeout\0"
+  "boostClosedLoopYAxisValue\0"
+  "canBoxTracTrimStep\0"
+  "fan1PwmEnabled\0"
+  "rpmLaunchCondition\0"
+  "instantMAPPREValue\0"
+  "accPedalSplit\0"
+  "idleidleClosedLoop\0"
+  "wastegatePositionOpenedVoltage\0"
+  "fan2OnTemperature\0"
+  "lambdaProtectionRestoreRpm\0"
+  "lambdaProtectionRestoreTps\0"
+  "compressorDischargeTemperature.config.resistance_1\0"
+  "compressorDischargeTemperature.config.resistance_2\0"
+  "compressorDischargeTemperature.config.resistance_3\0"
+  "isMapPredictionActive\0"
+  "canReWidebandFwDay\0"
+  "canReWidebandFwMon\0"
+  "fan1disabledBySpeed\0"
+  "knockDetectionUseDoubleFrequency\0"
+  "vehicleSpeedKph1\0"
+  "vehicleSpeedKph2\0"
+  "vehicleSpeedKph3\0"
+  "vehicleSpeedKph4\0"
+  "knockSuppressMinRpm\0"
+  "knockSuppressMinTps\0"
+  "ecumasterEgtToCan\0"
+  "maxInjectorDutyInstant\0"
+  "startStopState\0"
+  "boostrpmTooLow\0"
+  "dynoSaeTemperatureC\0"
+  "rawAfr2\0"
+  "rawMaf2\0"
+  "cruiseControlInhibitDFCO\0"
+  "assistedEtbPeriodSec\0"
+  "enableExtendedCanBroadcast\0"
+  "etbTargetSmoothingFactor\0"
+  "cc_rpmBandHigh\0"
+  "sparkCutReasonBlinker\0"
+  "map.sensorpre.highValue\0"
+  "useCltBasedRpmLimit\0"
+  "mc33_hpfp_i_hold_off\0"
+  "luaDigitalState0\0"
+  "luaDigitalState1\0"
+  "luaDigitalState2\0"
+  "luaDigitalState3\0"
+  "consumeObdSensors\0"
+  "auxSpeed1\0"
+  "auxSpeed2\0"
+  "auxSpeed3\0"
+  "auxSpeed4\0"
+  "useNoiselessTriggerDecoder\0"
+  "cc_maxEtbAdjustmentClose\0"
+  "tracMinMap\0"
+  "tracMinRpm\0"
+  "tracMinTps\0"
+  "schedulingUsedCount\0"
+  "boostPid.iFactor\0"
+  "mappreLowValueVoltage\0"
+  "acengineTooFast\0"
+  "acengineTooSlow\0"
+  "fan1MaxPwm\0"
+  "turbochargerFilter\0"
+  "vvt2etriggerCountersError\0"
+  "triggerIgnoredToothCount\0"
+  "rawHighFuelPressure\0"
+  "driveWheelRevPerKm\0"
+  "fan1MinPwm\0"
+  "epic_hall_inps18\0"
+  "enableFan2WithAc\0"
+  "forceIdleIgnitionUseDFCO\0"
+  "afrTableYAxis\0"
+  "camSyncOnSecondCrankRevolution\0"
+  "temp_mapVvt_index\0"
+  "dynoCarWheelTireWidthMm\0"
+  "idleidle_deltaRpmAdj\0"
+  "boostisNotClosedLoop\0"
+  "speedometerPulsePerKm\0"
+  "triggerSecondaryFall\0"
+  "triggerSecondaryRise\0"
+  "etb1DutyCycle\0"
+  "hpfpTargetDecay\0"
+  "stft.startupDelay\0"
+  "coilDutyCycle\0"
+  "waterPumpfan_pwm_started\0"
+  "injAdvAssistStepDeg\0"
+  "ltitEnabled\0"
+  "etb1boardEtbAdjustment\0"
+  "neverWrite\0"
+  "tpsaeburnskipinitial\0"
+  "etbJamTimeout\0"
+  "useCustomCLTSensor\0"
+  "knockm_knockThreshold\0"
+  "useAdvanceCorrectionsForCranking\0"
+  "idleIncrementalPidCic\0"
+  "baroHasNoPressure\0"
+  "luaCanRxWorkaround\0"
+  "canBoxIdleUpRpm\0"
+  "nitrousDeactivationRpm\0"
+  "fan2OffTemperature\0"
+  "usbBytesInPerSec\0"
+  "invertCamVVTSignal\0"
+  "rethrowHardFault\0"
+  "knockm_knockSpectrumChannelCyl\0"
+  "tuningDetector\0"
+  "afrTableSwitch1Active\0"
+  "fan1fan_pwm_started\0"
+  "nitrousMinimumClt\0"
+  "nitrousMinimumTps\0"
+  "rpmSoftLimitWindowSize\0"
+  "testBenchIter\0"
+  "rpmSoftLimitFuelAdded\0"
+  "fan2disabledBySpeed\0"
+  "accelSelfTest\0"
+  "isDoubleSolenoidIdle\0"
+  "trgtriggerCountersError\0"
+  "isTuningNow\0"
+  "nitrousisNitrousTpsCondition\0"
+  "fan1SoftStartSec\0"
+  "waterPump2disabledBySpeed\0"
+  "tpsAccelFractionPeriod\0"
+  "knockm_knockCount\0"
+  "crankingFuel.baseFuel\0"
+  "waterPump2notRunning\0"
+  "tachSweepUsesTachCorrection\0"
+  "mc33_t_min_boost\0"
+  "knockm_knockLevel\0"
+  "disableWaterPump2AtSpeed\0"
+  "ignitionLoad\0"
+  "hpfpPeakPos\0"
+  "idleStepperReactionTime\0"
+  "speedoSweepMax\0"
+  "deltaTpsAverageAlpha\0"
+  "antilagTriggered\0"
+  "kickStartCranking\0"
+  "enableStagedInjection\0"
+  "transitionEventsCounter\0"
+  "tpsDecelEnleanmentMultiplier\0"
+  "etbWastegatePid.periodMs\0"
+  "rpmHardLimit\0"
+  "epicInitHSHigh\0"
+  "canBroadcastUseChannelTwo\0"
+  "etbSkipReinitWhileRunning\0"
+  "mc33_hvolt\0"
+  "rawMapPreFast\0"
+  "enableKline\0"
+  "smartChipRestartCounter\0"
+  "canWriteOk\0"
+  "tmf_deltap\0"
+  "cc_rpmBandLow\0"
+  "mappreHighValueVoltage\0"
+  "trigger.customTotalToothCount\0"
+  "cruiseControlReadBrakePedal\0"
+  "launchTimingRetard\0"
+  "canBroadcastEgt\0"
+  "ALSEtbAdd\0"
+  "rawFuelTankLevel\0"
+  "rawAuxLinear1\0"
+  "rawAuxLinear2\0"
+  "rawAuxLinear3\0"
+  "rawAuxLinear4\0"
+  "knockm_knockFrequencyStep\0"
+  "dcOutput0\0"
+  "boostSpooledApplyToLowerWg\0"
+  "etb1luaAdjustment\0"
+  "canReadCounter\0"
+  "wheelspeedFrontAvgError\0"
+  "baroHighValueVoltage\0"
+  "activateSwitchCondition\0"
+  "coastingFuelCutRpmHigh\0"
+  "TPSValue\0"
+  "afr.value1\0"
+  "afr.value2\0"
+  "MAPValue\0"
+  "mc33_t_bypass\0"
+  "starterRelayDisable\0"
+  "noFuelTrimAfterDfcoTime\0"
+  "fan2fan_pwm_started\0"
+  "etbWastegatePid.iFactor\0"
+  "sd_active_rd\0"
+  "sd_active_wr\0"
+  "waterPump2fan_pwm_started\0"
+  "wheelSlipRatioLeftRightFRONT\0"
+  "tpsAccelEnrichmentThreshold\0"
+  "trgtriggerSyncGapRatio\0"
+  "stage2InjSmallPwActive\0"
+  "fan1PwmFrequency\0"
+  "warningPeriod\0"
+  "calmerBurn\0"
+  "vehicleSpeedKphRearAvg\0"
+  "auxTemp1\0"
+  "auxTemp2\0"
+  "tmf_airflow\0"
+  "actpsTooHigh\0"
+  "currentVe\0"
+  "overrideTriggerGaps\0"
+  "needBurn\0"
+  "waterPumpExtraIdle\0"
+  "globalFuelCorrection\0"
+  "globalAFRTrim\0"
+  "isFlatShiftConditionSatisfied\0"
+  "vvtPositionB1E\0"
+  "vvtPositionB1I\0"
+  "vvtPositionB2E\0"
+  "vvtPositionB2I\0"
+  "fan1ExtraIdle\0"
+  "mcp3208divider\0"
+  "compressorDischargePressure\0"
+  "isMapPreAveragingEnabled\0"
+  "maxIdleVss\0"
+  "enableWaterPump2\0"
+  "rawFuelLevel\0"
+  "canBoxIdleUpPercentage\0"
+  "pidExtraForLowRpm\0"
+  "sdTcharge_coff\0"
+  "totalFuelConsumption\0"
+  "isMafAveragingEnabled\0"
+  "etb2etbCurrentTarget\0"
+  "secToMainRelayOff\0"
+  "boostPid.pFactor\0"
+  "idlebadTps\0"
+  "epic_dinp1\0"
+  "epic_dinp2\0"
+  "epic_dinp3\0"
+  "epic_dinp4\0"
+  "epic_dinp5\0"
+  "epic_dinp6\0"
+  "epic_dinp7\0"
+  "epic_dinp8\0"
+  "cylinderBore\0"
+  "ltft.maxAdd\0"
+  "waterPump2hot\0"
+  "waterPump2Pwm\0"
+  "waterPumpcold\0"
+  "boostPid.offset\0"
+  "idlemightResetPid\0"
+  "widebandOnSecondBus\0"
+  "mapPredictionBlendDuration\0"
+  "lambdaProtectionEnable\0"
+  "triggerCompCenterVolt\0"
+  "tpsSecondaryADC\0"
+  "idlem_lastTargetRpm\0"
+  "fan2ExtraIdle\0"
+  "accPedalUnfiltered\0"
+  "tunerStudioSerialSpeed\0"
+  "acPressure.v1\0"
+  "acPressure.v2\0"
+  "vvtControlMinClt\0"
+  "vvtControlMinRpm\0"
+  "vvt2itriggerSyncGapRatio\0"
+  "baroSensor.lowValue\0"
+  "useBiQuadOnAuxSpeedSensors\0"
+  "idlePidDeactivationTpsThreshold\0"
+  "warningCounter\0"
+  "hpfpMinAngle\0"
+  "kLineBaudRate\0"
+  "acacPressureTooLow\0"
+  "etb1tcEtbDrop\0"
+  "isIatError\0"
+  "primingDelay\0"
+  "dynoSaeRelativeHumidity\0"
+  "knockBankCyl1\0"
+  "knockBankCyl2\0"
+  "knockBankCyl3\0"
+  "knockBankCyl4\0"
+  "knockBankCyl5\0"
+  "knockBankCyl6\0"
+  "knockBankCyl7\0"
+  "knockBankCyl8\0"
+  "knockBankCyl9\0"
+  "waterPump2AcAdder\0"
+  "overDwellCounter\0"
+  "veBlend1BlendMode\0"
+  "lua.acRequestState\0"
+  "tpsAeResetsEgo\0"
+  "rawBattery\0"
+  "ALSMaxCLT\0"
+  "ALSMaxRPM\0"
+  "ALSMaxTPS\0"
+  "injectionPrimingCounter\0"
+  "ALSMinCLT\0"
+  "ALSMinRPM\0"
+  "tps12Split\0"
+  "sd_airflow\0"
+  "vssGearRatio1\0"
+  "vssGearRatio2\0"
+  "vssGearRatio3\0"
+  "vssGearRatio4\0"
+  "mafAirmass\0"
+  "skippedWheelOnCam\0"
+  "coilState10\0"
+  "coilState11\0"
+  "coilState12\0"
+  "verboseVVTDecoding\0"
+  "assistedEtbSettleWindowSec\0"
+  "dynoCarWheelDiaInch\0"
+  "injector.flow\0"
+  "etbWastegatePid.maxValue\0"
+  "externalRusEfiGdiModule\0"
+  "accelerometerFds\0"
+  "accelerometerHPM\0"
+  "accelerometerOrd\0"
+  "wastegateDcStatus.dTerm\0"
+  "wastegateDcStatus.error\0"
+  "wastegateDcStatus.iTerm\0"
+  "knockSpectrumSensitivity\0"
+  "idleRpmPid.periodMs\0"
+  "veTableYAxis\0"
+  "isClutchActivated\0"
+  "wastegateDcStatus.pTerm\0"
+  "maxAcClt\0"
+  "maxAcRpm\0"
+  "maxAcTps\0"
+  "coastingFuelCutEnabled\0"
+  "iatSensorPulldown\0"
+  "etb2tcEtbDrop\0"
+  "vvt1ivvtToothDurations0\0"
+  "acrDisablePhase\0"
+  "etb.periodMs\0"
+  "mapCamPrevToothAngle\0"
+  "veBlend2BlendMode\0"
+  "assistedEtbRotateIterations\0"
+  "tChargeAirFlowMax\0"
+  "pedalToTpsIndex\0"
+  "afrExpAverageAlpha\0"
+  "normalizedCylinderFilling\0"
+  "idlecurrentIdlePosition\0"
+  "injectorFault\0"
+  "fuelClosedLoopCorrectionEnabled\0"
+  "flashWriteDelay\0"
+  "displayLogicLevelsInEngineSniffer\0"
+  "DriverThrottleIntent\0"
+  "oilTemp\0"
+  "overDwellNotScheduledCounter\0"
+  "extiOverflowCount\0"
+  "mapVvt_MAP_AT_CYCLE_COUNT\0"
+  "mapSyncThreshold\0"
+  "enableVerboseCanTx\0"
+  "acPressure\0"
+  "can_call_last_arg\0"
+  "can_call_last_ret\0"
+  "lua.fuelAdd\0"
+  "sdAirMassInOneCylinder\0"
+  "maxInjectorDutySustained\0"
+  "idleEntryRampInterpolateAngle\0"
+  "nitrousMinimumVehicleSpeed\0"
+  "mafMeasured2\0"
+  "etbNeutralPosition\0"
+  "can_call_last_func_id\0"
+  "cc_speedDeadBandLow\0"
+  "dfcoDelay\0"
+  "useSmoothedLambda\0"
+  "injAdvAssistStepCycles\0"
+  "tmf_pratio\0"
+  "lua.disableDecelerationFuelCutOff\0"
+  "mafMinBufferLength\0"
+  "tcUseSparkSkip\0"
+  "isEnabled0\0"
+  "frequencyMafMeasured\0"
+  "fuelLevelLowThresholdVoltage\0"
+  "idleRpmPid.iFactor\0"
+  "isSwitchActivated\0"
+  "RPMValue\0"
+  "rpmForIgnitionTableDot\0"
+  "tpsExtraShotMult\0"
+  "epicCanAllowSetVar\0"
+  "lambdaValue2\0"
+  "nitrousisNitrousAfrCondition\0"
+  "vvt2evvtToothDurations0\0"
+  "speedCondition\0"
+  "enableWaterPumpWithAc\0"
+  "engineMakeCodeNameCrc16\0"
+  "waterPumphot\0"
+  "waterPumpPwm\0"
+  "aeEngageCnt\0"
+  "tcUseETB\0"
+  "idleisIdleCoasting\0"
+  "etb2jamTimer\0"
+  "iacByTpsDecayTime\0"
+  "fuelCutReasonBlinker\0"
+  "etbWastegatePid.pFactor\0"
+  "fastAdcConversionCount\0"
+  "useTableForDfcoMap\0"
+  "idleTimingPid.minValue\0"
+  "rpmHardLimitHyst\0"
+  "lambdaProtectionMinRpm\0"
+  "lambdaProtectionMinTps\0"
+  "stoichRatioPrimary\0"
+  "luaInvocationCounter\0"
+  "measureMafOnlyInOneCylinder\0"
+  "baroCounts\0"
+  "calibrationMode\0"
+  "stft.cell.maxAdd\0"
+  "analogInputDividerCoefficient\0"
+  "rawAmbientTemp\0"
+  "idlem_isCoastingAdvance\0"
+  "useBiQuadOnAuxSpeedSensors1\0"
+  "useBiQuadOnAuxSpeedSensors2\0"
+  "useBiQuadOnAuxSpeedSensors3\0"
+  "useBiQuadOnAuxSpeedSensors4\0"
+  "can_blend_olboost_1_toggle\0"
+  "SparkLatencyCorrection\0"
+  "useIdleVeWhileCoasting\0"
+  "tmf_tbarea\0"
+  "running.coolantTemperatureCoefficient\0"
+  "ALSMaxDuration\0"
+  "isUsbConnected\0"
+  "idleluaAdd\0"
+  "stftIgnoreErrorMagnitude\0"
+  "fan2cranking\0"
+  "etbEnabled\0"
+  "tracDisabled\0"
+  "usbBytesIn\0"
+  "boostOpenLoopYAxisValue\0"
+  "lambdaMonitorCut\0"
+  "alternatorControl.iFactor\0"
+  "startButtonSuppressOnStartUpMs\0"
+  "waterPump2OffTemperature\0"
+  "wheelspeedRLerror\0"
+  "etb.dFactor\0"
+  "idleTimingSoftEntryTime\0"
+  "epic_dinps18\0"
+  "outputRequestPeriod\0"
+  "canBroadcastCams\0"
+  "mafLowPassCutoffHz\0"
+  "tmf_maxairflow\0"
+  "kLinePeriodUs\0"
+  "isInjectionEnabled\0"
+  "mapVvt_sync_counter\0"
+  "idleisIdleClosedLoop\0"
+  "isTorqueReductionTriggerPinValid\0"
+  "cltSensorPulldown\0"
+  "wheelSlipRatioFrontRear\0"
+  "trgvvtCurrentPosition\0"
+  "launchActivatePinState\0"
+  "acIdleExtraOffset\0"
+  "veValue\0"
+  "idleRpmPid.maxValue\0"
+  "idleidleState\0"
+  "ltft.timeConstant\0"
+  "stoichRatioSecondary\0"
+  "waterPump2MaxPwm\0"
+  "tmf_sd_engineload_split\0"
+  "etb.maxValue\0"
+  "maxAcPressure\0"
+  "waterPump2MinPwm\0"
+  "mapCamDetectionAnglePosition\0"
+  "idlePidRpmUpperLimit\0"
+  "canWriteNotOk\0"
+  "fan2m_state\0"
+  "ppsLowPassCutoffHz\0"
+  "dtTuneSequential\0"
+  "knockFrequency\0"
+  "isTimeConditionSatisfied\0"
+  "alternatorControl.offset\0"
+  "knockm_knockFuelTrimMultiplier\0"
+  "useIdleTimingTargetErrorMode\0"
+  "can_call_counter_dlc_ok\0"
+  "can_call_last_src_id\0"
+  "auxTempSensor2.config.resistance_1\0"
+  "auxTempSensor2.config.resistance_2\0"
+  "auxTempSensor2.config.resistance_3\0"
+  "knockRetardAggression\0"
+  "tcUseIgnTiming\0"
+  "isMafAveraging\0"
+  "vvtOutput\0"
+  "fuelPumpfuelPumpForceState\0"
+  "tcuEnabled\0"
+  "disablemax31855\0"
+  "fuelLevelHighThresholdVoltage\0"
+  "etb1etbPpsErrorCounter\0"
+  "cruiseControlAllowPedalUpToEngage\0"
+  "cruiseControlEnabled\0"
+  "etbFreq\0"
+  "totalTriggerErrorCounter\0"
+  "est_temp_charge_c\0"
+  "est_temp_charge_k\0"
+  "ltitApplyToFuel\0"
+  "afr2GasolineScale\0"
+  "dfcoRetardRampInTime\0"
+  "loadForIgnitionTableDot\0"
+  "idleidle_timeInIdle\0"
+  "highPressureFuel.v1\0"
+  "highPressureFuel.v2\0"
+  "rawWastegatePosition\0"
+  "rusefiVerbose29b\0"
+  "maf_airflow\0"
+  "maf_airmass\0"
+  "actualLastInjSTG2PreSmallPw\0"
+  "isFasterEngineSpinUpEnabled\0"
+  "lua.luaDisableEtb\0"
+  "cruiseControlReadClutchUp\0"
+  "stimulatorBench\0"
+  "etb1trim\0"
+  "rawOilPressure\0"
+  "airByRpmTaper\0"
+  "crankingTimingAngle\0"
+  "etb2trim\0"
+  "boostisBoostControlled\0"
+  "rawAcPressure\0"
+  "injectorState1\0"
+  "injectorState2\0"
+  "injectorState3\0"
+  "injectorState4\0"
+  "injectorState5\0"
+  "injectorState6\0"
+  "injectorState7\0"
+  "injectorState8\0"
+  "injectorState9\0"
+  "cc_minSpeed\0"
+  "fan2notRunning\0"
+  "Gego\0"
+  "fuelLevelAveragingAlpha\0"
+  "etbStatus.resetCounter\0"
+  "isRunningBench\0"
+  "throttlePedalWOTVoltage\0"
+  "wheelspeedRRerror\0"
+  "canWriteEnabled\0"
+  "cc_setpoint_adjust_rate\0"
+  "tps1_diameter\0"
+  "tChargeAirCoefMax\0"
+  "tChargeAirCoefMin\0"
+  "triggerSimulatorRpm\0"
+  "targetAFR\0"
+  "waterPumpAcAdder\0"
+  "waterPump2PwmEnabled\0"
+  "vvt2itriggerCountersError\0"
+  "stepper_dc_use_two_wires\0"
+  ;
+
+static const VarCatalogEntry VAR_CATALOG[VAR_CATALOG_SIZE] = {
+  { -2146852436, 0, 1 },  // etbSplit
+  { -2146434132, 9, 1 },  // idleRpmPid.pFactor
+  { -2146292012, 28, 0 },  // sadDwellRatioCounter
+  { -2142425790, 49, 1 },  // tachPulsePerRev
+  { -2140162309, 65, 1 },  // stft.maxLambda
+  { -2138018615, 80, 1 },  // acLowRpmLimit
+  { -2136933308, 94, 1 },  // calibrationBirthday
+  { -2133047664, 114, 0 },  // accelerationLat
+  { -2133047208, 130, 0 },  // accelerationLon
+  { -2132393748, 146, 0 },  // vvtTarget
+  { -2130836456, 156, 1 },  // throttlePedalUpVoltage
+  { -2124710580, 179, 0 },  // fuelPumpisPrime
+  { -2124102606, 195, 0 },  // etb2etbErrorCode
+  { -2120630025, 212, 0 },  // wheelSlipRatioLeftRightREF
+  { -2120302656, 239, 0 },  // waterPumpenabledForAc
+  { -2116746650, 261, 1 },  // tcuInputSpeedSensorTeeth
+  { -2114430012, 286, 1 },  // totalGearsCount
+  { -2112117188, 302, 0 },  // stopEngineCode
+  { -2111374247, 317, 1 },  // boostCutPressureHyst
+  { -2109056235, 338, 0 },  // etb2etbRevLimitActive
+  { -2104625325, 360, 1 },  // stepperForceParkingEveryRestart
+  { -2102560038, 392, 0 },  // acisDisabledByLua
+  { -2101952506, 410, 1 },  // useIacTableForCoasting
+  { -2100683129, 433, 1 },  // injectorPrimeInhibit
+  { -2096650725, 454, 1 },  // disableEtbWhenEngineStopped
+  { -2094010831, 482, 1 },  // lambdaProtectionMinLoad
+  { -2093662604, 506, 0 },  // idleisBlipping
+  { -2088298794, 521, 1 },  // cruiseControlReadClutchPedal
+  { -2086522258, 550, 1 },  // mc33_t_hold_off
+  { -2086516502, 566, 1 },  // mc33_t_hold_tot
+  { -2079960526, 582, 1 },  // gapTrackingLengthOverride
+  { -2079591860, 608, 1 },  // tcu_rangeSensorPulldown
+  { -2078468674, 632, 1 },  // waterPump2ExtraIdle
+  { -2073424832, 652, 0 },  // engineMode
+  { -2070332548, 663, 1 },  // maxCamPhaseResolveRpm
+  { -2068213709, 685, 1 },  // enabledStep1Limiter
+  { -2066867294, 705, 0 },  // baroPressure
+  { -2065814304, 718, 1 },  // iacByTpsTaper
+  { -2065042706, 732, 1 },  // ltitIntegratorThreshold
+  { -2056673411, 756, 0 },  // knockm_knockFrequencyStart
+  { -2054472109, 783, 0 },  // etb2luaAdjustment
+  { -2045878495, 801, 1 },  // disableWaterPump2WhenStopped
+  { -2045040875, 830, 0 },  // mafEstimate
+  { -2036308770, 842, 1 },  // cc_pedal_release_seconds
+  { -2036098060, 867, 1 },  // resetCanToggleInhibit1
+  { -2036098059, 890, 1 },  // resetCanToggleInhibit2
+  { -2036098058, 913, 1 },  // resetCanToggleInhibit3
+  { -2036098057, 936, 1 },  // resetCanToggleInhibit4
+  { -2036098056, 959, 1 },  // resetCanToggleInhibit5
+  { -2036098055, 982, 1 },  // resetCanToggleInhibit6
+  { -2036098054, 1005, 1 },  // resetCanToggleInhibit7
+  { -2036098053, 1028, 1 },  // resetCanToggleInhibit8
+  { -2035612655, 1051, 0 },  // isPedalError
+  { -2033984419, 1064, 1 },  // idleTimingPid.offset
+  { -2032003569, 1085, 0 },  // mafMeasured
+  { -2027523439, 1097, 1 },  // coastingFuelCutVssHigh
+  { -2021435668, 1120, 1 },  // ALSIdleAdd
+  { -2020267706, 1131, 1 },  // fan2MaxPwm
+  { -2018683234, 1142, 1 },  // complexWallModel
+  { -2016978331, 1159, 1 },  // minimumOilPressureTimeout
+  { -2015383594, 1185, 0 },  // hasCriticalError
+  { -2011139708, 1202, 1 },  // fan2MinPwm
+  { -2010169270, 1213, 0 },  // acacButtonState
+  { -2000802553, 1229, 0 },  // knockm_maximumRetard
+  { -1997922376, 1250, 0 },  // acacPressureTooHigh
+  { -1997438905, 1270, 1 },  // useSeparateVeForIdle
+  { -1997175144, 1291, 0 },  // fan1m_state
+  { -1996090622, 1303, 0 },  // idleneedReset
+  { -1995686573, 1317, 1 },  // alternatorControl.periodMs
+  { -1993968289, 1344, 1 },  // alternatorControl.pFactor
+  { -1993101119, 1370, 1 },  // waterPump2SoftStartSec
+  { -1992945039, 1393, 1 },  // boostCutPressure
+  { -1992436143, 1410, 1 },  // benchTestOnTime
+  { -1990709262, 1426, 1 },  // boostPwmFrequency
+  { -1985448683, 1444, 1 },  // yesUnderstandLocking
+  { -1983023250, 1465, 0 },  // vvt2esynchronizationCounter
+  { -1979108093, 1493, 0 },  // boosthasInitBoost
+  { -1976642929, 1511, 1 },  // boostControlMinMap
+  { -1976636992, 1530, 1 },  // boostControlMinRpm
+  { -1976634808, 1549, 1 },  // boostControlMinTps
+  { -1974390710, 1568, 1 },  // cc_smooth_exp_average
+  { -1973799222, 1590, 0 },  // highFuelPressure
+  { -1970249707, 1607, 0 },  // etb1etbFeedForward
+  { -1965263463, 1626, 0 },  // waterPumpradiatorFanStatus
+  { -1965075262, 1653, 1 },  // boostControlSafeDutyCycle
+  { -1965056926, 1679, 1 },  // fixedModeTiming
+  { -1962923820, 1695, 0 },  // seconds
+  { -1959120957, 1703, 0 },  // isLaunchCondition
+  { -1958312328, 1721, 1 },  // vssToothCount
+  { -1945673215, 1735, 0 },  // smartChipAliveCounter
+  { -1944260329, 1757, 1 },  // invertSecondaryTriggerSignal
+  { -1943724937, 1786, 0 },  // startStopPhysicalState
+  { -1943574844, 1809, 0 },  // trgsynchronizationCounter
+  { -1939960078, 1835, 0 },  // lastCanButtonSeen
+  { -1935221780, 1853, 0 },  // rawFlexFreq
+  { -1934896346, 1865, 1 },  // alwaysInstantRpm
+  { -1925174695, 1882, 0 },  // vehicleSpeedKph
+  { -1923222129, 1898, 1 },  // enableKnockSpectrogramFilter
+  { -1919072851, 1927, 0 },  // isWarnNow
+  { -1916613921, 1937, 0 },  // luaIgnitionSkip
+  { -1906717594, 1953, 1 },  // disableFan2AtSpeed
+  { -1902910591, 1972, 1 },  // ecuCanId
+  { -1899369472, 1981, 1 },  // ambientTempSensor.config.bias_resistor
+  { -1898025562, 2020, 1 },  // highPressureFuel.value1
+  { -1898025561, 2044, 1 },  // highPressureFuel.value2
+  { -1896516795, 2068, 1 },  // watchOutForLinearTime
+  { -1894116168, 2090, 1 },  // disableFan2WhenStoppedTimeout
+  { -1889531804, 2120, 0 },  // alternatorStatus.output
+  { -1888587696, 2144, 1 },  // ltft.deadband
+  { -1886479485, 2158, 0 },  // timingIatCorrection
+  { -1879090979, 2178, 1 },  // can2ListenMode
+  { -1877053191, 2193, 0 },  // etb2etbErrorCodeBlinker
+  { -1872098102, 2217, 0 },  // isPreLaunchCondition
+  { -1863470920, 2238, 0 },  // fuelAlgorithm
+  { -1862337922, 2252, 1 },  // idleTimingPid.iFactor
+  { -1855700175, 2274, 1 },  // etbMinimumPosition
+  { -1852204335, 2293, 1 },  // mapExpAverageAlpha
+  { -1847892463, 2312, 1 },  // fan2SoftStartSec
+  { -1843977329, 2329, 1 },  // ignitionDisabled1
+  { -1843977328, 2347, 1 },  // ignitionDisabled2
+  { -1843977327, 2365, 1 },  // ignitionDisabled3
+  { -1843977326, 2383, 1 },  // ignitionDisabled4
+  { -1843977325, 2401, 1 },  // ignitionDisabled5
+  { -1843977324, 2419, 1 },  // ignitionDisabled6
+  { -1843977323, 2437, 1 },  // ignitionDisabled7
+  { -1843977322, 2455, 1 },  // ignitionDisabled8
+  { -1843977321, 2473, 1 },  // ignitionDisabled9
+  { -1839290700, 2491, 0 },  // fuelInjectionCounter
+  { -1837413512, 2512, 1 },  // applyExpAverageToEtbTarget
+  { -1833685972, 2539, 1 },  // knockFuelTrimReapplyRate
+  { -1832527325, 2564, 1 },  // clt.config.tempC_1
+  { -1832527324, 2583, 1 },  // clt.config.tempC_2
+  { -1832527323, 2602, 1 },  // clt.config.tempC_3
+  { -1832431020, 2621, 1 },  // isBoostControlEnabled
+  { -1829995308, 2643, 1 },  // launchSparkCutEnable
+  { -1816997974, 2664, 1 },  // useLinearCltSensor
+  { -1813050607, 2683, 0 },  // idleStatus.dTerm
+  { -1811922497, 2700, 0 },  // idleStatus.error
+  { -1811840427, 2717, 1 },  // knockFuelTrimAggression
+  { -1811686395, 2741, 0 },  // sd_error
+  { -1808516876, 2750, 0 },  // etb1etbRevLimitActive
+  { -1808022618, 2772, 0 },  // etb1m_lastPidDtMs
+  { -1807121002, 2790, 0 },  // idleStatus.iTerm
+  { -1802940455, 2807, 0 },  // etb2m_adjustedTarget
+  { -1798887513, 2828, 1 },  // launchRpmWindow
+  { -1798837954, 2844, 0 },  // fastAdcPeriod
+  { -1798819555, 2858, 0 },  // idleStatus.pTerm
+  { -1798336054, 2875, 0 },  // rawPpsSecondary
+  { -1794461103, 2891, 1 },  // assistedEtbMinBatteryVoltage
+  { -1792900549, 2920, 0 },  // acacCompressorState
+  { -1791885641, 2940, 0 },  // tpsaccaen
+  { -1791882374, 2950, 0 },  // tpsaccden
+  { -1790051911, 2960, 0 },  // checkEngine
+  { -1789907774, 2972, 1 },  // waterPump2PwmFrequency
+  { -1788499857, 2995, 1 },  // maxOilPressureTimeout
+  { -1786673317, 3017, 1 },  // nitrousDeactivationRpmWindow
+  { -1780282696, 3046, 0 },  // RealLambdaValue1
+  { -1780282695, 3063, 0 },  // RealLambdaValue2
+  { -1779658835, 3080, 0 },  // totalFuelCorrection
+  { -1778606949, 3100, 0 },  // fan2radiatorFanStatus
+  { -1777838088, 3122, 0 },  // baseDwell
+  { -1773414247, 3132, 0 },  // fastAdcLastError
+  { -1771449111, 3149, 1 },  // isAlternatorControlEnabled
+  { -1764857649, 3176, 0 },  // vvtChannel1
+  { -1764857648, 3188, 0 },  // vvtChannel2
+  { -1764857647, 3200, 0 },  // vvtChannel3
+  { -1764857646, 3212, 0 },  // vvtChannel4
+  { -1760115393, 3224, 1 },  // nitrousLuaGaugeArmingValue
+  { -1746157889, 3251, 0 },  // isTriggerError
+  { -1744146782, 3266, 1 },  // tpsSecondaryMaximum
+  { -1743747394, 3286, 1 },  // launchSpeedThreshold
+  { -1742418955, 3307, 1 },  // idlerpmpid_iTermMax
+  { -1742418701, 3327, 1 },  // idlerpmpid_iTermMin
+  { -1738951225, 3347, 0 },  // veTableSwitch1Active
+  { -1732159411, 3368, 0 },  // vvt2itriggerStateIndex
+  { -1731476413, 3391, 1 },  // cc_unsafeTps
+  { -1730868480, 3404, 1 },  // knockBankCyl10
+  { -1730868479, 3419, 1 },  // knockBankCyl11
+  { -1730868478, 3434, 1 },  // knockBankCyl12
+  { -1730700941, 3449, 0 },  // dtTuneCurCycle
+  { -1727829859, 3464, 0 },  // mapVvt_MAP_AT_SPECIAL_POINT
+  { -1726245940, 3492, 1 },  // maximumIgnitionTiming
+  { -1725192730, 3514, 1 },  // etb_iTermMax
+  { -1725192476, 3527, 1 },  // etb_iTermMin
+  { -1724873939, 3540, 1 },  // enableSoftwareKnock
+  { -1724101868, 3560, 0 },  // effectiveMap
+  { -1723435379, 3573, 0 },  // AFRValue2
+  { -1717868938, 3583, 0 },  // fan1hot
+  { -1717859969, 3591, 0 },  // fan1Pwm
+  { -1717833001, 3599, 0 },  // fan2hot
+  { -1717824032, 3607, 0 },  // fan2Pwm
+  { -1717336209, 3615, 1 },  // cranking.rpm
+  { -1715823812, 3628, 1 },  // cc_rpmDeadBandHigh
+  { -1708884225, 3647, 0 },  // triggerPageRefreshFlag
+  { -1703719182, 3670, 0 },  // vvt1evvtToothDurations0
+  { -1697011009, 3694, 0 },  // mafAirChargeLoad
+  { -1686338448, 3711, 1 },  // ltft.correctionEnabled
+  { -1684644880, 3734, 0 },  // rtcUnixEpochTime
+  { -1671871759, 3751, 1 },  // idleMaximumAirmass
+  { -1671099729, 3770, 1 },  // TMFLoadIsTMF
+  { -1670732400, 3783, 0 },  // accelerationVert
+  { -1668210650, 3800, 0 },  // tracSpeedLeftRightREF
+  { -1662199734, 3822, 0 },  // toothLogReady
+  { -1661556925, 3836, 1 },  // dynoCarFrontalAreaM2
+  { -1659154648, 3857, 0 },  // etbResetCnt
+  { -1658957891, 3869, 1 },  // tcu_shiftTime
+  { -1655178001, 3883, 1 },  // benchTestOffTime
+  { -1653846075, 3900, 1 },  // auxLowPassCutoffHz
+  { -1652586744, 3919, 1 },  // wallWettingAeEnabled
+  { -1652521980, 3940, 0 },  // acm_acEnabled
+  { -1645106444, 3954, 1 },  // lambdaProtectionTimeout
+  { -1644887108, 3978, 1 },  // auxSpeed1Multiplier
+  { -1644699118, 3998, 1 },  // fan2PwmFrequency
+  { -1643597865, 4015, 0 },  // idletargetRpmByClt
+  { -1642070946, 4034, 0 },  // can_call_last_ok
+  { -1637023613, 4051, 1 },  // enableWaterPump2WithAc
+  { -1634779035, 4074, 0 },  // isAppConditionSatisfied
+  { -1634476895, 4098, 0 },  // inj10ok
+  { -1634475806, 4106, 0 },  // inj11ok
+  { -1634474717, 4114, 0 },  // inj12ok
+  { -1633831640, 4122, 1 },  // accelerometerScale
+  { -1632843151, 4141, 1 },  // driveWheelRevPerKm1
+  { -1632843150, 4161, 1 },  // driveWheelRevPerKm2
+  { -1632843149, 4181, 1 },  // driveWheelRevPerKm3
+  { -1632843148, 4201, 1 },  // driveWheelRevPerKm4
+  { -1629429387, 4221, 1 },  // disableProgOutputs
+  { -1626840525, 4240, 0 },  // isMapAveraging
+  { -1626770351, 4255, 0 },  // luaTimingMult
+  { -1623166029, 4269, 1 },  // alternatorControl.maxValue
+  { -1622665899, 4296, 1 },  // ltitClampMax
+  { -1622665645, 4309, 1 },  // ltitClampMin
+  { -1613565112, 4322, 1 },  // idleDeltaRpmAdjAvgFactor
+  { -1607465307, 4347, 1 },  // dynoCarGearPrimaryReduction
+  { -1605356346, 4375, 1 },  // stftLimitsUseLambda
+  { -1605036797, 4395, 0 },  // lua.torqueReductionState
+  { -1603867624, 4420, 1 },  // tachSweepTime
+  { -1603423011, 4434, 1 },  // isSdCardEnabled
+  { -1600154369, 4450, 0 },  // epic_hall_inps916
+  { -1596390371, 4468, 0 },  // epic_hall_inp1
+  { -1596390370, 4483, 0 },  // epic_hall_inp2
+  { -1596390369, 4498, 0 },  // epic_hall_inp3
+  { -1596390368, 4513, 0 },  // epic_hall_inp4
+  { -1596390367, 4528, 0 },  // epic_hall_inp5
+  { -1596390366, 4543, 0 },  // epic_hall_inp6
+  { -1596390365, 4558, 0 },  // epic_hall_inp7
+  { -1596390364, 4573, 0 },  // epic_hall_inp8
+  { -1596390363, 4588, 0 },  // epic_hall_inp9
+  { -1595596945, 4603, 0 },  // sparkOutOfOrderCounter
+  { -1595441102, 4626, 0 },  // maxTriggerReentrant
+  { -1591877056, 4646, 0 },  // idleidleTargetFlow
+  { -1591245125, 4665, 1 },  // dtTuneBatch
+  { -1585778708, 4677, 0 },  // mapVvt_MAP_AT_DIFF
+  { -1585413592, 4696, 1 },  // assistedEtbMaxAllowedPpsPct
+  { -1583589783, 4724, 1 },  // enableLaunchRetard
+  { -1578655365, 4743, 1 },  // cylindersCount
+  { -1575487611, 4758, 1 },  // disableFan1AtSpeed
+  { -1572546086, 4777, 1 },  // useEeprom
+  { -1564912640, 4787, 1 },  // throttlePedalSecondaryUpVoltage
+  { -1562952959, 4819, 1 },  // idlePidActivationTime
+  { -1562315488, 4841, 1 },  // canBroadcastKnock
+  { -1560670902, 4859, 0 },  // calibrationValue
+  { -1555883851, 4876, 1 },  // compressorDischargeTemperature.config.bias_resistor
+  { -1555684830, 4928, 0 },  // tractionControlSparkSkip
+  { -1555114948, 4953, 0 },  // revolutionCounterSinceStart
+  { -1553662697, 4981, 0 },  // instantMAFValue
+  { -1548941801, 4997, 0 },  // acrActive
+  { -1548385409, 5007, 1 },  // deferAllWritesUntilEngineOff
+  { -1543452424, 5036, 1 },  // isPhaseSyncRequiredForIgnition
+  { -1536638947, 5067, 1 },  // tpsAeFastCallback
+  { -1535181662, 5085, 0 },  // boostboostControllerClosedLoopPart
+  { -1529936844, 5120, 0 },  // isTps2Error
+  { -1528619572, 5132, 1 },  // artificialTestMisfire
+  { -1525404769, 5154, 0 },  // tmf_maf_tmf_airmass_split
+  { -1519032079, 5180, 1 },  // enableWaterPump
+  { -1517072029, 5196, 1 },  // cc_proportionalGainSPEED
+  { -1514354211, 5221, 1 },  // can2OpenBLT
+  { -1511514122, 5233, 0 },  // wallFuelCorrectionValue
+  { -1507985087, 5257, 1 },  // cc_proportionalGainRPM
+  { -1507281103, 5280, 0 },  // etb1integralError
+  { -1506146739, 5298, 1 },  // afrTrimRangeMax
+  { -1506146485, 5314, 1 },  // afrTrimRangeMin
+  { -1502616231, 5330, 0 },  // hasFaultReportFile
+  { -1501050240, 5349, 1 },  // primaryInjectorDisabled10
+  { -1501050239, 5375, 1 },  // primaryInjectorDisabled11
+  { -1501050238, 5401, 1 },  // primaryInjectorDisabled12
+  { -1498628812, 5427, 0 },  // currentMafCorrection
+  { -1498397570, 5448, 0 },  // luaHardSparkSkip
+  { -1494053736, 5465, 1 },  // coastingFuelCutClt
+  { -1494043213, 5484, 1 },  // coastingFuelCutMap
+  { -1494035092, 5503, 1 },  // coastingFuelCutTps
+  { -1493125058, 5522, 0 },  // mapaccaen
+  { -1493121791, 5532, 0 },  // mapaccden
+  { -1492749056, 5542, 0 },  // idlelooksLikeCrankToIdle
+  { -1492464952, 5567, 1 },  // engineChartSize
+  { -1491889938, 5583, 1 },  // isCylinderCleanupEnabled
+  { -1478067590, 5608, 0 },  // fan1radiatorFanStatus
+  { -1477802537, 5630, 0 },  // boostisZeroRpm
+  { -1471965894, 5645, 0 },  // mafmapBlendPercentage
+  { -1469913327, 5667, 0 },  // rawMafFast
+  { -1465119085, 5678, 1 },  // fordInjectorSmallPulseSlope
+  { -1462001003, 5706, 0 },  // shuttingDownMainRelay
+  { -1460984893, 5728, 1 },  // noFuelTrimAfterAccelTime
+  { -1460957868, 5753, 1 },  // oilTempSensor.config.tempC_1
+  { -1460957867, 5782, 1 },  // oilTempSensor.config.tempC_2
+  { -1460957866, 5811, 1 },  // oilTempSensor.config.tempC_3
+  { -1458054117, 5840, 0 },  // rawMapFast
+  { -1457567239, 5851, 0 },  // predTimerResetCnt
+  { -1454971281, 5869, 1 },  // disableWaterPumpWhenStopped
+  { -1453554940, 5897, 0 },  // brokenInjector
+  { -1448655345, 5912, 0 },  // boostopenLoopPart
+  { -1438648277, 5930, 0 },  // starterState
+  { -1434278346, 5943, 1 },  // map.sensor.highValue
+  { -1434098660, 5964, 0 },  // actualLastInjectionStage2
+  { -1432096142, 5990, 0 },  // vvt2isynchronizationCounter
+  { -1429499678, 6018, 1 },  // cc_speedBandLow
+  { -1422787851, 6034, 0 },  // fastAdcOverrunCount
+  { -1418343613, 6054, 0 },  // etbStatus.output
+  { -1415669996, 6071, 1 },  // auxLinear1.v1
+  { -1415669995, 6085, 1 },  // auxLinear1.v2
+  { -1415634059, 6099, 1 },  // auxLinear2.v1
+  { -1415634058, 6113, 1 },  // auxLinear2.v2
+  { -1415598122, 6127, 1 },  // auxLinear3.v1
+  { -1415598121, 6141, 1 },  // auxLinear3.v2
+  { -1415562185, 6155, 1 },  // auxLinear4.v1
+  { -1415562184, 6169, 1 },  // auxLinear4.v2
+  { -1415434345, 6183, 0 },  // waterPumpcranking
+  { -1411996731, 6201, 1 },  // idleTimingPid.pFactor
+  { -1409016614, 6223, 1 },  // enableTrailingSparks
+  { -1407066344, 6244, 1 },  // ltft.enabled
+  { -1404613719, 6257, 1 },  // dynoCarWheelAspectRatio
+  { -1404414917, 6281, 1 },  // ALSSkipRatio
+  { -1401426415, 6294, 1 },  // etbWastegatePid.minValue
+  { -1397911341, 6319, 0 },  // idleisIacTableForCoasting
+  { -1390672637, 6345, 0 },  // lua.fuelMult
+  { -1383513733, 6358, 0 },  // isAnalogFailure
+  { -1382627620, 6374, 0 },  // rawTps2Primary
+  { -1374156957, 6389, 0 },  // retardThresholdRpm
+  { -1373423899, 6408, 1 },  // acrRevolutions
+  { -1359134883, 6423, 1 },  // fixedTiming
+  { -1358648093, 6435, 0 },  // boostluaOpenLoopAdd
+  { -1357387481, 6455, 0 },  // distanceTraveled
+  { -1356218861, 6472, 0 },  // wheelspeedAvgError
+  { -1354884979, 6491, 1 },  // isIgnitionEnabled
+  { -1350791186, 6509, 1 },  // cruiseControlEnableTogglesState
+  { -1346040258, 6541, 0 },  // lastErrorCode
+  { -1345684809, 6555, 1 },  // auxSpeedMult1
+  { -1345684808, 6569, 1 },  // auxSpeedMult2
+  { -1345684807, 6583, 1 },  // auxSpeedMult3
+  { -1345684806, 6597, 1 },  // auxSpeedMult4
+  { -1344436946, 6611, 0 },  // fastAdcErrorCount
+  { -1343193327, 6629, 1 },  // dynoCarCarMassKg
+  { -1340834204, 6646, 1 },  // launchTpsThreshold
+  { -1337459841, 6665, 0 },  // injectorDutyCycleStage2
+  { -1334689362, 6689, 1 },  // etb_use_two_wires
+  { -1331668704, 6707, 1 },  // invertVvtControlExhaust
+  { -1329176058, 6731, 1 },  // cc_kmhstep
+  { -1326404407, 6742, 0 },  // orderingErrorCounter
+  { -1318050732, 6763, 0 },  // rawRawPpsSecondary
+  { -1312968741, 6782, 1 },  // tps1SecondaryMax
+  { -1312968487, 6799, 1 },  // tps1SecondaryMin
+  { -1311217456, 6816, 1 },  // vbattDividerCoeff
+  { -1309366300, 6834, 1 },  // tracMinSpeed
+  { -1307181880, 6847, 1 },  // map.sensor.lowValue
+  { -1305029825, 6867, 0 },  // RealAFRValue
+  { -1297544724, 6880, 1 },  // oilTempSensor.config.resistance_1
+  { -1297544723, 6914, 1 },  // oilTempSensor.config.resistance_2
+  { -1297544722, 6948, 1 },  // oilTempSensor.config.resistance_3
+  { -1296201087, 6982, 0 },  // lua.brakePedalState
+  { -1288205717, 7002, 0 },  // running.postCrankingFuelCorrection
+  { -1286234105, 7037, 1 },  // TMFPressureSplitPercentUp
+  { -1286084577, 7063, 1 },  // fuelPumpPrimeDelay
+  { -1285484724, 7082, 1 },  // fuelTempSensor.config.bias_resistor
+  { -1284359115, 7118, 1 },  // useFordRedundantPps
+  { -1284354759, 7138, 1 },  // useFordRedundantTps
+  { -1279670200, 7158, 1 },  // accelEnX
+  { -1279670199, 7167, 1 },  // accelEnY
+  { -1279670198, 7176, 1 },  // accelEnZ
+  { -1279270887, 7185, 1 },  // useTLE8888_cranking_hack
+  { -1278065791, 7210, 0 },  // rawOilTemperature
+  { -1276540673, 7228, 0 },  // idlem_isIdlingOrTaper
+  { -1274887687, 7250, 0 },  // mafLoad
+  { -1274631759, 7258, 1 },  // lambdaProtectionRestoreLoad
+  { -1271797456, 7286, 0 },  // idleidle_m_last_phase
+  { -1269130308, 7308, 1 },  // idle_derivativeFilterLoss
+  { -1263258735, 7334, 0 },  // mapFast
+  { -1261602589, 7342, 0 },  // boostlwgDutyPct
+  { -1261314140, 7358, 0 },  // wheelSlipRatioLeftRightREAR
+  { -1256791970, 7386, 1 },  // idlePositionMax
+  { -1256791716, 7402, 1 },  // idlePositionMin
+  { -1256141959, 7418, 1 },  // hpfpCamLobes
+  { -1254008074, 7431, 0 },  // alternatorStatus.resetCounter
+  { -1251676000, 7461, 1 },  // verboseTLE8888
+  { -1250788372, 7476, 0 },  // mapPredEventOver
+  { -1241003634, 7493, 0 },  // etb2etbTpsErrorCounter
+  { -1240666085, 7516, 1 },  // epicCanEcuReadONLYONWrite
+  { -1238909045, 7542, 0 },  // etb1jamDetected
+  { -1237512821, 7558, 0 },  // injectorHwIssue
+  { -1236599226, 7574, 0 },  // isEnabled0_int
+  { -1236202550, 7589, 1 },  // measureMapOnlyInOneCylinder
+  { -1227821282, 7617, 1 },  // displacement
+  { -1225980502, 7630, 0 },  // mc33810spiErrorCounter
+  { -1225000603, 7653, 0 },  // fuelCutReason
+  { -1211793460, 7667, 0 },  // sdAirmass
+  { -1211547749, 7677, 1 },  // dwellClampPercent
+  { -1208021110, 7695, 0 },  // dwellDurationAngle
+  { -1206067863, 7714, 0 },  // crankingFuel.coolantTemperatureCoefficient
+  { -1202716522, 7757, 1 },  // tunedVeStrengthMultiplier
+  { -1198455285, 7783, 1 },  // fan2PwmEnabled
+  { -1197734314, 7798, 1 },  // nitrousFuelAdderPercent
+  { -1196900531, 7822, 0 },  // tunedMassAirflow
+  { -1196188030, 7839, 1 },  // enableAemXSeriesEgt
+  { -1195844556, 7859, 1 },  // fuelTempSensor.config.resistance_1
+  { -1195844555, 7894, 1 },  // fuelTempSensor.config.resistance_2
+  { -1195844554, 7929, 1 },  // fuelTempSensor.config.resistance_3
+  { -1194560694, 7964, 1 },  // enableOilPressureProtect
+  { -1191102746, 7989, 0 },  // canBoxTracTrim
+  { -1190930054, 8004, 1 },  // boostPid.dFactor
+  { -1189603841, 8021, 1 },  // auxTempSensor1.config.bias_resistor
+  { -1188944476, 8057, 1 },  // stepperMaxDutyCycle
+  { -1185477196, 8077, 1 },  // tpsFuelPumpPrimeThreshold
+  { -1171243586, 8103, 1 },  // acPressure.value1
+  { -1171243585, 8121, 1 },  // acPressure.value2
+  { -1167844818, 8139, 0 },  // m_deadtime
+  { -1166766772, 8150, 0 },  // slowAdcOverrunCount
+  { -1165835361, 8170, 0 },  // engineRunTime
+  { -1165008919, 8184, 0 },  // stftDeadBand
+  { -1164679347, 8197, 1 },  // useSpooledCurve
+  { -1164331270, 8213, 1 },  // tpsAccelLookback
+  { -1162308767, 8230, 0 },  // instantMAPValue
+  { -1159462771, 8246, 0 },  // vvt1esynchronizationCounter
+  { -1158382750, 8274, 0 },  // ignitionFault
+  { -1158359776, 8288, 0 },  // tuneCrc16
+  { -1151782223, 8298, 1 },  // disableFuelCutOnClutch
+  { -1147263902, 8321, 1 },  // stepperMinDutyCycle
+  { -1147127033, 8341, 0 },  // stage1InjSmallPwActive
+  { -1143036666, 8364, 0 },  // canButtons916
+  { -1141274643, 8378, 0 },  // epic_hall_inp10
+  { -1140650813, 8394, 1 },  // ignBlend1BlendMode
+  { -1133692001, 8413, 0 },  // knockm_knockRetard
+  { -1132710384, 8432, 1 },  // disableFan1WhenStopped
+  { -1129280050, 8455, 1 },  // ltftEnableAutoSave
+  { -1128797750, 8474, 1 },  // tChargeAirIncrLimit
+  { -1124698530, 8494, 0 },  // coilState1
+  { -1124698529, 8505, 0 },  // coilState2
+  { -1124698528, 8516, 0 },  // coilState3
+  { -1124698527, 8527, 0 },  // coilState4
+  { -1124698526, 8538, 0 },  // coilState5
+  { -1124698525, 8549, 0 },  // coilState6
+  { -1124698524, 8560, 0 },  // coilState7
+  { -1124698523, 8571, 0 },  // coilState8
+  { -1124698522, 8582, 0 },  // coilState9
+  { -1121907071, 8593, 1 },  // maxCylindersCount
+  { -1121870933, 8611, 1 },  // dynoCarCoeffOfDrag
+  { -1119268893, 8630, 0 },  // lambdaValue
+  { -1118660179, 8642, 1 },  // tpsFuelPumpPrimeDuration
+  { -1118241790, 8667, 1 },  // alsMinTimeBetween
+  { -1117430949, 8685, 0 },  // luaSoftSparkSkip
+  { -1112972888, 8702, 0 },  // afrError
+  { -1111560081, 8711, 0 },  // alternatorStatus.dTerm
+  { -1110431971, 8734, 0 },  // alternatorStatus.error
+  { -1108794410, 8757, 1 },  // tpsAccelExtraShot
+  { -1105630476, 8775, 0 },  // alternatorStatus.iTerm
+  { -1104834801, 8798, 1 },  // auxTempSensor1.config.tempC_1
+  { -1104834800, 8828, 1 },  // auxTempSensor1.config.tempC_2
+  { -1104834799, 8858, 1 },  // auxTempSensor1.config.tempC_3
+  { -1097329029, 8888, 0 },  // alternatorStatus.pTerm
+  { -1093429509, 8911, 0 },  // AFRValue
+  { -1087585075, 8920, 1 },  // cutSparkOnHardLimit
+  { -1085712470, 8940, 1 },  // dynoRpmStep
+  { -1084296600, 8952, 1 },  // ambientTempSensor.config.resistance_1
+  { -1084296599, 8990, 1 },  // ambientTempSensor.config.resistance_2
+  { -1084296598, 9028, 1 },  // ambientTempSensor.config.resistance_3
+  { -1084262094, 9066, 1 },  // mapHighValueVoltage
+  { -1077373465, 9086, 0 },  // fuelTemp
+  { -1077032999, 9095, 1 },  // idleStepperTotalSteps
+  { -1074514630, 9117, 0 },  // isMapPreAveraging
+  { -1074393096, 9135, 1 },  // multisparkEnable
+  { -1073210355, 9152, 1 },  // verboseCan
+  { -1072849436, 9163, 1 },  // ignBlend2BlendMode
+  { -1067105700, 9182, 0 },  // waterPumpnotRunning
+  { -1065713562, 9202, 0 },  // canButtonToggle1
+  { -1065713561, 9219, 0 },  // canButtonToggle2
+  { -1065713560, 9236, 0 },  // canButtonToggle3
+  { -1065713559, 9253, 0 },  // canButtonToggle4
+  { -1065713558, 9270, 0 },  // canButtonToggle5
+  { -1065713557, 9287, 0 },  // canButtonToggle6
+  { -1065713556, 9304, 0 },  // canButtonToggle7
+  { -1065713555, 9321, 0 },  // canButtonToggle8
+  { -1065713554, 9338, 0 },  // canButtonToggle9
+  { -1063282840, 9355, 0 },  // etb2adjustedEtbTarget
+  { -1062352104, 9377, 0 },  // vvt2ivvtCurrentPosition
+  { -1058844738, 9401, 1 },  // auxLinear4.value1
+  { -1058844737, 9419, 1 },  // auxLinear4.value2
+  { -1056203297, 9437, 1 },  // verboseCan2
+  { -1056007485, 9449, 1 },  // turboSpeedSensorMultiplier
+  { -1055678778, 9476, 1 },  // verboseQuad
+  { -1053347749, 9488, 1 },  // harleyAcrSprayFuel
+  { -1051397637, 9507, 0 },  // rawTps1Primary
+  { -1049398690, 9522, 0 },  // baroHasPressure
+  { -1044288778, 9538, 0 },  // etb1etbCurrentTarget
+  { -1040875351, 9559, 1 },  // useBiQuadOnWheelSpeedSensors1
+  { -1040875350, 9589, 1 },  // useBiQuadOnWheelSpeedSensors2
+  { -1040875349, 9619, 1 },  // useBiQuadOnWheelSpeedSensors3
+  { -1040875348, 9649, 1 },  // useBiQuadOnWheelSpeedSensors4
+  { -1032938305, 9679, 1 },  // fordInjectorSmallPulseBreakPoint
+  { -1015189044, 9712, 1 },  // canBoxTracTrimMax
+  { -1015188790, 9730, 1 },  // canBoxTracTrimMin
+  { -1014418506, 9748, 1 },  // iat.config.resistance_1
+  { -1014418505, 9772, 1 },  // iat.config.resistance_2
+  { -1014418504, 9796, 1 },  // iat.config.resistance_3
+  { -1012476149, 9820, 1 },  // ecumasterEgtToCanBaseId
+  { -1011866871, 9844, 1 },  // useSpiImu
+  { -1009116322, 9854, 1 },  // idleRpmPid.minValue
+  { -1008823912, 9874, 0 },  // can_call_found_func
+  { -1008029221, 9894, 1 },  // ltitEmaAlpha
+  { -1007205736, 9907, 0 },  // etb1etbErrorCodeBlinker
+  { -1006487219, 9931, 0 },  // transitionEventCode
+  { -999870619, 9951, 1 },  // uartConsoleSerialSpeed
+  { -999819551, 9974, 1 },  // tpsAeUseDynamicThreshold
+  { -998567403, 9999, 1 },  // waterPumpOnTemperature
+  { -993302478, 10022, 0 },  // idleidleTargetError
+  { -991890097, 10042, 1 },  // etb.minValue
+  { -988986989, 10055, 0 },  // mafmapAirmassSplit
+  { -983339026, 10074, 0 },  // mapVvt_min_point_counter
+  { -980843809, 10099, 1 },  // launchFuelCutEnable
+  { -978523544, 10119, 0 },  // isValidInputPin
+  { -975349491, 10135, 1 },  // assistedEtbMaxPct
+  { -968092482, 10153, 0 },  // rpmAcceleration
+  { -966221493, 10169, 1 },  // assistedEtbMinPct
+  { -965637402, 10187, 1 },  // minAcPressure
+  { -965453331, 10201, 1 },  // tpsDecelEnleanmentThreshold
+  { -960645892, 10229, 0 },  // startStopStateToggleCounter
+  { -955735749, 10257, 0 },  // boostboostControlTarget
+  { -955291041, 10281, 0 },  // dtTuneInjModeOverride
+  { -954321508, 10303, 1 },  // launchSmoothRetard
+  { -953183719, 10322, 1 },  // triggerCompSensorSatRpm
+  { -945021094, 10346, 1 },  // boostPid.periodMs
+  { -940825965, 10364, 0 },  // fallbackMap
+  { -938609466, 10376, 1 },  // knockRetardReapplyRate
+  { -938324001, 10399, 0 },  // nitrousisNitrousRpmCondition
+  { -937296564, 10428, 0 },  // vvt1etriggerCountersError
+  { -933524784, 10454, 1 },  // antiLagEnabled
+  { -930632752, 10469, 0 },  // nitrousisNitrousCondition
+  { -929600315, 10495, 1 },  // mcp3208vref
+  { -924260494, 10507, 0 },  // nitrousisNitrousArmed
+  { -921867120, 10529, 0 },  // currentInjectionMode
+  { -921746905, 10550, 0 },  // boostm_shouldResetPid
+  { -920116109, 10572, 1 },  // useStepperIdle
+  { -917305595, 10587, 0 },  // pressureCorrectionReference
+  { -914016449, 10615, 1 },  // injAdvAssistEndDeg
+  { -911109767, 10634, 1 },  // disableEGT
+  { -908268760, 10645, 1 },  // acRelayAlternatorDutyAdder
+  { -904771683, 10672, 1 },  // launchFuelAdderPercent
+  { -904485188, 10695, 1 },  // dtTuneCycles
+  { -903101570, 10708, 0 },  // sparkDwell
+  { -900025104, 10719, 1 },  // auxTempSensor2.config.tempC_1
+  { -900025103, 10749, 1 },  // auxTempSensor2.config.tempC_2
+  { -900025102, 10779, 1 },  // auxTempSensor2.config.tempC_3
+  { -899895696, 10809, 0 },  // tractionAdvanceDrop
+  { -897907098, 10829, 1 },  // enableSlipCalculations
+  { -893849209, 10852, 0 },  // MAPPREValue
+  { -893360504, 10864, 1 },  // mc33_t_peak_off
+  { -893354748, 10880, 1 },  // mc33_t_peak_tot
+  { -893334680, 10896, 0 },  // sd.tCharge
+  { -885587728, 10907, 0 },  // usbBytesOutPerSec
+  { -871891659, 10925, 0 },  // internalMcuTemperature
+  { -869432403, 10948, 1 },  // finalGearRatio
+  { -868970149, 10963, 1 },  // CLBoostBlend1BlendMode
+  { -866520333, 10986, 1 },  // etbWastegatePid.dFactor
+  { -855687130, 11010, 1 },  // minOilPressureAfterStart
+  { -855279955, 11035, 0 },  // fan1cold
+  { -854707527, 11044, 1 },  // sparkHardwareLatencyCorrectionCurveCurveUnits
+  { -854094034, 11090, 0 },  // fan2cold
+  { -853358747, 11099, 1 },  // fanOnTemperature
+  { -848735021, 11116, 1 },  // STFTResetRegionChange
+  { -846143628, 11138, 1 },  // canVssScaling
+  { -838808073, 11152, 1 },  // tpsErrorDetectionTooHigh
+  { -838175736, 11177, 0 },  // lastCanButtonFoundIdx
+  { -836653176, 11199, 0 },  // etb2targetWithIdlePosition
+  { -829513073, 11226, 1 },  // tachSweepMax
+  { -823915964, 11239, 0 },  // canReWidebandCmdStatus
+  { -819413824, 11262, 1 },  // limitTorqueReductionTime
+  { -818268726, 11287, 0 },  // heaterControlEnabled
+  { -813957817, 11308, 0 },  // etb2m_lastPidDtMs
+  { -808809130, 11326, 0 },  // canButtonToggle10
+  { -808809129, 11344, 0 },  // canButtonToggle11
+  { -808809128, 11362, 0 },  // canButtonToggle12
+  { -808809127, 11380, 0 },  // canButtonToggle13
+  { -808809126, 11398, 0 },  // canButtonToggle14
+  { -808809125, 11416, 0 },  // canButtonToggle15
+  { -808809124, 11434, 0 },  // canButtonToggle16
+  { -807823931, 11452, 0 },  // slowAdcErrorCount
+  { -802271455, 11470, 0 },  // lua.luaIgnCut
+  { -801974332, 11484, 0 },  // rawAuxTemp1
+  { -801974331, 11496, 0 },  // rawAuxTemp2
+  { -797965330, 11508, 0 },  // clutchUpState
+  { -794631784, 11522, 1 },  // speedoSweepTime
+  { -794334344, 11538, 1 },  // cutFuelOnHardLimit
+  { -794283008, 11557, 0 },  // running.fuel
+  { -793811890, 11570, 0 },  // watchDogBuddy
+  { -791880034, 11584, 1 },  // etbJamDetectThreshold
+  { -791713926, 11606, 0 },  // idealEngineTorque
+  { -791147982, 11624, 0 },  // acrEngineMovedRecently
+  { -786901709, 11647, 1 },  // etbMaximumPosition
+  { -785386645, 11666, 1 },  // mc33810Gpgd0Mode
+  { -784200724, 11683, 1 },  // mc33810Gpgd1Mode
+  { -783014803, 11700, 1 },  // mc33810Gpgd2Mode
+  { -781828882, 11717, 1 },  // mc33810Gpgd3Mode
+  { -776487010, 11734, 0 },  // idleiacByTpsTaper
+  { -776108566, 11752, 0 },  // ignTableSwitch1Active
+  { -776106289, 11774, 1 },  // launchRpm
+  { -775882810, 11784, 1 },  // multisparkMaxRpm
+  { -774592003, 11801, 0 },  // rpmPreLaunchCondition
+  { -773841334, 11823, 1 },  // sdCardLogFrequency
+  { -770506808, 11842, 0 },  // triggerScopeReady
+  { -763838959, 11860, 1 },  // torqueReductionArmingApp
+  { -763820449, 11885, 1 },  // torqueReductionArmingRpm
+  { -763229169, 11910, 1 },  // assistedEtbRotate
+  { -762743481, 11928, 0 },  // etb1adjustedEtbTarget
+  { -755499083, 11950, 1 },  // cc_rpmstep
+  { -751355172, 11961, 1 },  // cc_maxEtbAdjustmentOpen
+  { -750525467, 11985, 1 },  // useCustomIATSensor
+  { -748456478, 12004, 1 },  // instantRpmRange
+  { -746111499, 12020, 0 },  // coolant
+  { -744843641, 12028, 0 },  // wheelspeedFLerror
+  { -735105365, 12046, 0 },  // dfcoTimingRetard
+  { -734904659, 12063, 0 },  // targetLambda
+  { -734820550, 12076, 0 },  // canReWidebandFwYear
+  { -731677323, 12096, 1 },  // alsEtbPosition
+  { -727657058, 12111, 1 },  // ppsSecondaryMaximum
+  { -727614755, 12131, 1 },  // auxLinear3.value1
+  { -727614754, 12149, 1 },  // auxLinear3.value2
+  { -726159643, 12167, 1 },  // isWaveAnalyzerEnabled
+  { -725051987, 12189, 1 },  // useMapEstimateDuringTransient
+  { -722238362, 12219, 1 },  // is_enabled_spi_1
+  { -722238361, 12236, 1 },  // is_enabled_spi_2
+  { -722238360, 12253, 1 },  // is_enabled_spi_3
+  { -722238359, 12270, 1 },  // is_enabled_spi_4
+  { -722238358, 12287, 1 },  // is_enabled_spi_5
+  { -722238357, 12304, 1 },  // is_enabled_spi_6
+  { -721709665, 12321, 1 },  // ignitionDisabled10
+  { -721709664, 12340, 1 },  // ignitionDisabled11
+  { -721709663, 12359, 1 },  // ignitionDisabled12
+  { -713764196, 12378, 1 },  // fuelTempSensor.config.tempC_1
+  { -713764195, 12408, 1 },  // fuelTempSensor.config.tempC_2
+  { -713764194, 12438, 1 },  // fuelTempSensor.config.tempC_3
+  { -705383759, 12468, 0 },  // brakePedalState
+  { -703903346, 12484, 1 },  // requireFootOnBrakeToCrank
+  { -700740893, 12510, 0 },  // vvt1etriggerSyncGapRatio
+  { -699822859, 12535, 1 },  // throttlePedalSecondaryWOTVoltage
+  { -695395485, 12568, 1 },  // mc33810Maxi
+  { -695344665, 12580, 1 },  // mc33810Nomi
+  { -694434518, 12592, 1 },  // useCustomOTSensor
+  { -687006075, 12610, 1 },  // tpsAccelAeEnabled
+  { -685727673, 12628, 0 },  // speedToRpmRatio
+  { -678234383, 12644, 0 },  // idlelooksLikeRunning
+  { -677882442, 12665, 0 },  // isMapPreValid
+  { -677584112, 12679, 1 },  // nitrousMaximumAfr
+  { -677571211, 12697, 1 },  // nitrousMaximumMap
+  { -677561380, 12715, 0 },  // rawIdlePositionSensor
+  { -672272162, 12737, 1 },  // iat.config.tempC_1
+  { -672272161, 12756, 1 },  // iat.config.tempC_2
+  { -672272160, 12775, 1 },  // iat.config.tempC_3
+  { -664540020, 12794, 1 },  // startUpFuelPumpDuration
+  { -662113279, 12818, 0 },  // fan1enabledForAc
+  { -658597643, 12835, 0 },  // instantRpm
+  { -657551755, 12846, 1 },  // tractionControlEnabled
+  { -654466797, 12869, 0 },  // throttlePressureRatio
+  { -653172717, 12891, 1 },  // clt.config.bias_resistor
+  { -652705567, 12916, 0 },  // can_blend_clboost_1_toggle
+  { -651684905, 12943, 1 },  // canBoxTracTrim1
+  { -651684904, 12959, 1 },  // canBoxTracTrim2
+  { -651684903, 12975, 1 },  // canBoxTracTrim3
+  { -651684902, 12991, 1 },  // canBoxTracTrim4
+  { -647008743, 13007, 1 },  // useTLE8888_stepper
+  { -642676914, 13026, 0 },  // waterPumpbrokenClt
+  { -631762165, 13045, 1 },  // canOpenBLT
+  { -628741220, 13056, 0 },  // lowFuelPressure
+  { -628192270, 13072, 0 },  // idleshouldResetPid
+  { -622949795, 13091, 0 },  // dfcoActive
+  { -618104323, 13102, 1 },  // torqueReductionEnabled
+  { -617915487, 13125, 1 },  // isForcedInduction
+  { -617548836, 13143, 1 },  // nitrousIgnitionRetard
+  { -615615923, 13165, 1 },  // injAdvAssistMaxRpm
+  { -614923438, 13184, 1 },  // enableFan1
+  { -614923437, 13195, 1 },  // enableFan2
+  { -614909137, 13206, 0 },  // fan1brokenClt
+  { -613392361, 13220, 1 },  // oilPressure.v1
+  { -613392360, 13235, 1 },  // oilPressure.v2
+  { -612624925, 13250, 0 },  // m_isPriming
+  { -608535663, 13262, 0 },  // vvt1isynchronizationCounter
+  { -608466667, 13290, 1 },  // tChargeMaxRpmMaxTps
+  { -607443421, 13310, 1 },  // cc_maxThrottlePedalAllowedToStayEngaged
+  { -606487925, 13350, 1 },  // injAdvAssistMinRpm
+  { -606276593, 13369, 1 },  // cruiseControlUseVehicleSpeed
+  { -605416844, 13398, 0 },  // idleveTableYAxis
+  { -601476695, 13415, 0 },  // trgvvtToothDurations0
+  { -601080675, 13437, 0 },  // idletargetRpmAc
+  { -600460986, 13453, 1 },  // useInjSmallPulseWidth1
+  { -600460985, 13476, 1 },  // useInjSmallPulseWidth2
+  { -599338669, 13499, 1 },  // tChargeMaxRpmMinTps
+  { -597849544, 13519, 0 },  // idleidleTargetAirmass
+  { -594545570, 13541, 1 },  // cc_speedDeadBandHigh
+  { -589710926, 13562, 1 },  // ignitionDwellForCrankingMs
+  { -587700301, 13589, 1 },  // invertPrimaryTriggerSignal
+  { -584588097, 13616, 1 },  // flexEnabled
+  { -582951931, 13628, 1 },  // nitrousControlEnabled
+  { -575702922, 13650, 0 },  // etb2validPlantPosition
+  { -572500550, 13673, 1 },  // boostPid.maxValue
+  { -572387970, 13691, 0 },  // getAirmassImpl_temp_c
+  { -568903712, 13713, 1 },  // idle.solenoidFrequency
+  { -566786093, 13736, 1 },  // tChargeMinRpmMaxTps
+  { -566251913, 13756, 1 },  // disableFan1WhenStoppedTimeout
+  { -563973567, 13786, 1 },  // flexCranking
+  { -561715997, 13799, 1 },  // mapMinBufferLength
+  { -558968637, 13818, 0 },  // maxLockedDuration
+  { -557658095, 13836, 1 },  // tChargeMinRpmMinTps
+  { -556893719, 13856, 1 },  // enableKnockSpectrogram
+  { -550209830, 13879, 1 },  // TMFPressureSplitPercentDown
+  { -547107760, 13907, 0 },  // fan2brokenClt
+  { -543684839, 13921, 1 },  // rpmSoftLimitTimingRetard
+  { -543204250, 13946, 0 },  // boostisTpsInvalid
+  { -537122990, 13964, 1 },  // egoLowPassCutoffHz
+  { -531703796, 13983, 1 },  // dtTuneMinRpm
+  { -530001975, 13996, 0 },  // vvt2etriggerStateIndex
+  { -528043591, 14019, 1 },  // idlePidRpmDeadZone
+  { -528008450, 14038, 1 },  // canReadEnabled
+  { -524949197, 14053, 1 },  // idle_antiwindupFreq
+  { -524812679, 14073, 1 },  // stft.minLambda
+  { -521053722, 14088, 1 },  // disableMCP3208
+  { -517673231, 14103, 0 },  // smartChipState
+  { -513494613, 14118, 0 },  // VssAcceleration
+  { -513216302, 14134, 0 },  // etb2integralError
+  { -513211487, 14152, 1 },  // speedoSweepUsesSpeedoCorrection
+  { -511528784, 14184, 1 },  // fan2AcAdder
+  { -510031283, 14196, 0 },  // wheelspeedFRerror
+  { -509113657, 14214, 1 },  // stepperParkingExtraSteps
+  { -506535813, 14239, 1 },  // ignKeyAdcDivider
+  { -505257058, 14256, 1 },  // oilPressure.value1
+  { -505257057, 14275, 1 },  // oilPressure.value2
+  { -501215062, 14294, 0 },  // can_blend_ign_2_toggle
+  { -498450107, 14317, 1 },  // compressorDischargeTemperature.config.tempC_1
+  { -498450106, 14363, 1 },  // compressorDischargeTemperature.config.tempC_2
+  { -498450105, 14409, 1 },  // compressorDischargeTemperature.config.tempC_3
+  { -495855925, 14455, 1 },  // vssFilterReciprocal
+  { -492231789, 14475, 1 },  // waterPumpOffTemperature
+  { -491789856, 14499, 1 },  // assistedEtbTuningEnabled
+  { -488166228, 14524, 0 },  // idlemustResetPid
+  { -487204662, 14541, 1 },  // verboseIsoTp
+  { -486240071, 14554, 1 },  // mc33_t_max_boost
+  { -485091122, 14571, 1 },  // verboseKLine
+  { -474791503, 14584, 1 },  // lowPressureFuel.v1
+  { -474791502, 14603, 1 },  // lowPressureFuel.v2
+  { -469950118, 14622, 1 },  // nitrousActivationRpm
+  { -465369765, 14643, 1 },  // stft.cell.timeConstant
+  { -464979268, 14666, 1 },  // mc33810DisableRecoveryMode
+  { -464180576, 14693, 1 },  // idleRpmPid.dFactor
+  { -462089681, 14712, 1 },  // forceIdleBelowTpsThreshold
+  { -450796483, 14739, 0 },  // tunedVeValue
+  { -448033693, 14752, 0 },  // triggerChannel1
+  { -448033692, 14768, 0 },  // triggerChannel2
+  { -447483256, 14784, 0 },  // veTableSwitch2Active
+  { -430252676, 14805, 1 },  // knockSamplingDuration
+  { -427776066, 14827, 0 },  // lua.clutchUpState
+  { -427105966, 14845, 1 },  // torqueReductionActivationTemperature
+  { -425992769, 14882, 1 },  // secondaryInjectorFuelReferencePressure
+  { -424088744, 14921, 0 },  // idleStatus.resetCounter
+  { -423426795, 14945, 1 },  // etb.offset
+  { -418454384, 14956, 1 },  // useSeparateIdleTablesForCrankingTaper
+  { -417653524, 14994, 0 },  // etb2jamDetected
+  { -413489794, 15010, 1 },  // issFilterReciprocal
+  { -411193027, 15030, 1 },  // allowDFUwithIgn
+  { -410785646, 15046, 0 },  // etb1state
+  { -404295156, 15056, 0 },  // vvt1itriggerStateIndex
+  { -400293845, 15079, 0 },  // sparkDwellClamp
+  { -398482072, 15095, 0 },  // idleidleTarget
+  { -396384772, 15110, 1 },  // auxLinear2.value1
+  { -396384771, 15128, 1 },  // auxLinear2.value2
+  { -395416807, 15146, 1 },  // fuelReferencePressure
+  { -391393956, 15168, 1 },  // dynoSaeBaro
+  { -390306941, 15180, 1 },  // wwaeTau
+  { -389678699, 15188, 1 },  // forceO2Heating
+  { -384925312, 15203, 0 },  // tpsAccelFuel
+  { -380849858, 15216, 1 },  // AFRBlend1BlendMode
+  { -380530585, 15235, 1 },  // fuelPumpDisable
+  { -378628860, 15251, 1 },  // waterPumpMaxPwm
+  { -376859614, 15267, 1 },  // vvtBooleanForVerySpecialCases
+  { -376325528, 15297, 0 },  // pressureDelta
+  { -371707639, 15311, 1 },  // mc33_i_boost
+  { -371650253, 15324, 0 },  // etb2state
+  { -369500862, 15334, 1 },  // waterPumpMinPwm
+  { -366994282, 15350, 1 },  // stft.deadband_lean
+  { -366774244, 15369, 1 },  // stft.deadband_rich
+  { -366242192, 15388, 0 },  // waterPumpdisabledWhileEngineStopped
+  { -364626778, 15424, 1 },  // useIacPidMultTable
+  { -360834835, 15443, 1 },  // initialIgnitionCutPercent
+  { -359858019, 15469, 0 },  // pressureRatio
+  { -356454233, 15483, 1 },  // accelHighRes
+  { -355385452, 15496, 0 },  // tmf_rho
+  { -354921780, 15504, 0 },  // tmfLoad
+  { -354325031, 15512, 0 },  // injectorDutyCycle
+  { -350710533, 15530, 0 },  // actualLastInjPreSmallPw
+  { -348839402, 15554, 0 },  // idleiacByRpmTaper
+  { -348170267, 15572, 0 },  // isMafValid
+  { -347083354, 15583, 0 },  // rawPpsPrimary
+  { -346622972, 15597, 1 },  // oilTempSensor.config.bias_resistor
+  { -342742961, 15632, 1 },  // waterPumpSoftStartSec
+  { -339821344, 15654, 1 },  // knockDetectionWindowStart
+  { -339275211, 15680, 1 },  // mapLowPassCutoffHz
+  { -338157684, 15699, 1 },  // launchControlEnabled
+  { -337000121, 15720, 0 },  // can_blend_ve_2_toggle
+  { -328386745, 15742, 0 },  // boosttpsTooLow
+  { -325018342, 15757, 1 },  // verboseTriggerSynchDetails
+  { -324119981, 15784, 0 },  // spooledLevel
+  { -319326974, 15797, 0 },  // timingPidCorrection
+  { -312962799, 15817, 1 },  // boardUseCanTerminator
+  { -311714733, 15839, 1 },  // alternatorControl.dFactor
+  { -311454863, 15865, 1 },  // disableFan2WhenStopped
+  { -310192191, 15888, 1 },  // accelerometerHPCF
+  { -309610760, 15906, 0 },  // luaTimingAdd
+  { -308232520, 15919, 0 },  // etb2m_wastegatePosition
+  { -306603236, 15943, 0 },  // tmfAirmass
+  { -304465879, 15954, 0 },  // waterPump2m_state
+  { -304304077, 15972, 0 },  // isRpmConditionSatisfied
+  { -298185774, 15996, 1 },  // enableFan1WithAc
+  { -295556270, 16013, 0 },  // hellenBoardId
+  { -295413160, 16027, 1 },  // globalTriggerAngleOffset
+  { -289303407, 16052, 1 },  // injectorSecondary.flow
+  { -283215870, 16075, 1 },  // anotherCiTest
+  { -282198345, 16089, 1 },  // customSentTpsMax
+  { -282198091, 16106, 1 },  // customSentTpsMin
+  { -281693247, 16123, 0 },  // baroCorrection
+  { -280624712, 16138, 0 },  // triggerToothAngleError
+  { -277099819, 16161, 0 },  // rawFrequencyMaf
+  { -272710799, 16177, 1 },  // alternatorControl.minValue
+  { -272579820, 16204, 0 },  // etb2boardEtbAdjustment
+  { -272334953, 16227, 0 },  // boostisPlantValid
+  { -269110527, 16245, 1 },  // ltft.maxRemove
+  { -264572349, 16260, 1 },  // useCicPidForIdle
+  { -257492461, 16277, 0 },  // nitrousisNitrousCltCondition
+  { -253720028, 16306, 1 },  // alphaNUseIat
+  { -253543882, 16319, 1 },  // etb.iFactor
+  { -251224435, 16331, 1 },  // assistedEtbRotatePeriodSec
+  { -246556940, 16358, 1 },  // tpsAeDynamicTresholdAverageStaticCurve
+  { -244496183, 16397, 1 },  // adcVcc
+  { -243078627, 16404, 1 },  // tuneHidingKey
+  { -243031057, 16418, 0 },  // injectionOffset
+  { -241663117, 16434, 1 },  // afr.v1
+  { -241663116, 16441, 1 },  // afr.v2
+  { -235994182, 16448, 1 },  // iacByTpsHoldTime
+  { -235965601, 16465, 1 },  // cc_maxRpm
+  { -235768100, 16475, 1 },  // auxFrequencyFilter1
+  { -235768099, 16495, 1 },  // auxFrequencyFilter2
+  { -235768098, 16515, 1 },  // auxFrequencyFilter3
+  { -235768097, 16535, 1 },  // auxFrequencyFilter4
+  { -230533156, 16555, 0 },  // sd_present
+  { -226837603, 16566, 1 },  // cc_minRpm
+  { -224185132, 16576, 1 },  // tps2Max
+  { -224184878, 16584, 1 },  // tps2Min
+  { -215143594, 16592, 1 },  // injAdvAssistStartDeg
+  { -213773345, 16613, 1 },  // vssGearRatio
+  { -213258422, 16626, 0 },  // etb1jamTimer
+  { -204721234, 16639, 1 },  // benchTestCount
+  { -199797335, 16654, 1 },  // vssToothCount1
+  { -199797334, 16669, 1 },  // vssToothCount2
+  { -199797333, 16684, 1 },  // vssToothCount3
+  { -199797332, 16699, 1 },  // vssToothCount4
+  { -194111409, 16714, 1 },  // map.sensorpre.lowValue
+  { -192504649, 16737, 0 },  // vvt1ivvtCurrentPosition
+  { -188591438, 16761, 1 },  // gapVvtTrackingLengthOverride
+  { -184764139, 16790, 0 },  // throttleEffectiveAreaOpening
+  { -184602782, 16819, 1 },  // dtTuneSimultaneous
+  { -184044765, 16838, 1 },  // forceIdleIgnitionBelowTps
+  { -180401224, 16864, 0 },  // crankingFuel.fuel
+  { -180298801, 16882, 1 },  // fan1AcAdder
+  { -174866119, 16894, 1 },  // airTaperRpmRange
+  { -173408670, 16911, 0 },  // waterPump2disabledWhileEngineStopped
+  { -172041355, 16948, 1 },  // dtTuneCycleFuel
+  { -169985079, 16964, 0 },  // can_blend_ign_1_toggle
+  { -165252373, 16987, 1 },  // cc_accdec_request_timeout
+  { -150769059, 17013, 0 },  // fan1notRunning
+  { -148455898, 17028, 0 },  // rawLowFuelPressure
+  { -139549616, 17047, 1 },  // waterPumpPwmFrequency
+  { -137390524, 17069, 1 },  // mapLowValueVoltage
+  { -135093297, 17088, 1 },  // ltitIgnitionOnDelay
+  { -133180239, 17108, 0 },  // idlebaseIdlePosition
+  { -131284394, 17129, 0 },  // runningAirmass
+  { -116334588, 17144, 0 },  // can_blend_afr_1_toggle
+  { -116311215, 17167, 0 },  // RealAFRValue2
+  { -113087656, 17181, 0 },  // fan1cranking
+  { -106437949, 17194, 1 },  // knockFuelTrim
+  { -105464622, 17208, 1 },  // sdTriggerLog
+  { -103982236, 17221, 1 },  // idleRpmPid.offset
+  { -101393725, 17239, 1 },  // injAdvAssistEnabled
+  { -92785887, 17259, 0 },  // fuelPumpengineTurnedRecently
+  { -90543309, 17288, 1 },  // stft.maxAfr
+  { -88256759, 17300, 0 },  // waterPump2cranking
+  { -84435626, 17319, 0 },  // throttlePedalPosition
+  { -81483444, 17341, 1 },  // hpfpActivationAngle
+  { -81415311, 17361, 1 },  // stft.minAfr
+  { -81412933, 17373, 1 },  // stft.minClt
+  { -80687031, 17385, 0 },  // rpmForIgnitionIdleTableDot
+  { -80612537, 17412, 0 },  // dwellVoltageCorrection
+  { -75965445, 17435, 0 },  // engine
+  { -65154789, 17442, 1 },  // auxLinear1.value1
+  { -65154788, 17460, 1 },  // auxLinear1.value2
+  { -60727986, 17478, 1 },  // invertExhaustCamVVTSignal
+  { -57270071, 17504, 1 },  // waterPumpPwmEnabled
+  { -56739846, 17524, 0 },  // sparkCutReason
+  { -56102764, 17539, 1 },  // disableINJOK
+  { -56077458, 17552, 0 },  // etbStatus.dTerm
+  { -54973711, 17568, 1 },  // useRunningMathForCranking
+  { -54949348, 17594, 0 },  // etbStatus.error
+  { -54532767, 17610, 1 },  // etbIdleThrottleRange
+  { -52473827, 17631, 0 },  // launchTriggered
+  { -50147853, 17647, 0 },  // etbStatus.iTerm
+  { -48120222, 17663, 1 },  // justATempTest
+  { -45862380, 17677, 0 },  // vvt2evvtCurrentPosition
+  { -45436934, 17701, 1 },  // minCamPhaseResolveRpm
+  { -43142203, 17723, 0 },  // injectorState10
+  { -43142202, 17739, 0 },  // injectorState11
+  { -43142201, 17755, 0 },  // injectorState12
+  { -42886021, 17771, 0 },  // running.baseFuel
+  { -41846406, 17788, 0 },  // etbStatus.pTerm
+  { -32425311, 17804, 0 },  // tmf_engineload
+  { -30520144, 17819, 1 },  // defaultEthanolContent
+  { -29626162, 17841, 0 },  // boostmapTooLow
+  { -25671466, 17856, 1 },  // triggerCompHystMax
+  { -25671212, 17875, 1 },  // triggerCompHystMin
+  { -24313313, 17894, 1 },  // pauseEtbControl
+  { -5770138, 17910, 0 },  // can_blend_ve_1_toggle
+  { -5328869, 17932, 1 },  // clt.config.resistance_1
+  { -5328868, 17956, 1 },  // clt.config.resistance_2
+  { -5328867, 17980, 1 },  // clt.config.resistance_3
+  { -4616606, 18004, 1 },  // brakeMeanEffectivePressureDifferential
+  { -4187390, 18043, 0 },  // turboSpeed
+  { -3603666, 18054, 0 },  // currentIgnitionMode
+  { -2850030, 18074, 0 },  // canReWidebandVersion
+  { -1965539, 18095, 1 },  // disableBARO
+  { -1885084, 18107, 1 },  // disableDINP
+  { 2555743, 18119, 0 },  // rawTps1Secondary
+  { 4130389, 18136, 1 },  // wwaeBeta
+  { 4686563, 18145, 1 },  // fanOffTemperature
+  { 5863453, 18163, 0 },  // hp
+  { 6238478, 18166, 1 },  // verboseCanBaseAddress
+  { 9388880, 18188, 1 },  // mapErrorDetectionTooLow
+  { 11736566, 18212, 1 },  // useIdleTimingPidControl
+  { 13806936, 18236, 1 },  // useHbridgesToDriveIdleStepper
+  { 14587330, 18266, 0 },  // isTpsError
+  { 16864629, 18277, 1 },  // mainRelayShutoffDelay
+  { 18659676, 18299, 1 },  // tps2SecondaryMax
+  { 18659930, 18316, 1 },  // tps2SecondaryMin
+  { 20003211, 18333, 1 },  // wastegatePositionClosedVoltage
+  { 20251202, 18364, 0 },  // crankingFuel.tpsCoefficient
+  { 23640681, 18392, 0 },  // isMapError
+  { 28274136, 18403, 0 },  // etb1m_adjustedTarget
+  { 29505657, 18424, 1 },  // idleTimingPid.periodMs
+  { 30701245, 18447, 1 },  // acIdleRpmTarget
+  { 37467836, 18463, 0 },  // calibrationValue2
+  { 38719415, 18481, 1 },  // twoStroke
+  { 42872346, 18491, 1 },  // hondaK
+  { 43183663, 18498, 0 },  // isMapValid
+  { 46918724, 18509, 1 },  // engineSnifferRpmThreshold
+  { 47348059, 18535, 1 },  // finalIgnitionCutPercentBeforeLaunch
+  { 48235288, 18571, 1 },  // multisparkSparkDuration
+  { 48769502, 18595, 0 },  // waterPump2cold
+  { 53406649, 18610, 0 },  // wastegatePositionSensor
+  { 58931511, 18634, 1 },  // tachPulseDuractionMs
+  { 62925536, 18655, 1 },  // idleReturnTargetRampDuration
+  { 68539114, 18684, 1 },  // tpsAccelFractionDivisor
+  { 70357120, 18708, 0 },  // rawTps2Secondary
+  { 71000176, 18725, 1 },  // cc_speedBandHigh
+  { 72665902, 18742, 0 },  // idlewasResetPid
+  { 78160430, 18758, 1 },  // cc_rpmDeadBandLow
+  { 80622993, 18776, 0 },  // inj1ok
+  { 80624082, 18783, 0 },  // inj2ok
+  { 80625171, 18790, 0 },  // inj3ok
+  { 80626260, 18797, 0 },  // inj4ok
+  { 80627349, 18804, 0 },  // inj5ok
+  { 80628438, 18811, 0 },  // inj6ok
+  { 80629527, 18818, 0 },  // inj7ok
+  { 80630616, 18825, 0 },  // inj8ok
+  { 80631705, 18832, 0 },  // inj9ok
+  { 81034497, 18839, 0 },  // intake
+  { 86860621, 18846, 0 },  // etb1etbTpsErrorCounter
+  { 98140608, 18869, 0 },  // rawAuxAnalog1
+  { 98140609, 18883, 0 },  // rawAuxAnalog2
+  { 98140610, 18897, 0 },  // rawAuxAnalog3
+  { 98140611, 18911, 0 },  // rawAuxAnalog4
+  { 98140612, 18925, 0 },  // rawAuxAnalog5
+  { 98140613, 18939, 0 },  // rawAuxAnalog6
+  { 98140614, 18953, 0 },  // rawAuxAnalog7
+  { 98140615, 18967, 0 },  // rawAuxAnalog8
+  { 99110078, 18981, 1 },  // tachPulseDurationAsDutyCycle
+  { 99356871, 19010, 0 },  // etb1targetWithIdlePosition
+  { 105270760, 19037, 0 },  // idlelooksLikeCoasting
+  { 105821772, 19059, 1 },  // triggerSkipPulses
+  { 107641479, 19077, 1 },  // alternator_iTermMax
+  { 107641733, 19097, 1 },  // alternator_iTermMin
+  { 111403416, 19117, 0 },  // afrGasolineScale
+  { 114836583, 19134, 0 },  // vvt1itriggerSyncGapRatio
+  { 115540725, 19159, 0 },  // wallFuelAmount
+  { 116281959, 19174, 1 },  // MAFMAPLoadIsMAF
+  { 118504154, 19190, 1 },  // idleReturnTargetRamp
+  { 122475036, 19211, 0 },  // mapVvt_CycleDelta
+  { 128251338, 19229, 1 },  // fuelLevelUpdatePeriodSec
+  { 133427185, 19254, 0 },  // lua.clutchDownState
+  { 149942287, 19274, 1 },  // disallowPrimeFuelPump
+  { 151249794, 19296, 0 },  // clBoostTableSwitch1Active
+  { 151619422, 19322, 0 },  // boostluaTargetAdd
+  { 156247622, 19340, 0 },  // wastegateDcStatus.resetCounter
+  { 162105111, 19371, 0 },  // currentEngineDecodedPhase
+  { 168011889, 19397, 0 },  // fan1disabledWhileEngineStopped
+  { 168701078, 19428, 1 },  // coastingFuelCutRpmLow
+  { 169693489, 19450, 0 },  // can_call_counter
+  { 171869155, 19467, 1 },  // byFirmwareVersion
+  { 173166222, 19485, 1 },  // baroSensor.highValue
+  { 178430876, 19506, 1 },  // can1ListenMode
+  { 183555079, 19521, 1 },  // dynoCarCargoMassKg
+  { 193889898, 19540, 1 },  // baroLowValueVoltage
+  { 196797309, 19560, 1 },  // etb.pFactor
+  { 197173469, 19572, 0 },  // running.intakeTemperatureCoefficient
+  { 200047729, 19609, 0 },  // ISSValue
+  { 200989782, 19618, 1 },  // stft.cell.maxRemove
+  { 201676494, 19638, 1 },  // useFixedBaroCorrFromMap
+  { 204510464, 19662, 0 },  // waterPump2brokenClt
+  { 206346164, 19682, 0 },  // wastegateDcStatus.output
+  { 206956368, 19707, 0 },  // vvt1itriggerCountersError
+  { 216872574, 19733, 1 },  // useSeparateAdvanceForIdle
+  { 220694456, 19759, 1 },  // dynoCarGearFinalDrive
+  { 222113127, 19781, 0 },  // dwellAccuracyRatio
+  { 223926129, 19800, 1 },  // launchCorrectionsEndRpm
+  { 245947066, 19824, 1 },  // enableCanVss
+  { 248437820, 19837, 0 },  // triggerPrimaryFall
+  { 248878000, 19856, 0 },  // triggerPrimaryRise
+  { 251753675, 19875, 0 },  // tmf_tmfarea
+  { 251826574, 19887, 0 },  // nitrousisNitrousMapCondition
+  { 252935343, 19916, 0 },  // lua.luaFuelCut
+  { 255764596, 19931, 0 },  // crank
+  { 256951528, 19937, 0 },  // cltTimingCorrection
+  { 259909218, 19957, 1 },  // enableAemXSeries
+  { 263235302, 19974, 1 },  // maxInjectorDutySustainedTimeout
+  { 266236834, 20006, 0 },  // tmf_sd_tmf_airmass_split
+  { 270256825, 20031, 1 },  // idleTimingPid.dFactor
+  { 273085914, 20053, 0 },  // ready
+  { 274318471, 20059, 0 },  // trailingSparkAngle
+  { 275986512, 20078, 1 },  // ambientTempSensor.config.tempC_1
+  { 275986513, 20111, 1 },  // ambientTempSensor.config.tempC_2
+  { 275986514, 20144, 1 },  // ambientTempSensor.config.tempC_3
+  { 277722310, 20177, 0 },  // VBatt
+  { 280323355, 20183, 1 },  // egoValueShift
+  { 283558758, 20197, 0 },  // detectedGear
+  { 285726462, 20210, 1 },  // isMapAveragingEnabled
+  { 288250022, 20232, 1 },  // vvtActivationDelayMs
+  { 296563315, 20253, 1 },  // canSleepPeriodMs
+  { 298344625, 20270, 1 },  // acPressureEnableHyst
+  { 298649674, 20291, 1 },  // minimumIgnitionTiming
+  { 301396472, 20313, 0 },  // firmwareSignatureHash
+  { 304164959, 20335, 1 },  // kLineDoHondaSend
+  { 306069239, 20352, 0 },  // waterPumpm_state
+  { 306303086, 20369, 1 },  // camDecoder2jzPrecision
+  { 308336833, 20392, 0 },  // boostStatus.resetCounter
+  { 309572379, 20417, 0 },  // ambientTemp
+  { 309682334, 20429, 1 },  // mapErrorDetectionTooHigh
+  { 310661471, 20454, 0 },  // trgtriggerStateIndex
+  { 311680038, 20475, 1 },  // assistedEtbRiseWindowSec
+  { 319978869, 20500, 0 },  // isBelowTemperatureThreshold
+  { 321581893, 20528, 1 },  // cc_max_soft_etb
+  { 329016035, 20544, 1 },  // coastingFuelCutVssLow
+  { 334494733, 20566, 1 },  // hpfpPumpVolume
+  { 337194154, 20581, 1 },  // stepperDcInvertedPins
+  { 341519713, 20603, 1 },  // ltitSmoothingIntensity
+  { 341693817, 20626, 1 },  // ltitStableRpmThreshold
+  { 341978922, 20649, 0 },  // stoichiometricRatio
+  { 344965200, 20669, 1 },  // primaryInjectorDisabled1
+  { 344965201, 20694, 1 },  // primaryInjectorDisabled2
+  { 344965202, 20719, 1 },  // primaryInjectorDisabled3
+  { 344965203, 20744, 1 },  // primaryInjectorDisabled4
+  { 344965204, 20769, 1 },  // primaryInjectorDisabled5
+  { 344965205, 20794, 1 },  // primaryInjectorDisabled6
+  { 344965206, 20819, 1 },  // primaryInjectorDisabled7
+  { 344965207, 20844, 1 },  // primaryInjectorDisabled8
+  { 344965208, 20869, 1 },  // primaryInjectorDisabled9
+  { 347478025, 20894, 0 },  // issEdgeCounter
+  { 347493808, 20909, 0 },  // rawRawPpsPrimary
+  { 350535927, 20926, 0 },  // lambdaCurrentlyGood
+  { 351868267, 20946, 1 },  // cruiseControlAverageAdjustment
+  { 352421907, 20977, 0 },  // correctedIgnitionAdvance
+  { 352763970, 21002, 0 },  // sd_formating
+  { 353722918, 21015, 1 },  // afrSensorLambdaRange
+  { 355813839, 21036, 0 },  // canButtons18
+  { 355839382, 21049, 1 },  // compressionRatio
+  { 356548450, 21066, 0 },  // idleStepperTargetPosition
+  { 358542498, 21092, 1 },  // vssCalSpeed
+  { 374188231, 21104, 1 },  // waterPump2OnTemperature
+  { 379403209, 21128, 1 },  // mc33_i_hold
+  { 379679459, 21140, 1 },  // mc33_i_peak
+  { 383307083, 21152, 1 },  // auxFrequencyFilter
+  { 385418550, 21171, 0 },  // vssEdgeCounter
+  { 387956265, 21186, 1 },  // trigger.customSkippedToothCount
+  { 392899738, 21218, 0 },  // boostStatus.dTerm
+  { 394027848, 21236, 0 },  // boostStatus.error
+  { 394665991, 21254, 1 },  // mafExpAverageAlpha
+  { 398495089, 21273, 0 },  // wheelSlipRatio
+  { 398829343, 21288, 0 },  // boostStatus.iTerm
+  { 399466905, 21306, 1 },  // etbRevLimitRange
+  { 401321850, 21323, 1 },  // etbRevLimitStart
+  { 402026201, 21340, 1 },  // idleTimingPid.maxValue
+  { 402092253, 21363, 1 },  // multisparkMaxSparkingAngle
+  { 404628421, 21390, 0 },  // flexPercent
+  { 406278046, 21402, 1 },  // cc_maxThrottlePedalAllowedToEngage
+  { 406607630, 21437, 1 },  // iat.config.bias_resistor
+  { 407130790, 21462, 0 },  // boostStatus.pTerm
+  { 407969621, 21480, 1 },  // bypassTcharge
+  { 417943720, 21494, 0 },  // rawAfr
+  { 417946098, 21501, 0 },  // rawClt
+  { 417952269, 21508, 0 },  // rawIat
+  { 417956611, 21515, 0 },  // rawMaf
+  { 417956621, 21522, 0 },  // rawMap
+  { 417967019, 21529, 0 },  // rawVss
+  { 423655964, 21536, 1 },  // ltitIgnitionOffSaveDelay
+  { 435614729, 21561, 1 },  // useInjectorFlowLinearizationTable
+  { 436500697, 21595, 1 },  // hpfpPidI
+  { 436500704, 21604, 1 },  // hpfpPidP
+  { 438683128, 21613, 0 },  // isO2HeaterOn
+  { 438814606, 21626, 0 },  // olBoostTableSwitch1Active
+  { 444648859, 21652, 1 },  // injectorFlowAsMassFlow
+  { 445194564, 21675, 1 },  // allowIdenticalPps
+  { 454615641, 21693, 1 },  // twoWireBatchIgnition
+  { 457158886, 21714, 1 },  // ppsExpAverageAlpha
+  { 459143268, 21733, 0 },  // boostboostOutput
+  { 459712992, 21750, 0 },  // idleisInDeadZone
+  { 459787871, 21767, 0 },  // sd_msd
+  { 460256636, 21774, 0 },  // sdLoad
+  { 465982216, 21781, 1 },  // engineSnifferFocusOnInputs
+  { 470555289, 21808, 1 },  // canInputBCM
+  { 471298448, 21820, 0 },  // tcuDesiredGear
+  { 477303734, 21835, 0 },  // vvtCamCounter
+  { 478839978, 21849, 0 },  // startw
+  { 480187723, 21856, 0 },  // waterPump2radiatorFanStatus
+  { 481450608, 21884, 0 },  // lambdaTimeSinceGood
+  { 483010008, 21904, 1 },  // acDelay
+  { 485165853, 21912, 0 },  // storedInitialBaroPressure
+  { 493641747, 21938, 0 },  // baseIgnitionAdvance
+  { 494714802, 21958, 0 },  // fan2disabledWhileEngineStopped
+  { 495219145, 21989, 0 },  // acnoClt
+  { 496209836, 21997, 1 },  // ltitStableTime
+  { 501156654, 22012, 0 },  // torqueReductionTriggerPinState
+  { 506292297, 22043, 1 },  // vssPulsePerKm
+  { 509832338, 22057, 0 },  // tmf_cd
+  { 512655621, 22064, 0 },  // torque
+  { 512911183, 22071, 1 },  // flexSensorInverted
+  { 513001967, 22090, 0 },  // boostStatus.output
+  { 513859492, 22109, 0 },  // tpsADC
+  { 513872482, 22116, 1 },  // tpsMax
+  { 513872736, 22123, 1 },  // tpsMin
+  { 515359403, 22130, 0 },  // ignTableSwitch2Active
+  { 518760558, 22152, 0 },  // isCltError
+  { 519838295, 22163, 0 },  // gyroYaw
+  { 524306482, 22171, 0 },  // waterPump2enabledForAc
+  { 526786951, 22194, 0 },  // running.timeSinceCrankingInSecs
+  { 535118454, 22226, 1 },  // hpfpPid_iTermMax
+  { 535118708, 22243, 1 },  // hpfpPid_iTermMin
+  { 540029591, 22260, 0 },  // deviceUid
+  { 541310369, 22270, 0 },  // rawMCP3208_v_1
+  { 541310370, 22285, 0 },  // rawMCP3208_v_2
+  { 541310371, 22300, 0 },  // rawMCP3208_v_3
+  { 541310372, 22315, 0 },  // rawMCP3208_v_4
+  { 541310373, 22330, 0 },  // rawMCP3208_v_5
+  { 541310374, 22345, 0 },  // rawMCP3208_v_6
+  { 541310375, 22360, 0 },  // rawMCP3208_v_7
+  { 541310376, 22375, 0 },  // rawMCP3208_v_8
+  { 541310377, 22390, 0 },  // rawMCP3208_v_9
+  { 543832183, 22405, 0 },  // fuelTankLevel
+  { 553570450, 22419, 0 },  // compressorDischargeTemp
+  { 559806914, 22443, 1 },  // tpsAeScaledFrom
+  { 561614935, 22459, 0 },  // etb1m_wastegatePosition
+  { 573036274, 22483, 1 },  // tpsFuelPumpPrimeEnabled
+  { 577940625, 22507, 0 },  // fuelPumpignitionOn
+  { 578657622, 22526, 1 },  // mc33_hpfp_i_hold
+  { 578933872, 22543, 1 },  // mc33_hpfp_i_peak
+  { 582390322, 22560, 1 },  // silentTriggerError
+  { 583799407, 22579, 0 },  // fuelingLoad
+  { 584726739, 22591, 0 },  // sd.tChargeK
+  { 586887955, 22603, 1 },  // useIdleAdvanceWhileCoasting
+  { 589242035, 22631, 1 },  // dynoCarGearRatio
+  { 590388191, 22648, 0 },  // tmf_maf_engineload_split
+  { 594789367, 22673, 1 },  // camDecoder2jzPosition
+  { 596585178, 22695, 1 },  // minimumBoostClosedLoopMap
+  { 598268994, 22721, 0 },  // oilPressure
+  { 600643125, 22733, 1 },  // modeledFlowIdle
+  { 601094003, 22749, 1 },  // dfcoRetardDeg
+  { 606580596, 22763, 0 },  // rawMapPre
+  { 613454561, 22773, 0 },  // warmup
+  { 617337449, 22780, 1 },  // multisparkDwell
+  { 625338761, 22796, 1 },  // tpsErrorDetectionTooLow
+  { 629168263, 22820, 1 },  // auxTempSensor1.config.resistance_1
+  { 629168264, 22855, 1 },  // auxTempSensor1.config.resistance_2
+  { 629168265, 22890, 1 },  // auxTempSensor1.config.resistance_3
+  { 632136522, 22925, 1 },  // boostUsePWMLimiterLowerWg
+  { 634106895, 22951, 0 },  // baroHasError
+  { 642962903, 22964, 0 },  // globalSparkCounter
+  { 644036825, 22983, 0 },  // tps1Split
+  { 644409862, 22993, 1 },  // startCrankingDuration
+  { 652896383, 23015, 1 },  // tpsExtraShotTimer
+  { 657642633, 23033, 1 },  // useIdleTimingTargetError
+  { 659064164, 23058, 0 },  // vvt2etriggerSyncGapRatio
+  { 663037299, 23083, 1 },  // mc33_hpfp_max_hold
+  { 665024981, 23102, 1 },  // triggerEventsTimeoutMs
+  { 667504645, 23125, 1 },  // useLinearIatSensor
+  { 669515138, 23144, 0 },  // fan2enabledForAc
+  { 670644444, 23161, 1 },  // tChargeAirDecrLimit
+  { 671821024, 23181, 1 },  // usescriptTableForCanSniffingFiltering
+  { 678545432, 23219, 1 },  // fixSyncMisfire
+  { 680091441, 23234, 0 },  // multiSparkCounter
+  { 681043126, 23252, 0 },  // actualLastInjection
+  { 683172218, 23272, 0 },  // tps2Split
+  { 683373041, 23282, 0 },  // rawMCP3208_v_10
+  { 683373042, 23298, 0 },  // rawMCP3208_v_11
+  { 683373043, 23314, 0 },  // rawMCP3208_v_12
+  { 683373044, 23330, 0 },  // rawMCP3208_v_13
+  { 683373045, 23346, 0 },  // rawMCP3208_v_14
+  { 683373046, 23362, 0 },  // rawMCP3208_v_15
+  { 683373047, 23378, 0 },  // rawMCP3208_v_16
+  { 683373048, 23394, 0 },  // rawMCP3208_v_17
+  { 683373049, 23410, 0 },  // rawMCP3208_v_18
+  { 683373050, 23426, 0 },  // rawMCP3208_v_19
+  { 683373074, 23442, 0 },  // rawMCP3208_v_20
+  { 683373075, 23458, 0 },  // rawMCP3208_v_21
+  { 683373076, 23474, 0 },  // rawMCP3208_v_22
+  { 683373077, 23490, 0 },  // rawMCP3208_v_23
+  { 683373078, 23506, 0 },  // rawMCP3208_v_24
+  { 685453869, 23522, 1 },  // useSeparateAdvanceForCranking
+  { 685697025, 23552, 0 },  // nitrousisNitrousSpeedCondition
+  { 686191307, 23583, 0 },  // TPS2Value
+  { 686428810, 23593, 0 },  // etb2etbPpsErrorCounter
+  { 698398225, 23616, 0 },  // tunedMafCorrection
+  { 704910935, 23635, 0 },  // vvt2ivvtToothDurations0
+  { 707453027, 23659, 0 },  // luaLaunchState
+  { 708639006, 23674, 0 },  // sd_logging_internal
+  { 708923767, 23694, 0 },  // boostluaTargetMult
+  { 713313260, 23713, 0 },  // idleisCranking
+  { 714144074, 23728, 0 },  // mcuSerial
+  { 717675541, 23738, 0 },  // fuelPumptpsFuelPumpPrime
+  { 722000488, 23763, 1 },  // disableWaterPump2WhenStoppedTimeout
+  { 724244513, 23799, 0 },  // clutchDownState
+  { 726613349, 23815, 1 },  // multisparkMaxExtraSparkCount
+  { 731084614, 23844, 0 },  // idleStatus.output
+  { 732676192, 23862, 0 },  // vehicleSpeedKphFrontAvg
+  { 732678913, 23886, 1 },  // cc_maxSpeed
+  { 734290080, 23898, 1 },  // auxTempSensor2.config.bias_resistor
+  { 742920423, 23934, 1 },  // OLBoostBlend1BlendMode
+  { 743163558, 23957, 1 },  // ltitCorrectionRate
+  { 746342705, 23976, 1 },  // frequencyMafFilter
+  { 747573348, 23995, 1 },  // startRequestPinInverted
+  { 752161333, 24019, 0 },  // etb1validPlantPosition
+  { 753242040, 24042, 0 },  // mapPreFast
+  { 755512282, 24053, 1 },  // invertVvtControlIntake
+  { 756216589, 24076, 0 },  // isDecodingMapCam
+  { 764445240, 24093, 1 },  // lowPressureFuel.value1
+  { 764445241, 24116, 1 },  // lowPressureFuel.value2
+  { 767689023, 24139, 0 },  // triggerElapsedUs
+  { 767930574, 24156, 1 },  // tpsLowPassCutoffHz
+  { 769117654, 24175, 0 },  // etb2etbFeedForward
+  { 769340240, 24194, 0 },  // throttleInletPressure
+  { 774230013, 24216, 0 },  // can_var_get_counter
+  { 774655824, 24236, 0 },  // tracSpeedFrontRearREF
+  { 777954680, 24258, 1 },  // boostPid.minValue
+  { 781025153, 24276, 0 },  // isBrakePedalActivated
+  { 782384530, 24298, 0 },  // idlePositionSensor
+  { 787397010, 24317, 1 },  // alwaysWriteSdCard
+  { 794879319, 24335, 1 },  // etbWastegatePid.offset
+  { 795671090, 24358, 0 },  // ignitionOnTime
+  { 797862280, 24373, 0 },  // vvt1etriggerStateIndex
+  { 799075048, 24396, 0 },  // firmwareVersion
+  { 799798215, 24412, 1 },  // alternatorPwmFrequency
+  { 800627490, 24435, 0 },  // boostisBelowClosedLoopThreshold
+  { 803810399, 24467, 0 },  // auxLinear1
+  { 803810400, 24478, 0 },  // auxLinear2
+  { 803810401, 24489, 0 },  // auxLinear3
+  { 803810402, 24500, 0 },  // auxLinear4
+  { 810685564, 24511, 0 },  // acengineTooHot
+  { 815813454, 24526, 0 },  // usbBytesOut
+  { 816623708, 24538, 1 },  // vssFilterReciprocal1
+  { 816623709, 24559, 1 },  // vssFilterReciprocal2
+  { 816623710, 24580, 1 },  // vssFilterReciprocal3
+  { 816623711, 24601, 1 },  // vssFilterReciprocal4
+  { 822501973, 24622, 0 },  // fuelFlowRate
+  { 823476017, 24635, 0 },  // luaLastCycleDuration
+  { 823985075, 24656, 0 },  // vvt1evvtCurrentPosition
+  { 825446500, 24680, 1 },  // disableWaterPumpAtSpeed
+  { 827982787, 24704, 0 },  // tpsCondition
+  { 831481498, 24717, 0 },  // fuelPumpisFuelPumpOn
+  { 835169742, 24738, 0 },  // waterPumpdisabledBySpeed
+  { 839236273, 24763, 0 },  // etb1etbErrorCode
+  { 839486731, 24780, 1 },  // useRawOutputToDriveIdleStepper
+  { 840966724, 24811, 1 },  // overrideVvtTriggerGaps
+  { 846844765, 24834, 0 },  // wheelspeedRearAvgError
+  { 848453110, 24857, 1 },  // disableWaterPumpWhenStoppedTimeout
+  { 854100555, 24892, 0 },  // boostClosedLoopYAxisValue
+  { 858735714, 24918, 1 },  // canBoxTracTrimStep
+  { 859066570, 24937, 1 },  // fan1PwmEnabled
+  { 859283926, 24952, 0 },  // rpmLaunchCondition
+  { 861508808, 24971, 0 },  // instantMAPPREValue
+  { 864210494, 24990, 0 },  // accPedalSplit
+  { 865747829, 25004, 0 },  // idleidleClosedLoop
+  { 866072300, 25023, 1 },  // wastegatePositionOpenedVoltage
+  { 871106583, 25054, 1 },  // fan2OnTemperature
+  { 872435040, 25072, 1 },  // lambdaProtectionRestoreRpm
+  { 872437224, 25099, 1 },  // lambdaProtectionRestoreTps
+  { 878369917, 25126, 1 },  // compressorDischargeTemperature.config.resistance_1
+  { 878369918, 25177, 1 },  // compressorDischargeTemperature.config.resistance_2
+  { 878369919, 25228, 1 },  // compressorDischargeTemperature.config.resistance_3
+  { 884518764, 25279, 0 },  // isMapPredictionActive
+  { 888763399, 25301, 0 },  // canReWidebandFwDay
+  { 888773651, 25320, 0 },  // canReWidebandFwMon
+  { 890832495, 25339, 0 },  // fan1disabledBySpeed
+  { 892958612, 25359, 1 },  // knockDetectionUseDoubleFrequency
+  { 893744554, 25392, 0 },  // vehicleSpeedKph1
+  { 893744555, 25409, 0 },  // vehicleSpeedKph2
+  { 893744556, 25426, 0 },  // vehicleSpeedKph3
+  { 893744557, 25443, 0 },  // vehicleSpeedKph4
+  { 893774675, 25460, 1 },  // knockSuppressMinRpm
+  { 893776859, 25480, 1 },  // knockSuppressMinTps
+  { 895067939, 25500, 1 },  // ecumasterEgtToCan
+  { 896753456, 25518, 1 },  // maxInjectorDutyInstant
+  { 897099930, 25541, 0 },  // startStopState
+  { 899082431, 25556, 0 },  // boostrpmTooLow
+  { 903483241, 25571, 1 },  // dynoSaeTemperatureC
+  { 907240922, 25591, 0 },  // rawAfr2
+  { 907666325, 25599, 0 },  // rawMaf2
+  { 910249844, 25607, 1 },  // cruiseControlInhibitDFCO
+  { 917458462, 25632, 1 },  // assistedEtbPeriodSec
+  { 923152418, 25653, 1 },  // enableExtendedCanBroadcast
+  { 923686462, 25680, 1 },  // etbTargetSmoothingFactor
+  { 924403790, 25705, 1 },  // cc_rpmBandHigh
+  { 927388609, 25720, 0 },  // sparkCutReasonBlinker
+  { 937308829, 25742, 1 },  // map.sensorpre.highValue
+  { 939816194, 25766, 1 },  // useCltBasedRpmLimit
+  { 944657936, 25786, 1 },  // mc33_hpfp_i_hold_off
+  { 945288534, 25807, 0 },  // luaDigitalState0
+  { 945288535, 25824, 0 },  // luaDigitalState1
+  { 945288536, 25841, 0 },  // luaDigitalState2
+  { 945288537, 25858, 0 },  // luaDigitalState3
+  { 950993889, 25875, 1 },  // consumeObdSensors
+  { 957036309, 25893, 0 },  // auxSpeed1
+  { 957036310, 25903, 0 },  // auxSpeed2
+  { 957036311, 25913, 0 },  // auxSpeed3
+  { 957036312, 25923, 0 },  // auxSpeed4
+  { 957244017, 25933, 1 },  // useNoiselessTriggerDecoder
+  { 960719456, 25960, 1 },  // cc_maxEtbAdjustmentClose
+  { 965059665, 25985, 1 },  // tracMinMap
+  { 965065602, 25996, 1 },  // tracMinRpm
+  { 965067786, 26007, 1 },  // tracMinTps
+  { 967311941, 26018, 0 },  // schedulingUsedCount
+  { 971442495, 26038, 1 },  // boostPid.iFactor
+  { 973253643, 26055, 1 },  // mappreLowValueVoltage
+  { 982732799, 26077, 0 },  // acengineTooFast
+  { 983211830, 26093, 0 },  // acengineTooSlow
+  { 983231621, 26109, 1 },  // fan1MaxPwm
+  { 983814707, 26120, 1 },  // turbochargerFilter
+  { 986597357, 26139, 0 },  // vvt2etriggerCountersError
+  { 989545496, 26165, 0 },  // triggerIgnoredToothCount
+  { 990714516, 26190, 0 },  // rawHighFuelPressure
+  { 991724096, 26210, 1 },  // driveWheelRevPerKm
+  { 992359619, 26229, 1 },  // fan1MinPwm
+  { 992714408, 26240, 0 },  // epic_hall_inps18
+  { 993282195, 26257, 1 },  // enableFan2WithAc
+  { 993647004, 26274, 1 },  // forceIdleIgnitionUseDFCO
+  { 995190836, 26299, 0 },  // afrTableYAxis
+  { 996346642, 26313, 1 },  // camSyncOnSecondCrankRevolution
+  { 997197711, 26344, 0 },  // temp_mapVvt_index
+  { 1000921080, 26362, 1 },  // dynoCarWheelTireWidthMm
+  { 1001494216, 26386, 0 },  // idleidle_deltaRpmAdj
+  { 1006880557, 26407, 0 },  // boostisNotClosedLoop
+  { 1007396714, 26428, 1 },  // speedometerPulsePerKm
+  { 1016089632, 26450, 0 },  // triggerSecondaryFall
+  { 1016529812, 26471, 0 },  // triggerSecondaryRise
+  { 1021133095, 26492, 0 },  // etb1DutyCycle
+  { 1025426144, 26506, 1 },  // hpfpTargetDecay
+  { 1028902582, 26522, 1 },  // stft.startupDelay
+  { 1029096098, 26540, 0 },  // coilDutyCycle
+  { 1029911752, 26554, 0 },  // waterPumpfan_pwm_started
+  { 1039339108, 26579, 1 },  // injAdvAssistStepDeg
+  { 1049828813, 26599, 1 },  // ltitEnabled
+  { 1055284435, 26611, 0 },  // etb1boardEtbAdjustment
+  { 1056486800, 26634, 1 },  // neverWrite
+  { 1056521754, 26645, 1 },  // tpsaeburnskipinitial
+  { 1057701663, 26666, 1 },  // etbJamTimeout
+  { 1059939210, 26680, 1 },  // useCustomCLTSensor
+  { 1060324714, 26699, 0 },  // knockm_knockThreshold
+  { 1060606307, 26721, 1 },  // useAdvanceCorrectionsForCranking
+  { 1064399425, 26754, 1 },  // idleIncrementalPidCic
+  { 1067281211, 26776, 0 },  // baroHasNoPressure
+  { 1068374799, 26794, 1 },  // luaCanRxWorkaround
+  { 1068607666, 26813, 1 },  // canBoxIdleUpRpm
+  { 1072117635, 26829, 1 },  // nitrousDeactivationRpm
+  { 1077467605, 26852, 1 },  // fan2OffTemperature
+  { 1080782767, 26871, 0 },  // usbBytesInPerSec
+  { 1081026348, 26888, 1 },  // invertCamVVTSignal
+  { 1081456939, 26907, 1 },  // rethrowHardFault
+  { 1082313329, 26924, 0 },  // knockm_knockSpectrumChannelCyl
+  { 1082602292, 26955, 1 },  // tuningDetector
+  { 1083710597, 26970, 0 },  // afrTableSwitch1Active
+  { 1085574505, 26992, 0 },  // fan1fan_pwm_started
+  { 1089348504, 27012, 1 },  // nitrousMinimumClt
+  { 1089367148, 27030, 1 },  // nitrousMinimumTps
+  { 1092207266, 27048, 1 },  // rpmSoftLimitWindowSize
+  { 1092959609, 27071, 0 },  // testBenchIter
+  { 1094944685, 27085, 1 },  // rpmSoftLimitFuelAdded
+  { 1095642192, 27107, 0 },  // fan2disabledBySpeed
+  { 1095822215, 27127, 1 },  // accelSelfTest
+  { 1097520823, 27141, 1 },  // isDoubleSolenoidIdle
+  { 1108896195, 27162, 0 },  // trgtriggerCountersError
+  { 1109228234, 27186, 0 },  // isTuningNow
+  { 1110995303, 27198, 0 },  // nitrousisNitrousTpsCondition
+  { 1115446416, 27227, 1 },  // fan1SoftStartSec
+  { 1117436160, 27244, 0 },  // waterPump2disabledBySpeed
+  { 1117566701, 27270, 1 },  // tpsAccelFractionPeriod
+  { 1119572486, 27293, 0 },  // knockm_knockCount
+  { 1119735859, 27311, 0 },  // crankingFuel.baseFuel
+  { 1120273998, 27333, 0 },  // waterPump2notRunning
+  { 1126586273, 27354, 1 },  // tachSweepUsesTachCorrection
+  { 1129109559, 27382, 1 },  // mc33_t_min_boost
+  { 1129887189, 27399, 0 },  // knockm_knockLevel
+  { 1132871702, 27417, 1 },  // disableWaterPump2AtSpeed
+  { 1136482406, 27442, 0 },  // ignitionLoad
+  { 1145081382, 27455, 1 },  // hpfpPeakPos
+  { 1145888170, 27467, 1 },  // idleStepperReactionTime
+  { 1147267087, 27491, 1 },  // speedoSweepMax
+  { 1148935975, 27506, 1 },  // deltaTpsAverageAlpha
+  { 1155330306, 27527, 0 },  // antilagTriggered
+  { 1156367906, 27544, 1 },  // kickStartCranking
+  { 1160459527, 27562, 1 },  // enableStagedInjection
+  { 1163075685, 27584, 0 },  // transitionEventsCounter
+  { 1164012327, 27608, 1 },  // tpsDecelEnleanmentMultiplier
+  { 1170565107, 27637, 1 },  // etbWastegatePid.periodMs
+  { 1176614802, 27662, 1 },  // rpmHardLimit
+  { 1176668021, 27675, 1 },  // epicInitHSHigh
+  { 1181153770, 27690, 1 },  // canBroadcastUseChannelTwo
+  { 1181226300, 27716, 1 },  // etbSkipReinitWhileRunning
+  { 1182499943, 27742, 1 },  // mc33_hvolt
+  { 1188291586, 27753, 0 },  // rawMapPreFast
+  { 1188684607, 27767, 1 },  // enableKline
+  { 1192769173, 27779, 0 },  // smartChipRestartCounter
+  { 1193280444, 27803, 0 },  // canWriteOk
+  { 1194318341, 27814, 0 },  // tmf_deltap
+  { 1199371520, 27825, 1 },  // cc_rpmBandLow
+  { 1207257049, 27839, 1 },  // mappreHighValueVoltage
+  { 1212570205, 27862, 1 },  // trigger.customTotalToothCount
+  { 1217219128, 27892, 1 },  // cruiseControlReadBrakePedal
+  { 1226423210, 27920, 1 },  // launchTimingRetard
+  { 1229072650, 27939, 1 },  // canBroadcastEgt
+  { 1232469673, 27955, 1 },  // ALSEtbAdd
+  { 1238409345, 27965, 0 },  // rawFuelTankLevel
+  { 1238859945, 27982, 0 },  // rawAuxLinear1
+  { 1238859946, 27996, 0 },  // rawAuxLinear2
+  { 1238859947, 28010, 0 },  // rawAuxLinear3
+  { 1238859948, 28024, 0 },  // rawAuxLinear4
+  { 1239181931, 28038, 0 },  // knockm_knockFrequencyStep
+  { 1242329357, 28064, 0 },  // dcOutput0
+  { 1243122194, 28074, 1 },  // boostSpooledApplyToLowerWg
+  { 1246430386, 28101, 0 },  // etb1luaAdjustment
+  { 1247316691, 28119, 0 },  // canReadCounter
+  { 1254214492, 28134, 0 },  // wheelspeedFrontAvgError
+  { 1258057240, 28158, 1 },  // baroHighValueVoltage
+  { 1265600943, 28179, 0 },  // activateSwitchCondition
+  { 1272017572, 28203, 1 },  // coastingFuelCutRpmHigh
+  { 1272048601, 28226, 0 },  // TPSValue
+  { 1273287930, 28235, 1 },  // afr.value1
+  { 1273287931, 28246, 1 },  // afr.value2
+  { 1281101952, 28257, 0 },  // MAPValue
+  { 1281862911, 28266, 1 },  // mc33_t_bypass
+  { 1286045659, 28280, 0 },  // starterRelayDisable
+  { 1286770247, 28300, 1 },  // noFuelTrimAfterDfcoTime
+  { 1290384202, 28324, 0 },  // fan2fan_pwm_started
+  { 1295852216, 28344, 1 },  // etbWastegatePid.iFactor
+  { 1301677708, 28368, 0 },  // sd_active_rd
+  { 1301677887, 28381, 0 },  // sd_active_wr
+  { 1312178170, 28394, 0 },  // waterPump2fan_pwm_started
+  { 1312557699, 28420, 0 },  // wheelSlipRatioLeftRightFRONT
+  { 1313479950, 28449, 1 },  // tpsAccelEnrichmentThreshold
+  { 1313522810, 28477, 0 },  // trgtriggerSyncGapRatio
+  { 1316625672, 28500, 0 },  // stage2InjSmallPwActive
+  { 1318639761, 28523, 1 },  // fan1PwmFrequency
+  { 1322924702, 28540, 1 },  // warningPeriod
+  { 1327246448, 28554, 1 },  // calmerBurn
+  { 1328773633, 28565, 0 },  // vehicleSpeedKphRearAvg
+  { 1331305978, 28588, 0 },  // auxTemp1
+  { 1331305979, 28597, 0 },  // auxTemp2
+  { 1341529023, 28606, 0 },  // tmf_airflow
+  { 1357163474, 28618, 0 },  // actpsTooHigh
+  { 1359980579, 28631, 0 },  // currentVe
+  { 1362186948, 28641, 1 },  // overrideTriggerGaps
+  { 1368986296, 28661, 0 },  // needBurn
+  { 1369311244, 28670, 1 },  // waterPumpExtraIdle
+  { 1371979578, 28689, 1 },  // globalFuelCorrection
+  { 1377697963, 28710, 0 },  // globalAFRTrim
+  { 1378388905, 28724, 0 },  // isFlatShiftConditionSatisfied
+  { 1384666002, 28754, 0 },  // vvtPositionB1E
+  { 1384666006, 28769, 0 },  // vvtPositionB1I
+  { 1384666035, 28784, 0 },  // vvtPositionB2E
+  { 1384666039, 28799, 0 },  // vvtPositionB2I
+  { 1397079021, 28814, 1 },  // fan1ExtraIdle
+  { 1400650745, 28828, 1 },  // mcp3208divider
+  { 1404346549, 28843, 0 },  // compressorDischargePressure
+  { 1406475301, 28871, 1 },  // isMapPreAveragingEnabled
+  { 1408421157, 28896, 1 },  // maxIdleVss
+  { 1411548995, 28907, 1 },  // enableWaterPump2
+  { 1413130003, 28924, 0 },  // rawFuelLevel
+  { 1414277985, 28937, 1 },  // canBoxIdleUpPercentage
+  { 1414346958, 28960, 1 },  // pidExtraForLowRpm
+  { 1417236183, 28978, 0 },  // sdTcharge_coff
+  { 1417905588, 28993, 0 },  // totalFuelConsumption
+  { 1418003188, 29014, 1 },  // isMafAveragingEnabled
+  { 1419463927, 29036, 0 },  // etb2etbCurrentTarget
+  { 1420262144, 29057, 0 },  // secToMainRelayOff
+  { 1421783686, 29075, 1 },  // boostPid.pFactor
+  { 1422719489, 29092, 0 },  // idlebadTps
+  { 1425505569, 29103, 0 },  // epic_dinp1
+  { 1425505570, 29114, 0 },  // epic_dinp2
+  { 1425505571, 29125, 0 },  // epic_dinp3
+  { 1425505572, 29136, 0 },  // epic_dinp4
+  { 1425505573, 29147, 0 },  // epic_dinp5
+  { 1425505574, 29158, 0 },  // epic_dinp6
+  { 1425505575, 29169, 0 },  // epic_dinp7
+  { 1425505576, 29180, 0 },  // epic_dinp8
+  { 1425664391, 29191, 1 },  // cylinderBore
+  { 1427207708, 29204, 1 },  // ltft.maxAdd
+  { 1433139079, 29216, 0 },  // waterPump2hot
+  { 1433148048, 29230, 0 },  // waterPump2Pwm
+  { 1434907500, 29244, 0 },  // waterPumpcold
+  { 1435801342, 29258, 1 },  // boostPid.offset
+  { 1439272316, 29274, 0 },  // idlemightResetPid
+  { 1445062086, 29292, 1 },  // widebandOnSecondBus
+  { 1445156767, 29312, 1 },  // mapPredictionBlendDuration
+  { 1451020756, 29339, 1 },  // lambdaProtectionEnable
+  { 1455224910, 29362, 1 },  // triggerCompCenterVolt
+  { 1457488876, 29384, 0 },  // tpsSecondaryADC
+  { 1461165305, 29400, 0 },  // idlem_lastTargetRpm
+  { 1464880398, 29420, 1 },  // fan2ExtraIdle
+  { 1466421764, 29434, 0 },  // accPedalUnfiltered
+  { 1467553180, 29453, 1 },  // tunerStudioSerialSpeed
+  { 1470507575, 29476, 1 },  // acPressure.v1
+  { 1470507576, 29490, 1 },  // acPressure.v2
+  { 1470830477, 29504, 1 },  // vvtControlMinClt
+  { 1470846937, 29521, 1 },  // vvtControlMinRpm
+  { 1474641640, 29538, 0 },  // vvt2itriggerSyncGapRatio
+  { 1474689568, 29563, 1 },  // baroSensor.lowValue
+  { 1486014321, 29583, 1 },  // useBiQuadOnAuxSpeedSensors
+  { 1490213215, 29610, 1 },  // idlePidDeactivationTpsThreshold
+  { 1492724763, 29642, 0 },  // warningCounter
+  { 1494394654, 29657, 1 },  // hpfpMinAngle
+  { 1498075808, 29670, 1 },  // kLineBaudRate
+  { 1501267754, 29684, 0 },  // acacPressureTooLow
+  { 1502782136, 29703, 0 },  // etb1tcEtbDrop
+  { 1505102185, 29717, 0 },  // isIatError
+  { 1506446058, 29728, 1 },  // primingDelay
+  { 1509051617, 29741, 1 },  // dynoSaeRelativeHumidity
+  { 1509355728, 29765, 1 },  // knockBankCyl1
+  { 1509355729, 29779, 1 },  // knockBankCyl2
+  { 1509355730, 29793, 1 },  // knockBankCyl3
+  { 1509355731, 29807, 1 },  // knockBankCyl4
+  { 1509355732, 29821, 1 },  // knockBankCyl5
+  { 1509355733, 29835, 1 },  // knockBankCyl6
+  { 1509355734, 29849, 1 },  // knockBankCyl7
+  { 1509355735, 29863, 1 },  // knockBankCyl8
+  { 1509355736, 29877, 1 },  // knockBankCyl9
+  { 1512410464, 29891, 1 },  // waterPump2AcAdder
+  { 1513852665, 29909, 0 },  // overDwellCounter
+  { 1516831168, 29926, 1 },  // veBlend1BlendMode
+  { 1517904291, 29944, 0 },  // lua.acRequestState
+  { 1519167539, 29963, 1 },  // tpsAeResetsEgo
+  { 1520918538, 29978, 0 },  // rawBattery
+  { 1523813390, 29989, 1 },  // ALSMaxCLT
+  { 1523829850, 29999, 1 },  // ALSMaxRPM
+  { 1523832034, 30009, 1 },  // ALSMaxTPS
+  { 1526237246, 30019, 0 },  // injectionPrimingCounter
+  { 1532941388, 30043, 1 },  // ALSMinCLT
+  { 1532957848, 30053, 1 },  // ALSMinRPM
+  { 1533250027, 30063, 0 },  // tps12Split
+  { 1535022703, 30074, 0 },  // sd_airflow
+  { 1535414256, 30085, 1 },  // vssGearRatio1
+  { 1535414257, 30099, 1 },  // vssGearRatio2
+  { 1535414258, 30113, 1 },  // vssGearRatio3
+  { 1535414259, 30127, 1 },  // vssGearRatio4
+  { 1536841513, 30141, 0 },  // mafAirmass
+  { 1538579992, 30152, 1 },  // skippedWheelOnCam
+  { 1539654222, 30170, 0 },  // coilState10
+  { 1539654223, 30182, 0 },  // coilState11
+  { 1539654224, 30194, 0 },  // coilState12
+  { 1540420600, 30206, 1 },  // verboseVVTDecoding
+  { 1541154756, 30225, 1 },  // assistedEtbSettleWindowSec
+  { 1541525498, 30252, 1 },  // dynoCarWheelDiaInch
+  { 1542550121, 30272, 1 },  // injector.flow
+  { 1543085651, 30286, 1 },  // etbWastegatePid.maxValue
+  { 1546871344, 30311, 1 },  // externalRusEfiGdiModule
+  { 1552403965, 30335, 1 },  // accelerometerFds
+  { 1552406533, 30352, 1 },  // accelerometerHPM
+  { 1552414213, 30369, 1 },  // accelerometerOrd
+  { 1554961855, 30386, 0 },  // wastegateDcStatus.dTerm
+  { 1556089965, 30410, 0 },  // wastegateDcStatus.error
+  { 1560891460, 30434, 0 },  // wastegateDcStatus.iTerm
+  { 1561929785, 30458, 1 },  // knockSpectrumSensitivity
+  { 1562875200, 30483, 1 },  // idleRpmPid.periodMs
+  { 1568071542, 30503, 0 },  // veTableYAxis
+  { 1569151513, 30516, 0 },  // isClutchActivated
+  { 1569192907, 30534, 0 },  // wastegateDcStatus.pTerm
+  { 1569342546, 30558, 1 },  // maxAcClt
+  { 1569359006, 30567, 1 },  // maxAcRpm
+  { 1569361190, 30576, 1 },  // maxAcTps
+  { 1570088896, 30585, 1 },  // coastingFuelCutEnabled
+  { 1570551154, 30608, 1 },  // iatSensorPulldown
+  { 1570583513, 30626, 0 },  // etb2tcEtbDrop
+  { 1574758390, 30640, 0 },  // vvt1ivvtToothDurations0
+  { 1574876352, 30664, 1 },  // acrDisablePhase
+  { 1580101425, 30680, 1 },  // etb.periodMs
+  { 1581624998, 30693, 0 },  // mapCamPrevToothAngle
+  { 1584632545, 30714, 1 },  // veBlend2BlendMode
+  { 1589865105, 30732, 1 },  // assistedEtbRotateIterations
+  { 1590125629, 30760, 1 },  // tChargeAirFlowMax
+  { 1596433789, 30778, 0 },  // pedalToTpsIndex
+  { 1597749004, 30794, 1 },  // afrExpAverageAlpha
+  { 1599780729, 30813, 0 },  // normalizedCylinderFilling
+  { 1601709561, 30839, 0 },  // idlecurrentIdlePosition
+  { 1608791711, 30863, 0 },  // injectorFault
+  { 1611799720, 30877, 1 },  // fuelClosedLoopCorrectionEnabled
+  { 1615716653, 30909, 1 },  // flashWriteDelay
+  { 1616873838, 30925, 1 },  // displayLogicLevelsInEngineSniffer
+  { 1620085753, 30959, 0 },  // DriverThrottleIntent
+  { 1628523935, 30980, 0 },  // oilTemp
+  { 1629214715, 30988, 0 },  // overDwellNotScheduledCounter
+  { 1630166812, 31017, 0 },  // extiOverflowCount
+  { 1637661099, 31035, 0 },  // mapVvt_MAP_AT_CYCLE_COUNT
+  { 1640008461, 31061, 1 },  // mapSyncThreshold
+  { 1643181024, 31078, 1 },  // enableVerboseCanTx
+  { 1644550754, 31097, 0 },  // acPressure
+  { 1646218718, 31108, 0 },  // can_call_last_arg
+  { 1646236815, 31126, 0 },  // can_call_last_ret
+  { 1649801578, 31144, 0 },  // lua.fuelAdd
+  { 1650433343, 31156, 0 },  // sdAirMassInOneCylinder
+  { 1651400031, 31179, 1 },  // maxInjectorDutySustained
+  { 1657973395, 31204, 1 },  // idleEntryRampInterpolateAngle
+  { 1658738502, 31234, 1 },  // nitrousMinimumVehicleSpeed
+  { 1663359009, 31261, 0 },  // mafMeasured2
+  { 1664668368, 31274, 1 },  // etbNeutralPosition
+  { 1665682844, 31293, 0 },  // can_call_last_func_id
+  { 1673944848, 31315, 1 },  // cc_speedDeadBandLow
+  { 1676700208, 31335, 1 },  // dfcoDelay
+  { 1677542038, 31345, 1 },  // useSmoothedLambda
+  { 1678478519, 31363, 1 },  // injAdvAssistStepCycles
+  { 1678964986, 31386, 0 },  // tmf_pratio
+  { 1680936043, 31397, 0 },  // lua.disableDecelerationFuelCutOff
+  { 1685154329, 31431, 1 },  // mafMinBufferLength
+  { 1686979713, 31450, 1 },  // tcUseSparkSkip
+  { 1691876092, 31465, 0 },  // isEnabled0
+  { 1692742817, 31476, 0 },  // frequencyMafMeasured
+  { 1697484698, 31497, 1 },  // fuelLevelLowThresholdVoltage
+  { 1698191973, 31526, 1 },  // idleRpmPid.iFactor
+  { 1699495432, 31545, 0 },  // isSwitchActivated
+  { 1699696209, 31563, 0 },  // RPMValue
+  { 1700636875, 31572, 0 },  // rpmForIgnitionTableDot
+  { 1711503040, 31595, 1 },  // tpsExtraShotMult
+  { 1713787596, 31612, 1 },  // epicCanAllowSetVar
+  { 1718832245, 31631, 0 },  // lambdaValue2
+  { 1719590281, 31644, 0 },  // nitrousisNitrousAfrCondition
+  { 1721400659, 31673, 0 },  // vvt2evvtToothDurations0
+  { 1722712413, 31697, 0 },  // speedCondition
+  { 1723460785, 31712, 1 },  // enableWaterPumpWithAc
+  { 1726931380, 31734, 0 },  // engineMakeCodeNameCrc16
+  { 1735444309, 31758, 0 },  // waterPumphot
+  { 1735453278, 31771, 0 },  // waterPumpPwm
+  { 1737199159, 31784, 0 },  // aeEngageCnt
+  { 1737683300, 31796, 1 },  // tcUseETB
+  { 1739403413, 31805, 0 },  // idleisIdleCoasting
+  { 1741054027, 31824, 0 },  // etb2jamTimer
+  { 1742748825, 31837, 1 },  // iacByTpsDecayTime
+  { 1745186508, 31855, 0 },  // fuelCutReasonBlinker
+  { 1746193407, 31876, 1 },  // etbWastegatePid.pFactor
+  { 1749059722, 31900, 0 },  // fastAdcConversionCount
+  { 1750679771, 31923, 1 },  // useTableForDfcoMap
+  { 1752481431, 31942, 1 },  // idleTimingPid.minValue
+  { 1756514810, 31965, 1 },  // rpmHardLimitHyst
+  { 1758659040, 31982, 1 },  // lambdaProtectionMinRpm
+  { 1758661224, 32005, 1 },  // lambdaProtectionMinTps
+  { 1762426578, 32028, 1 },  // stoichRatioPrimary
+  { 1766132801, 32047, 0 },  // luaInvocationCounter
+  { 1769191040, 32068, 1 },  // measureMafOnlyInOneCylinder
+  { 1773847813, 32096, 0 },  // baroCounts
+  { 1774505810, 32107, 0 },  // calibrationMode
+  { 1779308433, 32123, 1 },  // stft.cell.maxAdd
+  { 1779689293, 32140, 1 },  // analogInputDividerCoefficient
+  { 1781305509, 32170, 0 },  // rawAmbientTemp
+  { 1790577077, 32185, 0 },  // idlem_isCoastingAdvance
+  { 1793832386, 32209, 1 },  // useBiQuadOnAuxSpeedSensors1
+  { 1793832387, 32237, 1 },  // useBiQuadOnAuxSpeedSensors2
+  { 1793832388, 32265, 1 },  // useBiQuadOnAuxSpeedSensors3
+  { 1793832389, 32293, 1 },  // useBiQuadOnAuxSpeedSensors4
+  { 1805010797, 32321, 0 },  // can_blend_olboost_1_toggle
+  { 1806457198, 32348, 0 },  // SparkLatencyCorrection
+  { 1807072764, 32371, 1 },  // useIdleVeWhileCoasting
+  { 1816529498, 32394, 0 },  // tmf_tbarea
+  { 1822238385, 32405, 0 },  // running.coolantTemperatureCoefficient
+  { 1830002033, 32443, 1 },  // ALSMaxDuration
+  { 1836976702, 32458, 0 },  // isUsbConnected
+  { 1837662926, 32473, 0 },  // idleluaAdd
+  { 1838375282, 32484, 1 },  // stftIgnoreErrorMagnitude
+  { 1841224793, 32509, 0 },  // fan2cranking
+  { 1842618379, 32522, 1 },  // etbEnabled
+  { 1845538439, 32533, 0 },  // tracDisabled
+  { 1846828749, 32546, 0 },  // usbBytesIn
+  { 1848010723, 32557, 0 },  // boostOpenLoopYAxisValue
+  { 1849938842, 32581, 0 },  // lambdaMonitorCut
+  { 1850657816, 32598, 1 },  // alternatorControl.iFactor
+  { 1856486116, 32624, 1 },  // startButtonSuppressOnStartUpMs
+  { 1859031173, 32655, 1 },  // waterPump2OffTemperature
+  { 1867870099, 32680, 0 },  // wheelspeedRLerror
+  { 1879050865, 32698, 1 },  // etb.dFactor
+  { 1881137064, 32710, 1 },  // idleTimingSoftEntryTime
+  { 1892444332, 32734, 0 },  // epic_dinps18
+  { 1894184322, 32747, 0 },  // outputRequestPeriod
+  { 1904613262, 32767, 1 },  // canBroadcastCams
+  { 1907595115, 32784, 1 },  // mafLowPassCutoffHz
+  { 1910464965, 32803, 0 },  // tmf_maxairflow
+  { 1915146851, 32818, 1 },  // kLinePeriodUs
+  { 1917301199, 32832, 1 },  // isInjectionEnabled
+  { 1921134430, 32851, 0 },  // mapVvt_sync_counter
+  { 1921464113, 32871, 0 },  // idleisIdleClosedLoop
+  { 1922853657, 32892, 0 },  // isTorqueReductionTriggerPinValid
+  { 1925843479, 32925, 1 },  // cltSensorPulldown
+  { 1925854276, 32943, 0 },  // wheelSlipRatioFrontRear
+  { 1926227562, 32967, 0 },  // trgvvtCurrentPosition
+  { 1928406809, 32989, 0 },  // launchActivatePinState
+  { 1933500210, 33012, 1 },  // acIdleExtraOffset
+  { 1933507837, 33030, 0 },  // veValue
+  { 1935395744, 33038, 1 },  // idleRpmPid.maxValue
+  { 1939661442, 33058, 0 },  // idleidleState
+  { 1941168166, 33072, 1 },  // ltft.timeConstant
+  { 1945443830, 33090, 1 },  // stoichRatioSecondary
+  { 1945579510, 33111, 1 },  // waterPump2MaxPwm
+  { 1946185602, 33128, 0 },  // tmf_sd_engineload_split
+  { 1952621969, 33152, 1 },  // etb.maxValue
+  { 1953870952, 33165, 1 },  // maxAcPressure
+  { 1954707508, 33179, 1 },  // waterPump2MinPwm
+  { 1958105647, 33196, 1 },  // mapCamDetectionAnglePosition
+  { 1962548154, 33225, 1 },  // idlePidRpmUpperLimit
+  { 1964920685, 33246, 0 },  // canWriteNotOk
+  { 1966562169, 33260, 0 },  // fan2m_state
+  { 1970088010, 33272, 1 },  // ppsLowPassCutoffHz
+  { 1971361492, 33291, 1 },  // dtTuneSequential
+  { 1972605869, 33308, 1 },  // knockFrequency
+  { 1973309843, 33323, 0 },  // isTimeConditionSatisfied
+  { 1983046327, 33348, 1 },  // alternatorControl.offset
+  { 1984514028, 33373, 0 },  // knockm_knockFuelTrimMultiplier
+  { 1986632654, 33404, 1 },  // useIdleTimingTargetErrorMode
+  { 1986829660, 33433, 0 },  // can_call_counter_dlc_ok
+  { 1986934008, 33457, 0 },  // can_call_last_src_id
+  { 1988973320, 33478, 1 },  // auxTempSensor2.config.resistance_1
+  { 1988973321, 33513, 1 },  // auxTempSensor2.config.resistance_2
+  { 1988973322, 33548, 1 },  // auxTempSensor2.config.resistance_3
+  { 1989648303, 33583, 1 },  // knockRetardAggression
+  { 1989689967, 33605, 1 },  // tcUseIgnTiming
+  { 1990113001, 33620, 0 },  // isMafAveraging
+  { 1990697206, 33635, 0 },  // vvtOutput
+  { 1995425265, 33645, 0 },  // fuelPumpfuelPumpForceState
+  { 1997663388, 33672, 1 },  // tcuEnabled
+  { 2010183589, 33683, 1 },  // disablemax31855
+  { 2012123720, 33699, 1 },  // fuelLevelHighThresholdVoltage
+  { 2014293065, 33729, 0 },  // etb1etbPpsErrorCounter
+  { 2015832005, 33752, 1 },  // cruiseControlAllowPedalUpToEngage
+  { 2016604988, 33786, 1 },  // cruiseControlEnabled
+  { 2016887022, 33807, 1 },  // etbFreq
+  { 2018173863, 33815, 0 },  // totalTriggerErrorCounter
+  { 2018177457, 33840, 0 },  // est_temp_charge_c
+  { 2018177465, 33858, 0 },  // est_temp_charge_k
+  { 2022304759, 33876, 1 },  // ltitApplyToFuel
+  { 2029444810, 33892, 0 },  // afr2GasolineScale
+  { 2030571545, 33910, 1 },  // dfcoRetardRampInTime
+  { 2031242236, 33931, 0 },  // loadForIgnitionTableDot
+  { 2031699396, 33955, 0 },  // idleidle_timeInIdle
+  { 2032707103, 33975, 1 },  // highPressureFuel.v1
+  { 2032707104, 33995, 1 },  // highPressureFuel.v2
+  { 2039421097, 34015, 0 },  // rawWastegatePosition
+  { 2043354390, 34036, 1 },  // rusefiVerbose29b
+  { 2045663596, 34053, 0 },  // maf_airflow
+  { 2045903304, 34065, 0 },  // maf_airmass
+  { 2046400891, 34077, 0 },  // actualLastInjSTG2PreSmallPw
+  { 2048390406, 34105, 1 },  // isFasterEngineSpinUpEnabled
+  { 2055342630, 34133, 0 },  // lua.luaDisableEtb
+  { 2057611093, 34151, 1 },  // cruiseControlReadClutchUp
+  { 2068951385, 34177, 1 },  // stimulatorBench
+  { 2069994349, 34193, 0 },  // etb1trim
+  { 2070002124, 34202, 0 },  // rawOilPressure
+  { 2070727975, 34217, 1 },  // airByRpmTaper
+  { 2071041633, 34231, 1 },  // crankingTimingAngle
+  { 2071180270, 34251, 0 },  // etb2trim
+  { 2071622501, 34260, 0 },  // boostisBoostControlled
+  { 2079600300, 34283, 0 },  // rawAcPressure
+  { 2081101045, 34297, 0 },  // injectorState1
+  { 2081101046, 34312, 0 },  // injectorState2
+  { 2081101047, 34327, 0 },  // injectorState3
+  { 2081101048, 34342, 0 },  // injectorState4
+  { 2081101049, 34357, 0 },  // injectorState5
+  { 2081101050, 34372, 0 },  // injectorState6
+  { 2081101051, 34387, 0 },  // injectorState7
+  { 2081101052, 34402, 0 },  // injectorState8
+  { 2081101053, 34417, 0 },  // injectorState9
+  { 2083134143, 34432, 1 },  // cc_minSpeed
+  { 2086676382, 34444, 0 },  // fan2notRunning
+  { 2090288615, 34459, 0 },  // Gego
+  { 2094922339, 34464, 1 },  // fuelLevelAveragingAlpha
+  { 2098956565, 34488, 0 },  // etbStatus.resetCounter
+  { 2099290370, 34511, 0 },  // isRunningBench
+  { 2099527693, 34526, 1 },  // throttlePedalWOTVoltage
+  { 2102682457, 34550, 0 },  // wheelspeedRRerror
+  { 2104472173, 34568, 1 },  // canWriteEnabled
+  { 2109872789, 34584, 1 },  // cc_setpoint_adjust_rate
+  { 2112480535, 34608, 1 },  // tps1_diameter
+  { 2115625058, 34622, 1 },  // tChargeAirCoefMax
+  { 2115625312, 34640, 1 },  // tChargeAirCoefMin
+  { 2122875976, 34658, 1 },  // triggerSimulatorRpm
+  { 2122891301, 34678, 0 },  // targetAFR
+  { 2122945582, 34688, 1 },  // waterPumpAcAdder
+  { 2130109627, 34705, 1 },  // waterPump2PwmEnabled
+  { 2130850289, 34726, 0 },  // vvt2itriggerCountersError
+  { 2136379132, 34752, 1 },  // stepper_dc_use_two_wires
+};
+
+// Every entry checks the compile-time varHash() against variables.json.
+static_assert(varHash("etbSplit") == -2146852436, "varHash: etbSplit");
+static_assert(varHash("idleRpmPid.pFactor") == -2146434132, "varHash: idleRpmPid.pFactor");
+static_assert(varHash("sadDwellRatioCounter") == -2146292012, "varHash: sadDwellRatioCounter");
+static_assert(varHash("tachPulsePerRev") == -2142425790, "varHash: tachPulsePerRev");
+static_assert(varHash("stft.maxLambda") == -2140162309, "varHash: stft.maxLambda");
+static_assert(varHash("acLowRpmLimit") == -2138018615, "varHash: acLowRpmLimit");
+static_assert(varHash("calibrationBirthday") == -2136933308, "varHash: calibrationBirthday");
+static_assert(varHash("accelerationLat") == -2133047664, "varHash: accelerationLat");
+static_assert(varHash("accelerationLon") == -2133047208, "varHash: accelerationLon");
+static_assert(varHash("vvtTarget") == -2132393748, "varHash: vvtTarget");
+static_assert(varHash("throttlePedalUpVoltage") == -2130836456, "varHash: throttlePedalUpVoltage");
+static_assert(varHash("fuelPumpisPrime") == -2124710580, "varHash: fuelPumpisPrime");
+static_assert(varHash("etb2etbErrorCode") == -2124102606, "varHash: etb2etbErrorCode");
+static_assert(varHash("wheelSlipRatioLeftRightREF") == -2120630025, "varHash: wheelSlipRatioLeftRightREF");
+static_assert(varHash("waterPumpenabledForAc") == -2120302656, "varHash: waterPumpenabledForAc");
+static_assert(varHash("tcuInputSpeedSensorTeeth") == -2116746650, "varHash: tcuInputSpeedSensorTeeth");
+static_assert(varHash("totalGearsCount") == -2114430012, "varHash: totalGearsCount");
+static_assert(varHash("stopEngineCode") == -2112117188, "varHash: stopEngineCode");
+static_assert(varHash("boostCutPressureHyst") == -2111374247, "varHash: boostCutPressureHyst");
+static_assert(varHash("etb2etbRevLimitActive") == -2109056235, "varHash: etb2etbRevLimitActive");
+static_assert(varHash("stepperForceParkingEveryRestart") == -2104625325, "varHash: stepperForceParkingEveryRestart");
+static_assert(varHash("acisDisabledByLua") == -2102560038, "varHash: acisDisabledByLua");
+static_assert(varHash("useIacTableForCoasting") == -2101952506, "varHash: useIacTableForCoasting");
+static_assert(varHash("injectorPrimeInhibit") == -2100683129, "varHash: injectorPrimeInhibit");
+static_assert(varHash("disableEtbWhenEngineStopped") == -2096650725, "varHash: disableEtbWhenEngineStopped");
+static_assert(varHash("lambdaProtectionMinLoad") == -2094010831, "varHash: lambdaProtectionMinLoad");
+static_assert(varHash("idleisBlipping") == -2093662604, "varHash: idleisBlipping");
+static_assert(varHash("cruiseControlReadClutchPedal") == -2088298794, "varHash: cruiseControlReadClutchPedal");
+static_assert(varHash("mc33_t_hold_off") == -2086522258, "varHash: mc33_t_hold_off");
+static_assert(varHash("mc33_t_hold_tot") == -2086516502, "varHash: mc33_t_hold_tot");
+static_assert(varHash("gapTrackingLengthOverride") == -2079960526, "varHash: gapTrackingLengthOverride");
+static_assert(varHash("tcu_rangeSensorPulldown") == -2079591860, "varHash: tcu_rangeSensorPulldown");
+static_assert(varHash("waterPump2ExtraIdle") == -2078468674, "varHash: waterPump2ExtraIdle");
+static_assert(varHash("engineMode") == -2073424832, "varHash: engineMode");
+static_assert(varHash("maxCamPhaseResolveRpm") == -2070332548, "varHash: maxCamPhaseResolveRpm");
+static_assert(varHash("enabledStep1Limiter") == -2068213709, "varHash: enabledStep1Limiter");
+static_assert(varHash("baroPressure") == -2066867294, "varHash: baroPressure");
+static_assert(varHash("iacByTpsTaper") == -2065814304, "varHash: iacByTpsTaper");
+static_assert(varHash("ltitIntegratorThreshold") == -2065042706, "varHash: ltitIntegratorThreshold");
+static_assert(varHash("knockm_knockFrequencyStart") == -2056673411, "varHash: knockm_knockFrequencyStart");
+static_assert(varHash("etb2luaAdjustment") == -2054472109, "varHash: etb2luaAdjustment");
+static_assert(varHash("disableWaterPump2WhenStopped") == -2045878495, "varHash: disableWaterPump2WhenStopped");
+static_assert(varHash("mafEstimate") == -2045040875, "varHash: mafEstimate");
+static_assert(varHash("cc_pedal_release_seconds") == -2036308770, "varHash: cc_pedal_release_seconds");
+static_assert(varHash("resetCanToggleInhibit1") == -2036098060, "varHash: resetCanToggleInhibit1");
+static_assert(varHash("resetCanToggleInhibit2") == -2036098059, "varHash: resetCanToggleInhibit2");
+static_assert(varHash("resetCanToggleInhibit3") == -2036098058, "varHash: resetCanToggleInhibit3");
+static_assert(varHash("resetCanToggleInhibit4") == -2036098057, "varHash: resetCanToggleInhibit4");
+static_assert(varHash("resetCanToggleInhibit5") == -2036098056, "varHash: resetCanToggleInhibit5");
+static_assert(varHash("resetCanToggleInhibit6") == -2036098055, "varHash: resetCanToggleInhibit6");
+static_assert(varHash("resetCanToggleInhibit7") == -2036098054, "varHash: resetCanToggleInhibit7");
+static_assert(varHash("resetCanToggleInhibit8") == -2036098053, "varHash: resetCanToggleInhibit8");
+static_assert(varHash("isPedalError") == -2035612655, "varHash: isPedalError");
+static_assert(varHash("idleTimingPid.offset") == -2033984419, "varHash: idleTimingPid.offset");
+static_assert(varHash("mafMeasured") == -2032003569, "varHash: mafMeasured");
+static_assert(varHash("coastingFuelCutVssHigh") == -2027523439, "varHash: coastingFuelCutVssHigh");
+static_assert(varHash("ALSIdleAdd") == -2021435668, "varHash: ALSIdleAdd");
+static_assert(varHash("fan2MaxPwm") == -2020267706, "varHash: fan2MaxPwm");
+static_assert(varHash("complexWallModel") == -2018683234, "varHash: complexWallModel");
+static_assert(varHash("minimumOilPressureTimeout") == -2016978331, "varHash: minimumOilPressureTimeout");
+static_assert(varHash("hasCriticalError") == -2015383594, "varHash: hasCriticalError");
+static_assert(varHash("fan2MinPwm") == -2011139708, "varHash: fan2MinPwm");
+static_assert(varHash("acacButtonState") == -2010169270, "varHash: acacButtonState");
+static_assert(varHash("knockm_maximumRetard") == -2000802553, "varHash: knockm_maximumRetard");
+static_assert(varHash("acacPressureTooHigh") == -1997922376, "varHash: acacPressureTooHigh");
+static_assert(varHash("useSeparateVeForIdle") == -1997438905, "varHash: useSeparateVeForIdle");
+static_assert(varHash("fan1m_state") == -1997175144, "varHash: fan1m_state");
+static_assert(varHash("idleneedReset") == -1996090622, "varHash: idleneedReset");
+static_assert(varHash("alternatorControl.periodMs") == -1995686573, "varHash: alternatorControl.periodMs");
+static_assert(varHash("alternatorControl.pFactor") == -1993968289, "varHash: alternatorControl.pFactor");
+static_assert(varHash("waterPump2SoftStartSec") == -1993101119, "varHash: waterPump2SoftStartSec");
+static_assert(varHash("boostCutPressure") == -1992945039, "varHash: boostCutPressure");
+static_assert(varHash("benchTestOnTime") == -1992436143, "varHash: benchTestOnTime");
+static_assert(varHash("boostPwmFrequency") == -1990709262, "varHash: boostPwmFrequency");
+static_assert(varHash("yesUnderstandLocking") == -1985448683, "varHash: yesUnderstandLocking");
+static_assert(varHash("vvt2esynchronizationCounter") == -1983023250, "varHash: vvt2esynchronizationCounter");
+static_assert(varHash("boosthasInitBoost") == -1979108093, "varHash: boosthasInitBoost");
+static_assert(varHash("boostControlMinMap") == -1976642929, "varHash: boostControlMinMap");
+static_assert(varHash("boostControlMinRpm") == -1976636992, "varHash: boostControlMinRpm");
+static_assert(varHash("boostControlMinTps") == -1976634808, "varHash: boostControlMinTps");
+static_assert(varHash("cc_smooth_exp_average") == -1974390710, "varHash: cc_smooth_exp_average");
+static_assert(varHash("highFuelPressure") == -1973799222, "varHash: highFuelPressure");
+static_assert(varHash("etb1etbFeedForward") == -1970249707, "varHash: etb1etbFeedForward");
+static_assert(varHash("waterPumpradiatorFanStatus") == -1965263463, "varHash: waterPumpradiatorFanStatus");
+static_assert(varHash("boostControlSafeDutyCycle") == -1965075262, "varHash: boostControlSafeDutyCycle");
+static_assert(varHash("fixedModeTiming") == -1965056926, "varHash: fixedModeTiming");
+static_assert(varHash("seconds") == -1962923820, "varHash: seconds");
+static_assert(varHash("isLaunchCondition") == -1959120957, "varHash: isLaunchCondition");
+static_assert(varHash("vssToothCount") == -1958312328, "varHash: vssToothCount");
+static_assert(varHash("smartChipAliveCounter") == -1945673215, "varHash: smartChipAliveCounter");
+static_assert(varHash("invertSecondaryTriggerSignal") == -1944260329, "varHash: invertSecondaryTriggerSignal");
+static_assert(varHash("startStopPhysicalState") == -1943724937, "varHash: startStopPhysicalState");
+static_assert(varHash("trgsynchronizationCounter") == -1943574844, "varHash: trgsynchronizationCounter");
+static_assert(varHash("lastCanButtonSeen") == -1939960078, "varHash: lastCanButtonSeen");
+static_assert(varHash("rawFlexFreq") == -1935221780, "varHash: rawFlexFreq");
+static_assert(varHash("alwaysInstantRpm") == -1934896346, "varHash: alwaysInstantRpm");
+static_assert(varHash("vehicleSpeedKph") == -1925174695, "varHash: vehicleSpeedKph");
+static_assert(varHash("enableKnockSpectrogramFilter") == -1923222129, "varHash: enableKnockSpectrogramFilter");
+static_assert(varHash("isWarnNow") == -1919072851, "varHash: isWarnNow");
+static_assert(varHash("luaIgnitionSkip") == -1916613921, "varHash: luaIgnitionSkip");
+static_assert(varHash("disableFan2AtSpeed") == -1906717594, "varHash: disableFan2AtSpeed");
+static_assert(varHash("ecuCanId") == -1902910591, "varHash: ecuCanId");
+static_assert(varHash("ambientTempSensor.config.bias_resistor") == -1899369472, "varHash: ambientTempSensor.config.bias_resistor");
+static_assert(varHash("highPressureFuel.value1") == -1898025562, "varHash: highPressureFuel.value1");
+static_assert(varHash("highPressureFuel.value2") == -1898025561, "varHash: highPressureFuel.value2");
+static_assert(varHash("watchOutForLinearTime") == -1896516795, "varHash: watchOutForLinearTime");
+static_assert(varHash("disableFan2WhenStoppedTimeout") == -1894116168, "varHash: disableFan2WhenStoppedTimeout");
+static_assert(varHash("alternatorStatus.output") == -1889531804, "varHash: alternatorStatus.output");
+static_assert(varHash("ltft.deadband") == -1888587696, "varHash: ltft.deadband");
+static_assert(varHash("timingIatCorrection") == -1886479485, "varHash: timingIatCorrection");
+static_assert(varHash("can2ListenMode") == -1879090979, "varHash: can2ListenMode");
+static_assert(varHash("etb2etbErrorCodeBlinker") == -1877053191, "varHash: etb2etbErrorCodeBlinker");
+static_assert(varHash("isPreLaunchCondition") == -1872098102, "varHash: isPreLaunchCondition");
+static_assert(varHash("fuelAlgorithm") == -1863470920, "varHash: fuelAlgorithm");
+static_assert(varHash("idleTimingPid.iFactor") == -1862337922, "varHash: idleTimingPid.iFactor");
+static_assert(varHash("etbMinimumPosition") == -1855700175, "varHash: etbMinimumPosition");
+static_assert(varHash("mapExpAverageAlpha") == -1852204335, "varHash: mapExpAverageAlpha");
+static_assert(varHash("fan2SoftStartSec") == -1847892463, "varHash: fan2SoftStartSec");
+static_assert(varHash("ignitionDisabled1") == -1843977329, "varHash: ignitionDisabled1");
+static_assert(varHash("ignitionDisabled2") == -1843977328, "varHash: ignitionDisabled2");
+static_assert(varHash("ignitionDisabled3") == -1843977327, "varHash: ignitionDisabled3");
+static_assert(varHash("ignitionDisabled4") == -1843977326, "varHash: ignitionDisabled4");
+static_assert(varHash("ignitionDisabled5") == -1843977325, "varHash: ignitionDisabled5");
+static_assert(varHash("ignitionDisabled6") == -1843977324, "varHash: ignitionDisabled6");
+static_assert(varHash("ignitionDisabled7") == -1843977323, "varHash: ignitionDisabled7");
+static_assert(varHash("ignitionDisabled8") == -1843977322, "varHash: ignitionDisabled8");
+static_assert(varHash("ignitionDisabled9") == -1843977321, "varHash: ignitionDisabled9");
+static_assert(varHash("fuelInjectionCounter") == -1839290700, "varHash: fuelInjectionCounter");
+static_assert(varHash("applyExpAverageToEtbTarget") == -1837413512, "varHash: applyExpAverageToEtbTarget");
+static_assert(varHash("knockFuelTrimReapplyRate") == -1833685972, "varHash: knockFuelTrimReapplyRate");
+static_assert(varHash("clt.config.tempC_1") == -1832527325, "varHash: clt.config.tempC_1");
+static_assert(varHash("clt.config.tempC_2") == -1832527324, "varHash: clt.config.tempC_2");
+static_assert(varHash("clt.config.tempC_3") == -1832527323, "varHash: clt.config.tempC_3");
+static_assert(varHash("isBoostControlEnabled") == -1832431020, "varHash: isBoostControlEnabled");
+static_assert(varHash("launchSparkCutEnable") == -1829995308, "varHash: launchSparkCutEnable");
+static_assert(varHash("useLinearCltSensor") == -1816997974, "varHash: useLinearCltSensor");
+static_assert(varHash("idleStatus.dTerm") == -1813050607, "varHash: idleStatus.dTerm");
+static_assert(varHash("idleStatus.error") == -1811922497, "varHash: idleStatus.error");
+static_assert(varHash("knockFuelTrimAggression") == -1811840427, "varHash: knockFuelTrimAggression");
+static_assert(varHash("sd_error") == -1811686395, "varHash: sd_error");
+static_assert(varHash("etb1etbRevLimitActive") == -1808516876, "varHash: etb1etbRevLimitActive");
+static_assert(varHash("etb1m_lastPidDtMs") == -1808022618, "varHash: etb1m_lastPidDtMs");
+static_assert(varHash("idleStatus.iTerm") == -1807121002, "varHash: idleStatus.iTerm");
+static_assert(varHash("etb2m_adjustedTarget") == -1802940455, "varHash: etb2m_adjustedTarget");
+static_assert(varHash("launchRpmWindow") == -1798887513, "varHash: launchRpmWindow");
+static_assert(varHash("fastAdcPeriod") == -1798837954, "varHash: fastAdcPeriod");
+static_assert(varHash("idleStatus.pTerm") == -1798819555, "varHash: idleStatus.pTerm");
+static_assert(varHash("rawPpsSecondary") == -1798336054, "varHash: rawPpsSecondary");
+static_assert(varHash("assistedEtbMinBatteryVoltage") == -1794461103, "varHash: assistedEtbMinBatteryVoltage");
+static_assert(varHash("acacCompressorState") == -1792900549, "varHash: acacCompressorState");
+static_assert(varHash("tpsaccaen") == -1791885641, "varHash: tpsaccaen");
+static_assert(varHash("tpsaccden") == -1791882374, "varHash: tpsaccden");
+static_assert(varHash("checkEngine") == -1790051911, "varHash: checkEngine");
+static_assert(varHash("waterPump2PwmFrequency") == -1789907774, "varHash: waterPump2PwmFrequency");
+static_assert(varHash("maxOilPressureTimeout") == -1788499857, "varHash: maxOilPressureTimeout");
+static_assert(varHash("nitrousDeactivationRpmWindow") == -1786673317, "varHash: nitrousDeactivationRpmWindow");
+static_assert(varHash("RealLambdaValue1") == -1780282696, "varHash: RealLambdaValue1");
+static_assert(varHash("RealLambdaValue2") == -1780282695, "varHash: RealLambdaValue2");
+static_assert(varHash("totalFuelCorrection") == -1779658835, "varHash: totalFuelCorrection");
+static_assert(varHash("fan2radiatorFanStatus") == -1778606949, "varHash: fan2radiatorFanStatus");
+static_assert(varHash("baseDwell") == -1777838088, "varHash: baseDwell");
+static_assert(varHash("fastAdcLastError") == -1773414247, "varHash: fastAdcLastError");
+static_assert(varHash("isAlternatorControlEnabled") == -1771449111, "varHash: isAlternatorControlEnabled");
+static_assert(varHash("vvtChannel1") == -1764857649, "varHash: vvtChannel1");
+static_assert(varHash("vvtChannel2") == -1764857648, "varHash: vvtChannel2");
+static_assert(varHash("vvtChannel3") == -1764857647, "varHash: vvtChannel3");
+static_assert(varHash("vvtChannel4") == -1764857646, "varHash: vvtChannel4");
+static_assert(varHash("nitrousLuaGaugeArmingValue") == -1760115393, "varHash: nitrousLuaGaugeArmingValue");
+static_assert(varHash("isTriggerError") == -1746157889, "varHash: isTriggerError");
+static_assert(varHash("tpsSecondaryMaximum") == -1744146782, "varHash: tpsSecondaryMaximum");
+static_assert(varHash("launchSpeedThreshold") == -1743747394, "varHash: launchSpeedThreshold");
+static_assert(varHash("idlerpmpid_iTermMax") == -1742418955, "varHash: idlerpmpid_iTermMax");
+static_assert(varHash("idlerpmpid_iTermMin") == -1742418701, "varHash: idlerpmpid_iTermMin");
+static_assert(varHash("veTableSwitch1Active") == -1738951225, "varHash: veTableSwitch1Active");
+static_assert(varHash("vvt2itriggerStateIndex") == -1732159411, "varHash: vvt2itriggerStateIndex");
+static_assert(varHash("cc_unsafeTps") == -1731476413, "varHash: cc_unsafeTps");
+static_assert(varHash("knockBankCyl10") == -1730868480, "varHash: knockBankCyl10");
+static_assert(varHash("knockBankCyl11") == -1730868479, "varHash: knockBankCyl11");
+static_assert(varHash("knockBankCyl12") == -1730868478, "varHash: knockBankCyl12");
+static_assert(varHash("dtTuneCurCycle") == -1730700941, "varHash: dtTuneCurCycle");
+static_assert(varHash("mapVvt_MAP_AT_SPECIAL_POINT") == -1727829859, "varHash: mapVvt_MAP_AT_SPECIAL_POINT");
+static_assert(varHash("maximumIgnitionTiming") == -1726245940, "varHash: maximumIgnitionTiming");
+static_assert(varHash("etb_iTermMax") == -1725192730, "varHash: etb_iTermMax");
+static_assert(varHash("etb_iTermMin") == -1725192476, "varHash: etb_iTermMin");
+static_assert(varHash("enableSoftwareKnock") == -1724873939, "varHash: enableSoftwareKnock");
+static_assert(varHash("effectiveMap") == -1724101868, "varHash: effectiveMap");
+static_assert(varHash("AFRValue2") == -1723435379, "varHash: AFRValue2");
+static_assert(varHash("fan1hot") == -1717868938, "varHash: fan1hot");
+static_assert(varHash("fan1Pwm") == -1717859969, "varHash: fan1Pwm");
+static_assert(varHash("fan2hot") == -1717833001, "varHash: fan2hot");
+static_assert(varHash("fan2Pwm") == -1717824032, "varHash: fan2Pwm");
+static_assert(varHash("cranking.rpm") == -1717336209, "varHash: cranking.rpm");
+static_assert(varHash("cc_rpmDeadBandHigh") == -1715823812, "varHash: cc_rpmDeadBandHigh");
+static_assert(varHash("triggerPageRefreshFlag") == -1708884225, "varHash: triggerPageRefreshFlag");
+static_assert(varHash("vvt1evvtToothDurations0") == -1703719182, "varHash: vvt1evvtToothDurations0");
+static_assert(varHash("mafAirChargeLoad") == -1697011009, "varHash: mafAirChargeLoad");
+static_assert(varHash("ltft.correctionEnabled") == -1686338448, "varHash: ltft.correctionEnabled");
+static_assert(varHash("rtcUnixEpochTime") == -1684644880, "varHash: rtcUnixEpochTime");
+static_assert(varHash("idleMaximumAirmass") == -1671871759, "varHash: idleMaximumAirmass");
+static_assert(varHash("TMFLoadIsTMF") == -1671099729, "varHash: TMFLoadIsTMF");
+static_assert(varHash("accelerationVert") == -1670732400, "varHash: accelerationVert");
+static_assert(varHash("tracSpeedLeftRightREF") == -1668210650, "varHash: tracSpeedLeftRightREF");
+static_assert(varHash("toothLogReady") == -1662199734, "varHash: toothLogReady");
+static_assert(varHash("dynoCarFrontalAreaM2") == -1661556925, "varHash: dynoCarFrontalAreaM2");
+static_assert(varHash("etbResetCnt") == -1659154648, "varHash: etbResetCnt");
+static_assert(varHash("tcu_shiftTime") == -1658957891, "varHash: tcu_shiftTime");
+static_assert(varHash("benchTestOffTime") == -1655178001, "varHash: benchTestOffTime");
+static_assert(varHash("auxLowPassCutoffHz") == -1653846075, "varHash: auxLowPassCutoffHz");
+static_assert(varHash("wallWettingAeEnabled") == -1652586744, "varHash: wallWettingAeEnabled");
+static_assert(varHash("acm_acEnabled") == -1652521980, "varHash: acm_acEnabled");
+static_assert(varHash("lambdaProtectionTimeout") == -1645106444, "varHash: lambdaProtectionTimeout");
+static_assert(varHash("auxSpeed1Multiplier") == -1644887108, "varHash: auxSpeed1Multiplier");
+static_assert(varHash("fan2PwmFrequency") == -1644699118, "varHash: fan2PwmFrequency");
+static_assert(varHash("idletargetRpmByClt") == -1643597865, "varHash: idletargetRpmByClt");
+static_assert(varHash("can_call_last_ok") == -1642070946, "varHash: can_call_last_ok");
+static_assert(varHash("enableWaterPump2WithAc") == -1637023613, "varHash: enableWaterPump2WithAc");
+static_assert(varHash("isAppConditionSatisfied") == -1634779035, "varHash: isAppConditionSatisfied");
+static_assert(varHash("inj10ok") == -1634476895, "varHash: inj10ok");
+static_assert(varHash("inj11ok") == -1634475806, "varHash: inj11ok");
+static_assert(varHash("inj12ok") == -1634474717, "varHash: inj12ok");
+static_assert(varHash("accelerometerScale") == -1633831640, "varHash: accelerometerScale");
+static_assert(varHash("driveWheelRevPerKm1") == -1632843151, "varHash: driveWheelRevPerKm1");
+static_assert(varHash("driveWheelRevPerKm2") == -1632843150, "varHash: driveWheelRevPerKm2");
+static_assert(varHash("driveWheelRevPerKm3") == -1632843149, "varHash: driveWheelRevPerKm3");
+static_assert(varHash("driveWheelRevPerKm4") == -1632843148, "varHash: driveWheelRevPerKm4");
+static_assert(varHash("disableProgOutputs") == -1629429387, "varHash: disableProgOutputs");
+static_assert(varHash("isMapAveraging") == -1626840525, "varHash: isMapAveraging");
+static_assert(varHash("luaTimingMult") == -1626770351, "varHash: luaTimingMult");
+static_assert(varHash("alternatorControl.maxValue") == -1623166029, "varHash: alternatorControl.maxValue");
+static_assert(varHash("ltitClampMax") == -1622665899, "varHash: ltitClampMax");
+static_assert(varHash("ltitClampMin") == -1622665645, "varHash: ltitClampMin");
+static_assert(varHash("idleDeltaRpmAdjAvgFactor") == -1613565112, "varHash: idleDeltaRpmAdjAvgFactor");
+static_assert(varHash("dynoCarGearPrimaryReduction") == -1607465307, "varHash: dynoCarGearPrimaryReduction");
+static_assert(varHash("stftLimitsUseLambda") == -1605356346, "varHash: stftLimitsUseLambda");
+static_assert(varHash("lua.torqueReductionState") == -1605036797, "varHash: lua.torqueReductionState");
+static_assert(varHash("tachSweepTime") == -1603867624, "varHash: tachSweepTime");
+static_assert(varHash("isSdCardEnabled") == -1603423011, "varHash: isSdCardEnabled");
+static_assert(varHash("epic_hall_inps916") == -1600154369, "varHash: epic_hall_inps916");
+static_assert(varHash("epic_hall_inp1") == -1596390371, "varHash: epic_hall_inp1");
+static_assert(varHash("epic_hall_inp2") == -1596390370, "varHash: epic_hall_inp2");
+static_assert(varHash("epic_hall_inp3") == -1596390369, "varHash: epic_hall_inp3");
+static_assert(varHash("epic_hall_inp4") == -1596390368, "varHash: epic_hall_inp4");
+static_assert(varHash("epic_hall_inp5") == -1596390367, "varHash: epic_hall_inp5");
+static_assert(varHash("epic_hall_inp6") == -1596390366, "varHash: epic_hall_inp6");
+static_assert(varHash("epic_hall_inp7") == -1596390365, "varHash: epic_hall_inp7");
+static_assert(varHash("epic_hall_inp8") == -1596390364, "varHash: epic_hall_inp8");
+static_assert(varHash("epic_hall_inp9") == -1596390363, "varHash: epic_hall_inp9");
+static_assert(varHash("sparkOutOfOrderCounter") == -1595596945, "varHash: sparkOutOfOrderCounter");
+static_assert(varHash("maxTriggerReentrant") == -1595441102, "varHash: maxTriggerReentrant");
+static_assert(varHash("idleidleTargetFlow") == -1591877056, "varHash: idleidleTargetFlow");
+static_assert(varHash("dtTuneBatch") == -1591245125, "varHash: dtTuneBatch");
+static_assert(varHash("mapVvt_MAP_AT_DIFF") == -1585778708, "varHash: mapVvt_MAP_AT_DIFF");
+static_assert(varHash("assistedEtbMaxAllowedPpsPct") == -1585413592, "varHash: assistedEtbMaxAllowedPpsPct");
+static_assert(varHash("enableLaunchRetard") == -1583589783, "varHash: enableLaunchRetard");
+static_assert(varHash("cylindersCount") == -1578655365, "varHash: cylindersCount");
+static_assert(varHash("disableFan1AtSpeed") == -1575487611, "varHash: disableFan1AtSpeed");
+static_assert(varHash("useEeprom") == -1572546086, "varHash: useEeprom");
+static_assert(varHash("throttlePedalSecondaryUpVoltage") == -1564912640, "varHash: throttlePedalSecondaryUpVoltage");
+static_assert(varHash("idlePidActivationTime") == -1562952959, "varHash: idlePidActivationTime");
+static_assert(varHash("canBroadcastKnock") == -1562315488, "varHash: canBroadcastKnock");
+static_assert(varHash("calibrationValue") == -1560670902, "varHash: calibrationValue");
+static_assert(varHash("compressorDischargeTemperature.config.bias_resistor") == -1555883851, "varHash: compressorDischargeTemperature.config.bias_resistor");
+static_assert(varHash("tractionControlSparkSkip") == -1555684830, "varHash: tractionControlSparkSkip");
+static_assert(varHash("revolutionCounterSinceStart") == -1555114948, "varHash: revolutionCounterSinceStart");
+static_assert(varHash("instantMAFValue") == -1553662697, "varHash: instantMAFValue");
+static_assert(varHash("acrActive") == -1548941801, "varHash: acrActive");
+static_assert(varHash("deferAllWritesUntilEngineOff") == -1548385409, "varHash: deferAllWritesUntilEngineOff");
+static_assert(varHash("isPhaseSyncRequiredForIgnition") == -1543452424, "varHash: isPhaseSyncRequiredForIgnition");
+static_assert(varHash("tpsAeFastCallback") == -1536638947, "varHash: tpsAeFastCallback");
+static_assert(varHash("boostboostControllerClosedLoopPart") == -1535181662, "varHash: boostboostControllerClosedLoopPart");
+static_assert(varHash("isTps2Error") == -1529936844, "varHash: isTps2Error");
+static_assert(varHash("artificialTestMisfire") == -1528619572, "varHash: artificialTestMisfire");
+static_assert(varHash("tmf_maf_tmf_airmass_split") == -1525404769, "varHash: tmf_maf_tmf_airmass_split");
+static_assert(varHash("enableWaterPump") == -1519032079, "varHash: enableWaterPump");
+static_assert(varHash("cc_proportionalGainSPEED") == -1517072029, "varHash: cc_proportionalGainSPEED");
+static_assert(varHash("can2OpenBLT") == -1514354211, "varHash: can2OpenBLT");
+static_assert(varHash("wallFuelCorrectionValue") == -1511514122, "varHash: wallFuelCorrectionValue");
+static_assert(varHash("cc_proportionalGainRPM") == -1507985087, "varHash: cc_proportionalGainRPM");
+static_assert(varHash("etb1integralError") == -1507281103, "varHash: etb1integralError");
+static_assert(varHash("afrTrimRangeMax") == -1506146739, "varHash: afrTrimRangeMax");
+static_assert(varHash("afrTrimRangeMin") == -1506146485, "varHash: afrTrimRangeMin");
+static_assert(varHash("hasFaultReportFile") == -1502616231, "varHash: hasFaultReportFile");
+static_assert(varHash("primaryInjectorDisabled10") == -1501050240, "varHash: primaryInjectorDisabled10");
+static_assert(varHash("primaryInjectorDisabled11") == -1501050239, "varHash: primaryInjectorDisabled11");
+static_assert(varHash("primaryInjectorDisabled12") == -1501050238, "varHash: primaryInjectorDisabled12");
+static_assert(varHash("currentMafCorrection") == -1498628812, "varHash: currentMafCorrection");
+static_assert(varHash("luaHardSparkSkip") == -1498397570, "varHash: luaHardSparkSkip");
+static_assert(varHash("coastingFuelCutClt") == -1494053736, "varHash: coastingFuelCutClt");
+static_assert(varHash("coastingFuelCutMap") == -1494043213, "varHash: coastingFuelCutMap");
+static_assert(varHash("coastingFuelCutTps") == -1494035092, "varHash: coastingFuelCutTps");
+static_assert(varHash("mapaccaen") == -1493125058, "varHash: mapaccaen");
+static_assert(varHash("mapaccden") == -1493121791, "varHash: mapaccden");
+static_assert(varHash("idlelooksLikeCrankToIdle") == -1492749056, "varHash: idlelooksLikeCrankToIdle");
+static_assert(varHash("engineChartSize") == -1492464952, "varHash: engineChartSize");
+static_assert(varHash("isCylinderCleanupEnabled") == -1491889938, "varHash: isCylinderCleanupEnabled");
+static_assert(varHash("fan1radiatorFanStatus") == -1478067590, "varHash: fan1radiatorFanStatus");
+static_assert(varHash("boostisZeroRpm") == -1477802537, "varHash: boostisZeroRpm");
+static_assert(varHash("mafmapBlendPercentage") == -1471965894, "varHash: mafmapBlendPercentage");
+static_assert(varHash("rawMafFast") == -1469913327, "varHash: rawMafFast");
+static_assert(varHash("fordInjectorSmallPulseSlope") == -1465119085, "varHash: fordInjectorSmallPulseSlope");
+static_assert(varHash("shuttingDownMainRelay") == -1462001003, "varHash: shuttingDownMainRelay");
+static_assert(varHash("noFuelTrimAfterAccelTime") == -1460984893, "varHash: noFuelTrimAfterAccelTime");
+static_assert(varHash("oilTempSensor.config.tempC_1") == -1460957868, "varHash: oilTempSensor.config.tempC_1");
+static_assert(varHash("oilTempSensor.config.tempC_2") == -1460957867, "varHash: oilTempSensor.config.tempC_2");
+static_assert(varHash("oilTempSensor.config.tempC_3") == -1460957866, "varHash: oilTempSensor.config.tempC_3");
+static_assert(varHash("rawMapFast") == -1458054117, "varHash: rawMapFast");
+static_assert(varHash("predTimerResetCnt") == -1457567239, "varHash: predTimerResetCnt");
+static_assert(varHash("disableWaterPumpWhenStopped") == -1454971281, "varHash: disableWaterPumpWhenStopped");
+static_assert(varHash("brokenInjector") == -1453554940, "varHash: brokenInjector");
+static_assert(varHash("boostopenLoopPart") == -1448655345, "varHash: boostopenLoopPart");
+static_assert(varHash("starterState") == -1438648277, "varHash: starterState");
+static_assert(varHash("map.sensor.highValue") == -1434278346, "varHash: map.sensor.highValue");
+static_assert(varHash("actualLastInjectionStage2") == -1434098660, "varHash: actualLastInjectionStage2");
+static_assert(varHash("vvt2isynchronizationCounter") == -1432096142, "varHash: vvt2isynchronizationCounter");
+static_assert(varHash("cc_speedBandLow") == -1429499678, "varHash: cc_speedBandLow");
+static_assert(varHash("fastAdcOverrunCount") == -1422787851, "varHash: fastAdcOverrunCount");
+static_assert(varHash("etbStatus.output") == -1418343613, "varHash: etbStatus.output");
+static_assert(varHash("auxLinear1.v1") == -1415669996, "varHash: auxLinear1.v1");
+static_assert(varHash("auxLinear1.v2") == -1415669995, "varHash: auxLinear1.v2");
+static_assert(varHash("auxLinear2.v1") == -1415634059, "varHash: auxLinear2.v1");
+static_assert(varHash("auxLinear2.v2") == -1415634058, "varHash: auxLinear2.v2");
+static_assert(varHash("auxLinear3.v1") == -1415598122, "varHash: auxLinear3.v1");
+static_assert(varHash("auxLinear3.v2") == -1415598121, "varHash: auxLinear3.v2");
+static_assert(varHash("auxLinear4.v1") == -1415562185, "varHash: auxLinear4.v1");
+static_assert(varHash("auxLinear4.v2") == -1415562184, "varHash: auxLinear4.v2");
+static_assert(varHash("waterPumpcranking") == -1415434345, "varHash: waterPumpcranking");
+static_assert(varHash("idleTimingPid.pFactor") == -1411996731, "varHash: idleTimingPid.pFactor");
+static_assert(varHash("enableTrailingSparks") == -1409016614, "varHash: enableTrailingSparks");
+static_assert(varHash("ltft.enabled") == -1407066344, "varHash: ltft.enabled");
+static_assert(varHash("dynoCarWheelAspectRatio") == -1404613719, "varHash: dynoCarWheelAspectRatio");
+static_assert(varHash("ALSSkipRatio") == -1404414917, "varHash: ALSSkipRatio");
+static_assert(varHash("etbWastegatePid.minValue") == -1401426415, "varHash: etbWastegatePid.minValue");
+static_assert(varHash("idleisIacTableForCoasting") == -1397911341, "varHash: idleisIacTableForCoasting");
+static_assert(varHash("lua.fuelMult") == -1390672637, "varHash: lua.fuelMult");
+static_assert(varHash("isAnalogFailure") == -1383513733, "varHash: isAnalogFailure");
+static_assert(varHash("rawTps2Primary") == -1382627620, "varHash: rawTps2Primary");
+static_assert(varHash("retardThresholdRpm") == -1374156957, "varHash: retardThresholdRpm");
+static_assert(varHash("acrRevolutions") == -1373423899, "varHash: acrRevolutions");
+static_assert(varHash("fixedTiming") == -1359134883, "varHash: fixedTiming");
+static_assert(varHash("boostluaOpenLoopAdd") == -1358648093, "varHash: boostluaOpenLoopAdd");
+static_assert(varHash("distanceTraveled") == -1357387481, "varHash: distanceTraveled");
+static_assert(varHash("wheelspeedAvgError") == -1356218861, "varHash: wheelspeedAvgError");
+static_assert(varHash("isIgnitionEnabled") == -1354884979, "varHash: isIgnitionEnabled");
+static_assert(varHash("cruiseControlEnableTogglesState") == -1350791186, "varHash: cruiseControlEnableTogglesState");
+static_assert(varHash("lastErrorCode") == -1346040258, "varHash: lastErrorCode");
+static_assert(varHash("auxSpeedMult1") == -1345684809, "varHash: auxSpeedMult1");
+static_assert(varHash("auxSpeedMult2") == -1345684808, "varHash: auxSpeedMult2");
+static_assert(varHash("auxSpeedMult3") == -1345684807, "varHash: auxSpeedMult3");
+static_assert(varHash("auxSpeedMult4") == -1345684806, "varHash: auxSpeedMult4");
+static_assert(varHash("fastAdcErrorCount") == -1344436946, "varHash: fastAdcErrorCount");
+static_assert(varHash("dynoCarCarMassKg") == -1343193327, "varHash: dynoCarCarMassKg");
+static_assert(varHash("launchTpsThreshold") == -1340834204, "varHash: launchTpsThreshold");
+static_assert(varHash("injectorDutyCycleStage2") == -1337459841, "varHash: injectorDutyCycleStage2");
+static_assert(varHash("etb_use_two_wires") == -1334689362, "varHash: etb_use_two_wires");
+static_assert(varHash("invertVvtControlExhaust") == -1331668704, "varHash: invertVvtControlExhaust");
+static_assert(varHash("cc_kmhstep") == -1329176058, "varHash: cc_kmhstep");
+static_assert(varHash("orderingErrorCounter") == -1326404407, "varHash: orderingErrorCounter");
+static_assert(varHash("rawRawPpsSecondary") == -1318050732, "varHash: rawRawPpsSecondary");
+static_assert(varHash("tps1SecondaryMax") == -1312968741, "varHash: tps1SecondaryMax");
+static_assert(varHash("tps1SecondaryMin") == -1312968487, "varHash: tps1SecondaryMin");
+static_assert(varHash("vbattDividerCoeff") == -1311217456, "varHash: vbattDividerCoeff");
+static_assert(varHash("tracMinSpeed") == -1309366300, "varHash: tracMinSpeed");
+static_assert(varHash("map.sensor.lowValue") == -1307181880, "varHash: map.sensor.lowValue");
+static_assert(varHash("RealAFRValue") == -1305029825, "varHash: RealAFRValue");
+static_assert(varHash("oilTempSensor.config.resistance_1") == -1297544724, "varHash: oilTempSensor.config.resistance_1");
+static_assert(varHash("oilTempSensor.config.resistance_2") == -1297544723, "varHash: oilTempSensor.config.resistance_2");
+static_assert(varHash("oilTempSensor.config.resistance_3") == -1297544722, "varHash: oilTempSensor.config.resistance_3");
+static_assert(varHash("lua.brakePedalState") == -1296201087, "varHash: lua.brakePedalState");
+static_assert(varHash("running.postCrankingFuelCorrection") == -1288205717, "varHash: running.postCrankingFuelCorrection");
+static_assert(varHash("TMFPressureSplitPercentUp") == -1286234105, "varHash: TMFPressureSplitPercentUp");
+static_assert(varHash("fuelPumpPrimeDelay") == -1286084577, "varHash: fuelPumpPrimeDelay");
+static_assert(varHash("fuelTempSensor.config.bias_resistor") == -1285484724, "varHash: fuelTempSensor.config.bias_resistor");
+static_assert(varHash("useFordRedundantPps") == -1284359115, "varHash: useFordRedundantPps");
+static_assert(varHash("useFordRedundantTps") == -1284354759, "varHash: useFordRedundantTps");
+static_assert(varHash("accelEnX") == -1279670200, "varHash: accelEnX");
+static_assert(varHash("accelEnY") == -1279670199, "varHash: accelEnY");
+static_assert(varHash("accelEnZ") == -1279670198, "varHash: accelEnZ");
+static_assert(varHash("useTLE8888_cranking_hack") == -1279270887, "varHash: useTLE8888_cranking_hack");
+static_assert(varHash("rawOilTemperature") == -1278065791, "varHash: rawOilTemperature");
+static_assert(varHash("idlem_isIdlingOrTaper") == -1276540673, "varHash: idlem_isIdlingOrTaper");
+static_assert(varHash("mafLoad") == -1274887687, "varHash: mafLoad");
+static_assert(varHash("lambdaProtectionRestoreLoad") == -1274631759, "varHash: lambdaProtectionRestoreLoad");
+static_assert(varHash("idleidle_m_last_phase") == -1271797456, "varHash: idleidle_m_last_phase");
+static_assert(varHash("idle_derivativeFilterLoss") == -1269130308, "varHash: idle_derivativeFilterLoss");
+static_assert(varHash("mapFast") == -1263258735, "varHash: mapFast");
+static_assert(varHash("boostlwgDutyPct") == -1261602589, "varHash: boostlwgDutyPct");
+static_assert(varHash("wheelSlipRatioLeftRightREAR") == -1261314140, "varHash: wheelSlipRatioLeftRightREAR");
+static_assert(varHash("idlePositionMax") == -1256791970, "varHash: idlePositionMax");
+static_assert(varHash("idlePositionMin") == -1256791716, "varHash: idlePositionMin");
+static_assert(varHash("hpfpCamLobes") == -1256141959, "varHash: hpfpCamLobes");
+static_assert(varHash("alternatorStatus.resetCounter") == -1254008074, "varHash: alternatorStatus.resetCounter");
+static_assert(varHash("verboseTLE8888") == -1251676000, "varHash: verboseTLE8888");
+static_assert(varHash("mapPredEventOver") == -1250788372, "varHash: mapPredEventOver");
+static_assert(varHash("etb2etbTpsErrorCounter") == -1241003634, "varHash: etb2etbTpsErrorCounter");
+static_assert(varHash("epicCanEcuReadONLYONWrite") == -1240666085, "varHash: epicCanEcuReadONLYONWrite");
+static_assert(varHash("etb1jamDetected") == -1238909045, "varHash: etb1jamDetected");
+static_assert(varHash("injectorHwIssue") == -1237512821, "varHash: injectorHwIssue");
+static_assert(varHash("isEnabled0_int") == -1236599226, "varHash: isEnabled0_int");
+static_assert(varHash("measureMapOnlyInOneCylinder") == -1236202550, "varHash: measureMapOnlyInOneCylinder");
+static_assert(varHash("displacement") == -1227821282, "varHash: displacement");
+static_assert(varHash("mc33810spiErrorCounter") == -1225980502, "varHash: mc33810spiErrorCounter");
+static_assert(varHash("fuelCutReason") == -1225000603, "varHash: fuelCutReason");
+static_assert(varHash("sdAirmass") == -1211793460, "varHash: sdAirmass");
+static_assert(varHash("dwellClampPercent") == -1211547749, "varHash: dwellClampPercent");
+static_assert(varHash("dwellDurationAngle") == -1208021110, "varHash: dwellDurationAngle");
+static_assert(varHash("crankingFuel.coolantTemperatureCoefficient") == -1206067863, "varHash: crankingFuel.coolantTemperatureCoefficient");
+static_assert(varHash("tunedVeStrengthMultiplier") == -1202716522, "varHash: tunedVeStrengthMultiplier");
+static_assert(varHash("fan2PwmEnabled") == -1198455285, "varHash: fan2PwmEnabled");
+static_assert(varHash("nitrousFuelAdderPercent") == -1197734314, "varHash: nitrousFuelAdderPercent");
+static_assert(varHash("tunedMassAirflow") == -1196900531, "varHash: tunedMassAirflow");
+static_assert(varHash("enableAemXSeriesEgt") == -1196188030, "varHash: enableAemXSeriesEgt");
+static_assert(varHash("fuelTempSensor.config.resistance_1") == -1195844556, "varHash: fuelTempSensor.config.resistance_1");
+static_assert(varHash("fuelTempSensor.config.resistance_2") == -1195844555, "varHash: fuelTempSensor.config.resistance_2");
+static_assert(varHash("fuelTempSensor.config.resistance_3") == -1195844554, "varHash: fuelTempSensor.config.resistance_3");
+static_assert(varHash("enableOilPressureProtect") == -1194560694, "varHash: enableOilPressureProtect");
+static_assert(varHash("canBoxTracTrim") == -1191102746, "varHash: canBoxTracTrim");
+static_assert(varHash("boostPid.dFactor") == -1190930054, "varHash: boostPid.dFactor");
+static_assert(varHash("auxTempSensor1.config.bias_resistor") == -1189603841, "varHash: auxTempSensor1.config.bias_resistor");
+static_assert(varHash("stepperMaxDutyCycle") == -1188944476, "varHash: stepperMaxDutyCycle");
+static_assert(varHash("tpsFuelPumpPrimeThreshold") == -1185477196, "varHash: tpsFuelPumpPrimeThreshold");
+static_assert(varHash("acPressure.value1") == -1171243586, "varHash: acPressure.value1");
+static_assert(varHash("acPressure.value2") == -1171243585, "varHash: acPressure.value2");
+static_assert(varHash("m_deadtime") == -1167844818, "varHash: m_deadtime");
+static_assert(varHash("slowAdcOverrunCount") == -1166766772, "varHash: slowAdcOverrunCount");
+static_assert(varHash("engineRunTime") == -1165835361, "varHash: engineRunTime");
+static_assert(varHash("stftDeadBand") == -1165008919, "varHash: stftDeadBand");
+static_assert(varHash("useSpooledCurve") == -1164679347, "varHash: useSpooledCurve");
+static_assert(varHash("tpsAccelLookback") == -1164331270, "varHash: tpsAccelLookback");
+static_assert(varHash("instantMAPValue") == -1162308767, "varHash: instantMAPValue");
+static_assert(varHash("vvt1esynchronizationCounter") == -1159462771, "varHash: vvt1esynchronizationCounter");
+static_assert(varHash("ignitionFault") == -1158382750, "varHash: ignitionFault");
+static_assert(varHash("tuneCrc16") == -1158359776, "varHash: tuneCrc16");
+static_assert(varHash("disableFuelCutOnClutch") == -1151782223, "varHash: disableFuelCutOnClutch");
+static_assert(varHash("stepperMinDutyCycle") == -1147263902, "varHash: stepperMinDutyCycle");
+static_assert(varHash("stage1InjSmallPwActive") == -1147127033, "varHash: stage1InjSmallPwActive");
+static_assert(varHash("canButtons916") == -1143036666, "varHash: canButtons916");
+static_assert(varHash("epic_hall_inp10") == -1141274643, "varHash: epic_hall_inp10");
+static_assert(varHash("ignBlend1BlendMode") == -1140650813, "varHash: ignBlend1BlendMode");
+static_assert(varHash("knockm_knockRetard") == -1133692001, "varHash: knockm_knockRetard");
+static_assert(varHash("disableFan1WhenStopped") == -1132710384, "varHash: disableFan1WhenStopped");
+static_assert(varHash("ltftEnableAutoSave") == -1129280050, "varHash: ltftEnableAutoSave");
+static_assert(varHash("tChargeAirIncrLimit") == -1128797750, "varHash: tChargeAirIncrLimit");
+static_assert(varHash("coilState1") == -1124698530, "varHash: coilState1");
+static_assert(varHash("coilState2") == -1124698529, "varHash: coilState2");
+static_assert(varHash("coilState3") == -1124698528, "varHash: coilState3");
+static_assert(varHash("coilState4") == -1124698527, "varHash: coilState4");
+static_assert(varHash("coilState5") == -1124698526, "varHash: coilState5");
+static_assert(varHash("coilState6") == -1124698525, "varHash: coilState6");
+static_assert(varHash("coilState7") == -1124698524, "varHash: coilState7");
+static_assert(varHash("coilState8") == -1124698523, "varHash: coilState8");
+static_assert(varHash("coilState9") == -1124698522, "varHash: coilState9");
+static_assert(varHash("maxCylindersCount") == -1121907071, "varHash: maxCylindersCount");
+static_assert(varHash("dynoCarCoeffOfDrag") == -1121870933, "varHash: dynoCarCoeffOfDrag");
+static_assert(varHash("lambdaValue") == -1119268893, "varHash: lambdaValue");
+static_assert(varHash("tpsFuelPumpPrimeDuration") == -1118660179, "varHash: tpsFuelPumpPrimeDuration");
+static_assert(varHash("alsMinTimeBetween") == -1118241790, "varHash: alsMinTimeBetween");
+static_assert(varHash("luaSoftSparkSkip") == -1117430949, "varHash: luaSoftSparkSkip");
+static_assert(varHash("afrError") == -1112972888, "varHash: afrError");
+static_assert(varHash("alternatorStatus.dTerm") == -1111560081, "varHash: alternatorStatus.dTerm");
+static_assert(varHash("alternatorStatus.error") == -1110431971, "varHash: alternatorStatus.error");
+static_assert(varHash("tpsAccelExtraShot") == -1108794410, "varHash: tpsAccelExtraShot");
+static_assert(varHash("alternatorStatus.iTerm") == -1105630476, "varHash: alternatorStatus.iTerm");
+static_assert(varHash("auxTempSensor1.config.tempC_1") == -1104834801, "varHash: auxTempSensor1.config.tempC_1");
+static_assert(varHash("auxTempSensor1.config.tempC_2") == -1104834800, "varHash: auxTempSensor1.config.tempC_2");
+static_assert(varHash("auxTempSensor1.config.tempC_3") == -1104834799, "varHash: auxTempSensor1.config.tempC_3");
+static_assert(varHash("alternatorStatus.pTerm") == -1097329029, "varHash: alternatorStatus.pTerm");
+static_assert(varHash("AFRValue") == -1093429509, "varHash: AFRValue");
+static_assert(varHash("cutSparkOnHardLimit") == -1087585075, "varHash: cutSparkOnHardLimit");
+static_assert(varHash("dynoRpmStep") == -1085712470, "varHash: dynoRpmStep");
+static_assert(varHash("ambientTempSensor.config.resistance_1") == -1084296600, "varHash: ambientTempSensor.config.resistance_1");
+static_assert(varHash("ambientTempSensor.config.resistance_2") == -1084296599, "varHash: ambientTempSensor.config.resistance_2");
+static_assert(varHash("ambientTempSensor.config.resistance_3") == -1084296598, "varHash: ambientTempSensor.config.resistance_3");
+static_assert(varHash("mapHighValueVoltage") == -1084262094, "varHash: mapHighValueVoltage");
+static_assert(varHash("fuelTemp") == -1077373465, "varHash: fuelTemp");
+static_assert(varHash("idleStepperTotalSteps") == -1077032999, "varHash: idleStepperTotalSteps");
+static_assert(varHash("isMapPreAveraging") == -1074514630, "varHash: isMapPreAveraging");
+static_assert(varHash("multisparkEnable") == -1074393096, "varHash: multisparkEnable");
+static_assert(varHash("verboseCan") == -1073210355, "varHash: verboseCan");
+static_assert(varHash("ignBlend2BlendMode") == -1072849436, "varHash: ignBlend2BlendMode");
+static_assert(varHash("waterPumpnotRunning") == -1067105700, "varHash: waterPumpnotRunning");
+static_assert(varHash("canButtonToggle1") == -1065713562, "varHash: canButtonToggle1");
+static_assert(varHash("canButtonToggle2") == -1065713561, "varHash: canButtonToggle2");
+static_assert(varHash("canButtonToggle3") == -1065713560, "varHash: canButtonToggle3");
+static_assert(varHash("canButtonToggle4") == -1065713559, "varHash: canButtonToggle4");
+static_assert(varHash("canButtonToggle5") == -1065713558, "varHash: canButtonToggle5");
+static_assert(varHash("canButtonToggle6") == -1065713557, "varHash: canButtonToggle6");
+static_assert(varHash("canButtonToggle7") == -1065713556, "varHash: canButtonToggle7");
+static_assert(varHash("canButtonToggle8") == -1065713555, "varHash: canButtonToggle8");
+static_assert(varHash("canButtonToggle9") == -1065713554, "varHash: canButtonToggle9");
+static_assert(varHash("etb2adjustedEtbTarget") == -1063282840, "varHash: etb2adjustedEtbTarget");
+static_assert(varHash("vvt2ivvtCurrentPosition") == -1062352104, "varHash: vvt2ivvtCurrentPosition");
+static_assert(varHash("auxLinear4.value1") == -1058844738, "varHash: auxLinear4.value1");
+static_assert(varHash("auxLinear4.value2") == -1058844737, "varHash: auxLinear4.value2");
+static_assert(varHash("verboseCan2") == -1056203297, "varHash: verboseCan2");
+static_assert(varHash("turboSpeedSensorMultiplier") == -1056007485, "varHash: turboSpeedSensorMultiplier");
+static_assert(varHash("verboseQuad") == -1055678778, "varHash: verboseQuad");
+static_assert(varHash("harleyAcrSprayFuel") == -1053347749, "varHash: harleyAcrSprayFuel");
+static_assert(varHash("rawTps1Primary") == -1051397637, "varHash: rawTps1Primary");
+static_assert(varHash("baroHasPressure") == -1049398690, "varHash: baroHasPressure");
+static_assert(varHash("etb1etbCurrentTarget") == -1044288778, "varHash: etb1etbCurrentTarget");
+static_assert(varHash("useBiQuadOnWheelSpeedSensors1") == -1040875351, "varHash: useBiQuadOnWheelSpeedSensors1");
+static_assert(varHash("useBiQuadOnWheelSpeedSensors2") == -1040875350, "varHash: useBiQuadOnWheelSpeedSensors2");
+static_assert(varHash("useBiQuadOnWheelSpeedSensors3") == -1040875349, "varHash: useBiQuadOnWheelSpeedSensors3");
+static_assert(varHash("useBiQuadOnWheelSpeedSensors4") == -1040875348, "varHash: useBiQuadOnWheelSpeedSensors4");
+static_assert(varHash("fordInjectorSmallPulseBreakPoint") == -1032938305, "varHash: fordInjectorSmallPulseBreakPoint");
+static_assert(varHash("canBoxTracTrimMax") == -1015189044, "varHash: canBoxTracTrimMax");
+static_assert(varHash("canBoxTracTrimMin") == -1015188790, "varHash: canBoxTracTrimMin");
+static_assert(varHash("iat.config.resistance_1") == -1014418506, "varHash: iat.config.resistance_1");
+static_assert(varHash("iat.config.resistance_2") == -1014418505, "varHash: iat.config.resistance_2");
+static_assert(varHash("iat.config.resistance_3") == -1014418504, "varHash: iat.config.resistance_3");
+static_assert(varHash("ecumasterEgtToCanBaseId") == -1012476149, "varHash: ecumasterEgtToCanBaseId");
+static_assert(varHash("useSpiImu") == -1011866871, "varHash: useSpiImu");
+static_assert(varHash("idleRpmPid.minValue") == -1009116322, "varHash: idleRpmPid.minValue");
+static_assert(varHash("can_call_found_func") == -1008823912, "varHash: can_call_found_func");
+static_assert(varHash("ltitEmaAlpha") == -1008029221, "varHash: ltitEmaAlpha");
+static_assert(varHash("etb1etbErrorCodeBlinker") == -1007205736, "varHash: etb1etbErrorCodeBlinker");
+static_assert(varHash("transitionEventCode") == -1006487219, "varHash: transitionEventCode");
+static_assert(varHash("uartConsoleSerialSpeed") == -999870619, "varHash: uartConsoleSerialSpeed");
+static_assert(varHash("tpsAeUseDynamicThreshold") == -999819551, "varHash: tpsAeUseDynamicThreshold");
+static_assert(varHash("waterPumpOnTemperature") == -998567403, "varHash: waterPumpOnTemperature");
+static_assert(varHash("idleidleTargetError") == -993302478, "varHash: idleidleTargetError");
+static_assert(varHash("etb.minValue") == -991890097, "varHash: etb.minValue");
+static_assert(varHash("mafmapAirmassSplit") == -988986989, "varHash: mafmapAirmassSplit");
+static_assert(varHash("mapVvt_min_point_counter") == -983339026, "varHash: mapVvt_min_point_counter");
+static_assert(varHash("launchFuelCutEnable") == -980843809, "varHash: launchFuelCutEnable");
+static_assert(varHash("isValidInputPin") == -978523544, "varHash: isValidInputPin");
+static_assert(varHash("assistedEtbMaxPct") == -975349491, "varHash: assistedEtbMaxPct");
+static_assert(varHash("rpmAcceleration") == -968092482, "varHash: rpmAcceleration");
+static_assert(varHash("assistedEtbMinPct") == -966221493, "varHash: assistedEtbMinPct");
+static_assert(varHash("minAcPressure") == -965637402, "varHash: minAcPressure");
+static_assert(varHash("tpsDecelEnleanmentThreshold") == -965453331, "varHash: tpsDecelEnleanmentThreshold");
+static_assert(varHash("startStopStateToggleCounter") == -960645892, "varHash: startStopStateToggleCounter");
+static_assert(varHash("boostboostControlTarget") == -955735749, "varHash: boostboostControlTarget");
+static_assert(varHash("dtTuneInjModeOverride") == -955291041, "varHash: dtTuneInjModeOverride");
+static_assert(varHash("launchSmoothRetard") == -954321508, "varHash: launchSmoothRetard");
+static_assert(varHash("triggerCompSensorSatRpm") == -953183719, "varHash: triggerCompSensorSatRpm");
+static_assert(varHash("boostPid.periodMs") == -945021094, "varHash: boostPid.periodMs");
+static_assert(varHash("fallbackMap") == -940825965, "varHash: fallbackMap");
+static_assert(varHash("knockRetardReapplyRate") == -938609466, "varHash: knockRetardReapplyRate");
+static_assert(varHash("nitrousisNitrousRpmCondition") == -938324001, "varHash: nitrousisNitrousRpmCondition");
+static_assert(varHash("vvt1etriggerCountersError") == -937296564, "varHash: vvt1etriggerCountersError");
+static_assert(varHash("antiLagEnabled") == -933524784, "varHash: antiLagEnabled");
+static_assert(varHash("nitrousisNitrousCondition") == -930632752, "varHash: nitrousisNitrousCondition");
+static_assert(varHash("mcp3208vref") == -929600315, "varHash: mcp3208vref");
+static_assert(varHash("nitrousisNitrousArmed") == -924260494, "varHash: nitrousisNitrousArmed");
+static_assert(varHash("currentInjectionMode") == -921867120, "varHash: currentInjectionMode");
+static_assert(varHash("boostm_shouldResetPid") == -921746905, "varHash: boostm_shouldResetPid");
+static_assert(varHash("useStepperIdle") == -920116109, "varHash: useStepperIdle");
+static_assert(varHash("pressureCorrectionReference") == -917305595, "varHash: pressureCorrectionReference");
+static_assert(varHash("injAdvAssistEndDeg") == -914016449, "varHash: injAdvAssistEndDeg");
+static_assert(varHash("disableEGT") == -911109767, "varHash: disableEGT");
+static_assert(varHash("acRelayAlternatorDutyAdder") == -908268760, "varHash: acRelayAlternatorDutyAdder");
+static_assert(varHash("launchFuelAdderPercent") == -904771683, "varHash: launchFuelAdderPercent");
+static_assert(varHash("dtTuneCycles") == -904485188, "varHash: dtTuneCycles");
+static_assert(varHash("sparkDwell") == -903101570, "varHash: sparkDwell");
+static_assert(varHash("auxTempSensor2.config.tempC_1") == -900025104, "varHash: auxTempSensor2.config.tempC_1");
+static_assert(varHash("auxTempSensor2.config.tempC_2") == -900025103, "varHash: auxTempSensor2.config.tempC_2");
+static_assert(varHash("auxTempSensor2.config.tempC_3") == -900025102, "varHash: auxTempSensor2.config.tempC_3");
+static_assert(varHash("tractionAdvanceDrop") == -899895696, "varHash: tractionAdvanceDrop");
+static_assert(varHash("enableSlipCalculations") == -897907098, "varHash: enableSlipCalculations");
+static_assert(varHash("MAPPREValue") == -893849209, "varHash: MAPPREValue");
+static_assert(varHash("mc33_t_peak_off") == -893360504, "varHash: mc33_t_peak_off");
+static_assert(varHash("mc33_t_peak_tot") == -893354748, "varHash: mc33_t_peak_tot");
+static_assert(varHash("sd.tCharge") == -893334680, "varHash: sd.tCharge");
+static_assert(varHash("usbBytesOutPerSec") == -885587728, "varHash: usbBytesOutPerSec");
+static_assert(varHash("internalMcuTemperature") == -871891659, "varHash: internalMcuTemperature");
+static_assert(varHash("finalGearRatio") == -869432403, "varHash: finalGearRatio");
+static_assert(varHash("CLBoostBlend1BlendMode") == -868970149, "varHash: CLBoostBlend1BlendMode");
+static_assert(varHash("etbWastegatePid.dFactor") == -866520333, "varHash: etbWastegatePid.dFactor");
+static_assert(varHash("minOilPressureAfterStart") == -855687130, "varHash: minOilPressureAfterStart");
+static_assert(varHash("fan1cold") == -855279955, "varHash: fan1cold");
+static_assert(varHash("sparkHardwareLatencyCorrectionCurveCurveUnits") == -854707527, "varHash: sparkHardwareLatencyCorrectionCurveCurveUnits");
+static_assert(varHash("fan2cold") == -854094034, "varHash: fan2cold");
+static_assert(varHash("fanOnTemperature") == -853358747, "varHash: fanOnTemperature");
+static_assert(varHash("STFTResetRegionChange") == -848735021, "varHash: STFTResetRegionChange");
+static_assert(varHash("canVssScaling") == -846143628, "varHash: canVssScaling");
+static_assert(varHash("tpsErrorDetectionTooHigh") == -838808073, "varHash: tpsErrorDetectionTooHigh");
+static_assert(varHash("lastCanButtonFoundIdx") == -838175736, "varHash: lastCanButtonFoundIdx");
+static_assert(varHash("etb2targetWithIdlePosition") == -836653176, "varHash: etb2targetWithIdlePosition");
+static_assert(varHash("tachSweepMax") == -829513073, "varHash: tachSweepMax");
+static_assert(varHash("canReWidebandCmdStatus") == -823915964, "varHash: canReWidebandCmdStatus");
+static_assert(varHash("limitTorqueReductionTime") == -819413824, "varHash: limitTorqueReductionTime");
+static_assert(varHash("heaterControlEnabled") == -818268726, "varHash: heaterControlEnabled");
+static_assert(varHash("etb2m_lastPidDtMs") == -813957817, "varHash: etb2m_lastPidDtMs");
+static_assert(varHash("canButtonToggle10") == -808809130, "varHash: canButtonToggle10");
+static_assert(varHash("canButtonToggle11") == -808809129, "varHash: canButtonToggle11");
+static_assert(varHash("canButtonToggle12") == -808809128, "varHash: canButtonToggle12");
+static_assert(varHash("canButtonToggle13") == -808809127, "varHash: canButtonToggle13");
+static_assert(varHash("canButtonToggle14") == -808809126, "varHash: canButtonToggle14");
+static_assert(varHash("canButtonToggle15") == -808809125, "varHash: canButtonToggle15");
+static_assert(varHash("canButtonToggle16") == -808809124, "varHash: canButtonToggle16");
+static_assert(varHash("slowAdcErrorCount") == -807823931, "varHash: slowAdcErrorCount");
+static_assert(varHash("lua.luaIgnCut") == -802271455, "varHash: lua.luaIgnCut");
+static_assert(varHash("rawAuxTemp1") == -801974332, "varHash: rawAuxTemp1");
+static_assert(varHash("rawAuxTemp2") == -801974331, "varHash: rawAuxTemp2");
+static_assert(varHash("clutchUpState") == -797965330, "varHash: clutchUpState");
+static_assert(varHash("speedoSweepTime") == -794631784, "varHash: speedoSweepTime");
+static_assert(varHash("cutFuelOnHardLimit") == -794334344, "varHash: cutFuelOnHardLimit");
+static_assert(varHash("running.fuel") == -794283008, "varHash: running.fuel");
+static_assert(varHash("watchDogBuddy") == -793811890, "varHash: watchDogBuddy");
+static_assert(varHash("etbJamDetectThreshold") == -791880034, "varHash: etbJamDetectThreshold");
+static_assert(varHash("idealEngineTorque") == -791713926, "varHash: idealEngineTorque");
+static_assert(varHash("acrEngineMovedRecently") == -791147982, "varHash: acrEngineMovedRecently");
+static_assert(varHash("etbMaximumPosition") == -786901709, "varHash: etbMaximumPosition");
+static_assert(varHash("mc33810Gpgd0Mode") == -785386645, "varHash: mc33810Gpgd0Mode");
+static_assert(varHash("mc33810Gpgd1Mode") == -784200724, "varHash: mc33810Gpgd1Mode");
+static_assert(varHash("mc33810Gpgd2Mode") == -783014803, "varHash: mc33810Gpgd2Mode");
+static_assert(varHash("mc33810Gpgd3Mode") == -781828882, "varHash: mc33810Gpgd3Mode");
+static_assert(varHash("idleiacByTpsTaper") == -776487010, "varHash: idleiacByTpsTaper");
+static_assert(varHash("ignTableSwitch1Active") == -776108566, "varHash: ignTableSwitch1Active");
+static_assert(varHash("launchRpm") == -776106289, "varHash: launchRpm");
+static_assert(varHash("multisparkMaxRpm") == -775882810, "varHash: multisparkMaxRpm");
+static_assert(varHash("rpmPreLaunchCondition") == -774592003, "varHash: rpmPreLaunchCondition");
+static_assert(varHash("sdCardLogFrequency") == -773841334, "varHash: sdCardLogFrequency");
+static_assert(varHash("triggerScopeReady") == -770506808, "varHash: triggerScopeReady");
+static_assert(varHash("torqueReductionArmingApp") == -763838959, "varHash: torqueReductionArmingApp");
+static_assert(varHash("torqueReductionArmingRpm") == -763820449, "varHash: torqueReductionArmingRpm");
+static_assert(varHash("assistedEtbRotate") == -763229169, "varHash: assistedEtbRotate");
+static_assert(varHash("etb1adjustedEtbTarget") == -762743481, "varHash: etb1adjustedEtbTarget");
+static_assert(varHash("cc_rpmstep") == -755499083, "varHash: cc_rpmstep");
+static_assert(varHash("cc_maxEtbAdjustmentOpen") == -751355172, "varHash: cc_maxEtbAdjustmentOpen");
+static_assert(varHash("useCustomIATSensor") == -750525467, "varHash: useCustomIATSensor");
+static_assert(varHash("instantRpmRange") == -748456478, "varHash: instantRpmRange");
+static_assert(varHash("coolant") == -746111499, "varHash: coolant");
+static_assert(varHash("wheelspeedFLerror") == -744843641, "varHash: wheelspeedFLerror");
+static_assert(varHash("dfcoTimingRetard") == -735105365, "varHash: dfcoTimingRetard");
+static_assert(varHash("targetLambda") == -734904659, "varHash: targetLambda");
+static_assert(varHash("canReWidebandFwYear") == -734820550, "varHash: canReWidebandFwYear");
+static_assert(varHash("alsEtbPosition") == -731677323, "varHash: alsEtbPosition");
+static_assert(varHash("ppsSecondaryMaximum") == -727657058, "varHash: ppsSecondaryMaximum");
+static_assert(varHash("auxLinear3.value1") == -727614755, "varHash: auxLinear3.value1");
+static_assert(varHash("auxLinear3.value2") == -727614754, "varHash: auxLinear3.value2");
+static_assert(varHash("isWaveAnalyzerEnabled") == -726159643, "varHash: isWaveAnalyzerEnabled");
+static_assert(varHash("useMapEstimateDuringTransient") == -725051987, "varHash: useMapEstimateDuringTransient");
+static_assert(varHash("is_enabled_spi_1") == -722238362, "varHash: is_enabled_spi_1");
+static_assert(varHash("is_enabled_spi_2") == -722238361, "varHash: is_enabled_spi_2");
+static_assert(varHash("is_enabled_spi_3") == -722238360, "varHash: is_enabled_spi_3");
+static_assert(varHash("is_enabled_spi_4") == -722238359, "varHash: is_enabled_spi_4");
+static_assert(varHash("is_enabled_spi_5") == -722238358, "varHash: is_enabled_spi_5");
+static_assert(varHash("is_enabled_spi_6") == -722238357, "varHash: is_enabled_spi_6");
+static_assert(varHash("ignitionDisabled10") == -721709665, "varHash: ignitionDisabled10");
+static_assert(varHash("ignitionDisabled11") == -721709664, "varHash: ignitionDisabled11");
+static_assert(varHash("ignitionDisabled12") == -721709663, "varHash: ignitionDisabled12");
+static_assert(varHash("fuelTempSensor.config.tempC_1") == -713764196, "varHash: fuelTempSensor.config.tempC_1");
+static_assert(varHash("fuelTempSensor.config.tempC_2") == -713764195, "varHash: fuelTempSensor.config.tempC_2");
+static_assert(varHash("fuelTempSensor.config.tempC_3") == -713764194, "varHash: fuelTempSensor.config.tempC_3");
+static_assert(varHash("brakePedalState") == -705383759, "varHash: brakePedalState");
+static_assert(varHash("requireFootOnBrakeToCrank") == -703903346, "varHash: requireFootOnBrakeToCrank");
+static_assert(varHash("vvt1etriggerSyncGapRatio") == -700740893, "varHash: vvt1etriggerSyncGapRatio");
+static_assert(varHash("throttlePedalSecondaryWOTVoltage") == -699822859, "varHash: throttlePedalSecondaryWOTVoltage");
+static_assert(varHash("mc33810Maxi") == -695395485, "varHash: mc33810Maxi");
+static_assert(varHash("mc33810Nomi") == -695344665, "varHash: mc33810Nomi");
+static_assert(varHash("useCustomOTSensor") == -694434518, "varHash: useCustomOTSensor");
+static_assert(varHash("tpsAccelAeEnabled") == -687006075, "varHash: tpsAccelAeEnabled");
+static_assert(varHash("speedToRpmRatio") == -685727673, "varHash: speedToRpmRatio");
+static_assert(varHash("idlelooksLikeRunning") == -678234383, "varHash: idlelooksLikeRunning");
+static_assert(varHash("isMapPreValid") == -677882442, "varHash: isMapPreValid");
+static_assert(varHash("nitrousMaximumAfr") == -677584112, "varHash: nitrousMaximumAfr");
+static_assert(varHash("nitrousMaximumMap") == -677571211, "varHash: nitrousMaximumMap");
+static_assert(varHash("rawIdlePositionSensor") == -677561380, "varHash: rawIdlePositionSensor");
+static_assert(varHash("iat.config.tempC_1") == -672272162, "varHash: iat.config.tempC_1");
+static_assert(varHash("iat.config.tempC_2") == -672272161, "varHash: iat.config.tempC_2");
+static_assert(varHash("iat.config.tempC_3") == -672272160, "varHash: iat.config.tempC_3");
+static_assert(varHash("startUpFuelPumpDuration") == -664540020, "varHash: startUpFuelPumpDuration");
+static_assert(varHash("fan1enabledForAc") == -662113279, "varHash: fan1enabledForAc");
+static_assert(varHash("instantRpm") == -658597643, "varHash: instantRpm");
+static_assert(varHash("tractionControlEnabled") == -657551755, "varHash: tractionControlEnabled");
+static_assert(varHash("throttlePressureRatio") == -654466797, "varHash: throttlePressureRatio");
+static_assert(varHash("clt.config.bias_resistor") == -653172717, "varHash: clt.config.bias_resistor");
+static_assert(varHash("can_blend_clboost_1_toggle") == -652705567, "varHash: can_blend_clboost_1_toggle");
+static_assert(varHash("canBoxTracTrim1") == -651684905, "varHash: canBoxTracTrim1");
+static_assert(varHash("canBoxTracTrim2") == -651684904, "varHash: canBoxTracTrim2");
+static_assert(varHash("canBoxTracTrim3") == -651684903, "varHash: canBoxTracTrim3");
+static_assert(varHash("canBoxTracTrim4") == -651684902, "varHash: canBoxTracTrim4");
+static_assert(varHash("useTLE8888_stepper") == -647008743, "varHash: useTLE8888_stepper");
+static_assert(varHash("waterPumpbrokenClt") == -642676914, "varHash: waterPumpbrokenClt");
+static_assert(varHash("canOpenBLT") == -631762165, "varHash: canOpenBLT");
+static_assert(varHash("lowFuelPressure") == -628741220, "varHash: lowFuelPressure");
+static_assert(varHash("idleshouldResetPid") == -628192270, "varHash: idleshouldResetPid");
+static_assert(varHash("dfcoActive") == -622949795, "varHash: dfcoActive");
+static_assert(varHash("torqueReductionEnabled") == -618104323, "varHash: torqueReductionEnabled");
+static_assert(varHash("isForcedInduction") == -617915487, "varHash: isForcedInduction");
+static_assert(varHash("nitrousIgnitionRetard") == -617548836, "varHash: nitrousIgnitionRetard");
+static_assert(varHash("injAdvAssistMaxRpm") == -615615923, "varHash: injAdvAssistMaxRpm");
+static_assert(varHash("enableFan1") == -614923438, "varHash: enableFan1");
+static_assert(varHash("enableFan2") == -614923437, "varHash: enableFan2");
+static_assert(varHash("fan1brokenClt") == -614909137, "varHash: fan1brokenClt");
+static_assert(varHash("oilPressure.v1") == -613392361, "varHash: oilPressure.v1");
+static_assert(varHash("oilPressure.v2") == -613392360, "varHash: oilPressure.v2");
+static_assert(varHash("m_isPriming") == -612624925, "varHash: m_isPriming");
+static_assert(varHash("vvt1isynchronizationCounter") == -608535663, "varHash: vvt1isynchronizationCounter");
+static_assert(varHash("tChargeMaxRpmMaxTps") == -608466667, "varHash: tChargeMaxRpmMaxTps");
+static_assert(varHash("cc_maxThrottlePedalAllowedToStayEngaged") == -607443421, "varHash: cc_maxThrottlePedalAllowedToStayEngaged");
+static_assert(varHash("injAdvAssistMinRpm") == -606487925, "varHash: injAdvAssistMinRpm");
+static_assert(varHash("cruiseControlUseVehicleSpeed") == -606276593, "varHash: cruiseControlUseVehicleSpeed");
+static_assert(varHash("idleveTableYAxis") == -605416844, "varHash: idleveTableYAxis");
+static_assert(varHash("trgvvtToothDurations0") == -601476695, "varHash: trgvvtToothDurations0");
+static_assert(varHash("idletargetRpmAc") == -601080675, "varHash: idletargetRpmAc");
+static_assert(varHash("useInjSmallPulseWidth1") == -600460986, "varHash: useInjSmallPulseWidth1");
+static_assert(varHash("useInjSmallPulseWidth2") == -600460985, "varHash: useInjSmallPulseWidth2");
+static_assert(varHash("tChargeMaxRpmMinTps") == -599338669, "varHash: tChargeMaxRpmMinTps");
+static_assert(varHash("idleidleTargetAirmass") == -597849544, "varHash: idleidleTargetAirmass");
+static_assert(varHash("cc_speedDeadBandHigh") == -594545570, "varHash: cc_speedDeadBandHigh");
+static_assert(varHash("ignitionDwellForCrankingMs") == -589710926, "varHash: ignitionDwellForCrankingMs");
+static_assert(varHash("invertPrimaryTriggerSignal") == -587700301, "varHash: invertPrimaryTriggerSignal");
+static_assert(varHash("flexEnabled") == -584588097, "varHash: flexEnabled");
+static_assert(varHash("nitrousControlEnabled") == -582951931, "varHash: nitrousControlEnabled");
+static_assert(varHash("etb2validPlantPosition") == -575702922, "varHash: etb2validPlantPosition");
+static_assert(varHash("boostPid.maxValue") == -572500550, "varHash: boostPid.maxValue");
+static_assert(varHash("getAirmassImpl_temp_c") == -572387970, "varHash: getAirmassImpl_temp_c");
+static_assert(varHash("idle.solenoidFrequency") == -568903712, "varHash: idle.solenoidFrequency");
+static_assert(varHash("tChargeMinRpmMaxTps") == -566786093, "varHash: tChargeMinRpmMaxTps");
+static_assert(varHash("disableFan1WhenStoppedTimeout") == -566251913, "varHash: disableFan1WhenStoppedTimeout");
+static_assert(varHash("flexCranking") == -563973567, "varHash: flexCranking");
+static_assert(varHash("mapMinBufferLength") == -561715997, "varHash: mapMinBufferLength");
+static_assert(varHash("maxLockedDuration") == -558968637, "varHash: maxLockedDuration");
+static_assert(varHash("tChargeMinRpmMinTps") == -557658095, "varHash: tChargeMinRpmMinTps");
+static_assert(varHash("enableKnockSpectrogram") == -556893719, "varHash: enableKnockSpectrogram");
+static_assert(varHash("TMFPressureSplitPercentDown") == -550209830, "varHash: TMFPressureSplitPercentDown");
+static_assert(varHash("fan2brokenClt") == -547107760, "varHash: fan2brokenClt");
+static_assert(varHash("rpmSoftLimitTimingRetard") == -543684839, "varHash: rpmSoftLimitTimingRetard");
+static_assert(varHash("boostisTpsInvalid") == -543204250, "varHash: boostisTpsInvalid");
+static_assert(varHash("egoLowPassCutoffHz") == -537122990, "varHash: egoLowPassCutoffHz");
+static_assert(varHash("dtTuneMinRpm") == -531703796, "varHash: dtTuneMinRpm");
+static_assert(varHash("vvt2etriggerStateIndex") == -530001975, "varHash: vvt2etriggerStateIndex");
+static_assert(varHash("idlePidRpmDeadZone") == -528043591, "varHash: idlePidRpmDeadZone");
+static_assert(varHash("canReadEnabled") == -528008450, "varHash: canReadEnabled");
+static_assert(varHash("idle_antiwindupFreq") == -524949197, "varHash: idle_antiwindupFreq");
+static_assert(varHash("stft.minLambda") == -524812679, "varHash: stft.minLambda");
+static_assert(varHash("disableMCP3208") == -521053722, "varHash: disableMCP3208");
+static_assert(varHash("smartChipState") == -517673231, "varHash: smartChipState");
+static_assert(varHash("VssAcceleration") == -513494613, "varHash: VssAcceleration");
+static_assert(varHash("etb2integralError") == -513216302, "varHash: etb2integralError");
+static_assert(varHash("speedoSweepUsesSpeedoCorrection") == -513211487, "varHash: speedoSweepUsesSpeedoCorrection");
+static_assert(varHash("fan2AcAdder") == -511528784, "varHash: fan2AcAdder");
+static_assert(varHash("wheelspeedFRerror") == -510031283, "varHash: wheelspeedFRerror");
+static_assert(varHash("stepperParkingExtraSteps") == -509113657, "varHash: stepperParkingExtraSteps");
+static_assert(varHash("ignKeyAdcDivider") == -506535813, "varHash: ignKeyAdcDivider");
+static_assert(varHash("oilPressure.value1") == -505257058, "varHash: oilPressure.value1");
+static_assert(varHash("oilPressure.value2") == -505257057, "varHash: oilPressure.value2");
+static_assert(varHash("can_blend_ign_2_toggle") == -501215062, "varHash: can_blend_ign_2_toggle");
+static_assert(varHash("compressorDischargeTemperature.config.tempC_1") == -498450107, "varHash: compressorDischargeTemperature.config.tempC_1");
+static_assert(varHash("compressorDischargeTemperature.config.tempC_2") == -498450106, "varHash: compressorDischargeTemperature.config.tempC_2");
+static_assert(varHash("compressorDischargeTemperature.config.tempC_3") == -498450105, "varHash: compressorDischargeTemperature.config.tempC_3");
+static_assert(varHash("vssFilterReciprocal") == -495855925, "varHash: vssFilterReciprocal");
+static_assert(varHash("waterPumpOffTemperature") == -492231789, "varHash: waterPumpOffTemperature");
+static_assert(varHash("assistedEtbTuningEnabled") == -491789856, "varHash: assistedEtbTuningEnabled");
+static_assert(varHash("idlemustResetPid") == -488166228, "varHash: idlemustResetPid");
+static_assert(varHash("verboseIsoTp") == -487204662, "varHash: verboseIsoTp");
+static_assert(varHash("mc33_t_max_boost") == -486240071, "varHash: mc33_t_max_boost");
+static_assert(varHash("verboseKLine") == -485091122, "varHash: verboseKLine");
+static_assert(varHash("lowPressureFuel.v1") == -474791503, "varHash: lowPressureFuel.v1");
+static_assert(varHash("lowPressureFuel.v2") == -474791502, "varHash: lowPressureFuel.v2");
+static_assert(varHash("nitrousActivationRpm") == -469950118, "varHash: nitrousActivationRpm");
+static_assert(varHash("stft.cell.timeConstant") == -465369765, "varHash: stft.cell.timeConstant");
+static_assert(varHash("mc33810DisableRecoveryMode") == -464979268, "varHash: mc33810DisableRecoveryMode");
+static_assert(varHash("idleRpmPid.dFactor") == -464180576, "varHash: idleRpmPid.dFactor");
+static_assert(varHash("forceIdleBelowTpsThreshold") == -462089681, "varHash: forceIdleBelowTpsThreshold");
+static_assert(varHash("tunedVeValue") == -450796483, "varHash: tunedVeValue");
+static_assert(varHash("triggerChannel1") == -448033693, "varHash: triggerChannel1");
+static_assert(varHash("triggerChannel2") == -448033692, "varHash: triggerChannel2");
+static_assert(varHash("veTableSwitch2Active") == -447483256, "varHash: veTableSwitch2Active");
+static_assert(varHash("knockSamplingDuration") == -430252676, "varHash: knockSamplingDuration");
+static_assert(varHash("lua.clutchUpState") == -427776066, "varHash: lua.clutchUpState");
+static_assert(varHash("torqueReductionActivationTemperature") == -427105966, "varHash: torqueReductionActivationTemperature");
+static_assert(varHash("secondaryInjectorFuelReferencePressure") == -425992769, "varHash: secondaryInjectorFuelReferencePressure");
+static_assert(varHash("idleStatus.resetCounter") == -424088744, "varHash: idleStatus.resetCounter");
+static_assert(varHash("etb.offset") == -423426795, "varHash: etb.offset");
+static_assert(varHash("useSeparateIdleTablesForCrankingTaper") == -418454384, "varHash: useSeparateIdleTablesForCrankingTaper");
+static_assert(varHash("etb2jamDetected") == -417653524, "varHash: etb2jamDetected");
+static_assert(varHash("issFilterReciprocal") == -413489794, "varHash: issFilterReciprocal");
+static_assert(varHash("allowDFUwithIgn") == -411193027, "varHash: allowDFUwithIgn");
+static_assert(varHash("etb1state") == -410785646, "varHash: etb1state");
+static_assert(varHash("vvt1itriggerStateIndex") == -404295156, "varHash: vvt1itriggerStateIndex");
+static_assert(varHash("sparkDwellClamp") == -400293845, "varHash: sparkDwellClamp");
+static_assert(varHash("idleidleTarget") == -398482072, "varHash: idleidleTarget");
+static_assert(varHash("auxLinear2.value1") == -396384772, "varHash: auxLinear2.value1");
+static_assert(varHash("auxLinear2.value2") == -396384771, "varHash: auxLinear2.value2");
+static_assert(varHash("fuelReferencePressure") == -395416807, "varHash: fuelReferencePressure");
+static_assert(varHash("dynoSaeBaro") == -391393956, "varHash: dynoSaeBaro");
+static_assert(varHash("wwaeTau") == -390306941, "varHash: wwaeTau");
+static_assert(varHash("forceO2Heating") == -389678699, "varHash: forceO2Heating");
+static_assert(varHash("tpsAccelFuel") == -384925312, "varHash: tpsAccelFuel");
+static_assert(varHash("AFRBlend1BlendMode") == -380849858, "varHash: AFRBlend1BlendMode");
+static_assert(varHash("fuelPumpDisable") == -380530585, "varHash: fuelPumpDisable");
+static_assert(varHash("waterPumpMaxPwm") == -378628860, "varHash: waterPumpMaxPwm");
+static_assert(varHash("vvtBooleanForVerySpecialCases") == -376859614, "varHash: vvtBooleanForVerySpecialCases");
+static_assert(varHash("pressureDelta") == -376325528, "varHash: pressureDelta");
+static_assert(varHash("mc33_i_boost") == -371707639, "varHash: mc33_i_boost");
+static_assert(varHash("etb2state") == -371650253, "varHash: etb2state");
+static_assert(varHash("waterPumpMinPwm") == -369500862, "varHash: waterPumpMinPwm");
+static_assert(varHash("stft.deadband_lean") == -366994282, "varHash: stft.deadband_lean");
+static_assert(varHash("stft.deadband_rich") == -366774244, "varHash: stft.deadband_rich");
+static_assert(varHash("waterPumpdisabledWhileEngineStopped") == -366242192, "varHash: waterPumpdisabledWhileEngineStopped");
+static_assert(varHash("useIacPidMultTable") == -364626778, "varHash: useIacPidMultTable");
+static_assert(varHash("initialIgnitionCutPercent") == -360834835, "varHash: initialIgnitionCutPercent");
+static_assert(varHash("pressureRatio") == -359858019, "varHash: pressureRatio");
+static_assert(varHash("accelHighRes") == -356454233, "varHash: accelHighRes");
+static_assert(varHash("tmf_rho") == -355385452, "varHash: tmf_rho");
+static_assert(varHash("tmfLoad") == -354921780, "varHash: tmfLoad");
+static_assert(varHash("injectorDutyCycle") == -354325031, "varHash: injectorDutyCycle");
+static_assert(varHash("actualLastInjPreSmallPw") == -350710533, "varHash: actualLastInjPreSmallPw");
+static_assert(varHash("idleiacByRpmTaper") == -348839402, "varHash: idleiacByRpmTaper");
+static_assert(varHash("isMafValid") == -348170267, "varHash: isMafValid");
+static_assert(varHash("rawPpsPrimary") == -347083354, "varHash: rawPpsPrimary");
+static_assert(varHash("oilTempSensor.config.bias_resistor") == -346622972, "varHash: oilTempSensor.config.bias_resistor");
+static_assert(varHash("waterPumpSoftStartSec") == -342742961, "varHash: waterPumpSoftStartSec");
+static_assert(varHash("knockDetectionWindowStart") == -339821344, "varHash: knockDetectionWindowStart");
+static_assert(varHash("mapLowPassCutoffHz") == -339275211, "varHash: mapLowPassCutoffHz");
+static_assert(varHash("launchControlEnabled") == -338157684, "varHash: launchControlEnabled");
+static_assert(varHash("can_blend_ve_2_toggle") == -337000121, "varHash: can_blend_ve_2_toggle");
+static_assert(varHash("boosttpsTooLow") == -328386745, "varHash: boosttpsTooLow");
+static_assert(varHash("verboseTriggerSynchDetails") == -325018342, "varHash: verboseTriggerSynchDetails");
+static_assert(varHash("spooledLevel") == -324119981, "varHash: spooledLevel");
+static_assert(varHash("timingPidCorrection") == -319326974, "varHash: timingPidCorrection");
+static_assert(varHash("boardUseCanTerminator") == -312962799, "varHash: boardUseCanTerminator");
+static_assert(varHash("alternatorControl.dFactor") == -311714733, "varHash: alternatorControl.dFactor");
+static_assert(varHash("disableFan2WhenStopped") == -311454863, "varHash: disableFan2WhenStopped");
+static_assert(varHash("accelerometerHPCF") == -310192191, "varHash: accelerometerHPCF");
+static_assert(varHash("luaTimingAdd") == -309610760, "varHash: luaTimingAdd");
+static_assert(varHash("etb2m_wastegatePosition") == -308232520, "varHash: etb2m_wastegatePosition");
+static_assert(varHash("tmfAirmass") == -306603236, "varHash: tmfAirmass");
+static_assert(varHash("waterPump2m_state") == -304465879, "varHash: waterPump2m_state");
+static_assert(varHash("isRpmConditionSatisfied") == -304304077, "varHash: isRpmConditionSatisfied");
+static_assert(varHash("enableFan1WithAc") == -298185774, "varHash: enableFan1WithAc");
+static_assert(varHash("hellenBoardId") == -295556270, "varHash: hellenBoardId");
+static_assert(varHash("globalTriggerAngleOffset") == -295413160, "varHash: globalTriggerAngleOffset");
+static_assert(varHash("injectorSecondary.flow") == -289303407, "varHash: injectorSecondary.flow");
+static_assert(varHash("anotherCiTest") == -283215870, "varHash: anotherCiTest");
+static_assert(varHash("customSentTpsMax") == -282198345, "varHash: customSentTpsMax");
+static_assert(varHash("customSentTpsMin") == -282198091, "varHash: customSentTpsMin");
+static_assert(varHash("baroCorrection") == -281693247, "varHash: baroCorrection");
+static_assert(varHash("triggerToothAngleError") == -280624712, "varHash: triggerToothAngleError");
+static_assert(varHash("rawFrequencyMaf") == -277099819, "varHash: rawFrequencyMaf");
+static_assert(varHash("alternatorControl.minValue") == -272710799, "varHash: alternatorControl.minValue");
+static_assert(varHash("etb2boardEtbAdjustment") == -272579820, "varHash: etb2boardEtbAdjustment");
+static_assert(varHash("boostisPlantValid") == -272334953, "varHash: boostisPlantValid");
+static_assert(varHash("ltft.maxRemove") == -269110527, "varHash: ltft.maxRemove");
+static_assert(varHash("useCicPidForIdle") == -264572349, "varHash: useCicPidForIdle");
+static_assert(varHash("nitrousisNitrousCltCondition") == -257492461, "varHash: nitrousisNitrousCltCondition");
+static_assert(varHash("alphaNUseIat") == -253720028, "varHash: alphaNUseIat");
+static_assert(varHash("etb.iFactor") == -253543882, "varHash: etb.iFactor");
+static_assert(varHash("assistedEtbRotatePeriodSec") == -251224435, "varHash: assistedEtbRotatePeriodSec");
+static_assert(varHash("tpsAeDynamicTresholdAverageStaticCurve") == -246556940, "varHash: tpsAeDynamicTresholdAverageStaticCurve");
+static_assert(varHash("adcVcc") == -244496183, "varHash: adcVcc");
+static_assert(varHash("tuneHidingKey") == -243078627, "varHash: tuneHidingKey");
+static_assert(varHash("injectionOffset") == -243031057, "varHash: injectionOffset");
+static_assert(varHash("afr.v1") == -241663117, "varHash: afr.v1");
+static_assert(varHash("afr.v2") == -241663116, "varHash: afr.v2");
+static_assert(varHash("iacByTpsHoldTime") == -235994182, "varHash: iacByTpsHoldTime");
+static_assert(varHash("cc_maxRpm") == -235965601, "varHash: cc_maxRpm");
+static_assert(varHash("auxFrequencyFilter1") == -235768100, "varHash: auxFrequencyFilter1");
+static_assert(varHash("auxFrequencyFilter2") == -235768099, "varHash: auxFrequencyFilter2");
+static_assert(varHash("auxFrequencyFilter3") == -235768098, "varHash: auxFrequencyFilter3");
+static_assert(varHash("auxFrequencyFilter4") == -235768097, "varHash: auxFrequencyFilter4");
+static_assert(varHash("sd_present") == -230533156, "varHash: sd_present");
+static_assert(varHash("cc_minRpm") == -226837603, "varHash: cc_minRpm");
+static_assert(varHash("tps2Max") == -224185132, "varHash: tps2Max");
+static_assert(varHash("tps2Min") == -224184878, "varHash: tps2Min");
+static_assert(varHash("injAdvAssistStartDeg") == -215143594, "varHash: injAdvAssistStartDeg");
+static_assert(varHash("vssGearRatio") == -213773345, "varHash: vssGearRatio");
+static_assert(varHash("etb1jamTimer") == -213258422, "varHash: etb1jamTimer");
+static_assert(varHash("benchTestCount") == -204721234, "varHash: benchTestCount");
+static_assert(varHash("vssToothCount1") == -199797335, "varHash: vssToothCount1");
+static_assert(varHash("vssToothCount2") == -199797334, "varHash: vssToothCount2");
+static_assert(varHash("vssToothCount3") == -199797333, "varHash: vssToothCount3");
+static_assert(varHash("vssToothCount4") == -199797332, "varHash: vssToothCount4");
+static_assert(varHash("map.sensorpre.lowValue") == -194111409, "varHash: map.sensorpre.lowValue");
+static_assert(varHash("vvt1ivvtCurrentPosition") == -192504649, "varHash: vvt1ivvtCurrentPosition");
+static_assert(varHash("gapVvtTrackingLengthOverride") == -188591438, "varHash: gapVvtTrackingLengthOverride");
+static_assert(varHash("throttleEffectiveAreaOpening") == -184764139, "varHash: throttleEffectiveAreaOpening");
+static_assert(varHash("dtTuneSimultaneous") == -184602782, "varHash: dtTuneSimultaneous");
+static_assert(varHash("forceIdleIgnitionBelowTps") == -184044765, "varHash: forceIdleIgnitionBelowTps");
+static_assert(varHash("crankingFuel.fuel") == -180401224, "varHash: crankingFuel.fuel");
+static_assert(varHash("fan1AcAdder") == -180298801, "varHash: fan1AcAdder");
+static_assert(varHash("airTaperRpmRange") == -174866119, "varHash: airTaperRpmRange");
+static_assert(varHash("waterPump2disabledWhileEngineStopped") == -173408670, "varHash: waterPump2disabledWhileEngineStopped");
+static_assert(varHash("dtTuneCycleFuel") == -172041355, "varHash: dtTuneCycleFuel");
+static_assert(varHash("can_blend_ign_1_toggle") == -169985079, "varHash: can_blend_ign_1_toggle");
+static_assert(varHash("cc_accdec_request_timeout") == -165252373, "varHash: cc_accdec_request_timeout");
+static_assert(varHash("fan1notRunning") == -150769059, "varHash: fan1notRunning");
+static_assert(varHash("rawLowFuelPressure") == -148455898, "varHash: rawLowFuelPressure");
+static_assert(varHash("waterPumpPwmFrequency") == -139549616, "varHash: waterPumpPwmFrequency");
+static_assert(varHash("mapLowValueVoltage") == -137390524, "varHash: mapLowValueVoltage");
+static_assert(varHash("ltitIgnitionOnDelay") == -135093297, "varHash: ltitIgnitionOnDelay");
+static_assert(varHash("idlebaseIdlePosition") == -133180239, "varHash: idlebaseIdlePosition");
+static_assert(varHash("runningAirmass") == -131284394, "varHash: runningAirmass");
+static_assert(varHash("can_blend_afr_1_toggle") == -116334588, "varHash: can_blend_afr_1_toggle");
+static_assert(varHash("RealAFRValue2") == -116311215, "varHash: RealAFRValue2");
+static_assert(varHash("fan1cranking") == -113087656, "varHash: fan1cranking");
+static_assert(varHash("knockFuelTrim") == -106437949, "varHash: knockFuelTrim");
+static_assert(varHash("sdTriggerLog") == -105464622, "varHash: sdTriggerLog");
+static_assert(varHash("idleRpmPid.offset") == -103982236, "varHash: idleRpmPid.offset");
+static_assert(varHash("injAdvAssistEnabled") == -101393725, "varHash: injAdvAssistEnabled");
+static_assert(varHash("fuelPumpengineTurnedRecently") == -92785887, "varHash: fuelPumpengineTurnedRecently");
+static_assert(varHash("stft.maxAfr") == -90543309, "varHash: stft.maxAfr");
+static_assert(varHash("waterPump2cranking") == -88256759, "varHash: waterPump2cranking");
+static_assert(varHash("throttlePedalPosition") == -84435626, "varHash: throttlePedalPosition");
+static_assert(varHash("hpfpActivationAngle") == -81483444, "varHash: hpfpActivationAngle");
+static_assert(varHash("stft.minAfr") == -81415311, "varHash: stft.minAfr");
+static_assert(varHash("stft.minClt") == -81412933, "varHash: stft.minClt");
+static_assert(varHash("rpmForIgnitionIdleTableDot") == -80687031, "varHash: rpmForIgnitionIdleTableDot");
+static_assert(varHash("dwellVoltageCorrection") == -80612537, "varHash: dwellVoltageCorrection");
+static_assert(varHash("engine") == -75965445, "varHash: engine");
+static_assert(varHash("auxLinear1.value1") == -65154789, "varHash: auxLinear1.value1");
+static_assert(varHash("auxLinear1.value2") == -65154788, "varHash: auxLinear1.value2");
+static_assert(varHash("invertExhaustCamVVTSignal") == -60727986, "varHash: invertExhaustCamVVTSignal");
+static_assert(varHash("waterPumpPwmEnabled") == -57270071, "varHash: waterPumpPwmEnabled");
+static_assert(varHash("sparkCutReason") == -56739846, "varHash: sparkCutReason");
+static_assert(varHash("disableINJOK") == -56102764, "varHash: disableINJOK");
+static_assert(varHash("etbStatus.dTerm") == -56077458, "varHash: etbStatus.dTerm");
+static_assert(varHash("useRunningMathForCranking") == -54973711, "varHash: useRunningMathForCranking");
+static_assert(varHash("etbStatus.error") == -54949348, "varHash: etbStatus.error");
+static_assert(varHash("etbIdleThrottleRange") == -54532767, "varHash: etbIdleThrottleRange");
+static_assert(varHash("launchTriggered") == -52473827, "varHash: launchTriggered");
+static_assert(varHash("etbStatus.iTerm") == -50147853, "varHash: etbStatus.iTerm");
+static_assert(varHash("justATempTest") == -48120222, "varHash: justATempTest");
+static_assert(varHash("vvt2evvtCurrentPosition") == -45862380, "varHash: vvt2evvtCurrentPosition");
+static_assert(varHash("minCamPhaseResolveRpm") == -45436934, "varHash: minCamPhaseResolveRpm");
+static_assert(varHash("injectorState10") == -43142203, "varHash: injectorState10");
+static_assert(varHash("injectorState11") == -43142202, "varHash: injectorState11");
+static_assert(varHash("injectorState12") == -43142201, "varHash: injectorState12");
+static_assert(varHash("running.baseFuel") == -42886021, "varHash: running.baseFuel");
+static_assert(varHash("etbStatus.pTerm") == -41846406, "varHash: etbStatus.pTerm");
+static_assert(varHash("tmf_engineload") == -32425311, "varHash: tmf_engineload");
+static_assert(varHash("defaultEthanolContent") == -30520144, "varHash: defaultEthanolContent");
+static_assert(varHash("boostmapTooLow") == -29626162, "varHash: boostmapTooLow");
+static_assert(varHash("triggerCompHystMax") == -25671466, "varHash: triggerCompHystMax");
+static_assert(varHash("triggerCompHystMin") == -25671212, "varHash: triggerCompHystMin");
+static_assert(varHash("pauseEtbControl") == -24313313, "varHash: pauseEtbControl");
+static_assert(varHash("can_blend_ve_1_toggle") == -5770138, "varHash: can_blend_ve_1_toggle");
+static_assert(varHash("clt.config.resistance_1") == -5328869, "varHash: clt.config.resistance_1");
+static_assert(varHash("clt.config.resistance_2") == -5328868, "varHash: clt.config.resistance_2");
+static_assert(varHash("clt.config.resistance_3") == -5328867, "varHash: clt.config.resistance_3");
+static_assert(varHash("brakeMeanEffectivePressureDifferential") == -4616606, "varHash: brakeMeanEffectivePressureDifferential");
+static_assert(varHash("turboSpeed") == -4187390, "varHash: turboSpeed");
+static_assert(varHash("currentIgnitionMode") == -3603666, "varHash: currentIgnitionMode");
+static_assert(varHash("canReWidebandVersion") == -2850030, "varHash: canReWidebandVersion");
+static_assert(varHash("disableBARO") == -1965539, "varHash: disableBARO");
+static_assert(varHash("disableDINP") == -1885084, "varHash: disableDINP");
+static_assert(varHash("rawTps1Secondary") == 2555743, "varHash: rawTps1Secondary");
+static_assert(varHash("wwaeBeta") == 4130389, "varHash: wwaeBeta");
+static_assert(varHash("fanOffTemperature") == 4686563, "varHash: fanOffTemperature");
+static_assert(varHash("hp") == 5863453, "varHash: hp");
+static_assert(varHash("verboseCanBaseAddress") == 6238478, "varHash: verboseCanBaseAddress");
+static_assert(varHash("mapErrorDetectionTooLow") == 9388880, "varHash: mapErrorDetectionTooLow");
+static_assert(varHash("useIdleTimingPidControl") == 11736566, "varHash: useIdleTimingPidControl");
+static_assert(varHash("useHbridgesToDriveIdleStepper") == 13806936, "varHash: useHbridgesToDriveIdleStepper");
+static_assert(varHash("isTpsError") == 14587330, "varHash: isTpsError");
+static_assert(varHash("mainRelayShutoffDelay") == 16864629, "varHash: mainRelayShutoffDelay");
+static_assert(varHash("tps2SecondaryMax") == 18659676, "varHash: tps2SecondaryMax");
+static_assert(varHash("tps2SecondaryMin") == 18659930, "varHash: tps2SecondaryMin");
+static_assert(varHash("wastegatePositionClosedVoltage") == 20003211, "varHash: wastegatePositionClosedVoltage");
+static_assert(varHash("crankingFuel.tpsCoefficient") == 20251202, "varHash: crankingFuel.tpsCoefficient");
+static_assert(varHash("isMapError") == 23640681, "varHash: isMapError");
+static_assert(varHash("etb1m_adjustedTarget") == 28274136, "varHash: etb1m_adjustedTarget");
+static_assert(varHash("idleTimingPid.periodMs") == 29505657, "varHash: idleTimingPid.periodMs");
+static_assert(varHash("acIdleRpmTarget") == 30701245, "varHash: acIdleRpmTarget");
+static_assert(varHash("calibrationValue2") == 37467836, "varHash: calibrationValue2");
+static_assert(varHash("twoStroke") == 38719415, "varHash: twoStroke");
+static_assert(varHash("hondaK") == 42872346, "varHash: hondaK");
+static_assert(varHash("isMapValid") == 43183663, "varHash: isMapValid");
+static_assert(varHash("engineSnifferRpmThreshold") == 46918724, "varHash: engineSnifferRpmThreshold");
+static_assert(varHash("finalIgnitionCutPercentBeforeLaunch") == 47348059, "varHash: finalIgnitionCutPercentBeforeLaunch");
+static_assert(varHash("multisparkSparkDuration") == 48235288, "varHash: multisparkSparkDuration");
+static_assert(varHash("waterPump2cold") == 48769502, "varHash: waterPump2cold");
+static_assert(varHash("wastegatePositionSensor") == 53406649, "varHash: wastegatePositionSensor");
+static_assert(varHash("tachPulseDuractionMs") == 58931511, "varHash: tachPulseDuractionMs");
+static_assert(varHash("idleReturnTargetRampDuration") == 62925536, "varHash: idleReturnTargetRampDuration");
+static_assert(varHash("tpsAccelFractionDivisor") == 68539114, "varHash: tpsAccelFractionDivisor");
+static_assert(varHash("rawTps2Secondary") == 70357120, "varHash: rawTps2Secondary");
+static_assert(varHash("cc_speedBandHigh") == 71000176, "varHash: cc_speedBandHigh");
+static_assert(varHash("idlewasResetPid") == 72665902, "varHash: idlewasResetPid");
+static_assert(varHash("cc_rpmDeadBandLow") == 78160430, "varHash: cc_rpmDeadBandLow");
+static_assert(varHash("inj1ok") == 80622993, "varHash: inj1ok");
+static_assert(varHash("inj2ok") == 80624082, "varHash: inj2ok");
+static_assert(varHash("inj3ok") == 80625171, "varHash: inj3ok");
+static_assert(varHash("inj4ok") == 80626260, "varHash: inj4ok");
+static_assert(varHash("inj5ok") == 80627349, "varHash: inj5ok");
+static_assert(varHash("inj6ok") == 80628438, "varHash: inj6ok");
+static_assert(varHash("inj7ok") == 80629527, "varHash: inj7ok");
+static_assert(varHash("inj8ok") == 80630616, "varHash: inj8ok");
+static_assert(varHash("inj9ok") == 80631705, "varHash: inj9ok");
+static_assert(varHash("intake") == 81034497, "varHash: intake");
+static_assert(varHash("etb1etbTpsErrorCounter") == 86860621, "varHash: etb1etbTpsErrorCounter");
+static_assert(varHash("rawAuxAnalog1") == 98140608, "varHash: rawAuxAnalog1");
+static_assert(varHash("rawAuxAnalog2") == 98140609, "varHash: rawAuxAnalog2");
+static_assert(varHash("rawAuxAnalog3") == 98140610, "varHash: rawAuxAnalog3");
+static_assert(varHash("rawAuxAnalog4") == 98140611, "varHash: rawAuxAnalog4");
+static_assert(varHash("rawAuxAnalog5") == 98140612, "varHash: rawAuxAnalog5");
+static_assert(varHash("rawAuxAnalog6") == 98140613, "varHash: rawAuxAnalog6");
+static_assert(varHash("rawAuxAnalog7") == 98140614, "varHash: rawAuxAnalog7");
+static_assert(varHash("rawAuxAnalog8") == 98140615, "varHash: rawAuxAnalog8");
+static_assert(varHash("tachPulseDurationAsDutyCycle") == 99110078, "varHash: tachPulseDurationAsDutyCycle");
+static_assert(varHash("etb1targetWithIdlePosition") == 99356871, "varHash: etb1targetWithIdlePosition");
+static_assert(varHash("idlelooksLikeCoasting") == 105270760, "varHash: idlelooksLikeCoasting");
+static_assert(varHash("triggerSkipPulses") == 105821772, "varHash: triggerSkipPulses");
+static_assert(varHash("alternator_iTermMax") == 107641479, "varHash: alternator_iTermMax");
+static_assert(varHash("alternator_iTermMin") == 107641733, "varHash: alternator_iTermMin");
+static_assert(varHash("afrGasolineScale") == 111403416, "varHash: afrGasolineScale");
+static_assert(varHash("vvt1itriggerSyncGapRatio") == 114836583, "varHash: vvt1itriggerSyncGapRatio");
+static_assert(varHash("wallFuelAmount") == 115540725, "varHash: wallFuelAmount");
+static_assert(varHash("MAFMAPLoadIsMAF") == 116281959, "varHash: MAFMAPLoadIsMAF");
+static_assert(varHash("idleReturnTargetRamp") == 118504154, "varHash: idleReturnTargetRamp");
+static_assert(varHash("mapVvt_CycleDelta") == 122475036, "varHash: mapVvt_CycleDelta");
+static_assert(varHash("fuelLevelUpdatePeriodSec") == 128251338, "varHash: fuelLevelUpdatePeriodSec");
+static_assert(varHash("lua.clutchDownState") == 133427185, "varHash: lua.clutchDownState");
+static_assert(varHash("disallowPrimeFuelPump") == 149942287, "varHash: disallowPrimeFuelPump");
+static_assert(varHash("clBoostTableSwitch1Active") == 151249794, "varHash: clBoostTableSwitch1Active");
+static_assert(varHash("boostluaTargetAdd") == 151619422, "varHash: boostluaTargetAdd");
+static_assert(varHash("wastegateDcStatus.resetCounter") == 156247622, "varHash: wastegateDcStatus.resetCounter");
+static_assert(varHash("currentEngineDecodedPhase") == 162105111, "varHash: currentEngineDecodedPhase");
+static_assert(varHash("fan1disabledWhileEngineStopped") == 168011889, "varHash: fan1disabledWhileEngineStopped");
+static_assert(varHash("coastingFuelCutRpmLow") == 168701078, "varHash: coastingFuelCutRpmLow");
+static_assert(varHash("can_call_counter") == 169693489, "varHash: can_call_counter");
+static_assert(varHash("byFirmwareVersion") == 171869155, "varHash: byFirmwareVersion");
+static_assert(varHash("baroSensor.highValue") == 173166222, "varHash: baroSensor.highValue");
+static_assert(varHash("can1ListenMode") == 178430876, "varHash: can1ListenMode");
+static_assert(varHash("dynoCarCargoMassKg") == 183555079, "varHash: dynoCarCargoMassKg");
+static_assert(varHash("baroLowValueVoltage") == 193889898, "varHash: baroLowValueVoltage");
+static_assert(varHash("etb.pFactor") == 196797309, "varHash: etb.pFactor");
+static_assert(varHash("running.intakeTemperatureCoefficient") == 197173469, "varHash: running.intakeTemperatureCoefficient");
+static_assert(varHash("ISSValue") == 200047729, "varHash: ISSValue");
+static_assert(varHash("stft.cell.maxRemove") == 200989782, "varHash: stft.cell.maxRemove");
+static_assert(varHash("useFixedBaroCorrFromMap") == 201676494, "varHash: useFixedBaroCorrFromMap");
+static_assert(varHash("waterPump2brokenClt") == 204510464, "varHash: waterPump2brokenClt");
+static_assert(varHash("wastegateDcStatus.output") == 206346164, "varHash: wastegateDcStatus.output");
+static_assert(varHash("vvt1itriggerCountersError") == 206956368, "varHash: vvt1itriggerCountersError");
+static_assert(varHash("useSeparateAdvanceForIdle") == 216872574, "varHash: useSeparateAdvanceForIdle");
+static_assert(varHash("dynoCarGearFinalDrive") == 220694456, "varHash: dynoCarGearFinalDrive");
+static_assert(varHash("dwellAccuracyRatio") == 222113127, "varHash: dwellAccuracyRatio");
+static_assert(varHash("launchCorrectionsEndRpm") == 223926129, "varHash: launchCorrectionsEndRpm");
+static_assert(varHash("enableCanVss") == 245947066, "varHash: enableCanVss");
+static_assert(varHash("triggerPrimaryFall") == 248437820, "varHash: triggerPrimaryFall");
+static_assert(varHash("triggerPrimaryRise") == 248878000, "varHash: triggerPrimaryRise");
+static_assert(varHash("tmf_tmfarea") == 251753675, "varHash: tmf_tmfarea");
+static_assert(varHash("nitrousisNitrousMapCondition") == 251826574, "varHash: nitrousisNitrousMapCondition");
+static_assert(varHash("lua.luaFuelCut") == 252935343, "varHash: lua.luaFuelCut");
+static_assert(varHash("crank") == 255764596, "varHash: crank");
+static_assert(varHash("cltTimingCorrection") == 256951528, "varHash: cltTimingCorrection");
+static_assert(varHash("enableAemXSeries") == 259909218, "varHash: enableAemXSeries");
+static_assert(varHash("maxInjectorDutySustainedTimeout") == 263235302, "varHash: maxInjectorDutySustainedTimeout");
+static_assert(varHash("tmf_sd_tmf_airmass_split") == 266236834, "varHash: tmf_sd_tmf_airmass_split");
+static_assert(varHash("idleTimingPid.dFactor") == 270256825, "varHash: idleTimingPid.dFactor");
+static_assert(varHash("ready") == 273085914, "varHash: ready");
+static_assert(varHash("trailingSparkAngle") == 274318471, "varHash: trailingSparkAngle");
+static_assert(varHash("ambientTempSensor.config.tempC_1") == 275986512, "varHash: ambientTempSensor.config.tempC_1");
+static_assert(varHash("ambientTempSensor.config.tempC_2") == 275986513, "varHash: ambientTempSensor.config.tempC_2");
+static_assert(varHash("ambientTempSensor.config.tempC_3") == 275986514, "varHash: ambientTempSensor.config.tempC_3");
+static_assert(varHash("VBatt") == 277722310, "varHash: VBatt");
+static_assert(varHash("egoValueShift") == 280323355, "varHash: egoValueShift");
+static_assert(varHash("detectedGear") == 283558758, "varHash: detectedGear");
+static_assert(varHash("isMapAveragingEnabled") == 285726462, "varHash: isMapAveragingEnabled");
+static_assert(varHash("vvtActivationDelayMs") == 288250022, "varHash: vvtActivationDelayMs");
+static_assert(varHash("canSleepPeriodMs") == 296563315, "varHash: canSleepPeriodMs");
+static_assert(varHash("acPressureEnableHyst") == 298344625, "varHash: acPressureEnableHyst");
+static_assert(varHash("minimumIgnitionTiming") == 298649674, "varHash: minimumIgnitionTiming");
+static_assert(varHash("firmwareSignatureHash") == 301396472, "varHash: firmwareSignatureHash");
+static_assert(varHash("kLineDoHondaSend") == 304164959, "varHash: kLineDoHondaSend");
+static_assert(varHash("waterPumpm_state") == 306069239, "varHash: waterPumpm_state");
+static_assert(varHash("camDecoder2jzPrecision") == 306303086, "varHash: camDecoder2jzPrecision");
+static_assert(varHash("boostStatus.resetCounter") == 308336833, "varHash: boostStatus.resetCounter");
+static_assert(varHash("ambientTemp") == 309572379, "varHash: ambientTemp");
+static_assert(varHash("mapErrorDetectionTooHigh") == 309682334, "varHash: mapErrorDetectionTooHigh");
+static_assert(varHash("trgtriggerStateIndex") == 310661471, "varHash: trgtriggerStateIndex");
+static_assert(varHash("assistedEtbRiseWindowSec") == 311680038, "varHash: assistedEtbRiseWindowSec");
+static_assert(varHash("isBelowTemperatureThreshold") == 319978869, "varHash: isBelowTemperatureThreshold");
+static_assert(varHash("cc_max_soft_etb") == 321581893, "varHash: cc_max_soft_etb");
+static_assert(varHash("coastingFuelCutVssLow") == 329016035, "varHash: coastingFuelCutVssLow");
+static_assert(varHash("hpfpPumpVolume") == 334494733, "varHash: hpfpPumpVolume");
+static_assert(varHash("stepperDcInvertedPins") == 337194154, "varHash: stepperDcInvertedPins");
+static_assert(varHash("ltitSmoothingIntensity") == 341519713, "varHash: ltitSmoothingIntensity");
+static_assert(varHash("ltitStableRpmThreshold") == 341693817, "varHash: ltitStableRpmThreshold");
+static_assert(varHash("stoichiometricRatio") == 341978922, "varHash: stoichiometricRatio");
+static_assert(varHash("primaryInjectorDisabled1") == 344965200, "varHash: primaryInjectorDisabled1");
+static_assert(varHash("primaryInjectorDisabled2") == 344965201, "varHash: primaryInjectorDisabled2");
+static_assert(varHash("primaryInjectorDisabled3") == 344965202, "varHash: primaryInjectorDisabled3");
+static_assert(varHash("primaryInjectorDisabled4") == 344965203, "varHash: primaryInjectorDisabled4");
+static_assert(varHash("primaryInjectorDisabled5") == 344965204, "varHash: primaryInjectorDisabled5");
+static_assert(varHash("primaryInjectorDisabled6") == 344965205, "varHash: primaryInjectorDisabled6");
+static_assert(varHash("primaryInjectorDisabled7") == 344965206, "varHash: primaryInjectorDisabled7");
+static_assert(varHash("primaryInjectorDisabled8") == 344965207, "varHash: primaryInjectorDisabled8");
+static_assert(varHash("primaryInjectorDisabled9") == 344965208, "varHash: primaryInjectorDisabled9");
+static_assert(varHash("issEdgeCounter") == 347478025, "varHash: issEdgeCounter");
+static_assert(varHash("rawRawPpsPrimary") == 347493808, "varHash: rawRawPpsPrimary");
+static_assert(varHash("lambdaCurrentlyGood") == 350535927, "varHash: lambdaCurrentlyGood");
+static_assert(varHash("cruiseControlAverageAdjustment") == 351868267, "varHash: cruiseControlAverageAdjustment");
+static_assert(varHash("correctedIgnitionAdvance") == 352421907, "varHash: correctedIgnitionAdvance");
+static_assert(varHash("sd_formating") == 352763970, "varHash: sd_formating");
+static_assert(varHash("afrSensorLambdaRange") == 353722918, "varHash: afrSensorLambdaRange");
+static_assert(varHash("canButtons18") == 355813839, "varHash: canButtons18");
+static_assert(varHash("compressionRatio") == 355839382, "varHash: compressionRatio");
+static_assert(varHash("idleStepperTargetPosition") == 356548450, "varHash: idleStepperTargetPosition");
+static_assert(varHash("vssCalSpeed") == 358542498, "varHash: vssCalSpeed");
+static_assert(varHash("waterPump2OnTemperature") == 374188231, "varHash: waterPump2OnTemperature");
+static_assert(varHash("mc33_i_hold") == 379403209, "varHash: mc33_i_hold");
+static_assert(varHash("mc33_i_peak") == 379679459, "varHash: mc33_i_peak");
+static_assert(varHash("auxFrequencyFilter") == 383307083, "varHash: auxFrequencyFilter");
+static_assert(varHash("vssEdgeCounter") == 385418550, "varHash: vssEdgeCounter");
+static_assert(varHash("trigger.customSkippedToothCount") == 387956265, "varHash: trigger.customSkippedToothCount");
+static_assert(varHash("boostStatus.dTerm") == 392899738, "varHash: boostStatus.dTerm");
+static_assert(varHash("boostStatus.error") == 394027848, "varHash: boostStatus.error");
+static_assert(varHash("mafExpAverageAlpha") == 394665991, "varHash: mafExpAverageAlpha");
+static_assert(varHash("wheelSlipRatio") == 398495089, "varHash: wheelSlipRatio");
+static_assert(varHash("boostStatus.iTerm") == 398829343, "varHash: boostStatus.iTerm");
+static_assert(varHash("etbRevLimitRange") == 399466905, "varHash: etbRevLimitRange");
+static_assert(varHash("etbRevLimitStart") == 401321850, "varHash: etbRevLimitStart");
+static_assert(varHash("idleTimingPid.maxValue") == 402026201, "varHash: idleTimingPid.maxValue");
+static_assert(varHash("multisparkMaxSparkingAngle") == 402092253, "varHash: multisparkMaxSparkingAngle");
+static_assert(varHash("flexPercent") == 404628421, "varHash: flexPercent");
+static_assert(varHash("cc_maxThrottlePedalAllowedToEngage") == 406278046, "varHash: cc_maxThrottlePedalAllowedToEngage");
+static_assert(varHash("iat.config.bias_resistor") == 406607630, "varHash: iat.config.bias_resistor");
+static_assert(varHash("boostStatus.pTerm") == 407130790, "varHash: boostStatus.pTerm");
+static_assert(varHash("bypassTcharge") == 407969621, "varHash: bypassTcharge");
+static_assert(varHash("rawAfr") == 417943720, "varHash: rawAfr");
+static_assert(varHash("rawClt") == 417946098, "varHash: rawClt");
+static_assert(varHash("rawIat") == 417952269, "varHash: rawIat");
+static_assert(varHash("rawMaf") == 417956611, "varHash: rawMaf");
+static_assert(varHash("rawMap") == 417956621, "varHash: rawMap");
+static_assert(varHash("rawVss") == 417967019, "varHash: rawVss");
+static_assert(varHash("ltitIgnitionOffSaveDelay") == 423655964, "varHash: ltitIgnitionOffSaveDelay");
+static_assert(varHash("useInjectorFlowLinearizationTable") == 435614729, "varHash: useInjectorFlowLinearizationTable");
+static_assert(varHash("hpfpPidI") == 436500697, "varHash: hpfpPidI");
+static_assert(varHash("hpfpPidP") == 436500704, "varHash: hpfpPidP");
+static_assert(varHash("isO2HeaterOn") == 438683128, "varHash: isO2HeaterOn");
+static_assert(varHash("olBoostTableSwitch1Active") == 438814606, "varHash: olBoostTableSwitch1Active");
+static_assert(varHash("injectorFlowAsMassFlow") == 444648859, "varHash: injectorFlowAsMassFlow");
+static_assert(varHash("allowIdenticalPps") == 445194564, "varHash: allowIdenticalPps");
+static_assert(varHash("twoWireBatchIgnition") == 454615641, "varHash: twoWireBatchIgnition");
+static_assert(varHash("ppsExpAverageAlpha") == 457158886, "varHash: ppsExpAverageAlpha");
+static_assert(varHash("boostboostOutput") == 459143268, "varHash: boostboostOutput");
+static_assert(varHash("idleisInDeadZone") == 459712992, "varHash: idleisInDeadZone");
+static_assert(varHash("sd_msd") == 459787871, "varHash: sd_msd");
+static_assert(varHash("sdLoad") == 460256636, "varHash: sdLoad");
+static_assert(varHash("engineSnifferFocusOnInputs") == 465982216, "varHash: engineSnifferFocusOnInputs");
+static_assert(varHash("canInputBCM") == 470555289, "varHash: canInputBCM");
+static_assert(varHash("tcuDesiredGear") == 471298448, "varHash: tcuDesiredGear");
+static_assert(varHash("vvtCamCounter") == 477303734, "varHash: vvtCamCounter");
+static_assert(varHash("startw") == 478839978, "varHash: startw");
+static_assert(varHash("waterPump2radiatorFanStatus") == 480187723, "varHash: waterPump2radiatorFanStatus");
+static_assert(varHash("lambdaTimeSinceGood") == 481450608, "varHash: lambdaTimeSinceGood");
+static_assert(varHash("acDelay") == 483010008, "varHash: acDelay");
+static_assert(varHash("storedInitialBaroPressure") == 485165853, "varHash: storedInitialBaroPressure");
+static_assert(varHash("baseIgnitionAdvance") == 493641747, "varHash: baseIgnitionAdvance");
+static_assert(varHash("fan2disabledWhileEngineStopped") == 494714802, "varHash: fan2disabledWhileEngineStopped");
+static_assert(varHash("acnoClt") == 495219145, "varHash: acnoClt");
+static_assert(varHash("ltitStableTime") == 496209836, "varHash: ltitStableTime");
+static_assert(varHash("torqueReductionTriggerPinState") == 501156654, "varHash: torqueReductionTriggerPinState");
+static_assert(varHash("vssPulsePerKm") == 506292297, "varHash: vssPulsePerKm");
+static_assert(varHash("tmf_cd") == 509832338, "varHash: tmf_cd");
+static_assert(varHash("torque") == 512655621, "varHash: torque");
+static_assert(varHash("flexSensorInverted") == 512911183, "varHash: flexSensorInverted");
+static_assert(varHash("boostStatus.output") == 513001967, "varHash: boostStatus.output");
+static_assert(varHash("tpsADC") == 513859492, "varHash: tpsADC");
+static_assert(varHash("tpsMax") == 513872482, "varHash: tpsMax");
+static_assert(varHash("tpsMin") == 513872736, "varHash: tpsMin");
+static_assert(varHash("ignTableSwitch2Active") == 515359403, "varHash: ignTableSwitch2Active");
+static_assert(varHash("isCltError") == 518760558, "varHash: isCltError");
+static_assert(varHash("gyroYaw") == 519838295, "varHash: gyroYaw");
+static_assert(varHash("waterPump2enabledForAc") == 524306482, "varHash: waterPump2enabledForAc");
+static_assert(varHash("running.timeSinceCrankingInSecs") == 526786951, "varHash: running.timeSinceCrankingInSecs");
+static_assert(varHash("hpfpPid_iTermMax") == 535118454, "varHash: hpfpPid_iTermMax");
+static_assert(varHash("hpfpPid_iTermMin") == 535118708, "varHash: hpfpPid_iTermMin");
+static_assert(varHash("deviceUid") == 540029591, "varHash: deviceUid");
+static_assert(varHash("rawMCP3208_v_1") == 541310369, "varHash: rawMCP3208_v_1");
+static_assert(varHash("rawMCP3208_v_2") == 541310370, "varHash: rawMCP3208_v_2");
+static_assert(varHash("rawMCP3208_v_3") == 541310371, "varHash: rawMCP3208_v_3");
+static_assert(varHash("rawMCP3208_v_4") == 541310372, "varHash: rawMCP3208_v_4");
+static_assert(varHash("rawMCP3208_v_5") == 541310373, "varHash: rawMCP3208_v_5");
+static_assert(varHash("rawMCP3208_v_6") == 541310374, "varHash: rawMCP3208_v_6");
+static_assert(varHash("rawMCP3208_v_7") == 541310375, "varHash: rawMCP3208_v_7");
+static_assert(varHash("rawMCP3208_v_8") == 541310376, "varHash: rawMCP3208_v_8");
+static_assert(varHash("rawMCP3208_v_9") == 541310377, "varHash: rawMCP3208_v_9");
+static_assert(varHash("fuelTankLevel") == 543832183, "varHash: fuelTankLevel");
+static_assert(varHash("compressorDischargeTemp") == 553570450, "varHash: compressorDischargeTemp");
+static_assert(varHash("tpsAeScaledFrom") == 559806914, "varHash: tpsAeScaledFrom");
+static_assert(varHash("etb1m_wastegatePosition") == 561614935, "varHash: etb1m_wastegatePosition");
+static_assert(varHash("tpsFuelPumpPrimeEnabled") == 573036274, "varHash: tpsFuelPumpPrimeEnabled");
+static_assert(varHash("fuelPumpignitionOn") == 577940625, "varHash: fuelPumpignitionOn");
+static_assert(varHash("mc33_hpfp_i_hold") == 578657622, "varHash: mc33_hpfp_i_hold");
+static_assert(varHash("mc33_hpfp_i_peak") == 578933872, "varHash: mc33_hpfp_i_peak");
+static_assert(varHash("silentTriggerError") == 582390322, "varHash: silentTriggerError");
+static_assert(varHash("fuelingLoad") == 583799407, "varHash: fuelingLoad");
+static_assert(varHash("sd.tChargeK") == 584726739, "varHash: sd.tChargeK");
+static_assert(varHash("useIdleAdvanceWhileCoasting") == 586887955, "varHash: useIdleAdvanceWhileCoasting");
+static_assert(varHash("dynoCarGearRatio") == 589242035, "varHash: dynoCarGearRatio");
+static_assert(varHash("tmf_maf_engineload_split") == 590388191, "varHash: tmf_maf_engineload_split");
+static_assert(varHash("camDecoder2jzPosition") == 594789367, "varHash: camDecoder2jzPosition");
+static_assert(varHash("minimumBoostClosedLoopMap") == 596585178, "varHash: minimumBoostClosedLoopMap");
+static_assert(varHash("oilPressure") == 598268994, "varHash: oilPressure");
+static_assert(varHash("modeledFlowIdle") == 600643125, "varHash: modeledFlowIdle");
+static_assert(varHash("dfcoRetardDeg") == 601094003, "varHash: dfcoRetardDeg");
+static_assert(varHash("rawMapPre") == 606580596, "varHash: rawMapPre");
+static_assert(varHash("warmup") == 613454561, "varHash: warmup");
+static_assert(varHash("multisparkDwell") == 617337449, "varHash: multisparkDwell");
+static_assert(varHash("tpsErrorDetectionTooLow") == 625338761, "varHash: tpsErrorDetectionTooLow");
+static_assert(varHash("auxTempSensor1.config.resistance_1") == 629168263, "varHash: auxTempSensor1.config.resistance_1");
+static_assert(varHash("auxTempSensor1.config.resistance_2") == 629168264, "varHash: auxTempSensor1.config.resistance_2");
+static_assert(varHash("auxTempSensor1.config.resistance_3") == 629168265, "varHash: auxTempSensor1.config.resistance_3");
+static_assert(varHash("boostUsePWMLimiterLowerWg") == 632136522, "varHash: boostUsePWMLimiterLowerWg");
+static_assert(varHash("baroHasError") == 634106895, "varHash: baroHasError");
+static_assert(varHash("globalSparkCounter") == 642962903, "varHash: globalSparkCounter");
+static_assert(varHash("tps1Split") == 644036825, "varHash: tps1Split");
+static_assert(varHash("startCrankingDuration") == 644409862, "varHash: startCrankingDuration");
+static_assert(varHash("tpsExtraShotTimer") == 652896383, "varHash: tpsExtraShotTimer");
+static_assert(varHash("useIdleTimingTargetError") == 657642633, "varHash: useIdleTimingTargetError");
+static_assert(varHash("vvt2etriggerSyncGapRatio") == 659064164, "varHash: vvt2etriggerSyncGapRatio");
+static_assert(varHash("mc33_hpfp_max_hold") == 663037299, "varHash: mc33_hpfp_max_hold");
+static_assert(varHash("triggerEventsTimeoutMs") == 665024981, "varHash: triggerEventsTimeoutMs");
+static_assert(varHash("useLinearIatSensor") == 667504645, "varHash: useLinearIatSensor");
+static_assert(varHash("fan2enabledForAc") == 669515138, "varHash: fan2enabledForAc");
+static_assert(varHash("tChargeAirDecrLimit") == 670644444, "varHash: tChargeAirDecrLimit");
+static_assert(varHash("usescriptTableForCanSniffingFiltering") == 671821024, "varHash: usescriptTableForCanSniffingFiltering");
+static_assert(varHash("fixSyncMisfire") == 678545432, "varHash: fixSyncMisfire");
+static_assert(varHash("multiSparkCounter") == 680091441, "varHash: multiSparkCounter");
+static_assert(varHash("actualLastInjection") == 681043126, "varHash: actualLastInjection");
+static_assert(varHash("tps2Split") == 683172218, "varHash: tps2Split");
+static_assert(varHash("rawMCP3208_v_10") == 683373041, "varHash: rawMCP3208_v_10");
+static_assert(varHash("rawMCP3208_v_11") == 683373042, "varHash: rawMCP3208_v_11");
+static_assert(varHash("rawMCP3208_v_12") == 683373043, "varHash: rawMCP3208_v_12");
+static_assert(varHash("rawMCP3208_v_13") == 683373044, "varHash: rawMCP3208_v_13");
+static_assert(varHash("rawMCP3208_v_14") == 683373045, "varHash: rawMCP3208_v_14");
+static_assert(varHash("rawMCP3208_v_15") == 683373046, "varHash: rawMCP3208_v_15");
+static_assert(varHash("rawMCP3208_v_16") == 683373047, "varHash: rawMCP3208_v_16");
+static_assert(varHash("rawMCP3208_v_17") == 683373048, "varHash: rawMCP3208_v_17");
+static_assert(varHash("rawMCP3208_v_18") == 683373049, "varHash: rawMCP3208_v_18");
+static_assert(varHash("rawMCP3208_v_19") == 683373050, "varHash: rawMCP3208_v_19");
+static_assert(varHash("rawMCP3208_v_20") == 683373074, "varHash: rawMCP3208_v_20");
+static_assert(varHash("rawMCP3208_v_21") == 683373075, "varHash: rawMCP3208_v_21");
+static_assert(varHash("rawMCP3208_v_22") == 683373076, "varHash: rawMCP3208_v_22");
+static_assert(varHash("rawMCP3208_v_23") == 683373077, "varHash: rawMCP3208_v_23");
+static_assert(varHash("rawMCP3208_v_24") == 683373078, "varHash: rawMCP3208_v_24");
+static_assert(varHash("useSeparateAdvanceForCranking") == 685453869, "varHash: useSeparateAdvanceForCranking");
+static_assert(varHash("nitrousisNitrousSpeedCondition") == 685697025, "varHash: nitrousisNitrousSpeedCondition");
+static_assert(varHash("TPS2Value") == 686191307, "varHash: TPS2Value");
+static_assert(varHash("etb2etbPpsErrorCounter") == 686428810, "varHash: etb2etbPpsErrorCounter");
+static_assert(varHash("tunedMafCorrection") == 698398225, "varHash: tunedMafCorrection");
+static_assert(varHash("vvt2ivvtToothDurations0") == 704910935, "varHash: vvt2ivvtToothDurations0");
+static_assert(varHash("luaLaunchState") == 707453027, "varHash: luaLaunchState");
+static_assert(varHash("sd_logging_internal") == 708639006, "varHash: sd_logging_internal");
+static_assert(varHash("boostluaTargetMult") == 708923767, "varHash: boostluaTargetMult");
+static_assert(varHash("idleisCranking") == 713313260, "varHash: idleisCranking");
+static_assert(varHash("mcuSerial") == 714144074, "varHash: mcuSerial");
+static_assert(varHash("fuelPumptpsFuelPumpPrime") == 717675541, "varHash: fuelPumptpsFuelPumpPrime");
+static_assert(varHash("disableWaterPump2WhenStoppedTimeout") == 722000488, "varHash: disableWaterPump2WhenStoppedTimeout");
+static_assert(varHash("clutchDownState") == 724244513, "varHash: clutchDownState");
+static_assert(varHash("multisparkMaxExtraSparkCount") == 726613349, "varHash: multisparkMaxExtraSparkCount");
+static_assert(varHash("idleStatus.output") == 731084614, "varHash: idleStatus.output");
+static_assert(varHash("vehicleSpeedKphFrontAvg") == 732676192, "varHash: vehicleSpeedKphFrontAvg");
+static_assert(varHash("cc_maxSpeed") == 732678913, "varHash: cc_maxSpeed");
+static_assert(varHash("auxTempSensor2.config.bias_resistor") == 734290080, "varHash: auxTempSensor2.config.bias_resistor");
+static_assert(varHash("OLBoostBlend1BlendMode") == 742920423, "varHash: OLBoostBlend1BlendMode");
+static_assert(varHash("ltitCorrectionRate") == 743163558, "varHash: ltitCorrectionRate");
+static_assert(varHash("frequencyMafFilter") == 746342705, "varHash: frequencyMafFilter");
+static_assert(varHash("startRequestPinInverted") == 747573348, "varHash: startRequestPinInverted");
+static_assert(varHash("etb1validPlantPosition") == 752161333, "varHash: etb1validPlantPosition");
+static_assert(varHash("mapPreFast") == 753242040, "varHash: mapPreFast");
+static_assert(varHash("invertVvtControlIntake") == 755512282, "varHash: invertVvtControlIntake");
+static_assert(varHash("isDecodingMapCam") == 756216589, "varHash: isDecodingMapCam");
+static_assert(varHash("lowPressureFuel.value1") == 764445240, "varHash: lowPressureFuel.value1");
+static_assert(varHash("lowPressureFuel.value2") == 764445241, "varHash: lowPressureFuel.value2");
+static_assert(varHash("triggerElapsedUs") == 767689023, "varHash: triggerElapsedUs");
+static_assert(varHash("tpsLowPassCutoffHz") == 767930574, "varHash: tpsLowPassCutoffHz");
+static_assert(varHash("etb2etbFeedForward") == 769117654, "varHash: etb2etbFeedForward");
+static_assert(varHash("throttleInletPressure") == 769340240, "varHash: throttleInletPressure");
+static_assert(varHash("can_var_get_counter") == 774230013, "varHash: can_var_get_counter");
+static_assert(varHash("tracSpeedFrontRearREF") == 774655824, "varHash: tracSpeedFrontRearREF");
+static_assert(varHash("boostPid.minValue") == 777954680, "varHash: boostPid.minValue");
+static_assert(varHash("isBrakePedalActivated") == 781025153, "varHash: isBrakePedalActivated");
+static_assert(varHash("idlePositionSensor") == 782384530, "varHash: idlePositionSensor");
+static_assert(varHash("alwaysWriteSdCard") == 787397010, "varHash: alwaysWriteSdCard");
+static_assert(varHash("etbWastegatePid.offset") == 794879319, "varHash: etbWastegatePid.offset");
+static_assert(varHash("ignitionOnTime") == 795671090, "varHash: ignitionOnTime");
+static_assert(varHash("vvt1etriggerStateIndex") == 797862280, "varHash: vvt1etriggerStateIndex");
+static_assert(varHash("firmwareVersion") == 799075048, "varHash: firmwareVersion");
+static_assert(varHash("alternatorPwmFrequency") == 799798215, "varHash: alternatorPwmFrequency");
+static_assert(varHash("boostisBelowClosedLoopThreshold") == 800627490, "varHash: boostisBelowClosedLoopThreshold");
+static_assert(varHash("auxLinear1") == 803810399, "varHash: auxLinear1");
+static_assert(varHash("auxLinear2") == 803810400, "varHash: auxLinear2");
+static_assert(varHash("auxLinear3") == 803810401, "varHash: auxLinear3");
+static_assert(varHash("auxLinear4") == 803810402, "varHash: auxLinear4");
+static_assert(varHash("acengineTooHot") == 810685564, "varHash: acengineTooHot");
+static_assert(varHash("usbBytesOut") == 815813454, "varHash: usbBytesOut");
+static_assert(varHash("vssFilterReciprocal1") == 816623708, "varHash: vssFilterReciprocal1");
+static_assert(varHash("vssFilterReciprocal2") == 816623709, "varHash: vssFilterReciprocal2");
+static_assert(varHash("vssFilterReciprocal3") == 816623710, "varHash: vssFilterReciprocal3");
+static_assert(varHash("vssFilterReciprocal4") == 816623711, "varHash: vssFilterReciprocal4");
+static_assert(varHash("fuelFlowRate") == 822501973, "varHash: fuelFlowRate");
+static_assert(varHash("luaLastCycleDuration") == 823476017, "varHash: luaLastCycleDuration");
+static_assert(varHash("vvt1evvtCurrentPosition") == 823985075, "varHash: vvt1evvtCurrentPosition");
+static_assert(varHash("disableWaterPumpAtSpeed") == 825446500, "varHash: disableWaterPumpAtSpeed");
+static_assert(varHash("tpsCondition") == 827982787, "varHash: tpsCondition");
+static_assert(varHash("fuelPumpisFuelPumpOn") == 831481498, "varHash: fuelPumpisFuelPumpOn");
+static_assert(varHash("waterPumpdisabledBySpeed") == 835169742, "varHash: waterPumpdisabledBySpeed");
+static_assert(varHash("etb1etbErrorCode") == 839236273, "varHash: etb1etbErrorCode");
+static_assert(varHash("useRawOutputToDriveIdleStepper") == 839486731, "varHash: useRawOutputToDriveIdleStepper");
+static_assert(varHash("overrideVvtTriggerGaps") == 840966724, "varHash: overrideVvtTriggerGaps");
+static_assert(varHash("wheelspeedRearAvgError") == 846844765, "varHash: wheelspeedRearAvgError");
+static_assert(varHash("disableWaterPumpWhenStoppedTimeout") == 848453110, "varHash: disableWaterPumpWhenStoppedTimeout");
+static_assert(varHash("boostClosedLoopYAxisValue") == 854100555, "varHash: boostClosedLoopYAxisValue");
+static_assert(varHash("canBoxTracTrimStep") == 858735714, "varHash: canBoxTracTrimStep");
+static_assert(varHash("fan1PwmEnabled") == 859066570, "varHash: fan1PwmEnabled");
+static_assert(varHash("rpmLaunchCondition") == 859283926, "varHash: rpmLaunchCondition");
+static_assert(varHash("instantMAPPREValue") == 861508808, "varHash: instantMAPPREValue");
+static_assert(varHash("accPedalSplit") == 864210494, "varHash: accPedalSplit");
+static_assert(varHash("idleidleClosedLoop") == 865747829, "varHash: idleidleClosedLoop");
+static_assert(varHash("wastegatePositionOpenedVoltage") == 866072300, "varHash: wastegatePositionOpenedVoltage");
+static_assert(varHash("fan2OnTemperature") == 871106583, "varHash: fan2OnTemperature");
+static_assert(varHash("lambdaProtectionRestoreRpm") == 872435040, "varHash: lambdaProtectionRestoreRpm");
+static_assert(varHash("lambdaProtectionRestoreTps") == 872437224, "varHash: lambdaProtectionRestoreTps");
+static_assert(varHash("compressorDischargeTemperature.config.resistance_1") == 878369917, "varHash: compressorDischargeTemperature.config.resistance_1");
+static_assert(varHash("compressorDischargeTemperature.config.resistance_2") == 878369918, "varHash: compressorDischargeTemperature.config.resistance_2");
+static_assert(varHash("compressorDischargeTemperature.config.resistance_3") == 878369919, "varHash: compressorDischargeTemperature.config.resistance_3");
+static_assert(varHash("isMapPredictionActive") == 884518764, "varHash: isMapPredictionActive");
+static_assert(varHash("canReWidebandFwDay") == 888763399, "varHash: canReWidebandFwDay");
+static_assert(varHash("canReWidebandFwMon") == 888773651, "varHash: canReWidebandFwMon");
+static_assert(varHash("fan1disabledBySpeed") == 890832495, "varHash: fan1disabledBySpeed");
+static_assert(varHash("knockDetectionUseDoubleFrequency") == 892958612, "varHash: knockDetectionUseDoubleFrequency");
+static_assert(varHash("vehicleSpeedKph1") == 893744554, "varHash: vehicleSpeedKph1");
+static_assert(varHash("vehicleSpeedKph2") == 893744555, "varHash: vehicleSpeedKph2");
+static_assert(varHash("vehicleSpeedKph3") == 893744556, "varHash: vehicleSpeedKph3");
+static_assert(varHash("vehicleSpeedKph4") == 893744557, "varHash: vehicleSpeedKph4");
+static_assert(varHash("knockSuppressMinRpm") == 893774675, "varHash: knockSuppressMinRpm");
+static_assert(varHash("knockSuppressMinTps") == 893776859, "varHash: knockSuppressMinTps");
+static_assert(varHash("ecumasterEgtToCan") == 895067939, "varHash: ecumasterEgtToCan");
+static_assert(varHash("maxInjectorDutyInstant") == 896753456, "varHash: maxInjectorDutyInstant");
+static_assert(varHash("startStopState") == 897099930, "varHash: startStopState");
+static_assert(varHash("boostrpmTooLow") == 899082431, "varHash: boostrpmTooLow");
+static_assert(varHash("dynoSaeTemperatureC") == 903483241, "varHash: dynoSaeTemperatureC");
+static_assert(varHash("rawAfr2") == 907240922, "varHash: rawAfr2");
+static_assert(varHash("rawMaf2") == 907666325, "varHash: rawMaf2");
+static_assert(varHash("cruiseControlInhibitDFCO") == 910249844, "varHash: cruiseControlInhibitDFCO");
+static_assert(varHash("assistedEtbPeriodSec") == 917458462, "varHash: assistedEtbPeriodSec");
+static_assert(varHash("enableExtendedCanBroadcast") == 923152418, "varHash: enableExtendedCanBroadcast");
+static_assert(varHash("etbTargetSmoothingFactor") == 923686462, "varHash: etbTargetSmoothingFactor");
+static_assert(varHash("cc_rpmBandHigh") == 924403790, "varHash: cc_rpmBandHigh");
+static_assert(varHash("sparkCutReasonBlinker") == 927388609, "varHash: sparkCutReasonBlinker");
+static_assert(varHash("map.sensorpre.highValue") == 937308829, "varHash: map.sensorpre.highValue");
+static_assert(varHash("useCltBasedRpmLimit") == 939816194, "varHash: useCltBasedRpmLimit");
+static_assert(varHash("mc33_hpfp_i_hold_off") == 944657936, "varHash: mc33_hpfp_i_hold_off");
+static_assert(varHash("luaDigitalState0") == 945288534, "varHash: luaDigitalState0");
+static_assert(varHash("luaDigitalState1") == 945288535, "varHash: luaDigitalState1");
+static_assert(varHash("luaDigitalState2") == 945288536, "varHash: luaDigitalState2");
+static_assert(varHash("luaDigitalState3") == 945288537, "varHash: luaDigitalState3");
+static_assert(varHash("consumeObdSensors") == 950993889, "varHash: consumeObdSensors");
+static_assert(varHash("auxSpeed1") == 957036309, "varHash: auxSpeed1");
+static_assert(varHash("auxSpeed2") == 957036310, "varHash: auxSpeed2");
+static_assert(varHash("auxSpeed3") == 957036311, "varHash: auxSpeed3");
+static_assert(varHash("auxSpeed4") == 957036312, "varHash: auxSpeed4");
+static_assert(varHash("useNoiselessTriggerDecoder") == 957244017, "varHash: useNoiselessTriggerDecoder");
+static_assert(varHash("cc_maxEtbAdjustmentClose") == 960719456, "varHash: cc_maxEtbAdjustmentClose");
+static_assert(varHash("tracMinMap") == 965059665, "varHash: tracMinMap");
+static_assert(varHash("tracMinRpm") == 965065602, "varHash: tracMinRpm");
+static_assert(varHash("tracMinTps") == 965067786, "varHash: tracMinTps");
+static_assert(varHash("schedulingUsedCount") == 967311941, "varHash: schedulingUsedCount");
+static_assert(varHash("boostPid.iFactor") == 971442495, "varHash: boostPid.iFactor");
+static_assert(varHash("mappreLowValueVoltage") == 973253643, "varHash: mappreLowValueVoltage");
+static_assert(varHash("acengineTooFast") == 982732799, "varHash: acengineTooFast");
+static_assert(varHash("acengineTooSlow") == 983211830, "varHash: acengineTooSlow");
+static_assert(varHash("fan1MaxPwm") == 983231621, "varHash: fan1MaxPwm");
+static_assert(varHash("turbochargerFilter") == 983814707, "varHash: turbochargerFilter");
+static_assert(varHash("vvt2etriggerCountersError") == 986597357, "varHash: vvt2etriggerCountersError");
+static_assert(varHash("triggerIgnoredToothCount") == 989545496, "varHash: triggerIgnoredToothCount");
+static_assert(varHash("rawHighFuelPressure") == 990714516, "varHash: rawHighFuelPressure");
+static_assert(varHash("driveWheelRevPerKm") == 991724096, "varHash: driveWheelRevPerKm");
+static_assert(varHash("fan1MinPwm") == 992359619, "varHash: fan1MinPwm");
+static_assert(varHash("epic_hall_inps18") == 992714408, "varHash: epic_hall_inps18");
+static_assert(varHash("enableFan2WithAc") == 993282195, "varHash: enableFan2WithAc");
+static_assert(varHash("forceIdleIgnitionUseDFCO") == 993647004, "varHash: forceIdleIgnitionUseDFCO");
+static_assert(varHash("afrTableYAxis") == 995190836, "varHash: afrTableYAxis");
+static_assert(varHash("camSyncOnSecondCrankRevolution") == 996346642, "varHash: camSyncOnSecondCrankRevolution");
+static_assert(varHash("temp_mapVvt_index") == 997197711, "varHash: temp_mapVvt_index");
+static_assert(varHash("dynoCarWheelTireWidthMm") == 1000921080, "varHash: dynoCarWheelTireWidthMm");
+static_assert(varHash("idleidle_deltaRpmAdj") == 1001494216, "varHash: idleidle_deltaRpmAdj");
+static_assert(varHash("boostisNotClosedLoop") == 1006880557, "varHash: boostisNotClosedLoop");
+static_assert(varHash("speedometerPulsePerKm") == 1007396714, "varHash: speedometerPulsePerKm");
+static_assert(varHash("triggerSecondaryFall") == 1016089632, "varHash: triggerSecondaryFall");
+static_assert(varHash("triggerSecondaryRise") == 1016529812, "varHash: triggerSecondaryRise");
+static_assert(varHash("etb1DutyCycle") == 1021133095, "varHash: etb1DutyCycle");
+static_assert(varHash("hpfpTargetDecay") == 1025426144, "varHash: hpfpTargetDecay");
+static_assert(varHash("stft.startupDelay") == 1028902582, "varHash: stft.startupDelay");
+static_assert(varHash("coilDutyCycle") == 1029096098, "varHash: coilDutyCycle");
+static_assert(varHash("waterPumpfan_pwm_started") == 1029911752, "varHash: waterPumpfan_pwm_started");
+static_assert(varHash("injAdvAssistStepDeg") == 1039339108, "varHash: injAdvAssistStepDeg");
+static_assert(varHash("ltitEnabled") == 1049828813, "varHash: ltitEnabled");
+static_assert(varHash("etb1boardEtbAdjustment") == 1055284435, "varHash: etb1boardEtbAdjustment");
+static_assert(varHash("neverWrite") == 1056486800, "varHash: neverWrite");
+static_assert(varHash("tpsaeburnskipinitial") == 1056521754, "varHash: tpsaeburnskipinitial");
+static_assert(varHash("etbJamTimeout") == 1057701663, "varHash: etbJamTimeout");
+static_assert(varHash("useCustomCLTSensor") == 1059939210, "varHash: useCustomCLTSensor");
+static_assert(varHash("knockm_knockThreshold") == 1060324714, "varHash: knockm_knockThreshold");
+static_assert(varHash("useAdvanceCorrectionsForCranking") == 1060606307, "varHash: useAdvanceCorrectionsForCranking");
+static_assert(varHash("idleIncrementalPidCic") == 1064399425, "varHash: idleIncrementalPidCic");
+static_assert(varHash("baroHasNoPressure") == 1067281211, "varHash: baroHasNoPressure");
+static_assert(varHash("luaCanRxWorkaround") == 1068374799, "varHash: luaCanRxWorkaround");
+static_assert(varHash("canBoxIdleUpRpm") == 1068607666, "varHash: canBoxIdleUpRpm");
+static_assert(varHash("nitrousDeactivationRpm") == 1072117635, "varHash: nitrousDeactivationRpm");
+static_assert(varHash("fan2OffTemperature") == 1077467605, "varHash: fan2OffTemperature");
+static_assert(varHash("usbBytesInPerSec") == 1080782767, "varHash: usbBytesInPerSec");
+static_assert(varHash("invertCamVVTSignal") == 1081026348, "varHash: invertCamVVTSignal");
+static_assert(varHash("rethrowHardFault") == 1081456939, "varHash: rethrowHardFault");
+static_assert(varHash("knockm_knockSpectrumChannelCyl") == 1082313329, "varHash: knockm_knockSpectrumChannelCyl");
+static_assert(varHash("tuningDetector") == 1082602292, "varHash: tuningDetector");
+static_assert(varHash("afrTableSwitch1Active") == 1083710597, "varHash: afrTableSwitch1Active");
+static_assert(varHash("fan1fan_pwm_started") == 1085574505, "varHash: fan1fan_pwm_started");
+static_assert(varHash("nitrousMinimumClt") == 1089348504, "varHash: nitrousMinimumClt");
+static_assert(varHash("nitrousMinimumTps") == 1089367148, "varHash: nitrousMinimumTps");
+static_assert(varHash("rpmSoftLimitWindowSize") == 1092207266, "varHash: rpmSoftLimitWindowSize");
+static_assert(varHash("testBenchIter") == 1092959609, "varHash: testBenchIter");
+static_assert(varHash("rpmSoftLimitFuelAdded") == 1094944685, "varHash: rpmSoftLimitFuelAdded");
+static_assert(varHash("fan2disabledBySpeed") == 1095642192, "varHash: fan2disabledBySpeed");
+static_assert(varHash("accelSelfTest") == 1095822215, "varHash: accelSelfTest");
+static_assert(varHash("isDoubleSolenoidIdle") == 1097520823, "varHash: isDoubleSolenoidIdle");
+static_assert(varHash("trgtriggerCountersError") == 1108896195, "varHash: trgtriggerCountersError");
+static_assert(varHash("isTuningNow") == 1109228234, "varHash: isTuningNow");
+static_assert(varHash("nitrousisNitrousTpsCondition") == 1110995303, "varHash: nitrousisNitrousTpsCondition");
+static_assert(varHash("fan1SoftStartSec") == 1115446416, "varHash: fan1SoftStartSec");
+static_assert(varHash("waterPump2disabledBySpeed") == 1117436160, "varHash: waterPump2disabledBySpeed");
+static_assert(varHash("tpsAccelFractionPeriod") == 1117566701, "varHash: tpsAccelFractionPeriod");
+static_assert(varHash("knockm_knockCount") == 1119572486, "varHash: knockm_knockCount");
+static_assert(varHash("crankingFuel.baseFuel") == 1119735859, "varHash: crankingFuel.baseFuel");
+static_assert(varHash("waterPump2notRunning") == 1120273998, "varHash: waterPump2notRunning");
+static_assert(varHash("tachSweepUsesTachCorrection") == 1126586273, "varHash: tachSweepUsesTachCorrection");
+static_assert(varHash("mc33_t_min_boost") == 1129109559, "varHash: mc33_t_min_boost");
+static_assert(varHash("knockm_knockLevel") == 1129887189, "varHash: knockm_knockLevel");
+static_assert(varHash("disableWaterPump2AtSpeed") == 1132871702, "varHash: disableWaterPump2AtSpeed");
+static_assert(varHash("ignitionLoad") == 1136482406, "varHash: ignitionLoad");
+static_assert(varHash("hpfpPeakPos") == 1145081382, "varHash: hpfpPeakPos");
+static_assert(varHash("idleStepperReactionTime") == 1145888170, "varHash: idleStepperReactionTime");
+static_assert(varHash("speedoSweepMax") == 1147267087, "varHash: speedoSweepMax");
+static_assert(varHash("deltaTpsAverageAlpha") == 1148935975, "varHash: deltaTpsAverageAlpha");
+static_assert(varHash("antilagTriggered") == 1155330306, "varHash: antilagTriggered");
+static_assert(varHash("kickStartCranking") == 1156367906, "varHash: kickStartCranking");
+static_assert(varHash("enableStagedInjection") == 1160459527, "varHash: enableStagedInjection");
+static_assert(varHash("transitionEventsCounter") == 1163075685, "varHash: transitionEventsCounter");
+static_assert(varHash("tpsDecelEnleanmentMultiplier") == 1164012327, "varHash: tpsDecelEnleanmentMultiplier");
+static_assert(varHash("etbWastegatePid.periodMs") == 1170565107, "varHash: etbWastegatePid.periodMs");
+static_assert(varHash("rpmHardLimit") == 1176614802, "varHash: rpmHardLimit");
+static_assert(varHash("epicInitHSHigh") == 1176668021, "varHash: epicInitHSHigh");
+static_assert(varHash("canBroadcastUseChannelTwo") == 1181153770, "varHash: canBroadcastUseChannelTwo");
+static_assert(varHash("etbSkipReinitWhileRunning") == 1181226300, "varHash: etbSkipReinitWhileRunning");
+static_assert(varHash("mc33_hvolt") == 1182499943, "varHash: mc33_hvolt");
+static_assert(varHash("rawMapPreFast") == 1188291586, "varHash: rawMapPreFast");
+static_assert(varHash("enableKline") == 1188684607, "varHash: enableKline");
+static_assert(varHash("smartChipRestartCounter") == 1192769173, "varHash: smartChipRestartCounter");
+static_assert(varHash("canWriteOk") == 1193280444, "varHash: canWriteOk");
+static_assert(varHash("tmf_deltap") == 1194318341, "varHash: tmf_deltap");
+static_assert(varHash("cc_rpmBandLow") == 1199371520, "varHash: cc_rpmBandLow");
+static_assert(varHash("mappreHighValueVoltage") == 1207257049, "varHash: mappreHighValueVoltage");
+static_assert(varHash("trigger.customTotalToothCount") == 1212570205, "varHash: trigger.customTotalToothCount");
+static_assert(varHash("cruiseControlReadBrakePedal") == 1217219128, "varHash: cruiseControlReadBrakePedal");
+static_assert(varHash("launchTimingRetard") == 1226423210, "varHash: launchTimingRetard");
+static_assert(varHash("canBroadcastEgt") == 1229072650, "varHash: canBroadcastEgt");
+static_assert(varHash("ALSEtbAdd") == 1232469673, "varHash: ALSEtbAdd");
+static_assert(varHash("rawFuelTankLevel") == 1238409345, "varHash: rawFuelTankLevel");
+static_assert(varHash("rawAuxLinear1") == 1238859945, "varHash: rawAuxLinear1");
+static_assert(varHash("rawAuxLinear2") == 1238859946, "varHash: rawAuxLinear2");
+static_assert(varHash("rawAuxLinear3") == 1238859947, "varHash: rawAuxLinear3");
+static_assert(varHash("rawAuxLinear4") == 1238859948, "varHash: rawAuxLinear4");
+static_assert(varHash("knockm_knockFrequencyStep") == 1239181931, "varHash: knockm_knockFrequencyStep");
+static_assert(varHash("dcOutput0") == 1242329357, "varHash: dcOutput0");
+static_assert(varHash("boostSpooledApplyToLowerWg") == 1243122194, "varHash: boostSpooledApplyToLowerWg");
+static_assert(varHash("etb1luaAdjustment") == 1246430386, "varHash: etb1luaAdjustment");
+static_assert(varHash("canReadCounter") == 1247316691, "varHash: canReadCounter");
+static_assert(varHash("wheelspeedFrontAvgError") == 1254214492, "varHash: wheelspeedFrontAvgError");
+static_assert(varHash("baroHighValueVoltage") == 1258057240, "varHash: baroHighValueVoltage");
+static_assert(varHash("activateSwitchCondition") == 1265600943, "varHash: activateSwitchCondition");
+static_assert(varHash("coastingFuelCutRpmHigh") == 1272017572, "varHash: coastingFuelCutRpmHigh");
+static_assert(varHash("TPSValue") == 1272048601, "varHash: TPSValue");
+static_assert(varHash("afr.value1") == 1273287930, "varHash: afr.value1");
+static_assert(varHash("afr.value2") == 1273287931, "varHash: afr.value2");
+static_assert(varHash("MAPValue") == 1281101952, "varHash: MAPValue");
+static_assert(varHash("mc33_t_bypass") == 1281862911, "varHash: mc33_t_bypass");
+static_assert(varHash("starterRelayDisable") == 1286045659, "varHash: starterRelayDisable");
+static_assert(varHash("noFuelTrimAfterDfcoTime") == 1286770247, "varHash: noFuelTrimAfterDfcoTime");
+static_assert(varHash("fan2fan_pwm_started") == 1290384202, "varHash: fan2fan_pwm_started");
+static_assert(varHash("etbWastegatePid.iFactor") == 1295852216, "varHash: etbWastegatePid.iFactor");
+static_assert(varHash("sd_active_rd") == 1301677708, "varHash: sd_active_rd");
+static_assert(varHash("sd_active_wr") == 1301677887, "varHash: sd_active_wr");
+static_assert(varHash("waterPump2fan_pwm_started") == 1312178170, "varHash: waterPump2fan_pwm_started");
+static_assert(varHash("wheelSlipRatioLeftRightFRONT") == 1312557699, "varHash: wheelSlipRatioLeftRightFRONT");
+static_assert(varHash("tpsAccelEnrichmentThreshold") == 1313479950, "varHash: tpsAccelEnrichmentThreshold");
+static_assert(varHash("trgtriggerSyncGapRatio") == 1313522810, "varHash: trgtriggerSyncGapRatio");
+static_assert(varHash("stage2InjSmallPwActive") == 1316625672, "varHash: stage2InjSmallPwActive");
+static_assert(varHash("fan1PwmFrequency") == 1318639761, "varHash: fan1PwmFrequency");
+static_assert(varHash("warningPeriod") == 1322924702, "varHash: warningPeriod");
+static_assert(varHash("calmerBurn") == 1327246448, "varHash: calmerBurn");
+static_assert(varHash("vehicleSpeedKphRearAvg") == 1328773633, "varHash: vehicleSpeedKphRearAvg");
+static_assert(varHash("auxTemp1") == 1331305978, "varHash: auxTemp1");
+static_assert(varHash("auxTemp2") == 1331305979, "varHash: auxTemp2");
+static_assert(varHash("tmf_airflow") == 1341529023, "varHash: tmf_airflow");
+static_assert(varHash("actpsTooHigh") == 1357163474, "varHash: actpsTooHigh");
+static_assert(varHash("currentVe") == 1359980579, "varHash: currentVe");
+static_assert(varHash("overrideTriggerGaps") == 1362186948, "varHash: overrideTriggerGaps");
+static_assert(varHash("needBurn") == 1368986296, "varHash: needBurn");
+static_assert(varHash("waterPumpExtraIdle") == 1369311244, "varHash: waterPumpExtraIdle");
+static_assert(varHash("globalFuelCorrection") == 1371979578, "varHash: globalFuelCorrection");
+static_assert(varHash("globalAFRTrim") == 1377697963, "varHash: globalAFRTrim");
+static_assert(varHash("isFlatShiftConditionSatisfied") == 1378388905, "varHash: isFlatShiftConditionSatisfied");
+static_assert(varHash("vvtPositionB1E") == 1384666002, "varHash: vvtPositionB1E");
+static_assert(varHash("vvtPositionB1I") == 1384666006, "varHash: vvtPositionB1I");
+static_assert(varHash("vvtPositionB2E") == 1384666035, "varHash: vvtPositionB2E");
+static_assert(varHash("vvtPositionB2I") == 1384666039, "varHash: vvtPositionB2I");
+static_assert(varHash("fan1ExtraIdle") == 1397079021, "varHash: fan1ExtraIdle");
+static_assert(varHash("mcp3208divider") == 1400650745, "varHash: mcp3208divider");
+static_assert(varHash("compressorDischargePressure") == 1404346549, "varHash: compressorDischargePressure");
+static_assert(varHash("isMapPreAveragingEnabled") == 1406475301, "varHash: isMapPreAveragingEnabled");
+static_assert(varHash("maxIdleVss") == 1408421157, "varHash: maxIdleVss");
+static_assert(varHash("enableWaterPump2") == 1411548995, "varHash: enableWaterPump2");
+static_assert(varHash("rawFuelLevel") == 1413130003, "varHash: rawFuelLevel");
+static_assert(varHash("canBoxIdleUpPercentage") == 1414277985, "varHash: canBoxIdleUpPercentage");
+static_assert(varHash("pidExtraForLowRpm") == 1414346958, "varHash: pidExtraForLowRpm");
+static_assert(varHash("sdTcharge_coff") == 1417236183, "varHash: sdTcharge_coff");
+static_assert(varHash("totalFuelConsumption") == 1417905588, "varHash: totalFuelConsumption");
+static_assert(varHash("isMafAveragingEnabled") == 1418003188, "varHash: isMafAveragingEnabled");
+static_assert(varHash("etb2etbCurrentTarget") == 1419463927, "varHash: etb2etbCurrentTarget");
+static_assert(varHash("secToMainRelayOff") == 1420262144, "varHash: secToMainRelayOff");
+static_assert(varHash("boostPid.pFactor") == 1421783686, "varHash: boostPid.pFactor");
+static_assert(varHash("idlebadTps") == 1422719489, "varHash: idlebadTps");
+static_assert(varHash("epic_dinp1") == 1425505569, "varHash: epic_dinp1");
+static_assert(varHash("epic_dinp2") == 1425505570, "varHash: epic_dinp2");
+static_assert(varHash("epic_dinp3") == 1425505571, "varHash: epic_dinp3");
+static_assert(varHash("epic_dinp4") == 1425505572, "varHash: epic_dinp4");
+static_assert(varHash("epic_dinp5") == 1425505573, "varHash: epic_dinp5");
+static_assert(varHash("epic_dinp6") == 1425505574, "varHash: epic_dinp6");
+static_assert(varHash("epic_dinp7") == 1425505575, "varHash: epic_dinp7");
+static_assert(varHash("epic_dinp8") == 1425505576, "varHash: epic_dinp8");
+static_assert(varHash("cylinderBore") == 1425664391, "varHash: cylinderBore");
+static_assert(varHash("ltft.maxAdd") == 1427207708, "varHash: ltft.maxAdd");
+static_assert(varHash("waterPump2hot") == 1433139079, "varHash: waterPump2hot");
+static_assert(varHash("waterPump2Pwm") == 1433148048, "varHash: waterPump2Pwm");
+static_assert(varHash("waterPumpcold") == 1434907500, "varHash: waterPumpcold");
+static_assert(varHash("boostPid.offset") == 1435801342, "varHash: boostPid.offset");
+static_assert(varHash("idlemightResetPid") == 1439272316, "varHash: idlemightResetPid");
+static_assert(varHash("widebandOnSecondBus") == 1445062086, "varHash: widebandOnSecondBus");
+static_assert(varHash("mapPredictionBlendDuration") == 1445156767, "varHash: mapPredictionBlendDuration");
+static_assert(varHash("lambdaProtectionEnable") == 1451020756, "varHash: lambdaProtectionEnable");
+static_assert(varHash("triggerCompCenterVolt") == 1455224910, "varHash: triggerCompCenterVolt");
+static_assert(varHash("tpsSecondaryADC") == 1457488876, "varHash: tpsSecondaryADC");
+static_assert(varHash("idlem_lastTargetRpm") == 1461165305, "varHash: idlem_lastTargetRpm");
+static_assert(varHash("fan2ExtraIdle") == 1464880398, "varHash: fan2ExtraIdle");
+static_assert(varHash("accPedalUnfiltered") == 1466421764, "varHash: accPedalUnfiltered");
+static_assert(varHash("tunerStudioSerialSpeed") == 1467553180, "varHash: tunerStudioSerialSpeed");
+static_assert(varHash("acPressure.v1") == 1470507575, "varHash: acPressure.v1");
+static_assert(varHash("acPressure.v2") == 1470507576, "varHash: acPressure.v2");
+static_assert(varHash("vvtControlMinClt") == 1470830477, "varHash: vvtControlMinClt");
+static_assert(varHash("vvtControlMinRpm") == 1470846937, "varHash: vvtControlMinRpm");
+static_assert(varHash("vvt2itriggerSyncGapRatio") == 1474641640, "varHash: vvt2itriggerSyncGapRatio");
+static_assert(varHash("baroSensor.lowValue") == 1474689568, "varHash: baroSensor.lowValue");
+static_assert(varHash("useBiQuadOnAuxSpeedSensors") == 1486014321, "varHash: useBiQuadOnAuxSpeedSensors");
+static_assert(varHash("idlePidDeactivationTpsThreshold") == 1490213215, "varHash: idlePidDeactivationTpsThreshold");
+static_assert(varHash("warningCounter") == 1492724763, "varHash: warningCounter");
+static_assert(varHash("hpfpMinAngle") == 1494394654, "varHash: hpfpMinAngle");
+static_assert(varHash("kLineBaudRate") == 1498075808, "varHash: kLineBaudRate");
+static_assert(varHash("acacPressureTooLow") == 1501267754, "varHash: acacPressureTooLow");
+static_assert(varHash("etb1tcEtbDrop") == 1502782136, "varHash: etb1tcEtbDrop");
+static_assert(varHash("isIatError") == 1505102185, "varHash: isIatError");
+static_assert(varHash("primingDelay") == 1506446058, "varHash: primingDelay");
+static_assert(varHash("dynoSaeRelativeHumidity") == 1509051617, "varHash: dynoSaeRelativeHumidity");
+static_assert(varHash("knockBankCyl1") == 1509355728, "varHash: knockBankCyl1");
+static_assert(varHash("knockBankCyl2") == 1509355729, "varHash: knockBankCyl2");
+static_assert(varHash("knockBankCyl3") == 1509355730, "varHash: knockBankCyl3");
+static_assert(varHash("knockBankCyl4") == 1509355731, "varHash: knockBankCyl4");
+static_assert(varHash("knockBankCyl5") == 1509355732, "varHash: knockBankCyl5");
+static_assert(varHash("knockBankCyl6") == 1509355733, "varHash: knockBankCyl6");
+static_assert(varHash("knockBankCyl7") == 1509355734, "varHash: knockBankCyl7");
+static_assert(varHash("knockBankCyl8") == 1509355735, "varHash: knockBankCyl8");
+static_assert(varHash("knockBankCyl9") == 1509355736, "varHash: knockBankCyl9");
+static_assert(varHash("waterPump2AcAdder") == 1512410464, "varHash: waterPump2AcAdder");
+static_assert(varHash("overDwellCounter") == 1513852665, "varHash: overDwellCounter");
+static_assert(varHash("veBlend1BlendMode") == 1516831168, "varHash: veBlend1BlendMode");
+static_assert(varHash("lua.acRequestState") == 1517904291, "varHash: lua.acRequestState");
+static_assert(varHash("tpsAeResetsEgo") == 1519167539, "varHash: tpsAeResetsEgo");
+static_assert(varHash("rawBattery") == 1520918538, "varHash: rawBattery");
+static_assert(varHash("ALSMaxCLT") == 1523813390, "varHash: ALSMaxCLT");
+static_assert(varHash("ALSMaxRPM") == 1523829850, "varHash: ALSMaxRPM");
+static_assert(varHash("ALSMaxTPS") == 1523832034, "varHash: ALSMaxTPS");
+static_assert(varHash("injectionPrimingCounter") == 1526237246, "varHash: injectionPrimingCounter");
+static_assert(varHash("ALSMinCLT") == 1532941388, "varHash: ALSMinCLT");
+static_assert(varHash("ALSMinRPM") == 1532957848, "varHash: ALSMinRPM");
+static_assert(varHash("tps12Split") == 1533250027, "varHash: tps12Split");
+static_assert(varHash("sd_airflow") == 1535022703, "varHash: sd_airflow");
+static_assert(varHash("vssGearRatio1") == 1535414256, "varHash: vssGearRatio1");
+static_assert(varHash("vssGearRatio2") == 1535414257, "varHash: vssGearRatio2");
+static_assert(varHash("vssGearRatio3") == 1535414258, "varHash: vssGearRatio3");
+static_assert(varHash("vssGearRatio4") == 1535414259, "varHash: vssGearRatio4");
+static_assert(varHash("mafAirmass") == 1536841513, "varHash: mafAirmass");
+static_assert(varHash("skippedWheelOnCam") == 1538579992, "varHash: skippedWheelOnCam");
+static_assert(varHash("coilState10") == 1539654222, "varHash: coilState10");
+static_assert(varHash("coilState11") == 1539654223, "varHash: coilState11");
+static_assert(varHash("coilState12") == 1539654224, "varHash: coilState12");
+static_assert(varHash("verboseVVTDecoding") == 1540420600, "varHash: verboseVVTDecoding");
+static_assert(varHash("assistedEtbSettleWindowSec") == 1541154756, "varHash: assistedEtbSettleWindowSec");
+static_assert(varHash("dynoCarWheelDiaInch") == 1541525498, "varHash: dynoCarWheelDiaInch");
+static_assert(varHash("injector.flow") == 1542550121, "varHash: injector.flow");
+static_assert(varHash("etbWastegatePid.maxValue") == 1543085651, "varHash: etbWastegatePid.maxValue");
+static_assert(varHash("externalRusEfiGdiModule") == 1546871344, "varHash: externalRusEfiGdiModule");
+static_assert(varHash("accelerometerFds") == 1552403965, "varHash: accelerometerFds");
+static_assert(varHash("accelerometerHPM") == 1552406533, "varHash: accelerometerHPM");
+static_assert(varHash("accelerometerOrd") == 1552414213, "varHash: accelerometerOrd");
+static_assert(varHash("wastegateDcStatus.dTerm") == 1554961855, "varHash: wastegateDcStatus.dTerm");
+static_assert(varHash("wastegateDcStatus.error") == 1556089965, "varHash: wastegateDcStatus.error");
+static_assert(varHash("wastegateDcStatus.iTerm") == 1560891460, "varHash: wastegateDcStatus.iTerm");
+static_assert(varHash("knockSpectrumSensitivity") == 1561929785, "varHash: knockSpectrumSensitivity");
+static_assert(varHash("idleRpmPid.periodMs") == 1562875200, "varHash: idleRpmPid.periodMs");
+static_assert(varHash("veTableYAxis") == 1568071542, "varHash: veTableYAxis");
+static_assert(varHash("isClutchActivated") == 1569151513, "varHash: isClutchActivated");
+static_assert(varHash("wastegateDcStatus.pTerm") == 1569192907, "varHash: wastegateDcStatus.pTerm");
+static_assert(varHash("maxAcClt") == 1569342546, "varHash: maxAcClt");
+static_assert(varHash("maxAcRpm") == 1569359006, "varHash: maxAcRpm");
+static_assert(varHash("maxAcTps") == 1569361190, "varHash: maxAcTps");
+static_assert(varHash("coastingFuelCutEnabled") == 1570088896, "varHash: coastingFuelCutEnabled");
+static_assert(varHash("iatSensorPulldown") == 1570551154, "varHash: iatSensorPulldown");
+static_assert(varHash("etb2tcEtbDrop") == 1570583513, "varHash: etb2tcEtbDrop");
+static_assert(varHash("vvt1ivvtToothDurations0") == 1574758390, "varHash: vvt1ivvtToothDurations0");
+static_assert(varHash("acrDisablePhase") == 1574876352, "varHash: acrDisablePhase");
+static_assert(varHash("etb.periodMs") == 1580101425, "varHash: etb.periodMs");
+static_assert(varHash("mapCamPrevToothAngle") == 1581624998, "varHash: mapCamPrevToothAngle");
+static_assert(varHash("veBlend2BlendMode") == 1584632545, "varHash: veBlend2BlendMode");
+static_assert(varHash("assistedEtbRotateIterations") == 1589865105, "varHash: assistedEtbRotateIterations");
+static_assert(varHash("tChargeAirFlowMax") == 1590125629, "varHash: tChargeAirFlowMax");
+static_assert(varHash("pedalToTpsIndex") == 1596433789, "varHash: pedalToTpsIndex");
+static_assert(varHash("afrExpAverageAlpha") == 1597749004, "varHash: afrExpAverageAlpha");
+static_assert(varHash("normalizedCylinderFilling") == 1599780729, "varHash: normalizedCylinderFilling");
+static_assert(varHash("idlecurrentIdlePosition") == 1601709561, "varHash: idlecurrentIdlePosition");
+static_assert(varHash("injectorFault") == 1608791711, "varHash: injectorFault");
+static_assert(varHash("fuelClosedLoopCorrectionEnabled") == 1611799720, "varHash: fuelClosedLoopCorrectionEnabled");
+static_assert(varHash("flashWriteDelay") == 1615716653, "varHash: flashWriteDelay");
+static_assert(varHash("displayLogicLevelsInEngineSniffer") == 1616873838, "varHash: displayLogicLevelsInEngineSniffer");
+static_assert(varHash("DriverThrottleIntent") == 1620085753, "varHash: DriverThrottleIntent");
+static_assert(varHash("oilTemp") == 1628523935, "varHash: oilTemp");
+static_assert(varHash("overDwellNotScheduledCounter") == 1629214715, "varHash: overDwellNotScheduledCounter");
+static_assert(varHash("extiOverflowCount") == 1630166812, "varHash: extiOverflowCount");
+static_assert(varHash("mapVvt_MAP_AT_CYCLE_COUNT") == 1637661099, "varHash: mapVvt_MAP_AT_CYCLE_COUNT");
+static_assert(varHash("mapSyncThreshold") == 1640008461, "varHash: mapSyncThreshold");
+static_assert(varHash("enableVerboseCanTx") == 1643181024, "varHash: enableVerboseCanTx");
+static_assert(varHash("acPressure") == 1644550754, "varHash: acPressure");
+static_assert(varHash("can_call_last_arg") == 1646218718, "varHash: can_call_last_arg");
+static_assert(varHash("can_call_last_ret") == 1646236815, "varHash: can_call_last_ret");
+static_assert(varHash("lua.fuelAdd") == 1649801578, "varHash: lua.fuelAdd");
+static_assert(varHash("sdAirMassInOneCylinder") == 1650433343, "varHash: sdAirMassInOneCylinder");
+static_assert(varHash("maxInjectorDutySustained") == 1651400031, "varHash: maxInjectorDutySustained");
+static_assert(varHash("idleEntryRampInterpolateAngle") == 1657973395, "varHash: idleEntryRampInterpolateAngle");
+static_assert(varHash("nitrousMinimumVehicleSpeed") == 1658738502, "varHash: nitrousMinimumVehicleSpeed");
+static_assert(varHash("mafMeasured2") == 1663359009, "varHash: mafMeasured2");
+static_assert(varHash("etbNeutralPosition") == 1664668368, "varHash: etbNeutralPosition");
+static_assert(varHash("can_call_last_func_id") == 1665682844, "varHash: can_call_last_func_id");
+static_assert(varHash("cc_speedDeadBandLow") == 1673944848, "varHash: cc_speedDeadBandLow");
+static_assert(varHash("dfcoDelay") == 1676700208, "varHash: dfcoDelay");
+static_assert(varHash("useSmoothedLambda") == 1677542038, "varHash: useSmoothedLambda");
+static_assert(varHash("injAdvAssistStepCycles") == 1678478519, "varHash: injAdvAssistStepCycles");
+static_assert(varHash("tmf_pratio") == 1678964986, "varHash: tmf_pratio");
+static_assert(varHash("lua.disableDecelerationFuelCutOff") == 1680936043, "varHash: lua.disableDecelerationFuelCutOff");
+static_assert(varHash("mafMinBufferLength") == 1685154329, "varHash: mafMinBufferLength");
+static_assert(varHash("tcUseSparkSkip") == 1686979713, "varHash: tcUseSparkSkip");
+static_assert(varHash("isEnabled0") == 1691876092, "varHash: isEnabled0");
+static_assert(varHash("frequencyMafMeasured") == 1692742817, "varHash: frequencyMafMeasured");
+static_assert(varHash("fuelLevelLowThresholdVoltage") == 1697484698, "varHash: fuelLevelLowThresholdVoltage");
+static_assert(varHash("idleRpmPid.iFactor") == 1698191973, "varHash: idleRpmPid.iFactor");
+static_assert(varHash("isSwitchActivated") == 1699495432, "varHash: isSwitchActivated");
+static_assert(varHash("RPMValue") == 1699696209, "varHash: RPMValue");
+static_assert(varHash("rpmForIgnitionTableDot") == 1700636875, "varHash: rpmForIgnitionTableDot");
+static_assert(varHash("tpsExtraShotMult") == 1711503040, "varHash: tpsExtraShotMult");
+static_assert(varHash("epicCanAllowSetVar") == 1713787596, "varHash: epicCanAllowSetVar");
+static_assert(varHash("lambdaValue2") == 1718832245, "varHash: lambdaValue2");
+static_assert(varHash("nitrousisNitrousAfrCondition") == 1719590281, "varHash: nitrousisNitrousAfrCondition");
+static_assert(varHash("vvt2evvtToothDurations0") == 1721400659, "varHash: vvt2evvtToothDurations0");
+static_assert(varHash("speedCondition") == 1722712413, "varHash: speedCondition");
+static_assert(varHash("enableWaterPumpWithAc") == 1723460785, "varHash: enableWaterPumpWithAc");
+static_assert(varHash("engineMakeCodeNameCrc16") == 1726931380, "varHash: engineMakeCodeNameCrc16");
+static_assert(varHash("waterPumphot") == 1735444309, "varHash: waterPumphot");
+static_assert(varHash("waterPumpPwm") == 1735453278, "varHash: waterPumpPwm");
+static_assert(varHash("aeEngageCnt") == 1737199159, "varHash: aeEngageCnt");
+static_assert(varHash("tcUseETB") == 1737683300, "varHash: tcUseETB");
+static_assert(varHash("idleisIdleCoasting") == 1739403413, "varHash: idleisIdleCoasting");
+static_assert(varHash("etb2jamTimer") == 1741054027, "varHash: etb2jamTimer");
+static_assert(varHash("iacByTpsDecayTime") == 1742748825, "varHash: iacByTpsDecayTime");
+static_assert(varHash("fuelCutReasonBlinker") == 1745186508, "varHash: fuelCutReasonBlinker");
+static_assert(varHash("etbWastegatePid.pFactor") == 1746193407, "varHash: etbWastegatePid.pFactor");
+static_assert(varHash("fastAdcConversionCount") == 1749059722, "varHash: fastAdcConversionCount");
+static_assert(varHash("useTableForDfcoMap") == 1750679771, "varHash: useTableForDfcoMap");
+static_assert(varHash("idleTimingPid.minValue") == 1752481431, "varHash: idleTimingPid.minValue");
+static_assert(varHash("rpmHardLimitHyst") == 1756514810, "varHash: rpmHardLimitHyst");
+static_assert(varHash("lambdaProtectionMinRpm") == 1758659040, "varHash: lambdaProtectionMinRpm");
+static_assert(varHash("lambdaProtectionMinTps") == 1758661224, "varHash: lambdaProtectionMinTps");
+static_assert(varHash("stoichRatioPrimary") == 1762426578, "varHash: stoichRatioPrimary");
+static_assert(varHash("luaInvocationCounter") == 1766132801, "varHash: luaInvocationCounter");
+static_assert(varHash("measureMafOnlyInOneCylinder") == 1769191040, "varHash: measureMafOnlyInOneCylinder");
+static_assert(varHash("baroCounts") == 1773847813, "varHash: baroCounts");
+static_assert(varHash("calibrationMode") == 1774505810, "varHash: calibrationMode");
+static_assert(varHash("stft.cell.maxAdd") == 1779308433, "varHash: stft.cell.maxAdd");
+static_assert(varHash("analogInputDividerCoefficient") == 1779689293, "varHash: analogInputDividerCoefficient");
+static_assert(varHash("rawAmbientTemp") == 1781305509, "varHash: rawAmbientTemp");
+static_assert(varHash("idlem_isCoastingAdvance") == 1790577077, "varHash: idlem_isCoastingAdvance");
+static_assert(varHash("useBiQuadOnAuxSpeedSensors1") == 1793832386, "varHash: useBiQuadOnAuxSpeedSensors1");
+static_assert(varHash("useBiQuadOnAuxSpeedSensors2") == 1793832387, "varHash: useBiQuadOnAuxSpeedSensors2");
+static_assert(varHash("useBiQuadOnAuxSpeedSensors3") == 1793832388, "varHash: useBiQuadOnAuxSpeedSensors3");
+static_assert(varHash("useBiQuadOnAuxSpeedSensors4") == 1793832389, "varHash: useBiQuadOnAuxSpeedSensors4");
+static_assert(varHash("can_blend_olboost_1_toggle") == 1805010797, "varHash: can_blend_olboost_1_toggle");
+static_assert(varHash("SparkLatencyCorrection") == 1806457198, "varHash: SparkLatencyCorrection");
+static_assert(varHash("useIdleVeWhileCoasting") == 1807072764, "varHash: useIdleVeWhileCoasting");
+static_assert(varHash("tmf_tbarea") == 1816529498, "varHash: tmf_tbarea");
+static_assert(varHash("running.coolantTemperatureCoefficient") == 1822238385, "varHash: running.coolantTemperatureCoefficient");
+static_assert(varHash("ALSMaxDuration") == 1830002033, "varHash: ALSMaxDuration");
+static_assert(varHash("isUsbConnected") == 1836976702, "varHash: isUsbConnected");
+static_assert(varHash("idleluaAdd") == 1837662926, "varHash: idleluaAdd");
+static_assert(varHash("stftIgnoreErrorMagnitude") == 1838375282, "varHash: stftIgnoreErrorMagnitude");
+static_assert(varHash("fan2cranking") == 1841224793, "varHash: fan2cranking");
+static_assert(varHash("etbEnabled") == 1842618379, "varHash: etbEnabled");
+static_assert(varHash("tracDisabled") == 1845538439, "varHash: tracDisabled");
+static_assert(varHash("usbBytesIn") == 1846828749, "varHash: usbBytesIn");
+static_assert(varHash("boostOpenLoopYAxisValue") == 1848010723, "varHash: boostOpenLoopYAxisValue");
+static_assert(varHash("lambdaMonitorCut") == 1849938842, "varHash: lambdaMonitorCut");
+static_assert(varHash("alternatorControl.iFactor") == 1850657816, "varHash: alternatorControl.iFactor");
+static_assert(varHash("startButtonSuppressOnStartUpMs") == 1856486116, "varHash: startButtonSuppressOnStartUpMs");
+static_assert(varHash("waterPump2OffTemperature") == 1859031173, "varHash: waterPump2OffTemperature");
+static_assert(varHash("wheelspeedRLerror") == 1867870099, "varHash: wheelspeedRLerror");
+static_assert(varHash("etb.dFactor") == 1879050865, "varHash: etb.dFactor");
+static_assert(varHash("idleTimingSoftEntryTime") == 1881137064, "varHash: idleTimingSoftEntryTime");
+static_assert(varHash("epic_dinps18") == 1892444332, "varHash: epic_dinps18");
+static_assert(varHash("outputRequestPeriod") == 1894184322, "varHash: outputRequestPeriod");
+static_assert(varHash("canBroadcastCams") == 1904613262, "varHash: canBroadcastCams");
+static_assert(varHash("mafLowPassCutoffHz") == 1907595115, "varHash: mafLowPassCutoffHz");
+static_assert(varHash("tmf_maxairflow") == 1910464965, "varHash: tmf_maxairflow");
+static_assert(varHash("kLinePeriodUs") == 1915146851, "varHash: kLinePeriodUs");
+static_assert(varHash("isInjectionEnabled") == 1917301199, "varHash: isInjectionEnabled");
+static_assert(varHash("mapVvt_sync_counter") == 1921134430, "varHash: mapVvt_sync_counter");
+static_assert(varHash("idleisIdleClosedLoop") == 1921464113, "varHash: idleisIdleClosedLoop");
+static_assert(varHash("isTorqueReductionTriggerPinValid") == 1922853657, "varHash: isTorqueReductionTriggerPinValid");
+static_assert(varHash("cltSensorPulldown") == 1925843479, "varHash: cltSensorPulldown");
+static_assert(varHash("wheelSlipRatioFrontRear") == 1925854276, "varHash: wheelSlipRatioFrontRear");
+static_assert(varHash("trgvvtCurrentPosition") == 1926227562, "varHash: trgvvtCurrentPosition");
+static_assert(varHash("launchActivatePinState") == 1928406809, "varHash: launchActivatePinState");
+static_assert(varHash("acIdleExtraOffset") == 1933500210, "varHash: acIdleExtraOffset");
+static_assert(varHash("veValue") == 1933507837, "varHash: veValue");
+static_assert(varHash("idleRpmPid.maxValue") == 1935395744, "varHash: idleRpmPid.maxValue");
+static_assert(varHash("idleidleState") == 1939661442, "varHash: idleidleState");
+static_assert(varHash("ltft.timeConstant") == 1941168166, "varHash: ltft.timeConstant");
+static_assert(varHash("stoichRatioSecondary") == 1945443830, "varHash: stoichRatioSecondary");
+static_assert(varHash("waterPump2MaxPwm") == 1945579510, "varHash: waterPump2MaxPwm");
+static_assert(varHash("tmf_sd_engineload_split") == 1946185602, "varHash: tmf_sd_engineload_split");
+static_assert(varHash("etb.maxValue") == 1952621969, "varHash: etb.maxValue");
+static_assert(varHash("maxAcPressure") == 1953870952, "varHash: maxAcPressure");
+static_assert(varHash("waterPump2MinPwm") == 1954707508, "varHash: waterPump2MinPwm");
+static_assert(varHash("mapCamDetectionAnglePosition") == 1958105647, "varHash: mapCamDetectionAnglePosition");
+static_assert(varHash("idlePidRpmUpperLimit") == 1962548154, "varHash: idlePidRpmUpperLimit");
+static_assert(varHash("canWriteNotOk") == 1964920685, "varHash: canWriteNotOk");
+static_assert(varHash("fan2m_state") == 1966562169, "varHash: fan2m_state");
+static_assert(varHash("ppsLowPassCutoffHz") == 1970088010, "varHash: ppsLowPassCutoffHz");
+static_assert(varHash("dtTuneSequential") == 1971361492, "varHash: dtTuneSequential");
+static_assert(varHash("knockFrequency") == 1972605869, "varHash: knockFrequency");
+static_assert(varHash("isTimeConditionSatisfied") == 1973309843, "varHash: isTimeConditionSatisfied");
+static_assert(varHash("alternatorControl.offset") == 1983046327, "varHash: alternatorControl.offset");
+static_assert(varHash("knockm_knockFuelTrimMultiplier") == 1984514028, "varHash: knockm_knockFuelTrimMultiplier");
+static_assert(varHash("useIdleTimingTargetErrorMode") == 1986632654, "varHash: useIdleTimingTargetErrorMode");
+static_assert(varHash("can_call_counter_dlc_ok") == 1986829660, "varHash: can_call_counter_dlc_ok");
+static_assert(varHash("can_call_last_src_id") == 1986934008, "varHash: can_call_last_src_id");
+static_assert(varHash("auxTempSensor2.config.resistance_1") == 1988973320, "varHash: auxTempSensor2.config.resistance_1");
+static_assert(varHash("auxTempSensor2.config.resistance_2") == 1988973321, "varHash: auxTempSensor2.config.resistance_2");
+static_assert(varHash("auxTempSensor2.config.resistance_3") == 1988973322, "varHash: auxTempSensor2.config.resistance_3");
+static_assert(varHash("knockRetardAggression") == 1989648303, "varHash: knockRetardAggression");
+static_assert(varHash("tcUseIgnTiming") == 1989689967, "varHash: tcUseIgnTiming");
+static_assert(varHash("isMafAveraging") == 1990113001, "varHash: isMafAveraging");
+static_assert(varHash("vvtOutput") == 1990697206, "varHash: vvtOutput");
+static_assert(varHash("fuelPumpfuelPumpForceState") == 1995425265, "varHash: fuelPumpfuelPumpForceState");
+static_assert(varHash("tcuEnabled") == 1997663388, "varHash: tcuEnabled");
+static_assert(varHash("disablemax31855") == 2010183589, "varHash: disablemax31855");
+static_assert(varHash("fuelLevelHighThresholdVoltage") == 2012123720, "varHash: fuelLevelHighThresholdVoltage");
+static_assert(varHash("etb1etbPpsErrorCounter") == 2014293065, "varHash: etb1etbPpsErrorCounter");
+static_assert(varHash("cruiseControlAllowPedalUpToEngage") == 2015832005, "varHash: cruiseControlAllowPedalUpToEngage");
+static_assert(varHash("cruiseControlEnabled") == 2016604988, "varHash: cruiseControlEnabled");
+static_assert(varHash("etbFreq") == 2016887022, "varHash: etbFreq");
+static_assert(varHash("totalTriggerErrorCounter") == 2018173863, "varHash: totalTriggerErrorCounter");
+static_assert(varHash("est_temp_charge_c") == 2018177457, "varHash: est_temp_charge_c");
+static_assert(varHash("est_temp_charge_k") == 2018177465, "varHash: est_temp_charge_k");
+static_assert(varHash("ltitApplyToFuel") == 2022304759, "varHash: ltitApplyToFuel");
+static_assert(varHash("afr2GasolineScale") == 2029444810, "varHash: afr2GasolineScale");
+static_assert(varHash("dfcoRetardRampInTime") == 2030571545, "varHash: dfcoRetardRampInTime");
+static_assert(varHash("loadForIgnitionTableDot") == 2031242236, "varHash: loadForIgnitionTableDot");
+static_assert(varHash("idleidle_timeInIdle") == 2031699396, "varHash: idleidle_timeInIdle");
+static_assert(varHash("highPressureFuel.v1") == 2032707103, "varHash: highPressureFuel.v1");
+static_assert(varHash("highPressureFuel.v2") == 2032707104, "varHash: highPressureFuel.v2");
+static_assert(varHash("rawWastegatePosition") == 2039421097, "varHash: rawWastegatePosition");
+static_assert(varHash("rusefiVerbose29b") == 2043354390, "varHash: rusefiVerbose29b");
+static_assert(varHash("maf_airflow") == 2045663596, "varHash: maf_airflow");
+static_assert(varHash("maf_airmass") == 2045903304, "varHash: maf_airmass");
+static_assert(varHash("actualLastInjSTG2PreSmallPw") == 2046400891, "varHash: actualLastInjSTG2PreSmallPw");
+static_assert(varHash("isFasterEngineSpinUpEnabled") == 2048390406, "varHash: isFasterEngineSpinUpEnabled");
+static_assert(varHash("lua.luaDisableEtb") == 2055342630, "varHash: lua.luaDisableEtb");
+static_assert(varHash("cruiseControlReadClutchUp") == 2057611093, "varHash: cruiseControlReadClutchUp");
+static_assert(varHash("stimulatorBench") == 2068951385, "varHash: stimulatorBench");
+static_assert(varHash("etb1trim") == 2069994349, "varHash: etb1trim");
+static_assert(varHash("rawOilPressure") == 2070002124, "varHash: rawOilPressure");
+static_assert(varHash("airByRpmTaper") == 2070727975, "varHash: airByRpmTaper");
+static_assert(varHash("crankingTimingAngle") == 2071041633, "varHash: crankingTimingAngle");
+static_assert(varHash("etb2trim") == 2071180270, "varHash: etb2trim");
+static_assert(varHash("boostisBoostControlled") == 2071622501, "varHash: boostisBoostControlled");
+static_assert(varHash("rawAcPressure") == 2079600300, "varHash: rawAcPressure");
+static_assert(varHash("injectorState1") == 2081101045, "varHash: injectorState1");
+static_assert(varHash("injectorState2") == 2081101046, "varHash: injectorState2");
+static_assert(varHash("injectorState3") == 2081101047, "varHash: injectorState3");
+static_assert(varHash("injectorState4") == 2081101048, "varHash: injectorState4");
+static_assert(varHash("injectorState5") == 2081101049, "varHash: injectorState5");
+static_assert(varHash("injectorState6") == 2081101050, "varHash: injectorState6");
+static_assert(varHash("injectorState7") == 2081101051, "varHash: injectorState7");
+static_assert(varHash("injectorState8") == 2081101052, "varHash: injectorState8");
+static_assert(varHash("injectorState9") == 2081101053, "varHash: injectorState9");
+static_assert(varHash("cc_minSpeed") == 2083134143, "varHash: cc_minSpeed");
+static_assert(varHash("fan2notRunning") == 2086676382, "varHash: fan2notRunning");
+static_assert(varHash("Gego") == 2090288615, "varHash: Gego");
+static_assert(varHash("fuelLevelAveragingAlpha") == 2094922339, "varHash: fuelLevelAveragingAlpha");
+static_assert(varHash("etbStatus.resetCounter") == 2098956565, "varHash: etbStatus.resetCounter");
+static_assert(varHash("isRunningBench") == 2099290370, "varHash: isRunningBench");
+static_assert(varHash("throttlePedalWOTVoltage") == 2099527693, "varHash: throttlePedalWOTVoltage");
+static_assert(varHash("wheelspeedRRerror") == 2102682457, "varHash: wheelspeedRRerror");
+static_assert(varHash("canWriteEnabled") == 2104472173, "varHash: canWriteEnabled");
+static_assert(varHash("cc_setpoint_adjust_rate") == 2109872789, "varHash: cc_setpoint_adjust_rate");
+static_assert(varHash("tps1_diameter") == 2112480535, "varHash: tps1_diameter");
+static_assert(varHash("tChargeAirCoefMax") == 2115625058, "varHash: tChargeAirCoefMax");
+static_assert(varHash("tChargeAirCoefMin") == 2115625312, "varHash: tChargeAirCoefMin");
+static_assert(varHash("triggerSimulatorRpm") == 2122875976, "varHash: triggerSimulatorRpm");
+static_assert(varHash("targetAFR") == 2122891301, "varHash: targetAFR");
+static_assert(varHash("waterPumpAcAdder") == 2122945582, "varHash: waterPumpAcAdder");
+static_assert(varHash("waterPump2PwmEnabled") == 2130109627, "varHash: waterPump2PwmEnabled");
+static_assert(varHash("vvt2itriggerCountersError") == 2130850289, "varHash: vvt2itriggerCountersError");
+static_assert(varHash("stepper_dc_use_two_wires") == 2136379132, "varHash: stepper_dc_use_two_wires");
+
+#endif  // VAR_CATALOG_DATA_H
@@ -0,0 +1,270 @@
+#include "var_poller.h"
+#include "can_manager.h"
+#include "can_bus_stats.h"
+#include "var_catalog.h"
+#include "var_cache.h"
+#include "config_store.h"
+
+// 全局变量轮询实例
+VarPoller varPoller;
+
+VarPoller::VarPoller() {
+  for (uint8_t i = 0; i < VAR_ECU_COUNT; i++) {
+    lanes[i].ecuId = VAR_ECU_IDS[i];
+  }
+  clear();
+}
+
+void VarPoller::begin() {
+  // VAR_ECU_IDS 中的 ECU_ID 指运行时配置的主ECU
+  for (uint8_t i = 0; i < VAR_ECU_COUNT; i++) {
+    lanes[i].ecuId = VAR_ECU_IDS[i] == ECU_ID ? configStore.get().ecuId : VAR_ECU_IDS[i];
+  }
+}
+
+// ============================================================================
+// 批次
+// ============================================================================
+
+void VarPoller::clear() {
+  for (VarPollLane& lane : lanes) {
+    lane.head = VAR_POOL_END;
+    lane.tail = VAR_POOL_END;
+    lane.current = VAR_POOL_END;
+    lane.inFlight = false;
+    lane.deferred = false;
+    lane.sendFailed = false;
+  }
+  poolCount = 0;
+  active = false;
+}
+
+int16_t VarPoller::add(uint8_t ecuId, int32_t varHash) {
+  VarPollLane* lane = laneFor(ecuId);
+  if (lane == nullptr) return -1;
+
+  for (uint8_t i = 0; i < poolCount; i++) {
+    if (poolHashes[i] == varHash && poolLane[i] == lane) return i;
+  }
+  if (poolCount >= MAX_BATCH_VARS) return -1;
+
+  uint8_t entry = poolCount++;
+  poolHashes[entry] = varHash;
+  poolLane[entry] = lane;
+  writeInt32BigEndian(varHash, poolEntries[entry]);
+  poolNext[entry] = VAR_POOL_END;
+  poolAnswered[entry] = false;
+  if (lane->tail == VAR_POOL_END) {
+    lane->head = entry;
+  } else {
+    poolNext[lane->tail] = entry;
+  }
+  lane->tail = entry;
+  return entry;
+}
+
+void VarPoller::start(uint32_t batchStartMicros) {
+  this->batchStartMicros = batchStartMicros;
+  active = true;
+
+  uint32_t now = millis();
+  for (VarPollLane& lane : lanes) {
+    lane.current = lane.head;
+    if (lane.current != VAR_POOL_END) requestNext(lane, now);
+  }
+}
+
+void VarPoller::finish() {
+  clear();
+}
+
+bool VarPoller::lanesDone() const {
+  for (const VarPollLane& lane : lanes) {
+    if (lane.current != VAR_POOL_END) return false;
+  }
+  return true;
+}
+
+VarPollLane* VarPoller::laneFor(uint8_t ecuId) {
+  for (VarPollLane& lane : lanes) {
+    if (lane.ecuId == ecuId) return &lane;
+  }
+  return nullptr;
+}
+
+const VarPollLane* VarPoller::laneFor(uint8_t ecuId) const {
+  for (const VarPollLane& lane : lanes) {
+    if (lane.ecuId == ecuId) return &lane;
+  }
+  return nullptr;
+}
+
+// ============================================================================
+// 请求
+// ============================================================================
+
+void VarPoller::advance(VarPollLane& lane) {
+  lane.current = poolNext[lane.current];
+}
+
+void VarPoller::requestNext(VarPollLane& lane, uint32_t nowMs) {
+  while (lane.current != VAR_POOL_END) {
+    int32_t varHash = poolHashes[lane.current];
+#if VAR_SNIFF_ENABLED || DBC_DECODER_ENABLED
+    uint8_t entry[VAR_RESPONSE_SIZE];
+    if (varCache.copyFresh(lane.ecuId, varHash, nowMs, configStore.get().varSniffMaxAgeMs, entry)) {
+      storeEntry(lane, entry);
+      cachedCount++;
+      advance(lane);
+      continue;
+    }
+#endif
+    if (!lane.timeout.isBackedOff(varHash, nowMs)) break;
+    advance(lane);
+    skippedCount++;
+  }
+
+  if (lane.current != VAR_POOL_END) issue(lane, nowMs);
+}
+
+void VarPoller::issue(VarPollLane& lane, uint32_t nowMs) {
+  // 总线饱和时在请求之间插入退避间隔
+  if (!lane.deferred) {
+    uint32_t backoffMs = canBusStats.pollBackoffMs();
+    if (backoffMs > 0) {
+      lane.deferred = true;
+      lane.deferredUntil = nowMs + backoffMs;
+      return;
+    }
+  }
+
+  int32_t varHash = poolHashes[lane.current];
+  // 发送前取时间戳: 响应可能在requestVariable返回前就被驱动读出
+  const uint32_t sentMicros = micros();
+  if (!canManager.requestVariable(lane.ecuId, varHash)) {
+    // 请求类发送缓冲区满 (或发送被关闭): CAN任务下一次唤醒时重试，
+    // 从第一次尝试起计时，到超时仍发不出去时按超时跳过 (见 update())
+    if (!lane.sendFailed) {
+      lane.sendFailed = true;
+      lane.sentMs = nowMs;
+    }
+    lane.deferred = true;
+    lane.deferredUntil = nowMs;
+    return;
+  }
+
+  lane.deferred = false;
+  lane.sendFailed = false;
+  lane.inFlight = true;
+  lane.sentMs = nowMs;
+  lane.timeout.onRequestSent(varHash, sentMicros);
+}
+
+void VarPoller::update(uint32_t nowMs) {
+  if (!active) return;
+
+  for (VarPollLane& lane : lanes) {
+    if (lane.current == VAR_POOL_END) continue;
+
+    if (lane.deferred) {
+      if (lane.sendFailed && nowMs - lane.sentMs >= lane.timeout.timeoutMs()) {
+        // 请求没有发出，ECU没有失败: 不计入负缓存和超时估计
+        unsentCount++;
+        logMessage("Var Poller: ECU " + String(lane.ecuId) + " request not sent before timeout");
+        lane.deferred = false;
+        lane.sendFailed = false;
+        advance(lane);
+        requestNext(lane, nowMs);
+      } else if ((int32_t)(nowMs - lane.deferredUntil) >= 0) {
+        issue(lane, nowMs);
+      }
+      continue;
+    }
+
+    if (lane.inFlight && nowMs - lane.sentMs >= lane.timeout.timeoutMs()) {
+      if (lane.timeout.onTimeout(nowMs)) {
+        timeoutCount++;
+        int32_t varHash = poolHashes[lane.current];
+        const char* name = VarCatalog::name(varHash);
+        logMessage("Var Poller: ECU " + String(lane.ecuId) + " request timeout for " +
+                   String(name != nullptr ? name : "hash " + String(varHash)));
+      }
+
+      lane.inFlight = false;
+      advance(lane);
+      requestNext(lane, nowMs);
+    }
+  }
+}
+
+// ============================================================================
+// 响应
+// ============================================================================
+
+bool VarPoller::onResponse(uint8_t ecuId, const uint8_t* data, uint8_t len, uint32_t rxMicros) {
+  VarPollLane* lane = laneFor(ecuId);
+  if (lane == nullptr || len < VAR_RESPONSE_SIZE) return false;
+
+  int32_t varHash = readInt32BigEndian(data);
+  lane->timeout.onResponse(varHash, rxMicros);
+
+  // 只接受当前在途的请求; 迟到的响应已按超时处理
+  if (!active || !lane->inFlight || poolHashes[lane->current] != varHash) return false;
+
+  storeEntry(*lane, data);
+  lane->inFlight = false;
+  advance(*lane);
+  requestNext(*lane, millis());
+  return true;
+}
+
+void VarPoller::storeEntry(VarPollLane& lane, const uint8_t* entry) {
+  // 哈希已与请求比对，整个条目按原字节保存
+  memcpy(poolEntries[lane.current], entry, VAR_RESPONSE_SIZE);
+  poolAnswered[lane.current] = true;
+}
+
+uint16_t VarPoller::buildResponse(const uint8_t* selection, uint8_t* out, uint16_t maxEntries) const {
+  uint16_t count = 0;
+  uint8_t ecuId = configStore.get().ecuId;  // 上一个值的ECU
+
+  // 按通道输出，同一ECU的值连续排列，每个ECU最多一个标记
+  for (const VarPollLane& lane : lanes) {
+    for (uint8_t i = lane.head; i != VAR_POOL_END; i = poolNext[i]) {
+      if (!poolAnswered[i]) continue;
+      if (selection != nullptr && !(selection[i / 8] & (1 << (i % 8)))) continue;
+
+      const uint8_t needed = lane.ecuId != ecuId ? 2 : 1;
+      if (count + needed > maxEntries) return count;
+
+      if (lane.ecuId != ecuId) {
+        ecuId = lane.ecuId;
+        uint8_t* marker = out + count * VAR_RESPONSE_SIZE;
+        writeInt32BigEndian(varEcuMarker(ecuId), marker);
+        memset(marker + 4, 0, VAR_RESPONSE_SIZE - 4);
+        count++;
+      }
+
+      memcpy(out + count * VAR_RESPONSE_SIZE, poolEntries[i], VAR_RESPONSE_SIZE);
+      count++;
+    }
+  }
+
+  return count;
+}
+
+// ============================================================================
+// 诊断输出
+// ============================================================================
+
+void VarPoller::dumpTimeouts(Print& out) const {
+  for (const VarPollLane& lane : lanes) {
+    out.printf("ECU %u: ", lane.ecuId);
+    lane.timeout.dump(out);
+  }
+}
+
+size_t VarPoller::encodeTimeouts(uint8_t part, uint8_t* out, size_t maxLen) const {
+  if (part >= VAR_ECU_COUNT) return 0;
+  return lanes[part].timeout.encode(lanes[part].ecuId, out, maxLen);
+}
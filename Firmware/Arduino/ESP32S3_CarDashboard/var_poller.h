@@ -0,0 +1,116 @@
+#ifndef VAR_POLLER_H
+#define VAR_POLLER_H
+
+#include "project_config.h"
+#include "request_timeout.h"
+
+// ============================================================================
+// 多ECU变量轮询
+// ============================================================================
+// 一批请求按ECU拆分到各自的通道。每个通道同时只有一个请求在途，有自己的
+// 自适应超时和负缓存，各通道并行轮询，总吞吐随ECU数量增加。
+// 所有通道共享一个静态请求池 (MAX_BATCH_VARS)，每个通道是池中的一条链表，
+// 一批可以全部给一个ECU，也可以任意分配给多个ECU。重复的 (ECU, 哈希) 合并为一项。
+// 响应按CAN ID (0x720 + ecuId) 路由回通道，值按池下标保存，批次完成后
+// 按池顺序为每个请求方生成各自的响应。ECU响应的8个数据字节与VarData条目
+// 格式相同，整体复制，不做浮点转换。
+// 嗅探缓存 (VarCache) 中足够新的变量不发请求，直接合并缓存值。
+
+inline bool isVarEcuMarker(int32_t varHash) {
+  return ((uint32_t)varHash & 0xFFFFFF00UL) == VAR_ECU_MARKER;
+}
+
+inline int32_t varEcuMarker(uint8_t ecuId) {
+  return (int32_t)(VAR_ECU_MARKER | ecuId);
+}
+
+inline bool isVarOption(int32_t varHash) {
+  return ((uint32_t)varHash & 0xFFFFFF00UL) == VAR_OPTION_MARKER;
+}
+
+static_assert(MAX_BATCH_VARS < 255, "pool indices are uint8_t");
+static const uint8_t VAR_POOL_END = 0xFF;
+
+struct VarPollLane {
+  uint8_t ecuId;
+  uint8_t head;     // 池中第一个/最后一个条目，VAR_POOL_END = 空
+  uint8_t tail;
+  uint8_t current;  // 在途或下一个请求，VAR_POOL_END = 已完成
+  bool inFlight;
+  bool deferred;  // 总线饱和或发送缓冲区满，延后发送
+  bool sendFailed;  // 发送缓冲区满后重试中，sentMs为第一次尝试的时间
+  uint32_t sentMs;
+  uint32_t deferredUntil;
+  RequestTimeout timeout;
+};
+
+class VarPoller {
+public:
+  VarPoller();
+  // 配置读入后调用: 按运行时配置的主ECU设置通道
+  void begin();
+
+  // 开始新的一批: clear() -> add()... -> start()
+  void clear();
+  // 返回池下标，已在池中的 (ECU, 哈希) 返回原下标; 未配置的ECU或池已满返回-1
+  int16_t add(uint8_t ecuId, int32_t varHash);
+  void start(uint32_t batchStartMicros);
+
+  // CAN任务: 延后的请求和超时
+  void update(uint32_t nowMs);
+
+  // CanManager: 收到 0x720 + ecuId 的响应 (rxMicros = 驱动读出帧的时刻)，
+  // 不是本机在途请求的响应时返回false
+  bool onResponse(uint8_t ecuId, const uint8_t* data, uint8_t len, uint32_t rxMicros);
+
+  bool isActive() const { return active; }
+  bool isComplete() const { return active && lanesDone(); }
+  bool hasEcu(uint8_t ecuId) const { return laneFor(ecuId) != nullptr; }
+  uint8_t size() const { return poolCount; }
+
+  // isComplete()后生成响应条目: selection为池下标位图 (nullptr = 全部)，
+  // 只包含得到值的项，按ECU分组、组内按请求顺序，ECU变化处插入标记，
+  // 返回条目数。全部发送后调用finish()
+  uint16_t buildResponse(const uint8_t* selection, uint8_t* out, uint16_t maxEntries) const;
+  uint32_t batchStart() const { return batchStartMicros; }
+  void finish();
+
+  uint32_t getTimeoutCount() const { return timeoutCount; }
+  uint32_t getSkippedCount() const { return skippedCount; }
+  uint32_t getCachedCount() const { return cachedCount; }
+  uint32_t getUnsentCount() const { return unsentCount; }
+
+  // 诊断: 每个ECU的超时估计和负缓存
+  void dumpTimeouts(Print& out) const;
+  size_t encodeTimeouts(uint8_t part, uint8_t* out, size_t maxLen) const;
+
+private:
+  VarPollLane lanes[VAR_ECU_COUNT];
+
+  int32_t poolHashes[MAX_BATCH_VARS];
+  VarPollLane* poolLane[MAX_BATCH_VARS];
+  uint8_t poolNext[MAX_BATCH_VARS];       // 同一通道的下一个条目
+  uint8_t poolEntries[MAX_BATCH_VARS][VAR_RESPONSE_SIZE];  // 预编码的响应条目 [哈希][值]，大端
+  bool poolAnswered[MAX_BATCH_VARS];
+  uint8_t poolCount = 0;
+
+  uint32_t batchStartMicros = 0;
+  bool active = false;
+
+  uint32_t timeoutCount = 0;
+  uint32_t skippedCount = 0;
+  uint32_t cachedCount = 0;  // 由嗅探缓存返回的值
+  uint32_t unsentCount = 0;  // 超时前一直没能装入发送缓冲区的请求
+
+  VarPollLane* laneFor(uint8_t ecuId);
+  const VarPollLane* laneFor(uint8_t ecuId) const;
+  bool lanesDone() const;
+  void advance(VarPollLane& lane);
+  void requestNext(VarPollLane& lane, uint32_t nowMs);
+  void issue(VarPollLane& lane, uint32_t nowMs);
+  void storeEntry(VarPollLane& lane, const uint8_t* entry);
+};
+
+extern VarPoller varPoller;
+
+#endif  // VAR_POLLER_H
@@ -0,0 +1,108 @@
+#include "var_set_pipeline.h"
+#include "can_manager.h"
+#include "config_store.h"
+
+// 全局变量设置管线实例
+VarSetPipeline varSetPipeline;
+
+bool VarSetPipeline::post(int32_t varHash, float value) {
+  bool ok = true;
+
+  portENTER_CRITICAL(&slotMux);
+  VarSetSlot* slot = nullptr;
+  VarSetSlot* spare = nullptr;
+  for (uint8_t i = 0; i < VAR_SET_SLOTS; i++) {
+    if (slots[i].used && slots[i].varHash == varHash) {
+      slot = &slots[i];
+      break;
+    }
+    // 空槽位优先，其次复用已发送的槽位
+    if (!slots[i].used) {
+      if (spare == nullptr || spare->used) spare = &slots[i];
+    } else if (!slots[i].pending && spare == nullptr) {
+      spare = &slots[i];
+    }
+  }
+
+  if (slot != nullptr) {
+    if (slot->pending) coalescedCount++;
+  } else if (spare != nullptr) {
+    slot = spare;
+    slot->varHash = varHash;
+    slot->used = true;
+  }
+
+  if (slot != nullptr) {
+    slot->value = value;
+    slot->pending = true;
+  } else {
+    dropCount++;
+    ok = false;
+  }
+  portEXIT_CRITICAL(&slotMux);
+
+  return ok;
+}
+
+bool VarSetPipeline::takeNext(int32_t& varHash, float& value, uint8_t& index) {
+  bool found = false;
+
+  portENTER_CRITICAL(&slotMux);
+  for (uint8_t n = 0; n < VAR_SET_SLOTS; n++) {
+    uint8_t i = (cursor + n) % VAR_SET_SLOTS;
+    if (slots[i].pending) {
+      varHash = slots[i].varHash;
+      value = slots[i].value;
+      slots[i].pending = false;
+      index = i;
+      cursor = (i + 1) % VAR_SET_SLOTS;
+      found = true;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&slotMux);
+
+  return found;
+}
+
+void VarSetPipeline::process() {
+  // 波特率检测完成前只合并，不发送
+  if (!canManager.isTransmitEnabled()) return;
+
+  // 预算可在运行时修改，每次按当前值计算
+  const uint32_t frameCostUs = 1000000UL / configStore.get().varSetTxRate;
+  uint32_t now = micros();
+  creditUs += now - lastRefillUs;
+  lastRefillUs = now;
+  if (creditUs > frameCostUs * VAR_SET_TX_BURST) creditUs = frameCostUs * VAR_SET_TX_BURST;
+
+  int32_t varHash;
+  float value;
+  uint8_t index;
+  while (creditUs >= frameCostUs && takeNext(varHash, value, index)) {
+    if (!canManager.sendVariableToEcu(varHash, value)) {
+      // 发送缓冲区满: 没有更新的值时恢复待发送，下一轮再试
+      portENTER_CRITICAL(&slotMux);
+      if (slots[index].used && slots[index].varHash == varHash && !slots[index].pending) {
+        slots[index].pending = true;
+      }
+      portEXIT_CRITICAL(&slotMux);
+      return;
+    }
+    creditUs -= frameCostUs;
+    sentCount++;
+  }
+}
+
+void VarSetPipeline::dump(Print& out) const {
+  uint8_t used = 0;
+  uint8_t pending = 0;
+  for (uint8_t i = 0; i < VAR_SET_SLOTS; i++) {
+    if (slots[i].used) used++;
+    if (slots[i].pending) pending++;
+  }
+  out.printf("var set: slots=%u/%u pending=%u sent=%lu coalesced=%lu dropped=%lu budget=%lu/s\n",
+             used, VAR_SET_SLOTS, pending, (unsigned long)sentCount,
+             (unsigned long)coalescedCount, (unsigned long)dropCount,
+             (unsigned long)configStore.get().varSetTxRate);
+}
@@ -0,0 +1,51 @@
+#ifndef VAR_SET_PIPELINE_H
+#define VAR_SET_PIPELINE_H
+
+#include "project_config.h"
+
+// ============================================================================
+// 变量设置 (GPS / 虚拟ADC) -> CAN
+// ============================================================================
+// BLE回调只写槽位表: 每个哈希一个槽位，未发送的旧值被新值覆盖 (last-write-wins)。
+// 主循环按令牌桶 (VAR_SET_TX_RATE 帧/秒，深度 VAR_SET_TX_BURST) 轮流发送
+// 待发送的槽位，滑块连续拖动时总线上每个哈希最多只有一帧在排队。
+
+struct VarSetSlot {
+  int32_t varHash;
+  float value;
+  bool used;
+  bool pending;
+};
+
+class VarSetPipeline {
+public:
+  // BLE任务: 写入一个值，槽位表满且全部待发送时返回false
+  bool post(int32_t varHash, float value);
+
+  // 主循环: 在预算内发送待发送的槽位
+  void process();
+
+  uint32_t getSentCount() const { return sentCount; }
+  uint32_t getCoalescedCount() const { return coalescedCount; }
+  uint32_t getDropCount() const { return dropCount; }
+
+  void dump(Print& out) const;
+
+private:
+  VarSetSlot slots[VAR_SET_SLOTS] = {};
+  uint8_t cursor = 0;  // 轮询起点，保证各哈希轮流发送
+  portMUX_TYPE slotMux = portMUX_INITIALIZER_UNLOCKED;
+
+  uint32_t creditUs = 0;  // 令牌桶，以微秒计: 每帧花费 1e6 / VAR_SET_TX_RATE
+  uint32_t lastRefillUs = 0;
+
+  uint32_t sentCount = 0;
+  uint32_t coalescedCount = 0;  // 被覆盖而未发送的值
+  uint32_t dropCount = 0;
+
+  bool takeNext(int32_t& varHash, float& value, uint8_t& index);
+};
+
+extern VarSetPipeline varSetPipeline;
+
+#endif  // VAR_SET_PIPELINE_H
@@ -44,15 +44,26 @@ ACAN2515 can(MCP2515_CS, SPI, MCP2515_INT);
 #define CAN_VAR_RESPONSE_BASE 0x720
 #define CAN_GPS_DATA_BASE 0x780
 
+// ECU变量名哈希: 名称转小写后的djb2，编译期求值
+constexpr uint32_t varHashStep(const char* name, uint32_t hash) {
+  return *name == '\0'
+           ? hash
+           : varHashStep(name + 1, hash * 33 + (uint8_t)(*name >= 'A' && *name <= 'Z' ? *name + ('a' - 'A') : *name));
+}
+
+constexpr int32_t varHash(const char* name) {
+  return (int32_t)varHashStep(name, 5381);
+}
+
 // GPS变量哈希定义
-const int32_t VAR_HASH_GPS_HMSD_PACKED = 703958849;
-const int32_t VAR_HASH_GPS_MYQSAT_PACKED = -1519914092;
-const int32_t VAR_HASH_GPS_ACCURACY = -1489698215;
-const int32_t VAR_HASH_GPS_ALTITUDE = -2100224086;
-const int32_t VAR_HASH_GPS_COURSE = 1842893663;
-const int32_t VAR_HASH_GPS_LATITUDE = 1524934922;
-const int32_t VAR_HASH_GPS_LONGITUDE = -809214087;
-const int32_t VAR_HASH_GPS_SPEED = -1486968225;
+constexpr int32_t VAR_HASH_GPS_HMSD_PACKED = varHash("gps_hmsd_packed");
+constexpr int32_t VAR_HASH_GPS_MYQSAT_PACKED = varHash("gps_myqsat_packed");
+constexpr int32_t VAR_HASH_GPS_ACCURACY = varHash("gps_accuracy");
+constexpr int32_t VAR_HASH_GPS_ALTITUDE = varHash("gps_altitude");
+constexpr int32_t VAR_HASH_GPS_COURSE = varHash("gps_course");
+constexpr int32_t VAR_HASH_GPS_LATITUDE = varHash("gps_latitude");
+constexpr int32_t VAR_HASH_GPS_LONGITUDE = varHash("gps_longitude");
+constexpr int32_t VAR_HASH_GPS_SPEED = varHash("gps_speed");
 
 // 虚拟ADC变量哈希
 const int32_t VAR_HASH_ADC[16] = {
@@ -76,7 +87,8 @@ const int32_t VAR_HASH_ADC[16] = {
 
 // Digital input variable hash (D22-D37 packed as 16-bit bitmask)
 // Currently only reading IO1 (touch sensor)
-const int32_t VAR_HASH_D22_D37 = 2138825443;  // TODO: Replace with actual hash from ECU
+// ADC和D22-D37的ECU端名称不在 variables.json 中，保留ECU给出的值
+const int32_t VAR_HASH_D22_D37 = 2138825443;
 
 
 // 数字输入配置